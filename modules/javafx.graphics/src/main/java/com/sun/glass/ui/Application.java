@@ -661,6 +661,13 @@ public abstract class Application {
 
     public Accessible createAccessible() { return null; }
 
+    /**
+     * Creates a hardware plane to show video on, if the platform has one.
+     *
+     * @return the overlay, or null if video has to be rendered by Prism
+     */
+    public VideoOverlay createVideoOverlay() { return null; }
+
     protected abstract FileChooserResult staticCommonDialogs_showFileChooser(Window owner, String folder, String filename, String title, int type,
                                                      boolean multipleMode, ExtensionFilter[] extensionFilters, int defaultFilterIndex);
 
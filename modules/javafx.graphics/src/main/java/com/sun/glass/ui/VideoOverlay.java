@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui;
+
+import java.nio.ByteBuffer;
+
+/**
+ * A hardware plane that shows video frames below the window content.
+ * The display controller scales the frames and blends the window over
+ * them, so the window has to be transparent where the video shows.
+ * <p>
+ * The methods may be called on the render thread.
+ */
+public abstract class VideoOverlay {
+
+    /** One plane of premultiplied BGRA pixels */
+    public static final int FORMAT_BGRA_PRE = 1;
+    /** Y, U and V planes, the chroma planes subsampled 2x2 */
+    public static final int FORMAT_I420 = 2;
+
+    protected VideoOverlay() {
+    }
+
+    /**
+     * @param format one of the FORMAT constants
+     * @return whether frames of the format can be shown
+     */
+    public abstract boolean supportsFormat(int format);
+
+    /**
+     * Shows a frame, replacing the previous one.
+     *
+     * @param format one of the FORMAT constants
+     * @param planes the direct buffers holding the planes of the frame
+     * @param strides the number of bytes per row of each plane
+     * @param width the width of the frame in pixels
+     * @param height the height of the frame in pixels
+     * @param srcX the left edge of the part of the frame to show
+     * @param srcY the top edge of the part of the frame to show
+     * @param srcWidth the width of the part of the frame to show
+     * @param srcHeight the height of the part of the frame to show
+     * @param dstX the left edge of the plane on the screen
+     * @param dstY the top edge of the plane on the screen
+     * @param dstWidth the width of the plane on the screen
+     * @param dstHeight the height of the plane on the screen
+     * @return false if the frame could not be shown
+     */
+    public abstract boolean show(int format, ByteBuffer[] planes, int[] strides,
+                                 int width, int height,
+                                 int srcX, int srcY, int srcWidth, int srcHeight,
+                                 int dstX, int dstY, int dstWidth, int dstHeight);
+
+    /**
+     * Removes the plane from the screen. The next call to show puts it back.
+     */
+    public abstract void hide();
+
+    /**
+     * Releases the plane. The overlay may not be used afterwards.
+     */
+    public abstract void dispose();
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -398,6 +398,10 @@ final class GtkApplication extends Application implements
     protected native int staticTimer_getMaxPeriod();
 
     @Override protected double staticScreen_getVideoRefreshPeriod() {
+        if (GtkTimer.isVsyncTimerEnabled()) {
+            // nominal, the actual pacing comes from the GDK frame clock
+            return 1000.0 / 60.0;
+        }
         return 0.0;     // indicate millisecond resolution
     }
 
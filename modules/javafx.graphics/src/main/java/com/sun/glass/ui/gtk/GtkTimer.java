@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,14 +28,34 @@ import com.sun.glass.ui.Timer;
 
 final class GtkTimer extends Timer{
 
+    /*
+     * The vsync timer runs the pulse from the GDK frame clock of a visible
+     * window, see GlassTimer.cpp.  It can be turned off with
+     * -Dglass.gtk.vsyncTimer=false to get the fixed period timer back.
+     */
+    private static final boolean vsyncTimer =
+            Boolean.parseBoolean(System.getProperty("glass.gtk.vsyncTimer", "true")) &&
+            _isVsyncSupported();
+
     public GtkTimer(Runnable runnable) {
         super(runnable);
     }
 
+    static boolean isVsyncTimerEnabled() {
+        return vsyncTimer;
+    }
+
+    private static native boolean _isVsyncSupported();
+
     @Override protected long _start(Runnable runnable) {
-        throw new RuntimeException("vsync timer not supported");
+        if (!vsyncTimer) {
+            throw new RuntimeException("vsync timer not supported");
+        }
+        return _startVsync(runnable);
     }
 
+    private native long _startVsync(Runnable runnable);
+
     @Override
     protected native long _start(Runnable runnable, int period);
 
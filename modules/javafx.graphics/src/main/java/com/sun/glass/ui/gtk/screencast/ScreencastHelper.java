@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,7 +51,14 @@ public class ScreencastHelper {
     private static final int DENIED = -11;
     private static final int OUT_OF_BOUNDS = -12;
 
-    private static final int DELAY_BEFORE_SESSION_CLOSE = 2000;
+    /*
+     * The screencast session and its streams are kept open between captures
+     * and closed once no capture was requested for this many milliseconds.
+     * Tools taking many screenshots can keep it open for longer with
+     * -Djavafx.robot.screenshotSessionTimeout, to avoid setting up the
+     * session and the streams again.
+     */
+    private static final int DELAY_BEFORE_SESSION_CLOSE;
 
     private static volatile TimerTask timerTask = null;
     private static final Timer timerCloseSession
@@ -70,6 +77,9 @@ public class ScreencastHelper {
                 }).get();
         SCREENCAST_DEBUG = isDebugEnabled;
 
+        int delay = Integer.getInteger("javafx.robot.screenshotSessionTimeout", 2000);
+        DELAY_BEFORE_SESSION_CLOSE = delay > 0 ? delay : 2000;
+
         IS_NATIVE_LOADED = loadPipewire(SCREENCAST_DEBUG);
     }
 
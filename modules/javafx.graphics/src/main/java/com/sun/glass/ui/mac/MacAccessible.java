@@ -27,7 +27,10 @@ package com.sun.glass.ui.mac;
 
 import java.util.ArrayList;
 import java.util.Arrays;
+import java.util.EnumSet;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.function.Function;
 import javafx.collections.FXCollections;
 import javafx.collections.ObservableList;
@@ -653,6 +656,9 @@ final class MacAccessible extends Accessible {
     /* Notify accessible peer about hierarchy change to invalidate parent */
     private native void _invalidateParent(long accessible);
 
+    /* Notify accessible peer about a change to drop its cached attribute and action names */
+    private native void _invalidateCache(long accessible);
+
     private static native String getString(long nsString);
     private static native boolean isEqualToString(long nsString1, long nsString);
     private static native long NSAccessibilityUnignoredAncestor(long id);
@@ -681,14 +687,49 @@ final class MacAccessible extends Accessible {
             _destroyAccessiblePeer(peer);
             peer = 0L;
         }
+        pendingNotifications.remove(this);
         super.dispose();
     }
 
+    /* Notifications waiting to be posted, in the order they were first posted */
+    private static final Map<MacAccessible, EnumSet<MacNotification>> pendingNotifications = new LinkedHashMap<>();
+
+    /*
+     * Virtualized controls send bursts of changes while updating their cells,
+     * and VoiceOver queries the element again for every notification it gets.
+     * Repeated notifications for the same element are posted once, on the next
+     * pass of the event loop.
+     */
+    private void postNotification(MacNotification notification) {
+        if (pendingNotifications.isEmpty()) {
+            Application.invokeLater(MacAccessible::flushNotifications);
+        }
+        pendingNotifications.computeIfAbsent(this, k -> EnumSet.noneOf(MacNotification.class)).add(notification);
+    }
+
+    private static void flushNotifications() {
+        List<Map.Entry<MacAccessible, EnumSet<MacNotification>>> pending = new ArrayList<>(pendingNotifications.entrySet());
+        pendingNotifications.clear();
+        for (Map.Entry<MacAccessible, EnumSet<MacNotification>> entry : pending) {
+            MacAccessible acc = entry.getKey();
+            if (acc.isDisposed()) continue;
+            View view = acc.getView();
+            long id = view != null ? view.getNativeView() : acc.getNativeAccessible();
+            for (MacNotification notification : entry.getValue()) {
+                NSAccessibilityPostNotification(id, notification.ptr);
+            }
+        }
+    }
+
     @Override
     public void sendNotification(AccessibleAttribute notification) {
         Application.checkEventThread();
         if (isDisposed()) return;
 
+        if (peer != 0L) {
+            _invalidateCache(peer);
+        }
+
         MacNotification macNotification = null;
         switch (notification) {
             case FOCUS_ITEM: {
@@ -765,7 +806,7 @@ final class MacAccessible extends Accessible {
                                                                                 AccessibleRole.TREE_VIEW : AccessibleRole.TREE_TABLE_VIEW;
                     MacAccessible container = (MacAccessible)getContainerAccessible(containerRole);
                     if (container != null) {
-                        NSAccessibilityPostNotification(container.getNativeAccessible(), MacNotification.NSAccessibilityRowCountChangedNotification.ptr);
+                        container.postNotification(MacNotification.NSAccessibilityRowCountChangedNotification);
                     }
                 }
                 break;
@@ -819,9 +860,7 @@ final class MacAccessible extends Accessible {
                 macNotification = MacNotification.NSAccessibilityValueChangedNotification;
         }
         if (macNotification != null) {
-            View view = getView();
-            long id = view != null ? view.getNativeView() : getNativeAccessible();
-            NSAccessibilityPostNotification(id, macNotification.ptr);
+            postNotification(macNotification);
         }
     }
 
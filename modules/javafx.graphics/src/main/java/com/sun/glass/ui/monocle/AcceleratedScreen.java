@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@ public class AcceleratedScreen {
     protected static final LinuxSystem ls = LinuxSystem.getLinuxSystem();
     private EGL egl;
     long eglConfigs[] = {0};
+    private int swapWithDamage = 0; // 0 unknown, 1 supported, -1 not supported
 
     /** Returns a platform-specific native display handle suitable for use with
      * eglGetDisplay.
@@ -200,4 +201,30 @@ public class AcceleratedScreen {
 
     }
 
+    /** Copy the contents of the GL backbuffer to the screen, hinting that
+     * only the given rectangle has changed since the previous swap. The
+     * rectangle is in surface coordinates with the origin at the bottom left.
+     *
+     * @return success or failure
+     */
+    public boolean swapBuffers(int x, int y, int width, int height) {
+        if (egl == null || !MonocleWindowManager.getInstance().hasSingleWindow()) {
+            return swapBuffers();
+        }
+        if (swapWithDamage == 0) {
+            swapWithDamage = egl.eglHasSwapBuffersWithDamage(eglDisplay) ? 1 : -1;
+        }
+        if (swapWithDamage < 0) {
+            return swapBuffers();
+        }
+        synchronized(NativeScreen.framebufferSwapLock) {
+            if (egl.eglSwapBuffersWithDamage(eglDisplay, eglSurface,
+                                             x, y, width, height)) {
+                return true;
+            }
+        }
+        // Let swapBuffers() recreate an invalid surface
+        return swapBuffers();
+    }
+
 }
@@ -25,6 +25,8 @@
 
 package com.sun.glass.ui.monocle;
 
+import com.sun.glass.ui.VideoOverlay;
+
 class DispmanPlatform extends LinuxPlatform {
 
     @Override
@@ -33,6 +35,12 @@ class DispmanPlatform extends LinuxPlatform {
         return logSelectedCursor(c);
     }
 
+    @Override
+    protected VideoOverlay createVideoOverlay() {
+        final DispmanVideoOverlay overlay = new DispmanVideoOverlay();
+        return overlay.isValid() ? overlay : null;
+    }
+
     @Override
     protected NativeScreen createScreen() {
         return new DispmanScreen();
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.glass.ui.monocle;
+
+import com.sun.glass.ui.VideoOverlay;
+import java.nio.ByteBuffer;
+
+/** Video overlay on a dispman element placed right below the window layer.
+ * The window layer is blended using the alpha of its pixels, so the video
+ * shows wherever the window is cleared to transparent.
+ */
+class DispmanVideoOverlay extends VideoOverlay {
+
+    private long nativeOverlay;
+
+    private native long _create(int displayID, int layerID);
+    private native boolean _show(long nativeOverlay, boolean planar,
+                                 ByteBuffer plane0, int stride0,
+                                 ByteBuffer plane1, int stride1,
+                                 ByteBuffer plane2, int stride2,
+                                 int width, int height,
+                                 int srcX, int srcY, int srcWidth, int srcHeight,
+                                 int dstX, int dstY, int dstWidth, int dstHeight);
+    private native void _hide(long nativeOverlay);
+    private native void _dispose(long nativeOverlay);
+
+    DispmanVideoOverlay() {
+        int displayID = Integer.getInteger("dispman.display", 0 /* LCD */);
+        int layerID = Integer.getInteger("dispman.layer", 1) - 1;
+        nativeOverlay = _create(displayID, layerID);
+    }
+
+    boolean isValid() {
+        return nativeOverlay != 0L;
+    }
+
+    @Override
+    public boolean supportsFormat(int format) {
+        return format == FORMAT_BGRA_PRE || format == FORMAT_I420;
+    }
+
+    @Override
+    public synchronized boolean show(int format, ByteBuffer[] planes, int[] strides,
+                                     int width, int height,
+                                     int srcX, int srcY, int srcWidth, int srcHeight,
+                                     int dstX, int dstY, int dstWidth, int dstHeight) {
+        if (nativeOverlay == 0L || !supportsFormat(format)) {
+            return false;
+        }
+        boolean planar = format == FORMAT_I420;
+        if (planes.length < (planar ? 3 : 1)) {
+            return false;
+        }
+        return _show(nativeOverlay, planar,
+                     planes[0], strides[0],
+                     planar ? planes[1] : null, planar ? strides[1] : 0,
+                     planar ? planes[2] : null, planar ? strides[2] : 0,
+                     width, height,
+                     srcX, srcY, srcWidth, srcHeight,
+                     dstX, dstY, dstWidth, dstHeight);
+    }
+
+    @Override
+    public synchronized void hide() {
+        if (nativeOverlay != 0L) {
+            _hide(nativeOverlay);
+        }
+    }
+
+    @Override
+    public synchronized void dispose() {
+        if (nativeOverlay != 0L) {
+            _dispose(nativeOverlay);
+            nativeOverlay = 0L;
+        }
+    }
+}
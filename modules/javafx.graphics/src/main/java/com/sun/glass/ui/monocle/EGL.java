@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -223,6 +223,20 @@ class EGL {
 
     native boolean eglSwapBuffers(long eglDisplay, long eglSurface);
 
+    /** Looks up EGL_KHR_swap_buffers_with_damage or its EXT variant. Must be
+     * called once before eglSwapBuffersWithDamage.
+     *
+     * @return true if swapping with damage is supported
+     */
+    native boolean eglHasSwapBuffersWithDamage(long eglDisplay);
+
+    /** Swaps the buffers, hinting that only the given rectangle changed.
+     * The rectangle is in surface coordinates with the origin at the
+     * bottom left. Falls back to eglSwapBuffers if the extension is missing.
+     */
+    native boolean eglSwapBuffersWithDamage(long eglDisplay, long eglSurface,
+                                            int x, int y, int width, int height);
+
     /** Convert an EGL error code such as EGL_BAD_CONTEXT to a string
      * representation.
      * @param errorCode the EGL error code
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -550,17 +550,21 @@ class EPDFrameBuffer {
     }
 
     /**
-     * Sends the updated contents of the Linux frame buffer to the EPDC driver,
+     * Sends the updated rows of the Linux frame buffer to the EPDC driver,
      * optionally synchronizing with the driver by first waiting for the
      * previous update to complete.
      * <p>
      * <strong>This method is not thread safe</strong>, but it is invoked only
      * from the JavaFX Application Thread.</p>
+     *
+     * @param y the first row of the update region
+     * @param height the number of rows in the update region
      */
-    void sync() {
+    void sync(int y, int height) {
         if (!settings.noWait) {
             waitForUpdateComplete(lastMarker);
         }
+        syncUpdate.setUpdateRegion(syncUpdate.p, y, 0, xres, height);
         lastMarker = sendUpdate(syncUpdate, settings.waveformMode);
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,10 @@ import java.text.MessageFormat;
  * is configured with a color depth of 32 bits per pixel. Otherwise, this class
  * uploads pixels into a 32-bit off-screen composition buffer and converts the
  * pixels to the correct format when writing them to the Linux frame buffer.
+ * <p>
+ * Only the band of rows that changed since the previous frame is sent to the
+ * display, and a frame without changes is not sent at all. A partial update
+ * is both faster and shows less flashing than an update of the full panel.
  */
 class EPDScreen implements NativeScreen {
 
@@ -82,6 +86,15 @@ class EPDScreen implements NativeScreen {
 
     private boolean isShutdown;
 
+    /**
+     * A copy of the composition buffer as last sent to the display, used to
+     * find the rows that changed in the next frame.
+     */
+    private final ByteBuffer lastFrame;
+    private final int rowBytes;
+    private int changedY;
+    private int changedHeight;
+
     /**
      * Creates a native screen for the electrophoretic display.
      *
@@ -138,6 +151,10 @@ class EPDScreen implements NativeScreen {
         buffer.order(ByteOrder.nativeOrder());
         pixels = new FramebufferY8(buffer, width, height, bitDepth, true);
         clearScreen();
+
+        // The cleared screen is all zeros, the same as a new heap buffer
+        rowBytes = width * Integer.BYTES;
+        lastFrame = ByteBuffer.allocate(rowBytes * height);
     }
 
     /**
@@ -175,6 +192,34 @@ class EPDScreen implements NativeScreen {
         }
     }
 
+    /**
+     * Finds the band of rows in the composition buffer that differ from the
+     * last frame sent to the display and copies them into the last frame.
+     *
+     * @return {@code true} if any row changed, with the band in
+     * {@link #changedY} and {@link #changedHeight}; otherwise {@code false}
+     */
+    private boolean findChangedRows() {
+        ByteBuffer frame = pixels.getBuffer();
+        int size = lastFrame.capacity();
+        int first = frame.slice(0, size).mismatch(lastFrame);
+        if (first == -1) {
+            return false;
+        }
+        int top = first / rowBytes;
+        int bottom = height - 1;
+        while (bottom > top && frame.slice(bottom * rowBytes, rowBytes)
+                .mismatch(lastFrame.slice(bottom * rowBytes, rowBytes)) == -1) {
+            bottom--;
+        }
+        int offset = top * rowBytes;
+        int length = (bottom + 1) * rowBytes - offset;
+        lastFrame.put(offset, frame, offset, length);
+        changedY = top;
+        changedHeight = bottom + 1 - top;
+        return true;
+    }
+
     /**
      * Clears the screen.
      */
@@ -235,8 +280,10 @@ class EPDScreen implements NativeScreen {
     @Override
     public synchronized void swapBuffers() {
         if (!isShutdown && pixels.hasReceivedData()) {
-            writeBuffer();
-            fbDevice.sync();
+            if (findChangedRows()) {
+                writeBuffer();
+                fbDevice.sync(changedY, changedHeight);
+            }
             pixels.reset();
         }
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -91,16 +91,20 @@ class LinuxEventBuffer {
      * Adds a raw Linux event to the buffer. Blocks if the buffer is full.
      * Checks whether this is a SYN SYN_REPORT event terminator.
      *
-     * @param event A ByteBuffer containing the event to be added.
+     * @param event A ByteBuffer containing the event to be added at its
+     *              position. The position is advanced past the event, so that
+     *              a buffer holding several events can be passed repeatedly.
      * @return true if the event was "SYN SYN_REPORT", false otherwise
      * @throws InterruptedException if our thread was interrupted while waiting
      *                              for the buffer to empty.
      */
     synchronized boolean put(ByteBuffer event) throws
             InterruptedException {
-        boolean isSync = event.getShort(eventStruct.getTypeIndex()) == 0
-                && event.getInt(eventStruct.getValueIndex()) == 0;
-        while (bb.limit() - bb.position() < event.limit()) {
+        int start = event.position();
+        int size = eventStruct.getSize();
+        boolean isSync = event.getShort(start + eventStruct.getTypeIndex()) == 0
+                && event.getInt(start + eventStruct.getValueIndex()) == 0;
+        while (bb.limit() - bb.position() < size) {
             // Block if bb is full. This should be the
             // only time this thread waits for anything
             // except for more event lines.
@@ -115,7 +119,10 @@ class LinuxEventBuffer {
         if (isSync) {
             positionOfLastSync = bb.position();
         }
+        int limit = event.limit();
+        event.limit(start + size);
         bb.put(event);
+        event.limit(limit);
         if (MonocleSettings.settings.traceEventsVerbose) {
             int index = bb.position() - eventStruct.getSize();
             MonocleTrace.traceEvent("Read %s [index=%d]",
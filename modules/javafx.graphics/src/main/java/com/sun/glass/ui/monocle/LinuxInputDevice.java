@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,9 +47,15 @@ import java.util.Map;
  * hasNextEvent() are used to iterate over pending events.
  * <p>
  * To save on RAM and GC, event lines are not objects.
+ * <p>
+ * Event lines are read from the device in batches of up to READ_EVENTS,
+ * since touch panels can report several hundred events per second and a
+ * read per event line would cost a system call and a JNI call each.
  */
 class LinuxInputDevice implements Runnable, InputDevice {
 
+    private static final int READ_EVENTS = 64;
+
     private LinuxInputProcessor inputProcessor;
     private ReadableByteChannel in;
     private long fd = -1;
@@ -78,7 +84,7 @@ class LinuxInputDevice implements Runnable, InputDevice {
             File sysPath,
             Map<String, String> udevManifest) throws IOException {
         this.buffer = new LinuxEventBuffer(LinuxArch.getBits());
-        this.event = ByteBuffer.allocateDirect(buffer.getEventSize());
+        this.event = ByteBuffer.allocateDirect(buffer.getEventSize() * READ_EVENTS);
         this.devNode = devNode;
         this.sysPath = sysPath;
         this.udevManifest = udevManifest;
@@ -112,7 +118,7 @@ class LinuxInputDevice implements Runnable, InputDevice {
             Map<String, String> udevManifest,
             Map<String, String> uevent) {
         this.buffer = new LinuxEventBuffer(32);
-        this.event = ByteBuffer.allocateDirect(buffer.getEventSize());
+        this.event = ByteBuffer.allocateDirect(buffer.getEventSize() * READ_EVENTS);
         this.capabilities = capabilities;
         this.absCaps = absCaps;
         this.in = in;
@@ -149,15 +155,19 @@ class LinuxInputDevice implements Runnable, InputDevice {
         while (true) {
             try {
                 readToEventBuffer();
-                if (event.position() == event.limit()) {
+                int eventSize = buffer.getEventSize();
+                if (event.position() >= eventSize) {
                     event.flip();
                     synchronized (buffer) {
-                        if (buffer.put(event) && !processor.scheduled) {
-                            runnableProcessor.invokeLater(processor);
-                            processor.scheduled = true;
+                        while (event.remaining() >= eventSize) {
+                            if (buffer.put(event) && !processor.scheduled) {
+                                runnableProcessor.invokeLater(processor);
+                                processor.scheduled = true;
+                            }
                         }
                     }
-                    event.rewind();
+                    // keep a partially read event line for the next read
+                    event.compact();
                 }
             } catch (IOException | InterruptedException e) {
                 // the device is disconnected
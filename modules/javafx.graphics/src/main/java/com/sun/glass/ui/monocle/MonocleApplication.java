@@ -33,6 +33,7 @@ import com.sun.glass.ui.Pixels;
 import com.sun.glass.ui.Screen;
 import com.sun.glass.ui.Size;
 import com.sun.glass.ui.Timer;
+import com.sun.glass.ui.VideoOverlay;
 import com.sun.glass.ui.View;
 import com.sun.glass.ui.Window;
 import javafx.collections.SetChangeListener;
@@ -207,6 +208,11 @@ public final class MonocleApplication extends Application {
         return new MonocleRobot();
     }
 
+    @Override
+    public VideoOverlay createVideoOverlay() {
+        return platform.createVideoOverlay();
+    }
+
     @Override
     protected double staticScreen_getVideoRefreshPeriod() {
         return 0.0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -164,6 +164,14 @@ final class MonocleWindowManager {
         return focusedWindow;
     }
 
+    /** Whether a single window is shown. Several windows are composed into
+     * one framebuffer, so a damage hint from repainting one of them would
+     * not cover the others.
+     */
+    boolean hasSingleWindow() {
+        return windows.length == 1;
+    }
+
     void repaintAll() {
         for (int i = 0; i < windows.length; i++) {
             MonocleView view = (MonocleView) windows[i].getView();
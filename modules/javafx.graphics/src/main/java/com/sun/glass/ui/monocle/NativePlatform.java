@@ -25,6 +25,7 @@
 
 package com.sun.glass.ui.monocle;
 
+import com.sun.glass.ui.VideoOverlay;
 import java.util.ArrayList;
 import java.util.List;
 import java.util.function.Supplier;
@@ -113,6 +114,15 @@ public abstract class NativePlatform {
         return cursor;
     }
 
+    /**
+     * Creates a hardware plane for video. Platforms without one return null.
+     *
+     * @return a new VideoOverlay, or null
+     */
+    protected VideoOverlay createVideoOverlay() {
+        return null;
+    }
+
     /**
      * Creates the NativeScreen for this platform. Called once.
      *
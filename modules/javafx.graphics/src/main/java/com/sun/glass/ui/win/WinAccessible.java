@@ -234,6 +234,9 @@ final class WinAccessible extends Accessible {
     /* Releases the GlassAccessible and deletes the GlobalRef */
     private native void _destroyGlassAccessible(long accessible);
 
+    /* Drops the property values cached by the GlassAccessible */
+    private native void _invalidatePropertyCache(long accessible);
+
     private native static long UiaRaiseAutomationEvent(long pProvider, int id);
     private native static long UiaRaiseAutomationPropertyChangedEvent(long pProvider, int id, WinVariant oldV, WinVariant newV);
     private native static boolean UiaClientsAreListening();
@@ -271,6 +274,9 @@ final class WinAccessible extends Accessible {
         Application.checkEventThread();
         if (isDisposed()) return;
 
+        /* Any change can affect the properties cached by the native provider */
+        _invalidatePropertyCache(peer);
+
         switch (notification) {
             case FOCUS_NODE:
                 if (getView() != null) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -260,6 +260,10 @@ final class WinApplication extends Application implements InvokeLaterDispatcher.
     }
 
     @Override protected double staticScreen_getVideoRefreshPeriod() {
+        if (WinTimer.isVsyncTimerEnabled()) {
+            // nominal, the actual pacing comes from the DWM frames
+            return 1000.0 / 60.0;
+        }
         return 0.0;     // indicate millisecond resolution
     }
 
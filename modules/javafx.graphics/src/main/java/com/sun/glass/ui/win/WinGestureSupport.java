@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,18 +44,21 @@ final class WinGestureSupport {
     private static int modifiers;
     private static boolean isDirect;
 
-    public static void notifyBeginTouchEvent(View view, int modifiers,
-                                             boolean isDirect,
-                                             int touchEventCount) {
-        touches.notifyBeginTouchEvent(view, modifiers, isDirect, touchEventCount);
-    }
-
-    public static void notifyNextTouchEvent(View view, int state, long id, int x,
-                                            int y, int xAbs, int yAbs) {
-        touches.notifyNextTouchEvent(view, state, id, x, y, xAbs, yAbs);
-    }
-
-    public static void notifyEndTouchEvent(View view) {
+    /**
+     * Delivers the touch points of one WM_TOUCH message at once. Each point
+     * takes six consecutive values in {@code data}: the TouchEvent state,
+     * the unsigned touch ID, x, y, and the screen coordinates xAbs, yAbs.
+     */
+    public static void notifyTouchEvents(View view, int modifiers,
+                                         boolean isDirect, int[] data) {
+        int count = data.length / 6;
+        touches.notifyBeginTouchEvent(view, modifiers, isDirect, count);
+        for (int i = 0; i < data.length; i += 6) {
+            touches.notifyNextTouchEvent(view, data[i],
+                                         Integer.toUnsignedLong(data[i + 1]),
+                                         data[i + 2], data[i + 3],
+                                         data[i + 4], data[i + 5]);
+        }
         touches.notifyEndTouchEvent(view);
         gestureFinished(view, touches.getTouchCount(), false);
     }
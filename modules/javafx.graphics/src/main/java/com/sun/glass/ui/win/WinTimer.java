@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,6 +38,17 @@ final class WinTimer extends Timer {
 
     private static final int minPeriod, maxPeriod;
 
+    /*
+     * The vsync timer runs the pulse from the DWM frame on a dedicated
+     * thread, see Timer.cpp.  It can be turned off with
+     * -Dglass.win.vsyncTimer=false to get the multimedia timer back.
+     */
+    private static final boolean vsyncTimer =
+            Boolean.parseBoolean(System.getProperty("glass.win.vsyncTimer", "true")) &&
+            _isVsyncSupported();
+
+    private long vsyncPtr;
+
     protected WinTimer(Runnable runnable) {
         super(runnable);
     }
@@ -53,11 +64,34 @@ final class WinTimer extends Timer {
         return maxPeriod;
     }
 
+    static boolean isVsyncTimerEnabled() {
+        return vsyncTimer;
+    }
+
+    native private static boolean _isVsyncSupported();
+
     @Override protected long _start(Runnable runnable) {
-        throw new RuntimeException("vsync timer not supported");
+        if (!vsyncTimer) {
+            throw new RuntimeException("vsync timer not supported");
+        }
+        vsyncPtr = _startVsync(runnable);
+        return vsyncPtr;
     }
+
+    @Override protected void _stop(long timer) {
+        if (timer == vsyncPtr) {
+            vsyncPtr = 0L;
+            _stopVsync(timer);
+        } else {
+            _stopTimer(timer);
+        }
+    }
+
+    native private long _startVsync(Runnable runnable);
+    native private void _stopVsync(long timer);
+
     @Override native protected long _start(Runnable runnable, int period);
-    @Override native protected void _stop(long timer);
+    native private void _stopTimer(long timer);
     @Override protected void _pause(long timer) {}
     @Override protected void _resume(long timer) {}
 }
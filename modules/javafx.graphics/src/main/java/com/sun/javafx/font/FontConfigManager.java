@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -220,7 +220,7 @@ public class FontConfigManager {
         (HashMap<String,String> fontToFileMap,
          HashMap<String,String> fontToFamilyNameMap,
          HashMap<String,ArrayList<String>> familyToFontListMap,
-         Locale locale);
+         Locale locale, String familyName);
 
     public static void populateMaps
         (HashMap<String,String> fontToFileMap,
@@ -231,7 +231,7 @@ public class FontConfigManager {
         boolean pnm = false;
         if (useFontConfig && !fontConfigFailed) {
             pnm = populateMapsNative(fontToFileMap, fontToFamilyNameMap,
-                                familyToFontListMap, locale);
+                                familyToFontListMap, locale, null);
 
         }
 
@@ -244,6 +244,25 @@ public class FontConfigManager {
         }
     }
 
+    /**
+     * Adds only the fonts of the given family to the maps, which is much
+     * cheaper than listing all the fonts of the system as populateMaps does.
+     * Returns false if fontconfig is not used, in which case the caller
+     * must populate the maps in full.
+     */
+    public static boolean populateMapsForFamily
+        (HashMap<String,String> fontToFileMap,
+         HashMap<String,String> fontToFamilyNameMap,
+         HashMap<String,ArrayList<String>> familyToFontListMap,
+         Locale locale, String familyName) {
+
+        if (!useFontConfig || fontConfigFailed || useEmbeddedFontSupport) {
+            return false;
+        }
+        return populateMapsNative(fontToFileMap, fontToFamilyNameMap,
+                                  familyToFontListMap, locale, familyName);
+    }
+
     private static String mapFxToFcLogicalFamilyName(String fxName) {
         if (fxName.equals("serif")) {
             return "serif";
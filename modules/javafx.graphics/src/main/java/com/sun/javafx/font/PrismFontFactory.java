@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -506,8 +506,7 @@ public abstract class PrismFontFactory implements FontFactory {
             }
         }
 
-        getFullNameToFileMap();
-        ArrayList<String> family = familyToFontListMap.get(lcFamilyName);
+        ArrayList<String> family = getFamilyFontList(lcFamilyName);
         if (family == null) {
             return null;
         }
@@ -738,8 +737,6 @@ public abstract class PrismFontFactory implements FontFactory {
             }
         }
 
-        getFullNameToFileMap(); // init maps
-
         if (name != null && file != null) {
             // Typically the TTC case used in font linking.
             // The called method adds the resources to the physical
@@ -753,6 +750,8 @@ public abstract class PrismFontFactory implements FontFactory {
             }
         }
 
+        getFullNameToFileMap(); // init maps
+
         if (name != null) { // Typically normal application lookup
             fr = getFontResourceByFullName(name, wantComp);
             if (fr != null) {
@@ -898,6 +897,12 @@ public abstract class PrismFontFactory implements FontFactory {
         if (name.equals(jreDefaultFontLC)) {
             return jreFontDir+jreDefaultFontFile;
         }
+        if (fontToFileMap == null && familyFontToFileMap != null) {
+            String filename = familyFontToFileMap.get(name);
+            if (filename != null) {
+                return filename;
+            }
+        }
         getFullNameToFileMap();
         String filename = fontToFileMap.get(name);
         if (isWindows) {
@@ -1617,6 +1622,40 @@ public abstract class PrismFontFactory implements FontFactory {
         }
     }
 
+    /* Fonts of the families looked up through fontconfig one by one,
+     * while the maps of all the system fonts are not needed yet.
+     * Listing all the fonts is costly on systems with many of them,
+     * and the families used by an application are usually only a few.
+     */
+    private HashMap<String,String> familyFontToFileMap = null;
+    private HashMap<String,ArrayList<String>> familyFontListMap = null;
+
+    private synchronized ArrayList<String> getFamilyFontList(String lcFamilyName) {
+        if (isLinux && fontToFileMap == null) {
+            if (familyFontListMap == null) {
+                familyFontToFileMap = new HashMap<>();
+                familyFontListMap = new HashMap<>();
+            }
+            ArrayList<String> family = familyFontListMap.get(lcFamilyName);
+            if (family == null &&
+                FontConfigManager.populateMapsForFamily(familyFontToFileMap,
+                                                        new HashMap<>(),
+                                                        familyFontListMap,
+                                                        Locale.getDefault(),
+                                                        lcFamilyName)) {
+                family = familyFontListMap.get(lcFamilyName);
+            }
+            if (family != null) {
+                return family;
+            }
+            /* Not a family name known to fontconfig as such, it may be
+             * an alias or a localized name, so look at all the fonts.
+             */
+        }
+        getFullNameToFileMap();
+        return familyToFontListMap.get(lcFamilyName);
+    }
+
     private synchronized HashMap<String,String> getFullNameToFileMap() {
         if (fontToFileMap == null) {
 
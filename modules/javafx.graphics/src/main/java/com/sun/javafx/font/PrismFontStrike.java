@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,9 @@ public abstract class PrismFontStrike<T extends PrismFontFile> implements FontSt
     private DisposerRecord disposer;
     private T fontResource;
     private Map<Integer,Glyph> glyphMap = new HashMap<>();
+    // Outlines are only ever iterated, never handed out, so they can be
+    // shared between all the runs drawn or converted to shapes with this strike
+    private final Map<Integer,Path2D> outlineMap = new HashMap<>();
     private PrismMetrics metrics;
     protected boolean drawShapes = false;
     private float size;
@@ -186,6 +189,17 @@ public abstract class PrismFontStrike<T extends PrismFontFile> implements FontSt
 
     protected abstract Path2D createGlyphOutline(int glyphCode);
 
+    private Path2D getGlyphOutline(int glyphCode) {
+        synchronized (outlineMap) {
+            Path2D outline = outlineMap.get(glyphCode);
+            if (outline == null && !outlineMap.containsKey(glyphCode)) {
+                outline = createGlyphOutline(glyphCode);
+                outlineMap.put(glyphCode, outline);
+            }
+            return outline;
+        }
+    }
+
     @Override
     public Shape getOutline(GlyphList gl, BaseTransform transform) {
         Path2D result = new Path2D();
@@ -205,7 +219,7 @@ public abstract class PrismFontStrike<T extends PrismFontFile> implements FontSt
         for (int i = 0; i < gl.getGlyphCount(); i++) {
             int glyphCode = gl.getGlyphCode(i);
             if (glyphCode != CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
-                Shape gp = createGlyphOutline(glyphCode);
+                Shape gp = getGlyphOutline(glyphCode);
                 if (gp != null) {
                     t.setTransform(transform);
                     t.translate(gl.getPosX(i), gl.getPosY(i));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -200,35 +200,20 @@ class CTGlyph implements Glyph {
                                createContext(lcdContext, w, h);
         if (context == 0) return new byte[0];
 
-        /* Fill background with white */
-        OS.CGContextSetRGBFillColor(context, 1, 1, 1, 1);
-        CGRect rect = new CGRect();
-        rect.size.width = w;
-        rect.size.height = h;
-        OS.CGContextFillRect(context, rect);
-
-        double drawX = 0, drawY = 0;
+        double drawX = 0, drawY = 0, translateX = 0, translateY = 0;
         if (matrix != null) {
-            OS.CGContextTranslateCTM(context, -x, -y);
+            translateX = -x;
+            translateY = -y;
         } else {
             drawX = x - strike.getSubPixelPosition(subPixel);
             drawY = y;
         }
 
-        /* Draw the text with black */
-        OS.CGContextSetRGBFillColor(context, 0, 0, 0, 1);
-        OS.CTFontDrawGlyphs(fontRef, (short)glyphCode, -drawX, -drawY, context);
-
-        if (matrix != null) {
-            OS.CGContextTranslateCTM(context, x, y);
-        }
-
-        byte[] imageData;
-        if (lcd) {
-            imageData = OS.CGBitmapContextGetData(context, w, h, 24);
-        } else {
-            imageData = OS.CGBitmapContextGetData(context, w, h, 8);
-        }
+        /* Clears the context, draws the glyph and reads it back */
+        byte[] imageData = OS.CTFontDrawGlyphImage(fontRef, (short)glyphCode, context,
+                                                   translateX, translateY,
+                                                   -drawX, -drawY, w, h,
+                                                   lcd ? 24 : 8);
         if (imageData == null) {
             bounds = new CGRect();
             imageData = new byte[0];
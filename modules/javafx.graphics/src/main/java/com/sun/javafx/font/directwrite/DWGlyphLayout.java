@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,12 +41,34 @@ public class DWGlyphLayout extends GlyphLayout {
 
     private static final String LOCALE = "en-us";
 
+    /* Kept across layouts while this GlyphLayout is reused, see dispose() */
+    private IDWriteTextAnalyzer analyzer;
+    private JFXTextRenderer renderer;
+
+    private IDWriteTextAnalyzer getAnalyzer() {
+        if (analyzer == null) {
+            analyzer = DWFactory.getDWriteFactory().CreateTextAnalyzer();
+        }
+        return analyzer;
+    }
+
+    private JFXTextRenderer getRenderer() {
+        if (renderer == null) {
+            renderer = OS.NewJFXTextRenderer();
+            if (renderer != null) {
+                renderer.AddRef();
+            }
+        } else {
+            renderer.Reset();
+        }
+        return renderer;
+    }
+
     @Override
     protected TextRun addTextRun(PrismTextLayout layout, char[] chars, int start,
                                  int length, PGFont font, TextSpan span, byte level) {
 
-        IDWriteFactory factory = DWFactory.getDWriteFactory();
-        IDWriteTextAnalyzer analyzer = factory.CreateTextAnalyzer();
+        IDWriteTextAnalyzer analyzer = getAnalyzer();
         if (analyzer == null) {
             return new TextRun(start, length, level, false, 0, span, 0, false);
         }
@@ -73,7 +95,6 @@ public class DWGlyphLayout extends GlyphLayout {
             }
         }
 
-        analyzer.Release();
         sink.Release();
         return textRun;
     }
@@ -91,8 +112,7 @@ public class DWGlyphLayout extends GlyphLayout {
         IDWriteFontFace face = ((DWFontFile)fr).getFontFace();
         if (face == null) return;
 
-        IDWriteFactory factory = DWFactory.getDWriteFactory();
-        IDWriteTextAnalyzer analyzer = factory.CreateTextAnalyzer();
+        IDWriteTextAnalyzer analyzer = getAnalyzer();
         if (analyzer == null) return;
 
         /* ignore typographic feature for now */
@@ -129,7 +149,6 @@ public class DWGlyphLayout extends GlyphLayout {
         }
 
         if (hr != OS.S_OK) {
-            analyzer.Release();
             return;
         }
         int glyphCount = retGlyphcount[0];
@@ -151,7 +170,6 @@ public class DWGlyphLayout extends GlyphLayout {
             j+=step;
         }
         if (missingGlyph && composite) {
-            analyzer.Release();
             renderShape(text, run, font, slot);
             return;
         }
@@ -163,7 +181,6 @@ public class DWGlyphLayout extends GlyphLayout {
                                     glyphProps, glyphCount, face, size, false, rtl,
                                     analysis, null, features, featuresRangeLengths,
                                     featuresCount, advances, offsets);
-        analyzer.Release();
 
         float[] pos = getPositions(advances, offsets, glyphCount, rtl);
         int[] indices = getIndices(clusterMap, glyphCount, rtl);
@@ -358,37 +375,40 @@ public class DWGlyphLayout extends GlyphLayout {
         int length = run.getLength();
         IDWriteTextLayout layout = factory.CreateTextLayout(text, start, length, format, 100000, 100000);
         if (layout != null) {
-            JFXTextRenderer renderer = OS.NewJFXTextRenderer();
+            JFXTextRenderer renderer = getRenderer();
             if (renderer != null) {
-                renderer.AddRef();
-
                 /* Use renderer to produce glyph information */
                 layout.Draw(0, renderer, 0, 0);
 
-                /* Read data from renderer */
+                /* Read data from renderer, all glyph runs in a single call */
                 int glyphCount = renderer.GetTotalGlyphCount();
                 int[] glyphs = new int[glyphCount];
                 float[] advances = new float[glyphCount];
                 float[] offsets = new float[glyphCount * 2];
                 short[] clusterMap = new short[length];
+                long[] runs = renderer.GetRuns(glyphs, advances, offsets, clusterMap);
+                if (runs == null) runs = new long[0];
                 int glyphStart = 0;
-                int textStart = 0;
-                while (renderer.Next()) {
-                    IDWriteFontFace fallback = renderer.GetFontFace();
+                for (int r = 0; r < runs.length; r += 2) {
+                    IDWriteFontFace fallback = runs[r] != 0 ? new IDWriteFontFace(runs[r]) : null;
+                    int runGlyphCount = (int)runs[r + 1];
+                    int glyphEnd = glyphStart + runGlyphCount;
                     int slot = getFontSlot(fallback, composite, fullName, baseSlot);
                     if (slot >= 0) {
-                        renderer.GetGlyphIndices(glyphs, glyphStart, slot << 24);
-                        renderer.GetGlyphOffsets(offsets, glyphStart * 2);
+                        int slotMask = slot << 24;
+                        for (int i = glyphStart; i < glyphEnd; i++) {
+                            glyphs[i] |= slotMask;
+                        }
+                    } else {
+                        Arrays.fill(glyphs, glyphStart, glyphEnd, 0);
+                        Arrays.fill(offsets, glyphStart * 2, glyphEnd * 2, 0);
                     }
-                    if (size > 0) {
-                        /* Keep advances to zero if font size is zero */
-                        renderer.GetGlyphAdvances(advances, glyphStart);
-                    }
-                    renderer.GetClusterMap(clusterMap, textStart, glyphStart);
-                    glyphStart += renderer.GetGlyphCount();
-                    textStart += renderer.GetLength();
+                    glyphStart = glyphEnd;
+                }
+                if (size <= 0) {
+                    /* Keep advances to zero if font size is zero */
+                    Arrays.fill(advances, 0);
                 }
-                renderer.Release();
 
                 /* Converting data to be used by the JavaFX run */
                 boolean rtl = !run.isLeftToRight();
@@ -410,6 +430,16 @@ public class DWGlyphLayout extends GlyphLayout {
 
     @Override
     public void dispose() {
-        GlyphLayoutManager.dispose(this);
+        if (!GlyphLayoutManager.dispose(this)) {
+            /* Not reused, release the DirectWrite objects */
+            if (analyzer != null) {
+                analyzer.Release();
+                analyzer = null;
+            }
+            if (renderer != null) {
+                renderer.Release();
+                renderer = null;
+            }
+        }
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,10 @@ class JFXTextRenderer extends IUnknown {
         super(ptr);
     }
 
+    void Reset() {
+        OS.JFXTextRendererReset(ptr);
+    }
+
     boolean Next() {
         return OS.JFXTextRendererNext(ptr);
     }
@@ -71,4 +75,9 @@ class JFXTextRenderer extends IUnknown {
     int GetClusterMap(short[] clusterMap, int textStart, int glyphStart) {
         return OS.JFXTextRendererGetClusterMap(ptr, clusterMap, textStart, glyphStart);
     }
+
+    /* Returns {fontFace0, glyphCount0, fontFace1, glyphCount1, ...} */
+    long[] GetRuns(int[] glyphs, float[] advances, float[] offsets, short[] clusterMap) {
+        return OS.JFXTextRendererGetRuns(ptr, glyphs, advances, offsets, clusterMap);
+    }
 }
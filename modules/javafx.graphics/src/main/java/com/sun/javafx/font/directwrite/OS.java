@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -208,6 +208,7 @@ class OS {
     static final native DWRITE_SCRIPT_ANALYSIS GetAnalysis(long ptr);
 
     //JFXTextRenderer
+    static final native void JFXTextRendererReset(long ptr);
     static final native boolean JFXTextRendererNext(long ptr);
     static final native int JFXTextRendererGetStart(long ptr);
     static final native int JFXTextRendererGetLength(long ptr);
@@ -218,6 +219,7 @@ class OS {
     static final native int JFXTextRendererGetGlyphAdvances(long ptr, float[] advances, int start);
     static final native int JFXTextRendererGetGlyphOffsets(long ptr, float[] offsets, int start);
     static final native int JFXTextRendererGetClusterMap(long ptr, short[] clusterMap, int textStart, int glyphStart);
+    static final native long[] JFXTextRendererGetRuns(long ptr, int[] glyphs, float[] advances, float[] offsets, short[] clusterMap);
 
     //IDWriteFontFace
     static final native DWRITE_GLYPH_METRICS GetDesignGlyphMetrics(long ptr, short glyphIndex, boolean isSideways);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -73,7 +73,7 @@ class FTFontFile extends PrismFontFile {
         int fontIndex = getFontIndex();
         /* Freetype expects 'a standard C string' */
         byte[] buffer = (file+"\0").getBytes();
-        error = OSFreetype.FT_New_Face(library, buffer, fontIndex, ptr);
+        error = OSFreetype.newSharedFace(library, buffer, fontIndex, ptr);
         if (error != 0) {
             throw new Exception("FT_New_Face Failed error " + error +
                                 " Font File " + file +
@@ -117,6 +117,9 @@ class FTFontFile extends PrismFontFile {
         return OSFreetype.FT_Outline_Decompose(face);
     }
 
+    // Filled in by OSFreetype.loadGlyph, guarded by this font file
+    private final int[] glyphInfo = new int[OSFreetype.GLYPH_INFO_LENGTH];
+
     synchronized void initGlyph(FTGlyph glyph, FTFontStrike strike) {
         float size = strike.getSize();
         if (size == 0) {
@@ -144,7 +147,9 @@ class FTFontFile extends PrismFontFile {
         }
 
         int glyphCode = glyph.getGlyphCode();
-        int error = OSFreetype.FT_Load_Glyph(face, glyphCode, flags);
+        int[] info = glyphInfo;
+        byte[] buffer = OSFreetype.loadGlyph(face, glyphCode, flags, info);
+        int error = info[OSFreetype.GLYPH_INFO_ERROR];
         if (error != 0) {
             if (PrismFontFactory.debugFonts) {
                 System.err.println("FT_Load_Glyph failed " + error +
@@ -154,14 +159,9 @@ class FTFontFile extends PrismFontFile {
             return;
         }
 
-        FT_GlyphSlotRec glyphRec = OSFreetype.getGlyphSlot(face);
-        if (glyphRec == null) return;
-        FT_Bitmap bitmap = glyphRec.bitmap;
-        if (bitmap == null) return;
-        int pixelMode = bitmap.pixel_mode;
-        int width = bitmap.width;
-        int height = bitmap.rows;
-        int pitch = bitmap.pitch;
+        int pixelMode = info[OSFreetype.GLYPH_INFO_PIXEL_MODE];
+        int width = info[OSFreetype.GLYPH_INFO_WIDTH];
+        int height = info[OSFreetype.GLYPH_INFO_ROWS];
         if (pixelMode != OSFreetype.FT_PIXEL_MODE_GRAY && pixelMode != OSFreetype.FT_PIXEL_MODE_LCD) {
             /* This procedure only requests FT_RENDER_MODE_NORMAL and FT_RENDER_MODE_LCD,
              * and for its output is expects FT_PIXEL_MODE_GRAY and FT_PIXEL_MODE_LCD, respectively.
@@ -176,34 +176,23 @@ class FTFontFile extends PrismFontFile {
             }
             return;
         }
-        byte[] buffer;
-        if (width != 0 && height != 0) {
-            buffer = OSFreetype.getBitmapData(face);
-            if (buffer != null && pitch != width) {
-                /* Common for LCD glyphs */
-                byte[] newBuffer = new byte[width * height];
-                int src = 0, dst = 0;
-                for (int y = 0; y < height; y++) {
-                    for (int x = 0; x < width; x++) {
-                        newBuffer[dst + x] = buffer[src + x];
-                    }
-                    dst += width;
-                    src += pitch;
-                }
-                buffer = newBuffer;
-            }
-        } else {
+        if (width == 0 || height == 0) {
             /* white space */
             buffer = new byte[0];
         }
 
+        FT_Bitmap bitmap = new FT_Bitmap();
+        bitmap.pixel_mode = (byte)pixelMode;
+        bitmap.width = width;
+        bitmap.rows = height;
+        bitmap.pitch = width;
         glyph.buffer = buffer;
         glyph.bitmap = bitmap;
-        glyph.bitmap_left = glyphRec.bitmap_left;
-        glyph.bitmap_top = glyphRec.bitmap_top;
-        glyph.advanceX = glyphRec.advance_x / 64f;    /* Fixed 26.6*/
-        glyph.advanceY = glyphRec.advance_y / 64f;
-        glyph.userAdvance = glyphRec.linearHoriAdvance / 65536.0f; /* Fixed 16.16 */
+        glyph.bitmap_left = info[OSFreetype.GLYPH_INFO_BITMAP_LEFT];
+        glyph.bitmap_top = info[OSFreetype.GLYPH_INFO_BITMAP_TOP];
+        glyph.advanceX = info[OSFreetype.GLYPH_INFO_ADVANCE_X] / 64f;    /* Fixed 26.6*/
+        glyph.advanceY = info[OSFreetype.GLYPH_INFO_ADVANCE_Y] / 64f;
+        glyph.userAdvance = info[OSFreetype.GLYPH_INFO_LINEAR_HORI_ADVANCE] / 65536.0f; /* Fixed 16.16 */
         glyph.lcd = lcd;
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -99,12 +99,37 @@ class OSFreetype {
     static final native int FT_Library_SetLcdFilter(long library, int filter);
     static final native int FT_New_Face(long library, byte[] filepathname, long face_index, long[] aface);
     static final native int FT_Done_Face(long face);
+
+    /**
+     * Opens the face like FT_New_Face, from a memory mapping of the file
+     * that is shared with all the other faces opened from the same file.
+     * FT_Done_Face releases the face's reference to the mapping.
+     */
+    static final native int newSharedFace(long library, byte[] filepathname, long face_index, long[] aface);
     static final native int FT_Get_Char_Index(long face, long charcode);
     static final native int FT_Set_Char_Size(long face, long char_width, long char_height, int horz_resolution, int vert_resolution);
     static final native int FT_Load_Glyph(long face, int glyph_index, int load_flags);
     static final native void FT_Set_Transform(long face, FT_Matrix matrix, long delta_x, long delta_y);
     static final native FT_GlyphSlotRec getGlyphSlot(long face);
-    static final native byte[] getBitmapData(long face);
+
+    /* Indices into the info array filled in by loadGlyph */
+    static final int GLYPH_INFO_ERROR = 0;
+    static final int GLYPH_INFO_PIXEL_MODE = 1;
+    static final int GLYPH_INFO_WIDTH = 2;
+    static final int GLYPH_INFO_ROWS = 3;
+    static final int GLYPH_INFO_BITMAP_LEFT = 4;
+    static final int GLYPH_INFO_BITMAP_TOP = 5;
+    static final int GLYPH_INFO_ADVANCE_X = 6;
+    static final int GLYPH_INFO_ADVANCE_Y = 7;
+    static final int GLYPH_INFO_LINEAR_HORI_ADVANCE = 8;
+    static final int GLYPH_INFO_LENGTH = 9;
+
+    /**
+     * Loads the glyph with the given flags and returns its bitmap with
+     * width bytes per row, or null if it has none, filling in info with
+     * the GLYPH_INFO_* values of the glyph slot.
+     */
+    static final native byte[] loadGlyph(long face, int glyph_index, int load_flags, int[] info);
     static final native boolean isPangoEnabled();
     static final native boolean isHarfbuzzEnabled();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -84,9 +84,45 @@ class PangoGlyphLayout extends GlyphLayout {
         return true;
     }
 
+    /*
+     * Shaping results of recently laid out runs.  Controls such as ListView
+     * and TableView lay out the same labels over and over, and itemizing,
+     * shaping and resolving the fallback fonts of a run is far more costly
+     * than copying the result.
+     */
+    private static final int SHAPE_CACHE_SIZE = 512;
+
+    private record ShapeKey(FontResource fontResource, float size,
+                            boolean rtl, String text) {}
+
+    private record ShapeResult(int glyphCount, int[] glyphs, float[] pos,
+                               int[] indices) {}
+
+    private static final Map<ShapeKey, ShapeResult> shapeCache =
+            new LinkedHashMap<>(16, 0.75f, true) {
+                @Override
+                protected boolean removeEldestEntry(Map.Entry<ShapeKey, ShapeResult> eldest) {
+                    return size() > SHAPE_CACHE_SIZE;
+                }
+            };
+
     private Map<TextRun, Long> runUtf8 = new LinkedHashMap<>();
     @Override
     public void layout(TextRun run, PGFont font, FontStrike strike, char[] text) {
+        boolean rtl = (run.getLevel() & 1) != 0;
+        ShapeKey key = new ShapeKey(font.getFontResource(), font.getSize(), rtl,
+                                    new String(text, run.getStart(), run.getLength()));
+        ShapeResult cached;
+        synchronized (shapeCache) {
+            cached = shapeCache.get(key);
+        }
+        if (cached != null) {
+            // TextRun keeps the arrays, so it gets its own copies
+            run.shape(cached.glyphCount(), cached.glyphs().clone(),
+                      cached.pos().clone(), cached.indices().clone());
+            return;
+        }
+
         /* Create the pango font and attribute list */
         FontResource fr = font.getFontResource();
         boolean composite = fr instanceof CompositeFontResource;
@@ -100,7 +136,6 @@ class PangoGlyphLayout extends GlyphLayout {
         if (check(context, "Failed allocating PangoContext.", 0, 0, 0)) {
             return;
         }
-        boolean rtl = (run.getLevel() & 1) != 0;
         if (rtl) {
             OSPango.pango_context_set_base_dir(context, OSPango.PANGO_DIRECTION_RTL);
         }
@@ -197,6 +232,10 @@ class PangoGlyphLayout extends GlyphLayout {
                     gi += g.num_glyphs;
                 }
             }
+            synchronized (shapeCache) {
+                shapeCache.put(key, new ShapeResult(glyphCount, glyphs.clone(),
+                                                    pos.clone(), indices.clone()));
+            }
             run.shape(glyphCount, glyphs, pos, indices);
         }
 
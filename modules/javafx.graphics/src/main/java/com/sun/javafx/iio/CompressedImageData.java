@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio;
+
+import java.nio.ByteBuffer;
+
+/**
+ * The level 0 blocks of a GPU block-compressed image, as read from a
+ * container such as DDS or KTX2. Loaders always decode the blocks into an
+ * ordinary {@link ImageFrame} as well; the compressed data is only attached
+ * so that a pipeline that can sample the format directly may upload it
+ * without expanding it to 32 bits per pixel.
+ */
+public final class CompressedImageData {
+
+    /**
+     * The supported block formats. All of them use 4x4 texel blocks.
+     */
+    public enum Format {
+        BC1_RGBA(8, 0x83F1, false),   // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+        BC2_RGBA(16, 0x83F2, true),   // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
+        BC3_RGBA(16, 0x83F3, true),   // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+        ETC2_RGB8(8, 0x9274, false),  // GL_COMPRESSED_RGB8_ETC2
+        ETC2_RGBA8(16, 0x9278, true); // GL_COMPRESSED_RGBA8_ETC2_EAC
+
+        private final int bytesPerBlock;
+        private final int glInternalFormat;
+        private final boolean hasAlpha;
+
+        private Format(int bytesPerBlock, int glInternalFormat, boolean hasAlpha) {
+            this.bytesPerBlock = bytesPerBlock;
+            this.glInternalFormat = glInternalFormat;
+            this.hasAlpha = hasAlpha;
+        }
+
+        public int getBytesPerBlock() {
+            return bytesPerBlock;
+        }
+
+        public int getGLInternalFormat() {
+            return glInternalFormat;
+        }
+
+        /**
+         * Returns true if the format carries a separate alpha channel.
+         * BC1 transparent texels decode to (0, 0, 0, 0) and ETC2 RGB8 is
+         * opaque, so those two are usable as premultiplied data as is.
+         */
+        public boolean hasAlpha() {
+            return hasAlpha;
+        }
+
+        /**
+         * Returns the size in bytes of a {@code width} x {@code height}
+         * image in this format.
+         */
+        public int getDataSize(int width, int height) {
+            return ((width + 3) / 4) * ((height + 3) / 4) * bytesPerBlock;
+        }
+    }
+
+    private final Format format;
+    private final int width;
+    private final int height;
+    private final boolean premultiplied;
+    private final ByteBuffer data;
+
+    /**
+     * Creates a <code>CompressedImageData</code>.
+     *
+     * @param format The block format.
+     * @param width The image width in pixels.
+     * @param height The image height in pixels.
+     * @param premultiplied Whether the color channels are premultiplied by alpha.
+     * @param data The blocks, starting at the buffer's position; must hold at
+     *             least <code>format.getDataSize(width, height)</code> bytes.
+     */
+    public CompressedImageData(Format format, int width, int height,
+                               boolean premultiplied, ByteBuffer data) {
+        if (data.remaining() < format.getDataSize(width, height)) {
+            throw new IllegalArgumentException("Compressed data is too short");
+        }
+        this.format = format;
+        this.width = width;
+        this.height = height;
+        this.premultiplied = premultiplied;
+        this.data = data;
+    }
+
+    public Format getFormat() {
+        return format;
+    }
+
+    public int getWidth() {
+        return width;
+    }
+
+    public int getHeight() {
+        return height;
+    }
+
+    public ByteBuffer getData() {
+        return data;
+    }
+
+    public int getDataSize() {
+        return format.getDataSize(width, height);
+    }
+
+    /**
+     * Returns true if the blocks can be used as premultiplied color data,
+     * which is what Prism textures hold.
+     */
+    public boolean isPremultiplied() {
+        return premultiplied || !format.hasAlpha();
+    }
+}
@@ -41,6 +41,7 @@ public final class ImageFrame {
     private final int paletteIndexBits;
     private final ImageMetadata metadata;
     private float pixelScale;
+    private CompressedImageData compressedData;
 
     /**
      * Create an <code>ImageFrame</code> with a default 72DPI pixel scale.
@@ -148,4 +149,17 @@ public final class ImageFrame {
     public ImageMetadata getMetadata() {
         return this.metadata;
     }
+
+    /**
+     * Attaches the block-compressed form of this frame's pixels. The
+     * compressed data must describe exactly the same image, at the same
+     * size, as the uncompressed image data.
+     */
+    public void setCompressedData(CompressedImageData compressedData) {
+        this.compressedData = compressedData;
+    }
+
+    public CompressedImageData getCompressedData() {
+        return compressedData;
+    }
 }
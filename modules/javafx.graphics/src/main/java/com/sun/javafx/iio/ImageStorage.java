@@ -29,9 +29,11 @@ import com.sun.javafx.PlatformUtil;
 import com.sun.javafx.iio.ImageFormatDescription.Signature;
 import com.sun.javafx.iio.bmp.BMPImageLoaderFactory;
 import com.sun.javafx.iio.common.ImageTools;
+import com.sun.javafx.iio.dds.DDSImageLoaderFactory;
 import com.sun.javafx.iio.gif.GIFImageLoaderFactory;
 import com.sun.javafx.iio.ios.IosImageLoaderFactory;
 import com.sun.javafx.iio.jpeg.JPEGImageLoaderFactory;
+import com.sun.javafx.iio.ktx.KTXImageLoaderFactory;
 import com.sun.javafx.iio.png.PNGImageLoaderFactory;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.util.DataURI;
@@ -204,7 +206,9 @@ public class ImageStorage {
                 GIFImageLoaderFactory.getInstance(),
                 JPEGImageLoaderFactory.getInstance(),
                 PNGImageLoaderFactory.getInstance(),
-                BMPImageLoaderFactory.getInstance()
+                BMPImageLoaderFactory.getInstance(),
+                DDSImageLoaderFactory.getInstance(),
+                KTXImageLoaderFactory.getInstance()
                 // Note: append ImageLoadFactory for any new format here.
             };
         }
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.common;
+
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageMetadata;
+import com.sun.javafx.iio.ImageStorage;
+import java.nio.ByteBuffer;
+
+/**
+ * A software decoder for the block formats in
+ * {@link CompressedImageData.Format}. It is used to produce the ordinary
+ * RGBA pixels that every pipeline can consume, independent of whether the
+ * GPU can sample the compressed data directly.
+ */
+public final class BlockDecoder {
+
+    private static final int[][] ETC_MODIFIERS = {
+        { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 },
+        { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+    };
+
+    private static final int[] ETC_DISTANCES = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+    private static final int[][] EAC_MODIFIERS = {
+        { -3, -6, -9, -15, 2, 5, 8, 14 },
+        { -3, -7, -10, -13, 2, 6, 9, 12 },
+        { -2, -5, -8, -13, 1, 4, 7, 12 },
+        { -2, -4, -6, -13, 1, 3, 5, 12 },
+        { -3, -6, -8, -12, 2, 5, 7, 11 },
+        { -3, -7, -9, -11, 2, 6, 8, 10 },
+        { -4, -7, -8, -11, 3, 6, 7, 10 },
+        { -3, -5, -8, -11, 2, 4, 7, 10 },
+        { -2, -6, -8, -10, 1, 5, 7, 9 },
+        { -2, -5, -8, -10, 1, 4, 7, 9 },
+        { -2, -4, -8, -10, 1, 3, 7, 9 },
+        { -2, -5, -7, -10, 1, 4, 6, 9 },
+        { -3, -4, -7, -10, 2, 3, 6, 9 },
+        { -1, -2, -3, -10, 0, 1, 2, 9 },
+        { -4, -6, -8, -9, 3, 5, 7, 8 },
+        { -3, -5, -7, -9, 2, 4, 6, 8 }
+    };
+
+    private BlockDecoder() {
+    }
+
+    /**
+     * Decodes the image into tightly packed 4 byte RGBA pixels. The color
+     * channels are premultiplied exactly when the source data is.
+     */
+    public static byte[] decode(CompressedImageData src) {
+        CompressedImageData.Format format = src.getFormat();
+        int width = src.getWidth();
+        int height = src.getHeight();
+        ByteBuffer data = src.getData();
+        int pos = data.position();
+        int blockSize = format.getBytesPerBlock();
+
+        byte[] image = new byte[width * height * 4];
+        byte[] block = new byte[blockSize];
+        // one decoded 4x4 block, row major, RGBA
+        byte[] texels = new byte[64];
+        for (int by = 0; by < height; by += 4) {
+            for (int bx = 0; bx < width; bx += 4) {
+                data.get(pos, block);
+                pos += blockSize;
+                switch (format) {
+                    case BC1_RGBA:
+                        decodeBC1(block, 0, texels, true);
+                        break;
+                    case BC2_RGBA:
+                        decodeBC1(block, 8, texels, false);
+                        decodeBC2Alpha(block, texels);
+                        break;
+                    case BC3_RGBA:
+                        decodeBC1(block, 8, texels, false);
+                        decodeBC3Alpha(block, texels);
+                        break;
+                    case ETC2_RGB8:
+                        decodeETC2(block, 0, texels);
+                        break;
+                    case ETC2_RGBA8:
+                        decodeETC2(block, 8, texels);
+                        decodeEACAlpha(block, texels);
+                        break;
+                }
+                int rows = Math.min(4, height - by);
+                int cols = Math.min(4, width - bx);
+                for (int y = 0; y < rows; y++) {
+                    System.arraycopy(texels, y * 16, image,
+                            ((by + y) * width + bx) * 4, cols * 4);
+                }
+            }
+        }
+        return image;
+    }
+
+    /**
+     * Decodes the image and scales it to {@code width} x {@code height}.
+     * The compressed data is attached to the returned frame only if no
+     * scaling was needed.
+     */
+    public static ImageFrame decodeFrame(CompressedImageData src,
+                                         int width, int height, boolean smooth,
+                                         float pixelScale, ImageMetadata metadata) {
+        ByteBuffer img = ByteBuffer.wrap(decode(src));
+        boolean scaled = src.getWidth() != width || src.getHeight() != height;
+        if (scaled) {
+            img = ImageTools.scaleImage(img, src.getWidth(), src.getHeight(), 4,
+                    width, height, smooth);
+        }
+        ImageStorage.ImageType type = src.isPremultiplied()
+                ? ImageStorage.ImageType.RGBA_PRE
+                : ImageStorage.ImageType.RGBA;
+        ImageFrame frame = new ImageFrame(type, img, width, height, width * 4,
+                pixelScale, metadata);
+        if (!scaled) {
+            frame.setCompressedData(src);
+        }
+        return frame;
+    }
+
+    private static int getWord(byte[] buf, int pos) {
+        return (buf[pos] & 0xff) | ((buf[pos + 1] & 0xff) << 8);
+    }
+
+    private static int clamp(int v) {
+        return v < 0 ? 0 : (v > 255 ? 255 : v);
+    }
+
+    private static void setRGB(int[] palette, int i, int r, int g, int b) {
+        palette[i] = (clamp(r) << 16) | (clamp(g) << 8) | clamp(b);
+    }
+
+    private static void putRGBA(byte[] texels, int x, int y, int rgb, int a) {
+        int off = (y * 4 + x) * 4;
+        texels[off    ] = (byte) (rgb >> 16);
+        texels[off + 1] = (byte) (rgb >> 8);
+        texels[off + 2] = (byte) rgb;
+        texels[off + 3] = (byte) a;
+    }
+
+    private static void decodeBC1(byte[] block, int off, byte[] texels,
+                                  boolean allowTransparent) {
+        int c0 = getWord(block, off);
+        int c1 = getWord(block, off + 2);
+        int r0 = expand5((c0 >> 11) & 0x1f), g0 = expand6((c0 >> 5) & 0x3f), b0 = expand5(c0 & 0x1f);
+        int r1 = expand5((c1 >> 11) & 0x1f), g1 = expand6((c1 >> 5) & 0x3f), b1 = expand5(c1 & 0x1f);
+
+        int[] palette = new int[4];
+        int[] alpha = { 255, 255, 255, 255 };
+        setRGB(palette, 0, r0, g0, b0);
+        setRGB(palette, 1, r1, g1, b1);
+        if (c0 > c1 || !allowTransparent) {
+            setRGB(palette, 2, (2 * r0 + r1) / 3, (2 * g0 + g1) / 3, (2 * b0 + b1) / 3);
+            setRGB(palette, 3, (r0 + 2 * r1) / 3, (g0 + 2 * g1) / 3, (b0 + 2 * b1) / 3);
+        } else {
+            setRGB(palette, 2, (r0 + r1) / 2, (g0 + g1) / 2, (b0 + b1) / 2);
+            palette[3] = 0;
+            alpha[3] = 0;
+        }
+
+        int indices = getWord(block, off + 4) | (getWord(block, off + 6) << 16);
+        for (int i = 0; i < 16; i++) {
+            int idx = (indices >>> (2 * i)) & 3;
+            putRGBA(texels, i & 3, i >> 2, palette[idx], alpha[idx]);
+        }
+    }
+
+    private static void decodeBC2Alpha(byte[] block, byte[] texels) {
+        for (int i = 0; i < 16; i++) {
+            int nibble = (block[i >> 1] >> ((i & 1) * 4)) & 0xf;
+            texels[i * 4 + 3] = (byte) (nibble * 17);
+        }
+    }
+
+    private static void decodeBC3Alpha(byte[] block, byte[] texels) {
+        int a0 = block[0] & 0xff;
+        int a1 = block[1] & 0xff;
+        int[] palette = new int[8];
+        palette[0] = a0;
+        palette[1] = a1;
+        if (a0 > a1) {
+            for (int i = 1; i < 7; i++) {
+                palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+            }
+        } else {
+            for (int i = 1; i < 5; i++) {
+                palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+            }
+            palette[6] = 0;
+            palette[7] = 255;
+        }
+
+        long indices = 0;
+        for (int i = 7; i >= 2; i--) {
+            indices = (indices << 8) | (block[i] & 0xff);
+        }
+        for (int i = 0; i < 16; i++) {
+            texels[i * 4 + 3] = (byte) palette[(int) (indices >>> (3 * i)) & 7];
+        }
+    }
+
+    private static void decodeEACAlpha(byte[] block, byte[] texels) {
+        int base = block[0] & 0xff;
+        int multiplier = (block[1] >> 4) & 0xf;
+        int[] modifiers = EAC_MODIFIERS[block[1] & 0xf];
+        long indices = 0;
+        for (int i = 2; i < 8; i++) {
+            indices = (indices << 8) | (block[i] & 0xff);
+        }
+        // pixels are stored column major, first pixel in the top bits
+        for (int k = 0; k < 16; k++) {
+            int idx = (int) (indices >>> (45 - 3 * k)) & 7;
+            int x = k >> 2, y = k & 3;
+            texels[(y * 4 + x) * 4 + 3] =
+                    (byte) clamp(base + modifiers[idx] * multiplier);
+        }
+    }
+
+    private static void decodeETC2(byte[] block, int off, byte[] texels) {
+        int b0 = block[off] & 0xff, b1 = block[off + 1] & 0xff;
+        int b2 = block[off + 2] & 0xff, b3 = block[off + 3] & 0xff;
+        int low = ((block[off + 4] & 0xff) << 24) | ((block[off + 5] & 0xff) << 16)
+                | ((block[off + 6] & 0xff) << 8) | (block[off + 7] & 0xff);
+
+        if ((b3 & 2) == 0) {
+            // individual mode
+            decodeETCSubblocks(texels, low, b3,
+                    expand4(b0 >> 4), expand4(b1 >> 4), expand4(b2 >> 4),
+                    expand4(b0 & 0xf), expand4(b1 & 0xf), expand4(b2 & 0xf));
+            return;
+        }
+
+        int r = b0 >> 3, g = b1 >> 3, b = b2 >> 3;
+        int r2 = r + signed3(b0), g2 = g + signed3(b1), b2n = b + signed3(b2);
+        if (r2 < 0 || r2 > 31) {
+            decodeETC2T(texels, low, b0, b1, b2, b3);
+        } else if (g2 < 0 || g2 > 31) {
+            decodeETC2H(texels, low, b0, b1, b2, b3);
+        } else if (b2n < 0 || b2n > 31) {
+            decodeETC2Planar(texels, block, off);
+        } else {
+            decodeETCSubblocks(texels, low, b3,
+                    expand5(r), expand5(g), expand5(b),
+                    expand5(r2), expand5(g2), expand5(b2n));
+        }
+    }
+
+    private static void decodeETCSubblocks(byte[] texels, int low, int b3,
+                                           int r1, int g1, int b1,
+                                           int r2, int g2, int b2) {
+        boolean flip = (b3 & 1) != 0;
+        int[] table1 = ETC_MODIFIERS[(b3 >> 5) & 7];
+        int[] table2 = ETC_MODIFIERS[(b3 >> 2) & 7];
+        for (int k = 0; k < 16; k++) {
+            int x = k >> 2, y = k & 3;
+            boolean second = flip ? y >= 2 : x >= 2;
+            int[] table = second ? table2 : table1;
+            int msb = (low >>> (k + 16)) & 1;
+            int lsb = (low >>> k) & 1;
+            int delta = table[lsb];
+            if (msb != 0) {
+                delta = -delta;
+            }
+            int rgb = second
+                    ? (clamp(r2 + delta) << 16) | (clamp(g2 + delta) << 8) | clamp(b2 + delta)
+                    : (clamp(r1 + delta) << 16) | (clamp(g1 + delta) << 8) | clamp(b1 + delta);
+            putRGBA(texels, x, y, rgb, 255);
+        }
+    }
+
+    private static void decodeETC2T(byte[] texels, int low,
+                                    int b0, int b1, int b2, int b3) {
+        int r1 = expand4((((b0 >> 3) & 3) << 2) | (b0 & 3));
+        int g1 = expand4(b1 >> 4);
+        int bl1 = expand4(b1 & 0xf);
+        int r2 = expand4(b2 >> 4);
+        int g2 = expand4(b2 & 0xf);
+        int bl2 = expand4(b3 >> 4);
+        int d = ETC_DISTANCES[(((b3 >> 2) & 3) << 1) | (b3 & 1)];
+
+        int[] palette = new int[4];
+        setRGB(palette, 0, r1, g1, bl1);
+        setRGB(palette, 1, r2 + d, g2 + d, bl2 + d);
+        setRGB(palette, 2, r2, g2, bl2);
+        setRGB(palette, 3, r2 - d, g2 - d, bl2 - d);
+        putETCPaletteTexels(texels, low, palette);
+    }
+
+    private static void decodeETC2H(byte[] texels, int low,
+                                    int b0, int b1, int b2, int b3) {
+        int r1 = (b0 >> 3) & 0xf;
+        int g1 = ((b0 & 7) << 1) | ((b1 >> 4) & 1);
+        int bl1 = (((b1 >> 3) & 1) << 3) | ((b1 & 3) << 1) | ((b2 >> 7) & 1);
+        int r2 = (b2 >> 3) & 0xf;
+        int g2 = ((b2 & 7) << 1) | ((b3 >> 7) & 1);
+        int bl2 = (b3 >> 3) & 0xf;
+        int order = ((r1 << 8) | (g1 << 4) | bl1) >= ((r2 << 8) | (g2 << 4) | bl2) ? 1 : 0;
+        int d = ETC_DISTANCES[(((b3 >> 2) & 1) << 2) | ((b3 & 1) << 1) | order];
+
+        r1 = expand4(r1); g1 = expand4(g1); bl1 = expand4(bl1);
+        r2 = expand4(r2); g2 = expand4(g2); bl2 = expand4(bl2);
+        int[] palette = new int[4];
+        setRGB(palette, 0, r1 + d, g1 + d, bl1 + d);
+        setRGB(palette, 1, r1 - d, g1 - d, bl1 - d);
+        setRGB(palette, 2, r2 + d, g2 + d, bl2 + d);
+        setRGB(palette, 3, r2 - d, g2 - d, bl2 - d);
+        putETCPaletteTexels(texels, low, palette);
+    }
+
+    private static void putETCPaletteTexels(byte[] texels, int low, int[] palette) {
+        for (int k = 0; k < 16; k++) {
+            int idx = (((low >>> (k + 16)) & 1) << 1) | ((low >>> k) & 1);
+            putRGBA(texels, k >> 2, k & 3, palette[idx], 255);
+        }
+    }
+
+    private static void decodeETC2Planar(byte[] texels, byte[] block, int off) {
+        int b0 = block[off] & 0xff, b1 = block[off + 1] & 0xff;
+        int b2 = block[off + 2] & 0xff, b3 = block[off + 3] & 0xff;
+        int b4 = block[off + 4] & 0xff, b5 = block[off + 5] & 0xff;
+        int b6 = block[off + 6] & 0xff, b7 = block[off + 7] & 0xff;
+
+        int ro = expand6((b0 >> 1) & 0x3f);
+        int go = expand7(((b0 & 1) << 6) | ((b1 >> 1) & 0x3f));
+        int bo = expand6(((b1 & 1) << 5) | (((b2 >> 3) & 3) << 3)
+                | ((b2 & 3) << 1) | ((b3 >> 7) & 1));
+        int rh = expand6((((b3 >> 2) & 0x1f) << 1) | (b3 & 1));
+        int gh = expand7(b4 >> 1);
+        int bh = expand6(((b4 & 1) << 5) | (b5 >> 3));
+        int rv = expand6(((b5 & 7) << 3) | (b6 >> 5));
+        int gv = expand7(((b6 & 0x1f) << 2) | (b7 >> 6));
+        int bv = expand6(b7 & 0x3f);
+
+        for (int y = 0; y < 4; y++) {
+            for (int x = 0; x < 4; x++) {
+                int r = clamp((x * (rh - ro) + y * (rv - ro) + 4 * ro + 2) >> 2);
+                int g = clamp((x * (gh - go) + y * (gv - go) + 4 * go + 2) >> 2);
+                int b = clamp((x * (bh - bo) + y * (bv - bo) + 4 * bo + 2) >> 2);
+                putRGBA(texels, x, y, (r << 16) | (g << 8) | b, 255);
+            }
+        }
+    }
+
+    private static int signed3(int v) {
+        v &= 7;
+        return v >= 4 ? v - 8 : v;
+    }
+
+    private static int expand4(int v) {
+        return v * 17;
+    }
+
+    private static int expand5(int v) {
+        return (v << 3) | (v >> 2);
+    }
+
+    private static int expand6(int v) {
+        return (v << 2) | (v >> 4);
+    }
+
+    private static int expand7(int v) {
+        return (v << 1) | (v >> 6);
+    }
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.dds;
+
+import com.sun.javafx.iio.*;
+import com.sun.javafx.iio.CompressedImageData.Format;
+import com.sun.javafx.iio.common.*;
+import java.io.*;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+final class DDSDescriptor extends ImageDescriptor {
+
+    static final String formatName = "DDS";
+    static final String[] extensions = { "dds" };
+    static final Signature[] signatures = {
+        new Signature((byte)0x44, (byte)0x44, (byte)0x53, (byte)0x20)
+    };
+    static final String[] mimeSubtypes = { "vnd-ms.dds" };
+    static final ImageDescriptor theInstance = new DDSDescriptor();
+
+    private DDSDescriptor() {
+        super(formatName, extensions, signatures, mimeSubtypes);
+    }
+}
+
+/**
+ * Loads the top mip level of a DirectDraw Surface holding BC1, BC2 or BC3
+ * blocks, either with a legacy FourCC or with a DX10 extended header.
+ * Uncompressed and other block-compressed DDS variants are not supported.
+ */
+final class DDSImageLoader extends ImageLoaderImpl {
+
+    static final int MAGIC = 0x20534444;        // "DDS "
+    static final int HEADER_SIZE = 124;
+    static final int PIXELFORMAT_SIZE = 32;
+    static final int DDPF_FOURCC = 0x4;
+    static final int DDPF_ALPHAPREMULT = 0x8000;
+    static final int DX10_HEADER_SIZE = 20;
+    static final int DDS_ALPHA_MODE_PREMULTIPLIED = 2;
+
+    static final int FOURCC_DXT1 = 0x31545844;
+    static final int FOURCC_DXT2 = 0x32545844;
+    static final int FOURCC_DXT3 = 0x33545844;
+    static final int FOURCC_DXT4 = 0x34545844;
+    static final int FOURCC_DXT5 = 0x35545844;
+    static final int FOURCC_DX10 = 0x30315844;
+
+    static final int DXGI_FORMAT_BC1_UNORM = 71;
+    static final int DXGI_FORMAT_BC1_UNORM_SRGB = 72;
+    static final int DXGI_FORMAT_BC2_UNORM = 74;
+    static final int DXGI_FORMAT_BC2_UNORM_SRGB = 75;
+    static final int DXGI_FORMAT_BC3_UNORM = 77;
+    static final int DXGI_FORMAT_BC3_UNORM_SRGB = 78;
+
+    private final InputStream input;
+    private final int width;
+    private final int height;
+    private final Format format;
+    private final boolean premultiplied;
+
+    DDSImageLoader(InputStream input) throws IOException {
+        super(DDSDescriptor.theInstance);
+        this.input = input;
+
+        ByteBuffer header = readBlock(4 + HEADER_SIZE);
+        if (header.getInt() != MAGIC || header.getInt() != HEADER_SIZE) {
+            throw new IOException("Invalid DDS file header");
+        }
+        header.getInt(); // flags
+        height = header.getInt();
+        width = header.getInt();
+        if (width <= 0 || height <= 0 || width >= Integer.MAX_VALUE / height) {
+            throw new IOException("Bad DDS image size!");
+        }
+
+        int pf = 4 + 72;
+        if (header.getInt(pf) != PIXELFORMAT_SIZE) {
+            throw new IOException("Invalid DDS pixel format");
+        }
+        int pfFlags = header.getInt(pf + 4);
+        int fourCC = header.getInt(pf + 8);
+        if ((pfFlags & DDPF_FOURCC) == 0) {
+            throw new IOException("Unsupported DDS image: " +
+                    "only block-compressed images are supported");
+        }
+
+        boolean premult = (pfFlags & DDPF_ALPHAPREMULT) != 0;
+        switch (fourCC) {
+            case FOURCC_DXT1:
+                format = Format.BC1_RGBA;
+                break;
+            case FOURCC_DXT2:
+                premult = true;
+                // fall through
+            case FOURCC_DXT3:
+                format = Format.BC2_RGBA;
+                break;
+            case FOURCC_DXT4:
+                premult = true;
+                // fall through
+            case FOURCC_DXT5:
+                format = Format.BC3_RGBA;
+                break;
+            case FOURCC_DX10:
+                ByteBuffer dx10 = readBlock(DX10_HEADER_SIZE);
+                format = toFormat(dx10.getInt(0));
+                premult = (dx10.getInt(16) & 0x7) == DDS_ALPHA_MODE_PREMULTIPLIED;
+                break;
+            default:
+                throw new IOException("Unsupported DDS compression type");
+        }
+        premultiplied = premult;
+    }
+
+    private static Format toFormat(int dxgiFormat) throws IOException {
+        switch (dxgiFormat) {
+            case DXGI_FORMAT_BC1_UNORM:
+            case DXGI_FORMAT_BC1_UNORM_SRGB:
+                return Format.BC1_RGBA;
+            case DXGI_FORMAT_BC2_UNORM:
+            case DXGI_FORMAT_BC2_UNORM_SRGB:
+                return Format.BC2_RGBA;
+            case DXGI_FORMAT_BC3_UNORM:
+            case DXGI_FORMAT_BC3_UNORM_SRGB:
+                return Format.BC3_RGBA;
+            default:
+                throw new IOException("Unsupported DDS DXGI format: " + dxgiFormat);
+        }
+    }
+
+    private ByteBuffer readBlock(int size) throws IOException {
+        byte[] buf = new byte[size];
+        ImageTools.readFully(input, buf);
+        return ByteBuffer.wrap(buf).order(ByteOrder.LITTLE_ENDIAN);
+    }
+
+    @Override
+    public void dispose() {
+    }
+
+    @Override
+    public ImageFrame load(int imageIndex, double w, double h,
+            boolean preserveAspectRatio, boolean smooth,
+            float screenPixelScale, float imagePixelScale) throws IOException {
+        ImageTools.validateMaxDimensions(w, h, imagePixelScale);
+
+        if (0 != imageIndex) {
+            return null;
+        }
+
+        int[] outWH = ImageTools.computeDimensions(
+            width, height, (int)(w * imagePixelScale), (int)(h * imagePixelScale), preserveAspectRatio);
+        int outWidth = outWH[0];
+        int outHeight = outWH[1];
+        if (outWidth >= (Integer.MAX_VALUE / outHeight / 4)) {
+            throw new IOException("Bad DDS image size!");
+        }
+
+        // Pass image metadata to any listeners.
+        ImageMetadata imageMetadata = new ImageMetadata(null, Boolean.TRUE,
+            null, null, null, null, null, outWidth, outHeight,
+            null, null, null);
+        updateImageMetadata(imageMetadata);
+
+        // Only the first mip level is read; any further levels are ignored.
+        ByteBuffer blocks = readBlock(format.getDataSize(width, height));
+        CompressedImageData data =
+                new CompressedImageData(format, width, height, premultiplied, blocks);
+        return BlockDecoder.decodeFrame(data, outWidth, outHeight, smooth,
+                imagePixelScale, imageMetadata);
+    }
+}
+
+public final class DDSImageLoaderFactory implements ImageLoaderFactory {
+
+    private static final DDSImageLoaderFactory theInstance =
+            new DDSImageLoaderFactory();
+
+    public static ImageLoaderFactory getInstance() {
+        return theInstance;
+    }
+
+    @Override
+    public ImageFormatDescription getFormatDescription() {
+        return DDSDescriptor.theInstance;
+    }
+
+    @Override
+    public ImageLoader createImageLoader(InputStream input) throws IOException {
+        return new DDSImageLoader(input);
+    }
+}
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.iio.ktx;
+
+import com.sun.javafx.iio.*;
+import com.sun.javafx.iio.CompressedImageData.Format;
+import com.sun.javafx.iio.common.*;
+import java.io.*;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+final class KTXDescriptor extends ImageDescriptor {
+
+    static final String formatName = "KTX2";
+    static final String[] extensions = { "ktx2" };
+    static final Signature[] signatures = {
+        new Signature((byte)0xAB, (byte)0x4B, (byte)0x54, (byte)0x58,
+                      (byte)0x20, (byte)0x32, (byte)0x30, (byte)0xBB,
+                      (byte)0x0D, (byte)0x0A, (byte)0x1A, (byte)0x0A)
+    };
+    static final String[] mimeSubtypes = { "ktx2" };
+    static final ImageDescriptor theInstance = new KTXDescriptor();
+
+    private KTXDescriptor() {
+        super(formatName, extensions, signatures, mimeSubtypes);
+    }
+}
+
+/**
+ * Loads the top mip level of a single 2D KTX2 texture holding BC1, BC2,
+ * BC3 or ETC2 blocks without supercompression.
+ */
+final class KTXImageLoader extends ImageLoaderImpl {
+
+    static final int IDENTIFIER_SIZE = 12;
+    static final int HEADER_SIZE = 80;
+    static final int LEVEL_INDEX_ENTRY_SIZE = 24;
+    static final int DFD_FLAGS_OFFSET = 15;
+    static final int KHR_DF_FLAG_ALPHA_PREMULTIPLIED = 0x1;
+
+    static final int VK_FORMAT_BC1_RGBA_UNORM_BLOCK = 133;
+    static final int VK_FORMAT_BC1_RGBA_SRGB_BLOCK = 134;
+    static final int VK_FORMAT_BC2_UNORM_BLOCK = 135;
+    static final int VK_FORMAT_BC2_SRGB_BLOCK = 136;
+    static final int VK_FORMAT_BC3_UNORM_BLOCK = 137;
+    static final int VK_FORMAT_BC3_SRGB_BLOCK = 138;
+    static final int VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK = 147;
+    static final int VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK = 148;
+    static final int VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK = 151;
+    static final int VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK = 152;
+
+    private final InputStream input;
+    private final int width;
+    private final int height;
+    private final Format format;
+    private final boolean premultiplied;
+    private final long levelOffset;
+    private long position;
+
+    KTXImageLoader(InputStream input) throws IOException {
+        super(KTXDescriptor.theInstance);
+        this.input = input;
+
+        ByteBuffer header = readBlock(HEADER_SIZE);
+        if (!KTXDescriptor.signatures[0].matches(header.array())) {
+            throw new IOException("Invalid KTX2 file signature");
+        }
+        format = toFormat(header.getInt(12));
+        width = header.getInt(20);
+        height = header.getInt(24);
+        int depth = header.getInt(28);
+        int layers = header.getInt(32);
+        int faces = header.getInt(36);
+        int levels = Math.max(1, header.getInt(40));
+        int supercompression = header.getInt(44);
+        int dfdOffset = header.getInt(48);
+
+        if (width <= 0 || height <= 0 || width >= Integer.MAX_VALUE / height) {
+            throw new IOException("Bad KTX2 image size!");
+        }
+        if (depth != 0 || layers > 1 || faces != 1) {
+            throw new IOException("Unsupported KTX2 image: " +
+                    "only single 2D textures are supported");
+        }
+        if (supercompression != 0) {
+            throw new IOException("Unsupported KTX2 supercompression scheme");
+        }
+
+        // the first entry of the level index describes the base level
+        ByteBuffer levelIndex = readBlock(levels * LEVEL_INDEX_ENTRY_SIZE);
+        levelOffset = levelIndex.getLong(0);
+        if (levelIndex.getLong(8) < format.getDataSize(width, height)) {
+            throw new IOException("KTX2 level 0 is too short");
+        }
+
+        skipTo(dfdOffset);
+        ByteBuffer dfd = readBlock(DFD_FLAGS_OFFSET + 1);
+        premultiplied = (dfd.get(DFD_FLAGS_OFFSET) & KHR_DF_FLAG_ALPHA_PREMULTIPLIED) != 0;
+    }
+
+    private static Format toFormat(int vkFormat) throws IOException {
+        switch (vkFormat) {
+            case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+                return Format.BC1_RGBA;
+            case VK_FORMAT_BC2_UNORM_BLOCK:
+            case VK_FORMAT_BC2_SRGB_BLOCK:
+                return Format.BC2_RGBA;
+            case VK_FORMAT_BC3_UNORM_BLOCK:
+            case VK_FORMAT_BC3_SRGB_BLOCK:
+                return Format.BC3_RGBA;
+            case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
+            case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:
+                return Format.ETC2_RGB8;
+            case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+            case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
+                return Format.ETC2_RGBA8;
+            default:
+                throw new IOException("Unsupported KTX2 vkFormat: " + vkFormat);
+        }
+    }
+
+    private ByteBuffer readBlock(int size) throws IOException {
+        byte[] buf = new byte[size];
+        ImageTools.readFully(input, buf);
+        position += size;
+        return ByteBuffer.wrap(buf).order(ByteOrder.LITTLE_ENDIAN);
+    }
+
+    private void skipTo(long offset) throws IOException {
+        if (offset < position) {
+            throw new IOException("Unsupported KTX2 data layout");
+        }
+        ImageTools.skipFully(input, offset - position);
+        position = offset;
+    }
+
+    @Override
+    public void dispose() {
+    }
+
+    @Override
+    public ImageFrame load(int imageIndex, double w, double h,
+            boolean preserveAspectRatio, boolean smooth,
+            float screenPixelScale, float imagePixelScale) throws IOException {
+        ImageTools.validateMaxDimensions(w, h, imagePixelScale);
+
+        if (0 != imageIndex) {
+            return null;
+        }
+
+        int[] outWH = ImageTools.computeDimensions(
+            width, height, (int)(w * imagePixelScale), (int)(h * imagePixelScale), preserveAspectRatio);
+        int outWidth = outWH[0];
+        int outHeight = outWH[1];
+        if (outWidth >= (Integer.MAX_VALUE / outHeight / 4)) {
+            throw new IOException("Bad KTX2 image size!");
+        }
+
+        // Pass image metadata to any listeners.
+        ImageMetadata imageMetadata = new ImageMetadata(null, Boolean.TRUE,
+            null, null, null, null, null, outWidth, outHeight,
+            null, null, null);
+        updateImageMetadata(imageMetadata);
+
+        skipTo(levelOffset);
+        ByteBuffer blocks = readBlock(format.getDataSize(width, height));
+        CompressedImageData data =
+                new CompressedImageData(format, width, height, premultiplied, blocks);
+        return BlockDecoder.decodeFrame(data, outWidth, outHeight, smooth,
+                imagePixelScale, imageMetadata);
+    }
+}
+
+public final class KTXImageLoaderFactory implements ImageLoaderFactory {
+
+    private static final KTXImageLoaderFactory theInstance =
+            new KTXImageLoaderFactory();
+
+    public static ImageLoaderFactory getInstance() {
+        return theInstance;
+    }
+
+    @Override
+    public ImageFormatDescription getFormatDescription() {
+        return KTXDescriptor.theInstance;
+    }
+
+    @Override
+    public ImageLoader createImageLoader(InputStream input) throws IOException {
+        return new KTXImageLoader(input);
+    }
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.scene.shape;
+
+import com.sun.javafx.geom.Vec3d;
+
+/**
+ * A bounding volume hierarchy over the faces of a triangle mesh, used to
+ * limit ray picking to the faces whose bounding boxes the ray crosses.
+ * The tree only stores face indices and bounds; the caller still performs
+ * the exact ray-triangle test for each candidate face.
+ */
+public final class TriangleMeshBVH {
+
+    /**
+     * Receives the faces whose bounds are crossed by a ray.
+     */
+    public interface FaceVisitor {
+        /**
+         * @param faceIndex index of the first element of the face in the
+         * faces array
+         * @return true if the ray intersects the face
+         */
+        boolean visit(int faceIndex);
+    }
+
+    private static final int MAX_LEAF_SIZE = 4;
+    private static final int MAX_DEPTH = 64;
+
+    private final int faceElementSize;
+    // Face numbers, reordered so that every node covers a contiguous range
+    private final int[] order;
+    // minX, minY, minZ, maxX, maxY, maxZ for each node
+    private final float[] nodeBounds;
+    // For a leaf, the first entry in order; for an inner node, the index
+    // of its second child (the first child always follows its parent)
+    private final int[] nodeStart;
+    // Number of faces of a leaf, 0 for an inner node
+    private final int[] nodeCount;
+    private int numNodes;
+
+    // Build-time data, released once the tree is built
+    private float[] faceBounds;
+    private float[] centroids;
+
+    private TriangleMeshBVH(int numFaces, int faceElementSize) {
+        this.faceElementSize = faceElementSize;
+        order = new int[numFaces];
+        int maxNodes = Math.max(1, 2 * numFaces - 1);
+        nodeBounds = new float[maxNodes * 6];
+        nodeStart = new int[maxNodes];
+        nodeCount = new int[maxNodes];
+    }
+
+    /**
+     * Builds the tree for a mesh.
+     *
+     * @param points the points of the mesh
+     * @param pointElementSize number of floats per point
+     * @param faces the faces of the mesh
+     * @param vertexIndexSize number of ints per face vertex, the point
+     * index being the first
+     * @return the tree
+     */
+    public static TriangleMeshBVH build(float[] points, int pointElementSize,
+            int[] faces, int vertexIndexSize) {
+        final int faceElementSize = vertexIndexSize * 3;
+        final int numFaces = faces.length / faceElementSize;
+        TriangleMeshBVH bvh = new TriangleMeshBVH(numFaces, faceElementSize);
+        bvh.faceBounds = new float[numFaces * 6];
+        bvh.centroids = new float[numFaces * 3];
+        for (int f = 0; f < numFaces; f++) {
+            int base = f * faceElementSize;
+            float minX = Float.POSITIVE_INFINITY, minY = Float.POSITIVE_INFINITY, minZ = Float.POSITIVE_INFINITY;
+            float maxX = Float.NEGATIVE_INFINITY, maxY = Float.NEGATIVE_INFINITY, maxZ = Float.NEGATIVE_INFINITY;
+            for (int v = 0; v < 3; v++) {
+                int p = faces[base + v * vertexIndexSize] * pointElementSize;
+                float x = points[p], y = points[p + 1], z = points[p + 2];
+                minX = Math.min(minX, x);
+                minY = Math.min(minY, y);
+                minZ = Math.min(minZ, z);
+                maxX = Math.max(maxX, x);
+                maxY = Math.max(maxY, y);
+                maxZ = Math.max(maxZ, z);
+            }
+            int b = f * 6;
+            bvh.faceBounds[b] = minX;
+            bvh.faceBounds[b + 1] = minY;
+            bvh.faceBounds[b + 2] = minZ;
+            bvh.faceBounds[b + 3] = maxX;
+            bvh.faceBounds[b + 4] = maxY;
+            bvh.faceBounds[b + 5] = maxZ;
+            bvh.centroids[f * 3] = (minX + maxX) * 0.5f;
+            bvh.centroids[f * 3 + 1] = (minY + maxY) * 0.5f;
+            bvh.centroids[f * 3 + 2] = (minZ + maxZ) * 0.5f;
+            bvh.order[f] = f;
+        }
+        if (numFaces > 0) {
+            bvh.buildNode(0, numFaces, 0);
+        }
+        bvh.faceBounds = null;
+        bvh.centroids = null;
+        return bvh;
+    }
+
+    private int buildNode(int start, int end, int depth) {
+        final int node = numNodes++;
+        final int b = node * 6;
+        float cMinX = Float.POSITIVE_INFINITY, cMinY = Float.POSITIVE_INFINITY, cMinZ = Float.POSITIVE_INFINITY;
+        float cMaxX = Float.NEGATIVE_INFINITY, cMaxY = Float.NEGATIVE_INFINITY, cMaxZ = Float.NEGATIVE_INFINITY;
+        nodeBounds[b] = nodeBounds[b + 1] = nodeBounds[b + 2] = Float.POSITIVE_INFINITY;
+        nodeBounds[b + 3] = nodeBounds[b + 4] = nodeBounds[b + 5] = Float.NEGATIVE_INFINITY;
+        for (int i = start; i < end; i++) {
+            int f = order[i];
+            int fb = f * 6;
+            for (int k = 0; k < 3; k++) {
+                nodeBounds[b + k] = Math.min(nodeBounds[b + k], faceBounds[fb + k]);
+                nodeBounds[b + 3 + k] = Math.max(nodeBounds[b + 3 + k], faceBounds[fb + 3 + k]);
+            }
+            float cx = centroids[f * 3], cy = centroids[f * 3 + 1], cz = centroids[f * 3 + 2];
+            cMinX = Math.min(cMinX, cx);
+            cMinY = Math.min(cMinY, cy);
+            cMinZ = Math.min(cMinZ, cz);
+            cMaxX = Math.max(cMaxX, cx);
+            cMaxY = Math.max(cMaxY, cy);
+            cMaxZ = Math.max(cMaxZ, cz);
+        }
+
+        final float extentX = cMaxX - cMinX;
+        final float extentY = cMaxY - cMinY;
+        final float extentZ = cMaxZ - cMinZ;
+        final int axis = (extentX >= extentY && extentX >= extentZ) ? 0
+                : (extentY >= extentZ ? 1 : 2);
+        final float extent = axis == 0 ? extentX : (axis == 1 ? extentY : extentZ);
+
+        // Faces whose centroids coincide can't be separated, keep them
+        // in one leaf; the depth limit keeps the traversal stack bounded.
+        if (end - start <= MAX_LEAF_SIZE || !(extent > 0) || depth >= MAX_DEPTH - 2) {
+            nodeStart[node] = start;
+            nodeCount[node] = end - start;
+            return node;
+        }
+
+        final int mid = (start + end) >>> 1;
+        select(start, end - 1, mid, axis);
+        buildNode(start, mid, depth + 1);
+        nodeStart[node] = buildNode(mid, end, depth + 1);
+        nodeCount[node] = 0;
+        return node;
+    }
+
+    /**
+     * Partially orders order[lo..hi] so that the face at position k has
+     * the k-th smallest centroid along the given axis, with smaller ones
+     * before it and larger ones after it.
+     */
+    private void select(int lo, int hi, int k, int axis) {
+        while (hi > lo) {
+            float pivot = centroids[order[(lo + hi) >>> 1] * 3 + axis];
+            int i = lo;
+            int j = hi;
+            while (i <= j) {
+                while (centroids[order[i] * 3 + axis] < pivot) {
+                    i++;
+                }
+                while (centroids[order[j] * 3 + axis] > pivot) {
+                    j--;
+                }
+                if (i <= j) {
+                    int tmp = order[i];
+                    order[i] = order[j];
+                    order[j] = tmp;
+                    i++;
+                    j--;
+                }
+            }
+            if (k <= j) {
+                hi = j;
+            } else if (k >= i) {
+                lo = i;
+            } else {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Visits every face whose bounds are crossed by the ray between the
+     * near and far distances.
+     *
+     * @param origin origin of the ray
+     * @param dir direction of the ray, distances are multiples of it
+     * @param near near distance
+     * @param far far distance
+     * @param visitor receives the candidate faces
+     * @return true if the visitor returned true for any face
+     */
+    public boolean intersects(Vec3d origin, Vec3d dir, double near, double far,
+            FaceVisitor visitor) {
+        if (numNodes == 0) {
+            return false;
+        }
+        final double invX = 1.0 / dir.x;
+        final double invY = 1.0 / dir.y;
+        final double invZ = 1.0 / dir.z;
+
+        boolean found = false;
+        final int[] stack = new int[MAX_DEPTH];
+        int sp = 0;
+        stack[sp++] = 0;
+        while (sp > 0) {
+            final int node = stack[--sp];
+            if (!hitsNode(node, origin, dir, invX, invY, invZ, near, far)) {
+                continue;
+            }
+            final int count = nodeCount[node];
+            if (count > 0) {
+                final int start = nodeStart[node];
+                for (int i = start; i < start + count; i++) {
+                    if (visitor.visit(order[i] * faceElementSize)) {
+                        found = true;
+                    }
+                }
+            } else {
+                stack[sp++] = nodeStart[node];
+                stack[sp++] = node + 1;
+            }
+        }
+        return found;
+    }
+
+    private boolean hitsNode(int node, Vec3d o, Vec3d d,
+            double invX, double invY, double invZ, double near, double far) {
+        final int b = node * 6;
+        double tMin = near;
+        double tMax = far;
+
+        if (d.x == 0.0) {
+            if (o.x < nodeBounds[b] || o.x > nodeBounds[b + 3]) {
+                return false;
+            }
+        } else {
+            double t1 = (nodeBounds[b] - o.x) * invX;
+            double t2 = (nodeBounds[b + 3] - o.x) * invX;
+            tMin = Math.max(tMin, Math.min(t1, t2));
+            tMax = Math.min(tMax, Math.max(t1, t2));
+        }
+
+        if (d.y == 0.0) {
+            if (o.y < nodeBounds[b + 1] || o.y > nodeBounds[b + 4]) {
+                return false;
+            }
+        } else {
+            double t1 = (nodeBounds[b + 1] - o.y) * invY;
+            double t2 = (nodeBounds[b + 4] - o.y) * invY;
+            tMin = Math.max(tMin, Math.min(t1, t2));
+            tMax = Math.min(tMax, Math.max(t1, t2));
+        }
+
+        if (d.z == 0.0) {
+            if (o.z < nodeBounds[b + 2] || o.z > nodeBounds[b + 5]) {
+                return false;
+            }
+        } else {
+            double t1 = (nodeBounds[b + 2] - o.z) * invZ;
+            double t2 = (nodeBounds[b + 5] - o.z) * invZ;
+            tMin = Math.max(tMin, Math.min(t1, t2));
+            tMax = Math.min(tMax, Math.max(t1, t2));
+        }
+
+        return tMin <= tMax;
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,17 +26,43 @@
 package com.sun.javafx.sg.prism;
 
 import com.sun.javafx.geom.BaseBounds;
+import com.sun.javafx.geom.Rectangle;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.prism.Graphics;
+import com.sun.prism.impl.PrismSettings;
 import com.sun.scenario.effect.Effect;
+import com.sun.scenario.effect.ImageData;
 import com.sun.scenario.effect.impl.prism.PrEffectHelper;
+import java.util.LinkedHashMap;
 
 /**
  */
 public class EffectFilter {
+    // The result of the effect is kept once the node has been rendered this
+    // many times in a row, with the same transform and without becoming
+    // dirty, so that animated nodes never pay for it.
+    private static final int CACHE_AFTER_STABLE_RENDERS = 2;
+
+    // All filters holding a cached result, least recently rendered first,
+    // and the number of 32-bit pixels they hold. Results of nodes that are
+    // no longer rendered end up at the head and are evicted first once the
+    // budget is exceeded. Only accessed on the render thread.
+    private static final LinkedHashMap<EffectFilter, Long> cachedFilters =
+            new LinkedHashMap<>(16, 0.75f, true);
+    private static long cachedPixels;
+
     private Effect effect;
     private NodeEffectInput nodeInput;
 
+    private int stableRenders;
+    private boolean cacheRejected;
+    // Cleared on the FX thread during sync, the cached result itself is only
+    // released on the render thread.
+    private volatile boolean cacheValid;
+    private BaseTransform lastTransform;
+    private ImageData cachedResult;
+    private final Rectangle cachedCoverage = new Rectangle();
+
     EffectFilter(Effect effect, NGNode node) {
         this.effect = effect;
         this.nodeInput = new NodeEffectInput(node);
@@ -46,11 +72,41 @@ public class EffectFilter {
     NodeEffectInput getNodeInput() { return nodeInput; }
 
     void dispose() {
+        invalidate();
         effect = null;
         nodeInput.setNode(null);
         nodeInput = null;
     }
 
+    /**
+     * Marks the cached result as stale, called whenever the node or any of
+     * its children changes.
+     */
+    void invalidate() {
+        stableRenders = 0;
+        cacheRejected = false;
+        cacheValid = false;
+    }
+
+    private void releaseCachedResult() {
+        if (cachedResult != null) {
+            cachedResult.unref();
+            cachedResult = null;
+            cachedPixels -= cachedFilters.remove(this);
+        }
+    }
+
+    private boolean reserveCachedPixels(long pixels) {
+        long budget = PrismSettings.effectCacheSize / 4;
+        if (pixels > budget) {
+            return false;
+        }
+        while (cachedPixels + pixels > budget) {
+            cachedFilters.keySet().iterator().next().releaseCachedResult();
+        }
+        return true;
+    }
+
     BaseBounds getBounds(BaseBounds bounds, BaseTransform xform) {
         BaseBounds r = getEffect().getBounds(xform, nodeInput);
         return bounds.deriveWithNewBounds(r);
@@ -58,6 +114,44 @@ public class EffectFilter {
 
     void render(Graphics g) {
         NodeEffectInput nodeInput = getNodeInput();
+        BaseTransform tx = g.getTransformNoClone();
+        if (lastTransform == null || !lastTransform.equals(tx)) {
+            lastTransform = tx.copy();
+            stableRenders = 0;
+            cacheValid = false;
+        }
+        if (cachedResult != null) {
+            if (cacheValid && PrEffectHelper.renderCached(cachedResult, g, cachedCoverage)) {
+                cachedFilters.get(this);
+                return;
+            }
+            releaseCachedResult();
+        }
+        if (PrismSettings.effectCacheSize > 0 && !cacheRejected &&
+            ++stableRenders >= CACHE_AFTER_STABLE_RENDERS)
+        {
+            ImageData res = PrEffectHelper.filterForCache(getEffect(), g, nodeInput, cachedCoverage);
+            nodeInput.flush();
+            // Whatever happens, only try again once the node has changed
+            cacheRejected = true;
+            if (res != null) {
+                boolean rendered = PrEffectHelper.renderCached(res, g, cachedCoverage);
+                Rectangle r = res.getUntransformedBounds();
+                long pixels = (long) r.width * r.height;
+                if (rendered && reserveCachedPixels(pixels)) {
+                    cachedResult = res;
+                    cacheValid = true;
+                    cacheRejected = false;
+                    cachedFilters.put(this, pixels);
+                    cachedPixels += pixels;
+                    return;
+                }
+                res.unref();
+                if (rendered) {
+                    return;
+                }
+            }
+        }
         PrEffectHelper.render(getEffect(), g, 0, 0, nodeInput);
         nodeInput.flush();
     }
@@ -26,6 +26,7 @@
 package com.sun.javafx.sg.prism;
 
 import com.sun.javafx.geom.RectBounds;
+import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.prism.Graphics;
 import com.sun.prism.Image;
 import com.sun.prism.ResourceFactory;
@@ -34,6 +35,7 @@ import com.sun.prism.image.CachingCompoundImage;
 import com.sun.prism.image.CompoundCoords;
 import com.sun.prism.image.Coords;
 import com.sun.prism.image.ViewPort;
+import com.sun.prism.impl.PrismSettings;
 
 /**
  */
@@ -104,6 +106,29 @@ public class NGImageView extends NGNode {
         }
     }
 
+    // Images are sampled from a mipmapped texture when they are drawn at
+    // less than this fraction of their size in both directions, since
+    // bilinear filtering alone skips source pixels and aliases.
+    final static float MIPMAP_THRESHOLD = 0.5f;
+
+    private boolean useMipmap(Graphics g, ResourceFactory factory) {
+        if (!PrismSettings.imageMipmaps || !factory.isMipmapSupported()) {
+            return false;
+        }
+        float srcW, srcH;
+        if (imgviewport != null) {
+            srcW = imgviewport.u1 - imgviewport.u0;
+            srcH = imgviewport.v1 - imgviewport.v0;
+        } else {
+            srcW = image.getWidth();
+            srcH = image.getHeight();
+        }
+        BaseTransform tx = g.getTransformNoClone();
+        double dstW = w * Math.hypot(tx.getMxx(), tx.getMyx());
+        double dstH = h * Math.hypot(tx.getMxy(), tx.getMyy());
+        return dstW < srcW * MIPMAP_THRESHOLD && dstH < srcH * MIPMAP_THRESHOLD;
+    }
+
     // method for testing reasons
     final static int MAX_SIZE_OVERRIDE = 0; // 64
     private int maxSizeWrapper(ResourceFactory factory) {
@@ -118,7 +143,8 @@ public class NGImageView extends NGNode {
         ResourceFactory factory = g.getResourceFactory();
         int maxSize = maxSizeWrapper(factory);
         if (imgW <= maxSize && imgH <= maxSize) {
-            Texture texture = factory.getCachedTexture(image, Texture.WrapMode.CLAMP_TO_EDGE);
+            Texture texture = factory.getCachedTexture(image, Texture.WrapMode.CLAMP_TO_EDGE,
+                                                       useMipmap(g, factory));
             if (coords == null) {
                 g.drawTexture(texture, x, y, x + w, y + h, 0, 0, imgW, imgH);
             } else {
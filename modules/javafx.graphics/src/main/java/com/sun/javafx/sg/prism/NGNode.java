@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,7 @@ import com.sun.javafx.geom.transform.NoninvertibleTransformException;
 import com.sun.prism.CompositeMode;
 import com.sun.prism.Graphics;
 import com.sun.prism.GraphicsPipeline;
+import com.sun.prism.PrinterGraphics;
 import com.sun.prism.RTTexture;
 import com.sun.prism.ReadbackGraphics;
 import com.sun.prism.impl.PrismSettings;
@@ -934,15 +935,18 @@ public abstract class NGNode {
     }
 
     /**
-     * Invalidates the cache, if it is in use. There are several operations
-     * which need to cause the cached raster to become invalid so that a
-     * subsequent render operation will result in the cached image being
-     * reconstructed.
+     * Invalidates the cache, if it is in use, and any cached effect result.
+     * There are several operations which need to cause the cached raster to
+     * become invalid so that a subsequent render operation will result in the
+     * cached image being reconstructed.
      */
     protected final void invalidateCache() {
         if (cacheFilter != null) {
             cacheFilter.invalidate();
         }
+        if (effectFilter != null) {
+            effectFilter.invalidate();
+        }
     }
 
     /**
@@ -953,6 +957,9 @@ public abstract class NGNode {
         if (cacheFilter != null) {
             cacheFilter.invalidateByTranslation(hint.translateXDelta, hint.translateYDelta);
         }
+        if (effectFilter != null) {
+            effectFilter.invalidate();
+        }
     }
 
     /***************************************************************************
@@ -2215,6 +2222,20 @@ public abstract class NGNode {
             }
         }
 
+        if (g instanceof PrinterGraphics && curXform.is2D() &&
+                getClipNode() instanceof NGShape && ((NGShape) getClipNode()).isShapeClip())
+        {
+            // When printing, clip to the shape outline so that the content
+            // stays vector instead of being composited from raster masks
+            NGShape shapeNode = (NGShape) getClipNode();
+            BaseTransform clipXform = curXform.copy().deriveWithConcatenation(shapeNode.getTransform());
+            PrinterGraphics pg = (PrinterGraphics) g;
+            pg.pushClipShape(clipXform.createTransformedShape(shapeNode.getShape()));
+            renderRectClip(g, clipRect);
+            pg.popClipShape();
+            return;
+        }
+
         if (!curXform.is2D()) {
             Rectangle savedClip = g.getClipRect();
             g.setClipRect(clipRect);
@@ -2339,7 +2360,7 @@ public abstract class NGNode {
         // The third check is for the printing case, which doesn't use cached
         // bitmaps for the screen and for which there is no cacheFilter.
         if (isContentBounds2D() && g.getTransformNoClone().is2D() &&
-                !(g instanceof com.sun.prism.PrinterGraphics)) {
+                !(g instanceof PrinterGraphics)) {
             getCacheFilter().render(g);
         } else {
             renderContent(g);
@@ -325,6 +325,16 @@ public abstract class NGShape extends NGNode {
         }
     }
 
+    /**
+     * Returns whether using this node as a clip is equivalent to clipping to
+     * its fill geometry, so that printing can apply it as a vector clip.
+     */
+    final boolean isShapeClip() {
+        return mode == Mode.FILL && fillPaint != null && fillPaint.isOpaque() &&
+                getOpacity() == 1f && getEffect() == null && getClipNode() == null &&
+                getNodeBlendMode() == null && getTransform().is2D();
+    }
+
     @Override
     protected boolean hasOpaqueRegion() {
         final Mode mode = getMode();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,11 +27,15 @@ package com.sun.javafx.sg.prism;
 
 import com.sun.javafx.geom.Vec3d;
 import com.sun.javafx.geom.transform.Affine3D;
+import com.sun.javafx.geom.transform.GeneralTransform3D;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.javafx.util.Utils;
 import com.sun.prism.Graphics;
 import com.sun.prism.Material;
 import com.sun.prism.MeshView;
+import com.sun.prism.RenderTarget;
 import com.sun.prism.ResourceFactory;
+import com.sun.prism.impl.PrismSettings;
 
 import javafx.application.ConditionalFeature;
 import javafx.application.Platform;
@@ -96,6 +100,13 @@ public abstract class NGShape3D extends NGNode {
             return;
         }
 
+        if (PrismSettings.frustumCulling3D && isOutsideViewFrustum(g)) {
+            if (PulseLogger.PULSE_LOGGING_ENABLED) {
+                PulseLogger.incrementCounter("Shape3D culled by view frustum");
+            }
+            return;
+        }
+
         Material mtl =  material.createMaterial(rf);
         if (materialDirty) {
             meshView.setMaterial(mtl);
@@ -121,6 +132,58 @@ public abstract class NGShape3D extends NGNode {
         meshView.render(g);
     }
 
+    // Scratch state of the view frustum test, only used on the render thread
+    private static final GeneralTransform3D TEMP_PROJ_VIEW_TX = new GeneralTransform3D();
+    private static final double[] TEMP_MATRIX = new double[16];
+
+    /*
+     * Returns true if the content bounds of this shape are entirely on the
+     * outer side of one of the left, right, bottom or top planes of the view
+     * frustum, so that submitting the mesh could not produce any fragment.
+     * The corners of the bounds are tested in homogeneous clip space, which
+     * keeps the test conservative for corners behind the camera. The near
+     * and far planes are left to the depth range of the pipeline.
+     */
+    private boolean isOutsideViewFrustum(Graphics g) {
+        NGCamera camera = g.getCameraNoClone();
+        if (camera == null || contentBounds.isEmpty()) {
+            return false;
+        }
+        GeneralTransform3D tx = camera.getProjViewTx(TEMP_PROJ_VIEW_TX);
+        if (!(camera instanceof NGDefaultCamera)) {
+            // The viewport adjustment the contexts make in updateRenderTarget.
+            // The physical size is never smaller than the content size, so
+            // the test errs on the side of rendering with either pipeline.
+            RenderTarget target = g.getRenderTarget();
+            double w = target.getPhysicalWidth();
+            double h = target.getPhysicalHeight();
+            double vw = camera.getViewWidth();
+            double vh = camera.getViewHeight();
+            if (w != vw || h != vh) {
+                tx.scale(vw / w, vh / h, 1.0);
+            }
+        }
+        tx.mul(g.getTransformNoClone());
+        double[] m = tx.get(TEMP_MATRIX);
+
+        int outside = 0xF;
+        for (int i = 0; i < 8 && outside != 0; i++) {
+            double x = (i & 1) == 0 ? contentBounds.getMinX() : contentBounds.getMaxX();
+            double y = (i & 2) == 0 ? contentBounds.getMinY() : contentBounds.getMaxY();
+            double z = (i & 4) == 0 ? contentBounds.getMinZ() : contentBounds.getMaxZ();
+            double cx = m[0] * x + m[1] * y + m[2] * z + m[3];
+            double cy = m[4] * x + m[5] * y + m[6] * z + m[7];
+            double cw = m[12] * x + m[13] * y + m[14] * z + m[15];
+            int code = 0;
+            if (cx < -cw) code |= 0x1;
+            if (cx > cw) code |= 0x2;
+            if (cy < -cw) code |= 0x4;
+            if (cy > cw) code |= 0x8;
+            outside &= code;
+        }
+        return outside != 0;
+    }
+
     private void setupLights(Graphics g) {
         int lightIndex = 0;
         NGLightBase[] lights = g.getLights();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -153,6 +153,47 @@ public class NGText extends NGShape {
         return fontStrike;
     }
 
+    /*
+     * Every new scale of the text transform creates a new strike, and with
+     * it new glyph images in the glyph cache.  While the text is being
+     * zoomed or its scale is animated, that happens on every frame and the
+     * images are never reused.  After SCALE_CHANGE_RENDERS renders, each
+     * with a new scale, the glyphs are filled as outlines of the identity
+     * strike, which are shared by all scales, until the scale settles.
+     */
+    private static final int SCALE_CHANGE_RENDERS = 3;
+    private double[] renderMat = new double[4];
+    private int scaleChanges;
+
+    private boolean isScaleChanging(BaseTransform xform) {
+        if (xform.isTranslateOrIdentity()) {
+            scaleChanges = 0;
+        } else if ((Math.abs(renderMat[0] - xform.getMxx()) > EPSILON) ||
+                   (Math.abs(renderMat[1] - xform.getMxy()) > EPSILON) ||
+                   (Math.abs(renderMat[2] - xform.getMyx()) > EPSILON) ||
+                   (Math.abs(renderMat[3] - xform.getMyy()) > EPSILON)) {
+            scaleChanges++;
+        } else {
+            scaleChanges = 0;
+        }
+        renderMat[0] = xform.getMxx();
+        renderMat[1] = xform.getMxy();
+        renderMat[2] = xform.getMyx();
+        renderMat[3] = xform.getMyy();
+        return scaleChanges >= SCALE_CHANGE_RENDERS;
+    }
+
+    private boolean hasColorGlyphs(FontStrike strike) {
+        FontResource res = strike.getFontResource();
+        for (int i = 0; i < runs.length; i++) {
+            TextRun run = (TextRun)runs[i];
+            if (run.getGlyphCount() > 0 && res.isColorGlyph(run.getGlyphCode(0))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     @Override public Shape getShape() {
         if (runs == null) {
             return new Path2D();
@@ -233,7 +274,14 @@ public class NGText extends NGShape {
         if (runs == null || runs.length == 0) return;
 
         BaseTransform tx = g.getTransformNoClone();
-        FontStrike strike = getStrike(tx);
+        boolean fillOutlines = false;
+        if (isScaleChanging(tx) && mode != Mode.STROKE &&
+            selectionStart == selectionEnd)
+        {
+            FontStrike identity = getStrike(IDENT);
+            fillOutlines = !identity.drawAsShapes() && !hasColorGlyphs(identity);
+        }
+        FontStrike strike = fillOutlines ? getStrike(IDENT) : getStrike(tx);
 
         if (strike.getAAMode() == FontResource.AA_LCD ||
                 (fillPaint != null && fillPaint.isProportional()) ||
@@ -266,7 +314,8 @@ public class NGText extends NGShape {
         if (mode != Mode.STROKE) {
             g.setPaint(fillPaint);
             int op = TEXT;
-            op |= strike.drawAsShapes() || drawingEffect ? SHAPE_FILL : FILL;
+            op |= strike.drawAsShapes() || drawingEffect || fillOutlines ?
+                  SHAPE_FILL : FILL;
             renderText(g, strike, clipBds, selectionColor, op);
 
             // Splitting decoration from text rendering is important in order
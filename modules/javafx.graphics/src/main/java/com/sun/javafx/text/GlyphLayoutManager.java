@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -55,9 +55,12 @@ public class GlyphLayoutManager {
         }
     }
 
-    public static void dispose(GlyphLayout la) {
+    /* Returns true if the layout is kept for reuse, false if it is discarded */
+    public static boolean dispose(GlyphLayout la) {
         if (la == REUSABLE_INSTANCE) {
             IN_USE.set(false);
+            return true;
         }
+        return false;
     }
 }
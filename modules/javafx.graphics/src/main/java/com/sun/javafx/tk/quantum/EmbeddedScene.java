@@ -244,13 +244,9 @@ final class EmbeddedScene extends GlassScene implements EmbeddedSceneInterface {
 
                 // Copy the intersection to the dest.
                 // The backed array of the textureBits may not be available,
-                // so not relying on it.
-                int[] linebuf = new int[w];
+                // so not relying on it, but copy buffer to buffer line by line.
                 for (int i = 0; i < h; i++) {
-                    texBits.position(i * texLineStride);
-                    texBits.get(linebuf, 0, w);
-                    dest.position(i * scaledWidth);
-                    dest.put(linebuf);
+                    dest.put(i * scaledWidth, texBits, i * texLineStride, w);
                 }
                 return true;
             }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -201,9 +201,16 @@ class GlassViewEventHandler extends View.EventHandler {
         keyNotification.modifiers = modifiers;
 
         boolean consumed = QuantumToolkit.runWithoutRenderLock(keyNotification);
+        inputHint();
         return consumed;
     }
 
+    private static void inputHint() {
+        if (QuantumToolkit.inputPulse) {
+            ((QuantumToolkit) QuantumToolkit.getToolkit()).inputHint();
+        }
+    }
+
     private static EventType<javafx.scene.input.MouseEvent> mouseEventType(int glassType) {
         switch (glassType) {
             case com.sun.glass.events.MouseEvent.DOWN:
@@ -384,6 +391,7 @@ class GlassViewEventHandler extends View.EventHandler {
         mouseNotification.isSynthesized = isSynthesized;
 
         QuantumToolkit.runWithoutRenderLock(mouseNotification);
+        inputHint();
     }
 
     @Override public void handleMenuEvent(final View view,
@@ -483,6 +491,7 @@ class GlassViewEventHandler extends View.EventHandler {
                 PulseLogger.newInput(null);
             }
         }
+        inputHint();
     }
 
     private static byte inputMethodEventAttrValue(int pos, int[] attrBoundary, byte[] attrValue) {
@@ -1237,6 +1246,7 @@ class GlassViewEventHandler extends View.EventHandler {
         }
 
         gestures.notifyEndTouchEvent(time);
+        inputHint();
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,8 +39,9 @@ import com.sun.javafx.runtime.async.AsyncOperationListener;
 import com.sun.javafx.tk.PlatformImage;
 import com.sun.prism.Image;
 import com.sun.prism.impl.PrismSettings;
+import java.util.concurrent.CancellationException;
 import java.util.concurrent.ExecutorService;
-import java.util.concurrent.Executors;
+import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
 import java.util.concurrent.TimeUnit;
@@ -68,7 +69,14 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
     public PrismImageLoader2(InputStream stream, double width, double height,
                              boolean preserveRatio, boolean smooth)
     {
-        loadAll(stream, width, height, preserveRatio, smooth);
+        this(stream, width, height, preserveRatio, smooth, false);
+    }
+
+    private PrismImageLoader2(InputStream stream, double width, double height,
+                              boolean preserveRatio, boolean smooth,
+                              boolean interruptible)
+    {
+        loadAll(stream, width, height, preserveRatio, smooth, interruptible);
     }
 
     @Override
@@ -122,7 +130,7 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
                          boolean preserveRatio, float pixelScale,
                          boolean smooth)
     {
-        ImageLoadListener listener = new PrismLoadListener();
+        ImageLoadListener listener = new PrismLoadListener(false);
         try {
             ImageFrame[] imgFrames =
                 ImageStorage.getInstance().loadAll(url, listener, w, h, preserveRatio, pixelScale, smooth);
@@ -135,9 +143,10 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
     }
 
     private void loadAll(InputStream stream, double w, double h,
-                         boolean preserveRatio, boolean smooth)
+                         boolean preserveRatio, boolean smooth,
+                         boolean interruptible)
     {
-        ImageLoadListener listener = new PrismLoadListener();
+        ImageLoadListener listener = new PrismLoadListener(interruptible);
         try {
             ImageFrame[] imgFrames =
                 ImageStorage.getInstance().loadAll(stream, listener, w, h, preserveRatio, 1.0f, smooth);
@@ -203,6 +212,12 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
     }
 
     private class PrismLoadListener implements ImageLoadListener {
+        private final boolean interruptible;
+
+        PrismLoadListener(boolean interruptible) {
+            this.interruptible = interruptible;
+        }
+
         @Override
         public void imageLoadWarning(ImageLoader loader, String message) {
             getImageioLogger().warning(message);
@@ -212,6 +227,12 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
         public void imageLoadProgress(ImageLoader loader,
                                       float percentageComplete)
         {
+            // A background load is interrupted when its Image is cancelled;
+            // stop decoding at the next progress update instead of finishing
+            // an image nobody will use.
+            if (interruptible && Thread.currentThread().isInterrupted()) {
+                throw new CancellationException("Image loading cancelled");
+            }
             // progress only matters when backgroundLoading=true, but
             // currently we are relying on AbstractRemoteResource for tracking
             // progress of the InputStream, so there's no need to implement
@@ -229,6 +250,11 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
     static final class AsyncImageLoader
         extends AbstractRemoteResource<PrismImageLoader2>
     {
+        // Number of images decoded at the same time, by default one per core
+        private static final int BG_LOADING_THREADS = Math.max(1,
+                Integer.getInteger("javafx.image.backgroundLoadingThreads",
+                        Math.max(2, Runtime.getRuntime().availableProcessors())));
+
         private static final ExecutorService BG_LOADING_EXECUTOR =
                 createExecutor();
 
@@ -250,7 +276,7 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
 
         @Override
         protected PrismImageLoader2 processStream(InputStream stream) throws IOException {
-            return new PrismImageLoader2(stream, width, height, preserveRatio, smooth);
+            return new PrismImageLoader2(stream, width, height, preserveRatio, smooth, true);
         }
 
         @Override
@@ -279,10 +305,14 @@ class PrismImageLoader2 implements com.sun.javafx.tk.ImageLoader {
                 return newThread;
             };
 
-            final ExecutorService bgLoadingExecutor =
-                    Executors.newCachedThreadPool(bgLoadingThreadFactory);
-            ((ThreadPoolExecutor) bgLoadingExecutor).setKeepAliveTime(
-                                                         1, TimeUnit.SECONDS);
+            // Bounded, so that bulk loading queues up instead of decoding
+            // every image at once and holding all their buffers in memory.
+            final ThreadPoolExecutor bgLoadingExecutor =
+                    new ThreadPoolExecutor(BG_LOADING_THREADS, BG_LOADING_THREADS,
+                                           1, TimeUnit.SECONDS,
+                                           new LinkedBlockingQueue<>(),
+                                           bgLoadingThreadFactory);
+            bgLoadingExecutor.allowCoreThreadTimeOut(true);
 
             return bgLoadingExecutor;
         }
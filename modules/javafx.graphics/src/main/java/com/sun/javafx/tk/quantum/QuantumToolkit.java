@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -153,6 +153,15 @@ public final class QuantumToolkit extends Toolkit {
 
     private static Integer pulseHZ = Integer.getInteger("javafx.animation.pulse");
 
+    /*
+     * With -Dquantum.inputPulse=true, an input event that changes the scene
+     * runs a pulse right after the event is handled instead of waiting for
+     * the pulse timer, removing up to a frame of latency between the input
+     * and its rendering. Use together with -Dprism.vsync=false so that the
+     * frame is also presented without waiting for the vertical blank.
+     */
+    static final boolean inputPulse = Boolean.getBoolean("quantum.inputPulse");
+
     static final boolean liveResize = ((Supplier<Boolean>) () -> {
         boolean isSWT = "swt".equals(System.getProperty("glass.platform"));
         String result = (PlatformUtil.isMac() || PlatformUtil.isWindows()) && !isSWT ? "true" : "false";
@@ -608,6 +617,15 @@ public final class QuantumToolkit extends Toolkit {
         }
     }
 
+    void inputHint() {
+        if (nextPulseRequested.get() || animationRunning.get()) {
+            if (debug) {
+                System.err.println("QT.inputHint: postPulse: " + System.nanoTime());
+            }
+            postPulse();
+        }
+    }
+
     @Override public TKStage createTKStage(Window peerWindow, StageStyle stageStyle, boolean primary, Modality modality, TKStage owner, boolean rtl) {
         assertToolkitRunning();
         WindowStage stage = new WindowStage(peerWindow, stageStyle, modality, owner);
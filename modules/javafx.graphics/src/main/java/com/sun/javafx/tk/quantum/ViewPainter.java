@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -99,6 +99,10 @@ abstract class ViewPainter implements Runnable {
     // and if dirty opts are turned off via a runtime flag, then these fields
     // are never initialized or used.
     private Rectangle dirtyRect;
+    // Union of the dirty rectangles painted by the last paintImpl;
+    // paintedRegion is null whenever the whole scene was painted
+    private Rectangle paintedRect;
+    private Rectangle paintedRegion;
     private RectBounds clip;
     private RectBounds dirtyRegionTemp;
     private DirtyRegionPool dirtyRegionPool;
@@ -136,6 +140,7 @@ abstract class ViewPainter implements Runnable {
             scaleTx = new Affine3D();
             clip = new RectBounds();
             dirtyRect = new Rectangle();
+            paintedRect = new Rectangle();
             dirtyRegionTemp = new RectBounds();
             dirtyRegionPool = new DirtyRegionPool(PrismSettings.dirtyRegionCount);
             dirtyRegionContainer = dirtyRegionPool.checkOut();
@@ -162,7 +167,17 @@ abstract class ViewPainter implements Runnable {
         }
     }
 
+    /**
+     * Returns the part of the back buffer painted by the last paintImpl, in
+     * pixels, or null if the whole scene was painted.
+     */
+    protected final Rectangle getPaintedRegion() {
+        return paintedRegion;
+    }
+
     protected void paintImpl(final Graphics backBufferGraphics) {
+        paintedRegion = null;
+
         // We should not be painting anything with a width / height
         // that is <= 0, so we might as well bail right off.
         if (width <= 0 || height <= 0 || backBufferGraphics == null) {
@@ -320,6 +335,12 @@ abstract class ViewPainter implements Runnable {
                     g.setClipRectIndex(i);
                     doPaint(g, getRootPath(i));
                     getRootPath(i).clear();
+                    if (paintedRegion == null) {
+                        paintedRect.setBounds(dirtyRect);
+                        paintedRegion = paintedRect;
+                    } else {
+                        paintedRect.add(dirtyRect);
+                    }
                 }
             }
         } else {
@@ -341,6 +362,8 @@ abstract class ViewPainter implements Runnable {
         // we will first blit the sceneBuffer into the back buffer, and then draw directly
         // on the back buffer.
         if (showDirtyOpts) {
+            // The dirty region overlay covers the whole scene
+            paintedRegion = null;
             if (sceneBuffer != null) {
                 g.sync();
                 backBufferGraphics.clear();
@@ -39,6 +39,7 @@ import java.nio.ByteBuffer;
 import java.nio.FloatBuffer;
 import java.nio.IntBuffer;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.iio.CompressedImageData;
 import com.sun.javafx.iio.ImageFrame;
 import com.sun.javafx.iio.ImageStorage;
 import com.sun.javafx.image.BytePixelGetter;
@@ -85,6 +86,7 @@ public class Image implements PlatformImage {
     private final PixelFormat pixelFormat;
     private final float pixelScale;
     private Serial serial = new Serial();
+    private CompressedImageData compressedData;
 
     public static Image fromIntArgbPreData(int[] pixels, int width, int height) {
         return new Image(PixelFormat.INT_ARGB_PRE, pixels, width, height);
@@ -228,7 +230,7 @@ public class Image implements PlatformImage {
 
         // GRAY, RGB, BGRA_PRE, and INT_ARGB_PRE are directly supported by Prism.
         // We'll need to convert all other formats that we might encounter to one of the supported formats.
-        return switch (type) {
+        Image image = switch (type) {
             case GRAY -> fromByteGrayData((ByteBuffer)frame.getImageData(), w, h, stride, ps);
             case RGB -> fromByteRgbData((ByteBuffer)frame.getImageData(), w, h, stride, ps);
             case BGRA_PRE -> fromByteBgraPreData((ByteBuffer)frame.getImageData(), w, h, stride, ps);
@@ -359,6 +361,8 @@ public class Image implements PlatformImage {
             case PALETTE_TRANS ->
                 throw new RuntimeException("Unsupported image type: " + type);
         };
+        image.compressedData = frame.getCompressedData();
+        return image;
     }
 
     private Image(PixelFormat pixelFormat, int[] pixels,
@@ -687,11 +691,22 @@ public class Image implements PlatformImage {
         return serial;
     }
 
+    /**
+     * Returns the GPU block-compressed form of this image's pixels, if it
+     * was loaded from a block-compressed file and has not been modified
+     * since, or null otherwise.
+     */
+    public CompressedImageData getCompressedData() {
+        return compressedData;
+    }
+
     private void updateSerial() {
         updateSerial(null);
     }
 
     private void updateSerial(Rectangle rect) {
+        // the compressed form no longer matches the pixels
+        compressedData = null;
         serial.update(rect);
     }
 
@@ -25,6 +25,8 @@
 
 package com.sun.prism;
 
+import com.sun.javafx.geom.Shape;
+
 /**
  * A tagging interface to be implemented by any Graphics that
  * supports printing.
@@ -41,4 +43,22 @@ package com.sun.prism;
  * lookup, nor store in a cache.
  */
 public interface PrinterGraphics {
+
+    /**
+     * Intersects the clip with the given shape, which is specified in
+     * device space, until the matching {@link #popClipShape()}.
+     * This lets printing apply a shape clip as vector geometry instead
+     * of compositing the clipped content from rasterized masks.
+     * The shape clip survives subsequent calls to
+     * {@link Graphics#setClipRect(com.sun.javafx.geom.Rectangle)}.
+     *
+     * @param devShape the clip shape in device space
+     */
+    public void pushClipShape(Shape devShape);
+
+    /**
+     * Restores the shape clip in effect before the last call to
+     * {@link #pushClipShape(Shape)}.
+     */
+    public void popClipShape();
 }
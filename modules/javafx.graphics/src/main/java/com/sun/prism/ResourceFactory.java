@@ -25,6 +25,7 @@
 
 package com.sun.prism;
 
+import com.sun.javafx.iio.CompressedImageData;
 import com.sun.prism.Texture.WrapMode;
 import com.sun.prism.impl.TextureResourcePool;
 import com.sun.prism.shape.ShapeRep;
@@ -226,6 +227,41 @@ public interface ResourceFactory extends GraphicsResource {
      */
     public boolean isWrapModeSupported(WrapMode mode);
 
+    /**
+     * Returns true if this factory generates the mip chain of textures
+     * created with {@code useMipmap} and samples them trilinearly.
+     * Otherwise such textures are created without mipmaps.
+     *
+     * @return true if mipmapped textures are supported
+     */
+    public default boolean isMipmapSupported() {
+        return false;
+    }
+
+    /**
+     * Returns true if textures can be created directly from block-compressed
+     * data in the given format. Pipelines that cannot sample compressed
+     * textures use the decoded pixels of the {@code Image} instead.
+     *
+     * @param format the block-compressed format to test
+     * @return true if {@link #createCompressedTexture} supports the format
+     */
+    public default boolean isCompressedFormatSupported(CompressedImageData.Format format) {
+        return false;
+    }
+
+    /**
+     * Creates a texture that holds the given block-compressed data as is.
+     * The texture cannot be updated; its contents are premultiplied RGBA.
+     *
+     * @param data the compressed image data
+     * @param wrapMode the desired {@code WrapMode}
+     * @return the new texture, or null if it could not be created
+     */
+    public default Texture createCompressedTexture(CompressedImageData data, WrapMode wrapMode) {
+        return null;
+    }
+
     /**
      * Returns the maximum supported texture dimension for this device.
      * For example, if this method returns 2048, it means that textures
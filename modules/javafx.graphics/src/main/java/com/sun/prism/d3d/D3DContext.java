@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -414,6 +414,16 @@ class D3DContext extends BaseShaderContext {
         validate(nSetBlendEnabled(pContext, d3dmode));
     }
 
+    /**
+     * Returns the GPU time in milliseconds of a recently presented frame,
+     * or a negative value if no new measurement is available. Timing is
+     * turned on by the first call and measured with timestamp queries
+     * that complete a few frames later.
+     */
+    float getGpuFrameTime() {
+        return nGetGpuFrameTime(pContext);
+    }
+
     D3DFrameStats getFrameStats(boolean reset, D3DFrameStats result) {
         if (result == null) {
             result = new D3DFrameStats();
@@ -426,6 +436,7 @@ class D3DContext extends BaseShaderContext {
      * if needed, of the same format as the render target. The depth test state
      * is handled elsewhere.
      */
+    private static native float nGetGpuFrameTime(long pContext);
     private static native int nSetRenderTarget(long pContext, long pDest, boolean depthBuffer, boolean msaa);
     private static native int nSetTexture(long pContext, long pTex, int texUnit,
         boolean linear, int wrapMode);
@@ -460,6 +471,8 @@ class D3DContext extends BaseShaderContext {
             float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength);
     private static native boolean nBuildNativeGeometryInt(long pContext, long nativeHandle,
             float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength);
+    private static native boolean nUpdateNativeVertexBuffer(long pContext, long nativeHandle,
+            float[] vertexBuffer, int offset, int length);
     private static native long nCreateD3DPhongMaterial(long pContext);
     private static native void nReleaseD3DPhongMaterial(long pContext, long nativeHandle);
     private static native void nSetDiffuseColor(long pContext, long nativePhongMaterial,
@@ -554,6 +567,12 @@ class D3DContext extends BaseShaderContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeVertexBuffer(long nativeHandle, float[] vertexBuffer,
+            int offset, int length) {
+        return nUpdateNativeVertexBuffer(pContext, nativeHandle, vertexBuffer,
+                offset, length);
+    }
+
     long createD3DPhongMaterial() {
         return nCreateD3DPhongMaterial(pContext);
     }
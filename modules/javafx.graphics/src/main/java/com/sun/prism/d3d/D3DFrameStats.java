@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,8 @@ class D3DFrameStats {
     public int numSetTexture;
     public int numSetPixelShader;
     public int numRenderTargetSwitch;
+    public int numStateChanges;
+    public int numStateChangesSkipped;
 
     static int divr(int x, int d) {
         return (x + d / 2) / d;
@@ -49,6 +51,8 @@ class D3DFrameStats {
                 + ", numTextureTransferKBytes=" + divr(numTextureTransferBytes / 1024, nFrames)
                 + "\n\tnumRenderTargetSwitch=" + divr(numRenderTargetSwitch, nFrames)
                 + ", numSetTexture=" + divr(numSetTexture, nFrames)
-                + ", numSetPixelShader=" + divr(numSetPixelShader, nFrames);
+                + ", numSetPixelShader=" + divr(numSetPixelShader, nFrames)
+                + "\n\tnumStateChanges=" + divr(numStateChanges, nFrames)
+                + ", numStateChangesSkipped=" + divr(numStateChangesSkipped, nFrames);
     }
 }
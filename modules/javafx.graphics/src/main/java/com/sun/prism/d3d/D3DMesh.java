@@ -83,6 +83,11 @@ class D3DMesh extends BaseMesh {
                 vertexBufferLength, indexBufferShort, indexBufferLength);
     }
 
+    @Override
+    public boolean updateNativeVertexBuffer(float[] vertexBuffer, int offset, int length) {
+        return context.updateNativeVertexBuffer(nativeHandle, vertexBuffer, offset, length);
+    }
+
     static class D3DMeshDisposerRecord implements Disposer.Record {
 
         private final D3DContext context;
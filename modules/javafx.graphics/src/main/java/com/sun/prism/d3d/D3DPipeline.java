@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -235,6 +235,12 @@ public final class D3DPipeline extends GraphicsPipeline {
 
     @Override
     public int getAdapterOrdinal(Screen screen) {
+        // Keeping every screen on one adapter means windows moved between
+        // monitors keep their device and do not re-upload their textures.
+        // D3D presents to monitors of other adapters with a copy.
+        if (PrismSettings.d3dAdapter >= 0 && PrismSettings.d3dAdapter < nGetAdapterCount()) {
+            return PrismSettings.d3dAdapter;
+        }
         return nGetAdapterOrdinal(screen.getNativeScreen());
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -62,6 +62,7 @@ class D3DResourceFactory extends BaseShaderFactory {
     private static final Map<Image,Texture> clampTexCache = new WeakHashMap<>();
     private static final Map<Image,Texture> repeatTexCache = new WeakHashMap<>();
     private static final Map<Image,Texture> mipmapTexCache = new WeakHashMap<>();
+    private static final Map<Image,Texture> clampMipmapTexCache = new WeakHashMap<>();
 
     private final D3DContext context;
     private final int maxTextureSize;
@@ -74,7 +75,7 @@ class D3DResourceFactory extends BaseShaderFactory {
         new LinkedList<>();
 
     D3DResourceFactory(long pContext, Screen screen) {
-        super(clampTexCache, repeatTexCache, mipmapTexCache);
+        super(clampTexCache, repeatTexCache, mipmapTexCache, clampMipmapTexCache);
         context = new D3DContext(pContext, screen, this);
         context.initState();
         maxTextureSize = computeMaxTextureSize();
@@ -371,7 +372,9 @@ class D3DResourceFactory extends BaseShaderFactory {
 
         long pResource = nCreateSwapChain(context.getContextHandle(),
                                           pState.getNativeView(),
-                                          PrismSettings.isVsyncEnabled);
+                                          PrismSettings.isVsyncEnabled,
+                                          PrismSettings.d3dFlipEx,
+                                          PrismSettings.d3dMaxFrameLatency);
 
         if (pResource != 0L) {
             int width = pState.getRenderWidth();
@@ -461,6 +464,12 @@ class D3DResourceFactory extends BaseShaderFactory {
         }
     }
 
+    @Override
+    public boolean isMipmapSupported() {
+        // the mip chain is generated by D3DUSAGE_AUTOGENMIPMAP
+        return true;
+    }
+
     @Override
     public boolean isFormatSupported(PixelFormat format) {
         return true;
@@ -546,7 +555,9 @@ class D3DResourceFactory extends BaseShaderFactory {
                                       int width, int height, int samples,
                                       boolean useMipmap);
     static native long nCreateSwapChain(long pContext, long hwnd,
-                                        boolean isVsyncEnabled);
+                                        boolean isVsyncEnabled,
+                                        boolean useFlipEx,
+                                        int maxFrameLatency);
     static native int nReleaseResource(long pContext, long resource);
     static native int nGetMaximumTextureSize(long pContext);
     static native int nGetTextureWidth(long pResource);
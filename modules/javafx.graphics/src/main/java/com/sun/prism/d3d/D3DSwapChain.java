@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package com.sun.prism.d3d;
 
 import com.sun.glass.ui.Screen;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.logging.PulseLogger;
 import com.sun.prism.CompositeMode;
 import com.sun.prism.Graphics;
 import com.sun.prism.Presentable;
@@ -85,6 +86,12 @@ class D3DSwapChain
             return false;
         }
         int res = nPresent(context.getContextHandle(), d3dResRecord.getResource());
+        if (PulseLogger.PULSE_LOGGING_ENABLED) {
+            float gpuTime = context.getGpuFrameTime();
+            if (gpuTime >= 0) {
+                PulseLogger.addMessage(String.format("GPU frame time: %.2f ms", gpuTime));
+            }
+        }
         return context.validatePresent(res);
     }
 
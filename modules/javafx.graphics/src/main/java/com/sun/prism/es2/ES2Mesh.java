@@ -78,6 +78,11 @@ class ES2Mesh extends BaseMesh {
                 vertexBufferLength, indexBufferShort, indexBufferLength);
     }
 
+    @Override
+    public boolean updateNativeVertexBuffer(float[] vertexBuffer, int offset, int length) {
+        return context.updateNativeVertexBuffer(nativeHandle, vertexBuffer, offset, length);
+    }
+
     static class ES2MeshDisposerRecord implements Disposer.Record {
 
         private final ES2Context context;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 package com.sun.prism.es2;
 
+import com.sun.prism.impl.PrismSettings;
 import java.util.HashMap;
 import java.util.Map;
 
@@ -71,6 +72,23 @@ class ES2PhongShader {
     private static String normalMapShaderParts[] = new String[BumpMapState.values().length];
     private static String lightingShaderParts[] = new String[lightStateCount];
 
+    // Uniform names of the light array elements, built once instead of
+    // for every light of every mesh view rendered.
+    private static final int LIGHT_POS = 0, LIGHT_COLOR = 1, LIGHT_ATTN = 2, LIGHT_RANGE = 3,
+            LIGHT_DIR = 4, LIGHT_COS_OUTER = 5, LIGHT_DENOM = 6, LIGHT_FALLOFF = 7;
+    private static final String[] lightUniformSuffixes = {
+        ".pos", ".color", ".attn", ".range", ".dir", ".cosOuter", ".denom", ".falloff"
+    };
+    private static final String[][] lightUniformNames =
+            new String[lightStateCount - 1][lightUniformSuffixes.length];
+    static {
+        for (int i = 0; i < lightUniformNames.length; i++) {
+            for (int j = 0; j < lightUniformSuffixes.length; j++) {
+                lightUniformNames[i][j] = "lights[" + i + "]" + lightUniformSuffixes[j];
+            }
+        }
+    }
+
     static {
         shaders = new ES2Shader[DiffuseState.values().length][SpecularState.values().length]
                 [SelfIllumState.values().length][BumpMapState.values().length][lightStateCount];
@@ -150,37 +168,51 @@ class ES2PhongShader {
             if (light != null && light.w > 0) { numLights++; }
         }
 
-        ES2Shader shader = shaders[diffuseState.ordinal()][specularState.ordinal()]
-                [selfIllumState.ordinal()][bumpState.ordinal()][numLights];
-        if (shader == null) {
-            String fragShader = lightingShaderParts[numLights].replace("vec4 apply_diffuse();", diffuseShaderParts[diffuseState.ordinal()]);
-            fragShader = fragShader.replace("vec4 apply_specular();", specularShaderParts[specularState.ordinal()]);
-            fragShader = fragShader.replace("vec3 apply_normal();", normalMapShaderParts[bumpState.ordinal()]);
-            fragShader = fragShader.replace("vec4 apply_selfIllum();", selfIllumShaderParts[selfIllumState.ordinal()]);
-
-            String[] pixelShaders = new String[]{
-                fragShader
-            };
-
-            //TODO: 3D - should be done in state checking?
-            Map<String, Integer> attributes = new HashMap<>();
-            attributes.put("pos", 0);
-            attributes.put("texCoords", 1);
-            attributes.put("tangent", 2);
-
-            Map<String, Integer> samplers = new HashMap<>();
-            samplers.put("diffuseTexture", 0);
-            samplers.put("specularMap", 1);
-            samplers.put("normalMap", 2);
-            samplers.put("selfIllumTexture", 3);
-
-            shader = ES2Shader.createFromSource(context, vertexShaderSource, pixelShaders, samplers, attributes, 1, false);
-
-
-            shaders[diffuseState.ordinal()][specularState.ordinal()][selfIllumState.ordinal()]
-                    [bumpState.ordinal()][numLights] = shader;
+        ES2Shader[] lightShaders = shaders[diffuseState.ordinal()][specularState.ordinal()]
+                [selfIllumState.ordinal()][bumpState.ordinal()];
+        if (lightShaders[numLights] == null) {
+            if (PrismSettings.prewarmPhongShaders) {
+                // Build the variants for every light count at once so adding
+                // or removing lights later does not compile a new program
+                for (int i = 0; i < lightStateCount; i++) {
+                    if (lightShaders[i] == null) {
+                        lightShaders[i] = createShader(context, diffuseState, specularState,
+                                                       selfIllumState, bumpState, i);
+                    }
+                }
+            } else {
+                lightShaders[numLights] = createShader(context, diffuseState, specularState,
+                                                       selfIllumState, bumpState, numLights);
+            }
         }
-        return shader;
+        return lightShaders[numLights];
+    }
+
+    private static ES2Shader createShader(ES2Context context, DiffuseState diffuseState,
+                                          SpecularState specularState, SelfIllumState selfIllumState,
+                                          BumpMapState bumpState, int numLights) {
+        String fragShader = lightingShaderParts[numLights].replace("vec4 apply_diffuse();", diffuseShaderParts[diffuseState.ordinal()]);
+        fragShader = fragShader.replace("vec4 apply_specular();", specularShaderParts[specularState.ordinal()]);
+        fragShader = fragShader.replace("vec3 apply_normal();", normalMapShaderParts[bumpState.ordinal()]);
+        fragShader = fragShader.replace("vec4 apply_selfIllum();", selfIllumShaderParts[selfIllumState.ordinal()]);
+
+        String[] pixelShaders = new String[]{
+            fragShader
+        };
+
+        //TODO: 3D - should be done in state checking?
+        Map<String, Integer> attributes = new HashMap<>();
+        attributes.put("pos", 0);
+        attributes.put("texCoords", 1);
+        attributes.put("tangent", 2);
+
+        Map<String, Integer> samplers = new HashMap<>();
+        samplers.put("diffuseTexture", 0);
+        samplers.put("specularMap", 1);
+        samplers.put("normalMap", 2);
+        samplers.put("selfIllumTexture", 3);
+
+        return ES2Shader.createFromSource(context, vertexShaderSource, pixelShaders, samplers, attributes, 1, false);
     }
 
     static void setShaderParamaters(ES2Shader shader, ES2MeshView meshView, ES2Context context) {
@@ -212,30 +244,31 @@ class ES2PhongShader {
     }
 
     private static void setLightConstants(int i, ES2Shader shader, ES2Light light) {
-        shader.setConstant("lights[" + i + "].pos", light.x, light.y, light.z, light.w);
-        shader.setConstant("lights[" + i + "].color", light.r, light.g, light.b);
-        shader.setConstant("lights[" + i + "].attn", light.ca, light.la, light.qa, light.isAttenuated);
-        shader.setConstant("lights[" + i + "].range", light.maxRange);
+        String[] names = lightUniformNames[i];
+        shader.setConstant(names[LIGHT_POS], light.x, light.y, light.z, light.w);
+        shader.setConstant(names[LIGHT_COLOR], light.r, light.g, light.b);
+        shader.setConstant(names[LIGHT_ATTN], light.ca, light.la, light.qa, light.isAttenuated);
+        shader.setConstant(names[LIGHT_RANGE], light.maxRange);
         if (light.isPointLight()) {
-            shader.setConstant("lights[" + i + "].dir", 0f, 0f, 1f);
+            shader.setConstant(names[LIGHT_DIR], 0f, 0f, 1f);
         } else {
             float dirX = light.dirX;
             float dirY = light.dirY;
             float dirZ = light.dirZ;
             float length = (float) Math.sqrt(dirX * dirX + dirY * dirY + dirZ * dirZ);
-            shader.setConstant("lights[" + i + "].dir", dirX / length, dirY / length, dirZ / length);
+            shader.setConstant(names[LIGHT_DIR], dirX / length, dirY / length, dirZ / length);
         }
         if (light.isPointLight() || light.isDirectionalLight()) {
-            shader.setConstant("lights[" + i + "].cosOuter", -1f); // cos(180)
-            shader.setConstant("lights[" + i + "].denom", 2f);     // cos(0) - cos(180)
-            shader.setConstant("lights[" + i + "].falloff", 0f);
+            shader.setConstant(names[LIGHT_COS_OUTER], -1f); // cos(180)
+            shader.setConstant(names[LIGHT_DENOM], 2f);     // cos(0) - cos(180)
+            shader.setConstant(names[LIGHT_FALLOFF], 0f);
         } else {
             // preparing for: I = pow((cosAngle - cosOuter) / (cosInner - cosOuter), falloff);
             float cosOuter = (float) Math.cos(Math.toRadians(light.outerAngle));
             float cosInner = (float) Math.cos(Math.toRadians(light.innerAngle));
-            shader.setConstant("lights[" + i + "].cosOuter", cosOuter);
-            shader.setConstant("lights[" + i + "].denom", cosInner - cosOuter);
-            shader.setConstant("lights[" + i + "].falloff", light.falloff);
+            shader.setConstant(names[LIGHT_COS_OUTER], cosOuter);
+            shader.setConstant(names[LIGHT_DENOM], cosInner - cosOuter);
+            shader.setConstant(names[LIGHT_FALLOFF], light.falloff);
         }
     }
 }
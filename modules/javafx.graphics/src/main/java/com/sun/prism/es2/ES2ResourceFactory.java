@@ -30,6 +30,7 @@ import java.util.Map;
 
 import com.sun.glass.ui.Screen;
 import com.sun.javafx.PlatformUtil;
+import com.sun.javafx.iio.CompressedImageData;
 import com.sun.prism.Image;
 import com.sun.prism.MediaFrame;
 import com.sun.prism.Mesh;
@@ -55,13 +56,14 @@ public class ES2ResourceFactory extends BaseShaderFactory {
     private static final Map<Image,Texture> clampTexCache = new WeakHashMap<>();
     private static final Map<Image,Texture> repeatTexCache = new WeakHashMap<>();
     private static final Map<Image,Texture> mipmapTexCache = new WeakHashMap<>();
+    private static final Map<Image,Texture> clampMipmapTexCache = new WeakHashMap<>();
 
     private ES2Context context;
     // Maximum size of the texture
     private final int maxTextureSize;
 
     ES2ResourceFactory(Screen screen) {
-        super(clampTexCache, repeatTexCache, mipmapTexCache);
+        super(clampTexCache, repeatTexCache, mipmapTexCache, clampMipmapTexCache);
         context = new ES2Context(screen, this);
         maxTextureSize = computeMaxTextureSize();
 
@@ -197,6 +199,36 @@ public class ES2ResourceFactory extends BaseShaderFactory {
         }
     }
 
+    @Override
+    public boolean isMipmapSupported() {
+        // mipmaps are generated with GL_GENERATE_MIPMAP, which OpenGL ES 2
+        // does not have
+        return ES2Pipeline.glFactory.isGL2();
+    }
+
+    @Override
+    public boolean isCompressedFormatSupported(CompressedImageData.Format format) {
+        GLFactory glFactory = ES2Pipeline.glFactory;
+        switch (format) {
+            case BC1_RGBA:
+            case BC2_RGBA:
+            case BC3_RGBA:
+                return glFactory.isGLExtensionSupported("GL_EXT_texture_compression_s3tc");
+            case ETC2_RGB8:
+            case ETC2_RGBA8:
+                // ETC2 is core in OpenGL ES 3.0 and OpenGL 4.3
+                return glFactory.isGLExtensionSupported("GL_ARB_ES3_compatibility")
+                        || glFactory.isGLExtensionSupported("GL_OES_compressed_ETC2_RGBA8_texture");
+            default:
+                return false;
+        }
+    }
+
+    @Override
+    public Texture createCompressedTexture(CompressedImageData data, WrapMode wrapMode) {
+        return ES2Texture.createCompressed(context, data, wrapMode);
+    }
+
     private int computeMaxTextureSize() {
         int size = context.getGLContext().getMaxTextureSize();
         if (PrismSettings.verbose) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -81,7 +81,6 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
     private final int maxTexCoordIndex;
     private final boolean isPixcoordUsed;
     private boolean valid;
-    private float[] currentMatrix;
 
     private ES2Shader(ES2Context context, int programID,
             int vertexShaderID, int[] fragmentShaderID,
@@ -117,23 +116,43 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             int maxTexCoordIndex,
             boolean isPixcoordUsed) {
         GLContext glCtx = context.getGLContext();
-        if (!glCtx.isShaderCompilerSupported()) {
-            throw new RuntimeException("Shader compiler not available on this device");
-        }
-
         if (vert == null || frag == null || frag.length == 0) {
             throw new RuntimeException(
                     "Both vertexShaderSource and fragmentShaderSource "
                     + "must be specified");
         }
 
+        String[] attrs = new String[attributes.size()];
+        int[] indexs = new int[attrs.length];
+        int i = 0;
+        for (String attr : attributes.keySet()) {
+            attrs[i] = attr;
+            indexs[i] = attributes.get(attr);
+            i++;
+        }
+
+        String cacheKey = ES2ShaderCache.getKey(vert, frag, attrs, indexs);
+        if (cacheKey != null) {
+            int programID = ES2ShaderCache.load(glCtx, cacheKey);
+            if (programID != 0) {
+                // There are no shader objects to dispose with the program
+                return new ES2Shader(context,
+                        programID, 0, new int[0],
+                        samplers, maxTexCoordIndex, isPixcoordUsed);
+            }
+        }
+
+        if (!glCtx.isShaderCompilerSupported()) {
+            throw new RuntimeException("Shader compiler not available on this device");
+        }
+
         int vertexShaderID = glCtx.compileShader(vert, true);
         if (vertexShaderID == 0) {
             throw new RuntimeException("Error creating vertex shader");
         }
 
         int[] fragmentShaderID = new int[frag.length];
-        for (int i = 0; i < frag.length; i++) {
+        for (i = 0; i < frag.length; i++) {
             fragmentShaderID[i] = glCtx.compileShader(frag[i], false);
             if (fragmentShaderID[i] == 0) {
                 glCtx.deleteShader(vertexShaderID);
@@ -142,14 +161,6 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             }
         }
 
-        String[] attrs = new String[attributes.size()];
-        int[] indexs = new int[attrs.length];
-        int i = 0;
-        for (String attr : attributes.keySet()) {
-            attrs[i] = attr;
-            indexs[i] = attributes.get(attr);
-            i++;
-        }
         int programID = glCtx.createProgram(vertexShaderID, fragmentShaderID,
                 attrs, indexs);
         if (programID == 0) {
@@ -158,6 +169,10 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
             throw new RuntimeException("Error creating shader program");
         }
 
+        if (cacheKey != null) {
+            ES2ShaderCache.store(glCtx, programID, cacheKey);
+        }
+
         return new ES2Shader(context,
                 programID, vertexShaderID, fragmentShaderID,
                 samplers, maxTexCoordIndex, isPixcoordUsed);
@@ -551,18 +566,20 @@ public class ES2Shader extends BaseGraphicsResource implements Shader {
      * OpenGL-related errors occurred
      */
     public void setMatrix(String name, float buf[]) throws RuntimeException {
-        int loc = getUniform(name).location;
-        if (loc == -1) {
+        Uniform uniform = getUniform(name);
+        if (uniform.location == -1) {
             return;
         }
-
-        if (currentMatrix == null) {
-            currentMatrix = new float[GLContext.NUM_MATRIX_ELEMENTS];
+        // Remember the last value per uniform: the view projection and the
+        // world matrix are set for every mesh view, and the former rarely
+        // changes between the meshes of a scene.
+        if (uniform.values == null) {
+            uniform.values = new float[GLContext.NUM_MATRIX_ELEMENTS];
         }
-
-        if (!Arrays.equals(currentMatrix, buf)) {
-            context.getGLContext().uniformMatrix4fv(loc, false, buf);
-            System.arraycopy(buf, 0, currentMatrix, 0, buf.length);
+        float[] values = (float[]) uniform.values;
+        if (!Arrays.equals(values, buf)) {
+            context.getGLContext().uniformMatrix4fv(uniform.location, false, buf);
+            System.arraycopy(buf, 0, values, 0, buf.length);
         }
     }
 
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package com.sun.prism.es2;
+
+import com.sun.prism.impl.PrismSettings;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.HexFormat;
+
+/**
+ * A disk cache of linked shader program binaries, which saves compiling and
+ * linking the shaders again on the next run. The cache is enabled with the
+ * {@code prism.shadercache} property naming the cache directory.
+ * <p>
+ * Entries are keyed by a digest of the shader sources and attribute
+ * bindings, the JavaFX runtime version and the GL vendor, renderer and
+ * version strings, so that a runtime or driver update misses the cache
+ * rather than loading a stale binary. A binary the driver rejects anyway is
+ * compiled from source and replaced.
+ */
+final class ES2ShaderCache {
+
+    // Bump when the layout of the cache files changes
+    private static final int FILE_VERSION = 1;
+    private static final int FILE_MAGIC = 0x4a465853; // "JFXS"
+
+    private static final Path cacheDir = (PrismSettings.shaderCacheDir == null)
+            ? null : Paths.get(PrismSettings.shaderCacheDir);
+    private static String driverId;
+
+    private ES2ShaderCache() {
+    }
+
+    /**
+     * Returns the cache key of a program, or null if the cache is disabled.
+     */
+    static String getKey(String vert, String[] frag, String[] attrs, int[] indexs) {
+        if (cacheDir == null) {
+            return null;
+        }
+        if (driverId == null) {
+            driverId = ES2Pipeline.glFactory.getDriverId();
+        }
+        try {
+            MessageDigest md = MessageDigest.getInstance("SHA-256");
+            update(md, Integer.toString(FILE_VERSION));
+            update(md, System.getProperty("javafx.runtime.version", "versionless"));
+            update(md, driverId);
+            update(md, vert);
+            for (String f : frag) {
+                update(md, f);
+            }
+            for (int i = 0; i < attrs.length; i++) {
+                update(md, attrs[i] + "=" + indexs[i]);
+            }
+            return HexFormat.of().formatHex(md.digest());
+        } catch (NoSuchAlgorithmException e) {
+            return null;
+        }
+    }
+
+    private static void update(MessageDigest md, String s) {
+        md.update(s.getBytes(StandardCharsets.UTF_8));
+        md.update((byte) 0);
+    }
+
+    /**
+     * Creates the program cached under the given key. Returns 0 if there is
+     * no usable cache entry.
+     */
+    static int load(GLContext glCtx, String key) {
+        Path file = cacheDir.resolve(key);
+        if (!Files.isRegularFile(file)) {
+            return 0;
+        }
+        int format;
+        byte[] binary;
+        try (InputStream in = Files.newInputStream(file);
+             DataInputStream din = new DataInputStream(in)) {
+            if (din.readInt() != FILE_MAGIC || din.readInt() != FILE_VERSION) {
+                return 0;
+            }
+            format = din.readInt();
+            binary = din.readAllBytes();
+        } catch (IOException e) {
+            if (PrismSettings.verbose) {
+                System.err.println("Could not read shader cache entry " + file + ": " + e);
+            }
+            return 0;
+        }
+        return glCtx.createProgramFromBinary(format, binary);
+    }
+
+    /**
+     * Stores the binary of a freshly linked program under the given key.
+     */
+    static void store(GLContext glCtx, int programID, String key) {
+        int[] format = new int[1];
+        byte[] binary = glCtx.getProgramBinary(programID, format);
+        if (binary == null) {
+            return;
+        }
+        Path tmp = null;
+        try {
+            Files.createDirectories(cacheDir);
+            // Write to a temporary file first, so that a concurrently starting
+            // application never reads a partial entry
+            tmp = Files.createTempFile(cacheDir, key, ".tmp");
+            try (OutputStream out = Files.newOutputStream(tmp);
+                 DataOutputStream dout = new DataOutputStream(out)) {
+                dout.writeInt(FILE_MAGIC);
+                dout.writeInt(FILE_VERSION);
+                dout.writeInt(format[0]);
+                dout.write(binary);
+            }
+            Files.move(tmp, cacheDir.resolve(key),
+                    StandardCopyOption.REPLACE_EXISTING, StandardCopyOption.ATOMIC_MOVE);
+        } catch (IOException e) {
+            if (PrismSettings.verbose) {
+                System.err.println("Could not write shader cache entry " + key + ": " + e);
+            }
+            if (tmp != null) {
+                try {
+                    Files.deleteIfExists(tmp);
+                } catch (IOException ignore) {
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,9 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
      */
     private RTTexture stableBackbuffer;
     private boolean copyFullBuffer;
+    // The part of the window that changed since the last present, in GL
+    // window coordinates, or null when all of it may have changed
+    private Rectangle damage;
 
     @Override
     public boolean isOpaque() {
@@ -127,7 +130,9 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
     public boolean prepare(Rectangle clip) {
         try {
             ES2Graphics g = ES2Graphics.create(context, this);
+            damage = null;
             if (stableBackbuffer != null) {
+                boolean fullCopy = copyFullBuffer || needsResize;
                 if (needsResize) {
                     g.forceRenderTarget();
                     needsResize = false;
@@ -151,6 +156,9 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
                                 0, 0, dw, dh, 0, 0, sw, sh);
                 }
                 stableBackbuffer.unlock();
+                if (clip != null && !fullCopy) {
+                    damage = toWindowCoordinates(clip, sw, sh, dw, dh);
+                }
             }
             return drawable != null;
         } catch (Throwable th) {
@@ -161,6 +169,19 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
         }
     }
 
+    // Maps a region of the stable backbuffer to GL window coordinates,
+    // which have their origin at the bottom left
+    private Rectangle toWindowCoordinates(Rectangle r, int sw, int sh, int dw, int dh) {
+        double sx = (double) dw / sw;
+        double sy = (double) dh / sh;
+        int x0 = (int) Math.floor(r.x * sx);
+        int y0 = (int) Math.floor(r.y * sy);
+        int x1 = (int) Math.ceil((r.x + r.width) * sx);
+        int y1 = (int) Math.ceil((r.y + r.height) * sy);
+        return new Rectangle(getContentX() + x0, getContentY() + dh - y1,
+                             x1 - x0, y1 - y0);
+    }
+
     private void drawTexture(ES2Graphics g, RTTexture src,
                              float dx1, float dy1, float dx2, float dy2,
                              float sx1, float sy1, float sx2, float sy2) {
@@ -183,7 +204,10 @@ class ES2SwapChain implements ES2RenderTarget, Presentable, GraphicsResource {
 
     @Override
     public boolean present() {
-        boolean presented = drawable.swapBuffers(context.getGLContext());
+        boolean presented = (damage == null)
+                ? drawable.swapBuffers(context.getGLContext())
+                : drawable.swapBuffers(context.getGLContext(),
+                        damage.x, damage.y, damage.width, damage.height);
         context.makeCurrent(null);
         return presented;
     }
@@ -26,6 +26,7 @@
 package com.sun.prism.es2;
 
 import com.sun.javafx.PlatformUtil;
+import com.sun.javafx.iio.CompressedImageData;
 import com.sun.prism.Image;
 import com.sun.prism.Texture;
 import com.sun.prism.MediaFrame;
@@ -233,6 +234,67 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
 
     }
 
+    static ES2Texture createCompressed(ES2Context context,
+            CompressedImageData data, WrapMode wrapMode) {
+        GLContext glCtx = context.getGLContext();
+        int w = data.getWidth();
+        int h = data.getHeight();
+
+        // Compressed blocks cannot be padded, so the wrap modes that would
+        // need a border or a power of two size are left to the regular path.
+        switch (wrapMode) {
+            case CLAMP_TO_EDGE:
+            case REPEAT:
+                if (!glCtx.canCreateNonPowTwoTextures() &&
+                    ((w & (w-1)) != 0 || (h & (h-1)) != 0))
+                {
+                    return null;
+                }
+                break;
+            case CLAMP_NOT_NEEDED:
+                break;
+            default:
+                return null;
+        }
+        int maxSize = glCtx.getMaxTextureSize();
+        if (w > maxSize || h > maxSize) {
+            return null;
+        }
+
+        ES2VramPool pool = ES2VramPool.instance;
+        long size = data.getDataSize();
+        if (!pool.prepareForAllocation(size)) {
+            return null;
+        }
+
+        // save current texture object for this texture unit
+        int savedTex = glCtx.getBoundTexture();
+        ES2TextureData texData =
+            new ES2TextureData(context, glCtx.genAndBindTexture(), w, h, size);
+        ES2TextureResource texRes = new ES2TextureResource(texData);
+
+        boolean result = glCtx.compressedTexImage2D(
+                data.getFormat().getGLInternalFormat(), w, h,
+                data.getData(), data.getDataSize());
+        glCtx.texParamsMinMax(GLContext.GL_LINEAR, false);
+
+        // restore previous texture objects
+        glCtx.setBoundTexture(savedTex);
+
+        if (!result) {
+            return null;
+        }
+        // The format only selects the shaders; a compressed texture samples
+        // the same as one uploaded from BGRA_PRE (or RGB) pixels.
+        PixelFormat format = data.getFormat() == CompressedImageData.Format.ETC2_RGB8
+                ? PixelFormat.BYTE_RGB
+                : PixelFormat.BYTE_BGRA_PRE;
+        ES2Texture tex = new ES2Texture(context, texRes, format, wrapMode,
+                                        w, h, 0, 0, w, h, false);
+        tex.setCompressed(true);
+        return tex;
+    }
+
     public static Texture create(ES2Context context, MediaFrame frame) {
         frame.holdFrame();
 
@@ -638,7 +700,12 @@ class ES2Texture<T extends ES2TextureData> extends BaseTexture<ES2TextureResourc
             if (savedTex != texID) {
                 glCtx.setBoundTexture(texID);
             }
-            glCtx.updateFilterState(texID, cLFM);
+            if (getUseMipmap()) {
+                // keep sampling between mip levels
+                glCtx.texParamsMinMax(cLFM ? GLContext.GL_LINEAR : GLContext.GL_NEAREST, true);
+            } else {
+                glCtx.updateFilterState(texID, cLFM);
+            }
             if (savedTex != texID) {
                 glCtx.setBoundTexture(savedTex);
             }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -151,6 +151,8 @@ abstract class GLContext {
     private static native int nCreateProgram(long nativeCtxInfo,
             int vertexShaderID, int[] fragmentShaderID,
             int numAttrs, String[] attrs, int[] indexs);
+    private static native int nCreateProgramFromBinary(long nativeCtxInfo,
+            int format, byte[] binary);
     private static native int nCreateTexture(long nativeCtxInfo, int width,
             int height);
     private static native void nDeleteRenderBuffer(long nativeCtxInfo, int rbID);
@@ -164,6 +166,8 @@ abstract class GLContext {
     private static native int nGetFBO();
     private static native int nGetIntParam(int pname);
     private static native int nGetMaxSampleSize();
+    private static native byte[] nGetProgramBinary(long nativeCtxInfo,
+            int programID, int[] format);
     private static native int nGetUniformLocation(long nativeCtxInfo,
             int programID, String name);
     private static native void nPixelStorei(int pname, int param);
@@ -182,6 +186,12 @@ abstract class GLContext {
     private static native boolean nTexImage2D1(int target, int level, int internalFormat,
             int width, int height, int border, int format,
             int type, Object pixels, int pixelsByteOffset, boolean useMipmap);
+    private static native boolean nCompressedTexImage2D0(long nativeCtxInfo,
+            int internalFormat, int width, int height,
+            Object data, int dataByteOffset, int dataSize);
+    private static native boolean nCompressedTexImage2D1(long nativeCtxInfo,
+            int internalFormat, int width, int height,
+            Object data, int dataByteOffset, int dataSize);
     private static native void nTexSubImage2D0(int target, int level,
             int xoffset, int yoffset, int width, int height, int format,
             int type, Object pixels, int pixelsByteOffset);
@@ -235,6 +245,8 @@ abstract class GLContext {
             float[] vertexBuffer, int vertexBufferLength, short[] indexBuffer, int indexBufferLength);
     private static native boolean nBuildNativeGeometryInt(long nativeCtxInfo, long nativeHandle,
             float[] vertexBuffer, int vertexBufferLength, int[] indexBuffer, int indexBufferLength);
+    private static native boolean nUpdateNativeVertexBuffer(long nativeCtxInfo, long nativeHandle,
+            float[] vertexBuffer, int offset, int length);
     private static native long nCreateES2PhongMaterial(long nativeCtxInfo);
     private static native void nReleaseES2PhongMaterial(long nativeCtxInfo, long nativeHandle);
     private static native void nSetSolidColor(long nativeCtxInfo, long nativePhongMaterial,
@@ -386,6 +398,15 @@ abstract class GLContext {
                 attrs.length, attrs, indexs);
     }
 
+    /**
+     * Creates a shader program from a binary returned by getProgramBinary.
+     * Returns 0 if program binaries are not supported or the driver does
+     * not accept the binary.
+     */
+    int createProgramFromBinary(int format, byte[] binary) {
+        return nCreateProgramFromBinary(nativeCtxInfo, format, binary);
+    }
+
     int createTexture(int width, int height) {
         return nCreateTexture(nativeCtxInfo, width, height);
     }
@@ -517,6 +538,14 @@ abstract class GLContext {
         return maxTextureSize = getIntParam(GLContext.GL_MAX_TEXTURE_SIZE);
     }
 
+    /**
+     * Returns the binary of a linked shader program and stores its format in
+     * format[0], or returns null if program binaries are not supported.
+     */
+    byte[] getProgramBinary(int programID, int[] format) {
+        return nGetProgramBinary(nativeCtxInfo, programID, format);
+    }
+
     int getUniformLocation(int programID, String name) {
         return nGetUniformLocation(nativeCtxInfo, programID, name);
     }
@@ -591,6 +620,23 @@ abstract class GLContext {
 
     }
 
+    /**
+     * Uploads level 0 of the currently bound GL_TEXTURE_2D from
+     * block-compressed data; internalFormat is a GL compressed format enum.
+     */
+    boolean compressedTexImage2D(int internalFormat, int width, int height,
+            java.nio.Buffer data, int dataSize) {
+        if (BufferFactory.isDirect(data)) {
+            return nCompressedTexImage2D0(nativeCtxInfo, internalFormat,
+                    width, height, data,
+                    BufferFactory.getDirectBufferByteOffset(data), dataSize);
+        } else {
+            return nCompressedTexImage2D1(nativeCtxInfo, internalFormat,
+                    width, height, BufferFactory.getArray(data),
+                    BufferFactory.getIndirectBufferByteOffset(data), dataSize);
+        }
+    }
+
     void texSubImage2D(int target, int level, int xoffset, int yoffset,
             int width, int height, int format, int type, java.nio.Buffer pixels) {
         boolean direct = BufferFactory.isDirect(pixels);
@@ -760,6 +806,12 @@ abstract class GLContext {
                 vertexBufferLength, indexBuffer, indexBufferLength);
     }
 
+    boolean updateNativeVertexBuffer(long nativeHandle, float[] vertexBuffer,
+            int offset, int length) {
+        return nUpdateNativeVertexBuffer(nativeCtxInfo, nativeHandle,
+                vertexBuffer, offset, length);
+    }
+
     long createES2PhongMaterial() {
         return nCreateES2PhongMaterial(nativeCtxInfo);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,4 +54,13 @@ abstract class GLDrawable implements GraphicsResource {
         return nativeDrawableInfo;
     }
     abstract boolean swapBuffers(GLContext glCtx);
+
+    /**
+     * Swaps the buffers, hinting that only the given rectangle has changed
+     * since the previous swap. The rectangle is in GL window coordinates.
+     * Drawables that cannot pass the hint on present the whole surface.
+     */
+    boolean swapBuffers(GLContext glCtx, int x, int y, int width, int height) {
+        return swapBuffers(glCtx);
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -203,6 +203,12 @@ abstract class GLFactory {
 
     abstract void updateDeviceDetails(HashMap deviceDetails);
 
+    // Identifies the driver shader program binaries are created with
+    String getDriverId() {
+        return nGetGLVendor(nativeCtxInfo) + "/" + nGetGLRenderer(nativeCtxInfo)
+                + "/" + nGetGLVersion(nativeCtxInfo);
+    }
+
     void printDriverInformation(int adapter) {
         /* We are assuming a system with a single or homogeneous GPUs. */
         System.out.println("Graphics Vendor: " + nGetGLVendor(nativeCtxInfo));
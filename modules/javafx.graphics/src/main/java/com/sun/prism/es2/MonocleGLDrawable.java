@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,7 +51,18 @@ class MonocleGLDrawable extends GLDrawable {
 
        boolean retval = accScreen.swapBuffers();
        // boolean retval = nSwapBuffers(getNativeDrawableInfo());
+       clearAfterSwap(glCtx);
+       return retval;
+    }
 
+    @Override
+    boolean swapBuffers(GLContext glCtx, int x, int y, int width, int height) {
+        boolean retval = accScreen.swapBuffers(x, y, width, height);
+        clearAfterSwap(glCtx);
+        return retval;
+    }
+
+    private void clearAfterSwap(GLContext glCtx) {
         // TODO: This looks hacky. Need to find a better approach.
         // For Monocle, we are painting in Z-order from the back,
         // possibly (likely) with an app that does not cover the
@@ -60,8 +71,6 @@ class MonocleGLDrawable extends GLDrawable {
         glCtx.clearBuffers(
                 transparentFramebuffer ? Color.TRANSPARENT : Color.BLACK,
                 true, true, true);
-        return retval;
-
     }
 
     @Override
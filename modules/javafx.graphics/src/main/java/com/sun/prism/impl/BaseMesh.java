@@ -78,6 +78,17 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
     public abstract boolean buildNativeGeometry(float[] vertexBuffer,
             int vertexBufferLength, short[] indexBufferShort, int indexBufferLength);
 
+    /**
+     * Uploads {@code length} floats of {@code vertexBuffer}, starting at
+     * {@code offset}, into the existing native vertex buffer, leaving the rest
+     * of the buffer and the index buffer untouched.
+     *
+     * @return false if the native buffer can't be updated in place, in which
+     * case the caller must rebuild the whole geometry
+     */
+    public abstract boolean updateNativeVertexBuffer(float[] vertexBuffer,
+            int offset, int length);
+
     private boolean[] dirtyVertices;
     private float[] cachedNormals;
     private float[] cachedTangents;
@@ -490,6 +501,28 @@ public abstract class BaseMesh extends BaseGraphicsResource implements Mesh {
         convertNormalsToQuats(instance, numberOfVertices,
                 cachedNormals, cachedTangents, cachedBitangents, vertexBuffer, dirtyVertices);
 
+        // Only upload the span of triangles that contains dirty vertices;
+        // the index buffer doesn't change, as the faces array is unchanged.
+        int firstDirty = -1;
+        int lastDirty = -1;
+        for (int j = 0; j < numberOfVertices; j++) {
+            if (dirtyVertices[j]) {
+                if (firstDirty < 0) {
+                    firstDirty = j;
+                }
+                lastDirty = j;
+            }
+        }
+        if (firstDirty < 0) {
+            return true;
+        }
+        firstDirty -= firstDirty % 3;
+        lastDirty += 3 - (lastDirty % 3);
+        if (updateNativeVertexBuffer(vertexBuffer, firstDirty * VERTEX_SIZE_VB,
+                (lastDirty - firstDirty) * VERTEX_SIZE_VB)) {
+            return true;
+        }
+
         if (indexBuffer != null) {
             return buildNativeGeometry(vertexBuffer,
                     numberOfVertices * VERTEX_SIZE_VB, indexBuffer, indexBufferSize);
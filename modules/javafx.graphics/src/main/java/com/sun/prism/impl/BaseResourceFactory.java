@@ -26,6 +26,7 @@
 package com.sun.prism.impl;
 
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.iio.CompressedImageData;
 import com.sun.prism.Image;
 import com.sun.prism.PixelFormat;
 import com.sun.prism.ResourceFactory;
@@ -43,8 +44,10 @@ import javafx.util.Pair;
 public abstract class BaseResourceFactory implements ResourceFactory {
     private final Map<Image,Texture> clampTexCache;
     private final Map<Image,Texture> repeatTexCache;
-    // Solely used by diffuse and selfillum maps in PhongMaterial for 3D rendering
+    // Used by diffuse and selfillum maps in PhongMaterial for 3D rendering
     private final Map<Image,Texture> mipmapTexCache;
+    // Used for images drawn well below their native size
+    private final Map<Image,Texture> clampMipmapTexCache;
 
     // Use a WeakHashMap as it automatically removes dead objects when they're
     // collected
@@ -59,17 +62,20 @@ public abstract class BaseResourceFactory implements ResourceFactory {
 
     public BaseResourceFactory() {
         this(new WeakHashMap<Image,Texture>(),
+             new WeakHashMap<Image,Texture>(),
              new WeakHashMap<Image,Texture>(),
              new WeakHashMap<Image,Texture>());
     }
 
     public BaseResourceFactory(Map<Image, Texture> clampTexCache,
                                Map<Image, Texture> repeatTexCache,
-                               Map<Image, Texture> mipmapTexCache)
+                               Map<Image, Texture> mipmapTexCache,
+                               Map<Image, Texture> clampMipmapTexCache)
     {
         this.clampTexCache = clampTexCache;
         this.repeatTexCache = repeatTexCache;
         this.mipmapTexCache = mipmapTexCache;
+        this.clampMipmapTexCache = clampMipmapTexCache;
     }
 
     @Override public void addFactoryListener(ResourceFactoryListener l) {
@@ -90,6 +96,7 @@ public abstract class BaseResourceFactory implements ResourceFactory {
         clearTextureCache(clampTexCache);
         clearTextureCache(repeatTexCache);
         clearTextureCache(mipmapTexCache);
+        clearTextureCache(clampMipmapTexCache);
     }
 
     protected void clearTextureCache(Map<Image,Texture> texCache) {
@@ -108,6 +115,7 @@ public abstract class BaseResourceFactory implements ResourceFactory {
         clampTexCache.clear();
         repeatTexCache.clear();
         mipmapTexCache.clear();
+        clampMipmapTexCache.clear();
 
         if (regionTexture != null) {
             regionTexture.dispose();
@@ -179,12 +187,7 @@ public abstract class BaseResourceFactory implements ResourceFactory {
         }
         Map<Image,Texture> texCache;
         if (wrapMode == WrapMode.CLAMP_TO_EDGE) {
-            // Mipmap not supported with CLAMP mode in current implementation
-            if (useMipmap) {
-                throw new IllegalArgumentException("Mipmap not supported with CLAMP mode: useMipmap = "
-                        + useMipmap + ", wrapMode = " + wrapMode);
-            }
-            texCache = clampTexCache;
+            texCache = useMipmap ? clampMipmapTexCache : clampTexCache;
         } else if (wrapMode == WrapMode.REPEAT) {
             texCache = useMipmap ? mipmapTexCache : repeatTexCache;
         } else {
@@ -229,7 +232,9 @@ public abstract class BaseResourceFactory implements ResourceFactory {
             int h = image.getHeight();
             TextureResourcePool pool = getTextureResourcePool();
             // Mipmap will use more memory
+            CompressedImageData compressed = getUsableCompressedData(image, useMipmap);
             long size = useMipmap ? sizeWithMipMap(w, h, image.getPixelFormat())
+                    : compressed != null ? compressed.getDataSize()
                     : pool.estimateTextureSize(w, h, image.getPixelFormat());
             if (!pool.prepareForAllocation(size)) {
                 return null;
@@ -240,6 +245,14 @@ public abstract class BaseResourceFactory implements ResourceFactory {
                 tex.setLastImageSerial(idRect.getKey());
                 texCache.put(image, tex);
             }
+        } else if (tex.getLastImageSerial() != idRect.getKey()
+                && tex instanceof BaseTexture<?> btex && btex.isCompressed()) {
+            // A compressed texture cannot take uncompressed updates, so
+            // the modified image gets a new texture.
+            texCache.remove(image);
+            tex.contentsNotUseful();
+            tex.unlock();
+            return getCachedTexture(image, wrapMode, useMipmap);
         } else if (tex.getLastImageSerial() != idRect.getKey()) {
             // If the image was updated only once, then the image is partially updated.
             // Else whole image is updated.
@@ -270,6 +283,15 @@ public abstract class BaseResourceFactory implements ResourceFactory {
 
         if (checkDisposed()) return null;
 
+        CompressedImageData compressed = getUsableCompressedData(image, useMipmap);
+        if (compressed != null) {
+            Texture tex = createCompressedTexture(compressed, wrapMode);
+            if (tex != null) {
+                tex.contentsUseful();
+                return tex;
+            }
+        }
+
         PixelFormat format = image.getPixelFormat();
         int w = image.getWidth();
         int h = image.getHeight();
@@ -285,6 +307,22 @@ public abstract class BaseResourceFactory implements ResourceFactory {
         return tex;
     }
 
+    /**
+     * Returns the compressed form of the image if a texture can be created
+     * directly from it, or null if the decoded pixels must be uploaded.
+     * Mipmaps would have to be generated from uncompressed data.
+     */
+    private CompressedImageData getUsableCompressedData(Image image, boolean useMipmap) {
+        CompressedImageData data = image.getCompressedData();
+        if (useMipmap || data == null || !data.isPremultiplied()
+                || data.getWidth() != image.getWidth()
+                || data.getHeight() != image.getHeight()
+                || !isCompressedFormatSupported(data.getFormat())) {
+            return null;
+        }
+        return data;
+    }
+
     @Override
     public Texture createMaskTexture(int width, int height, WrapMode wrapMode) {
         return createTexture(PixelFormat.BYTE_ALPHA,
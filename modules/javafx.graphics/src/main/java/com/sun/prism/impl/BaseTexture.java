@@ -53,6 +53,7 @@ public abstract class BaseTexture<T extends ManagedResource> implements Texture
     private final boolean useMipmap;
     private boolean linearFiltering = true;
     private int lastImageSerial;
+    private boolean compressed;
 
     protected BaseTexture(BaseTexture<T> sharedTex, WrapMode newMode, boolean useMipmap) {
         this.resource = sharedTex.resource;
@@ -67,6 +68,7 @@ public abstract class BaseTexture<T extends ManagedResource> implements Texture
         this.maxContentWidth = sharedTex.maxContentWidth;
         this.maxContentHeight = sharedTex.maxContentHeight;
         this.useMipmap = useMipmap;
+        this.compressed = sharedTex.compressed;
     }
 
     protected BaseTexture(T resource,
@@ -247,6 +249,18 @@ public abstract class BaseTexture<T extends ManagedResource> implements Texture
         lastImageSerial = serial;
     }
 
+    /**
+     * Returns true if this texture holds block-compressed data, in which
+     * case its contents cannot be updated from uncompressed pixels.
+     */
+    public final boolean isCompressed() {
+        return compressed;
+    }
+
+    protected final void setCompressed(boolean compressed) {
+        this.compressed = compressed;
+    }
+
     @Override
     public final void lock() {
         resource.lock();
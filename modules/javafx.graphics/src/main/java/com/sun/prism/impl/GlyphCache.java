@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -143,16 +143,18 @@ public class GlyphCache {
             if ((gc & CompositeGlyphMapper.GLYPHMASK) == CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
                 continue;
             }
+            if (clip != null) {
+                // Always check clipping using user space. Test before the
+                // lookup so that clipped glyphs are not rasterized into
+                // the cache only to be skipped.
+                if (x + gl.getPosX(gi) > clip.getMaxX()) break;
+                if (x + gl.getPosX(gi + 1) < clip.getMinX()) continue;
+            }
             pt.setLocation(x + gl.getPosX(gi), y + gl.getPosY(gi));
             xform.transform(pt, pt);
             int subPixel = strike.getQuantizedPosition(pt);
             GlyphData data = getCachedGlyph(gc, subPixel);
             if (data != null) {
-                if (clip != null) {
-                    // Always check clipping using user space.
-                    if (x + gl.getPosX(gi) > clip.getMaxX()) break;
-                    if (x + gl.getPosX(gi + 1) < clip.getMinX()) continue;
-                }
                 /* Will not render selected text for complex
                  * paints such as gradient.
                  */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,7 @@ public final class PrismSettings {
     public static final boolean isVsyncEnabled;
     public static final boolean dirtyOptsEnabled;
     public static final boolean occlusionCullingEnabled;
+    public static final boolean frustumCulling3D;
     public static final boolean scrollCacheOpt;
     public static final boolean threadCheck;
     public static final boolean cacheSimpleShapes;
@@ -66,15 +67,22 @@ public final class PrismSettings {
     public static final boolean disableRegionCaching;
     public static final boolean forcePow2;
     public static final boolean noClampToZero;
+    public static final boolean imageMipmaps;
     public static final boolean allowHiDPIScaling;
     public static final long maxVram;
     public static final long targetVram;
     public static final boolean poolStats;
     public static final boolean poolDebug;
     public static final boolean disableEffects;
+    public static final long effectCacheSize;
     public static final int glyphCacheWidth;
     public static final int glyphCacheHeight;
     public static final String perfLog;
+    public static final String shaderCacheDir;
+    public static final boolean prewarmPhongShaders;
+    public static final boolean d3dFlipEx;
+    public static final int d3dMaxFrameLatency;
+    public static final int d3dAdapter;
     public static final boolean perfLogExitFlush;
     public static final boolean perfLogFirstPaintFlush;
     public static final boolean perfLogFirstPaintExit;
@@ -126,6 +134,9 @@ public final class PrismSettings {
                                                "prism.occlusion.culling",
                                                true);
 
+        // Skip 3D shapes whose bounds are outside of the view frustum
+        frustumCulling3D = getBoolean(systemProperties, "prism.frustumculling3d", true);
+
         // The maximum number of dirty regions to use. The absolute max that we can
         // support at present is 15.
         dirtyRegionCount = Utils.clamp(0, getInt(systemProperties, "prism.dirtyregioncount", 6, null), 15);
@@ -255,9 +266,29 @@ public final class PrismSettings {
         /* Setting for reference type used by Disposer */
         refType = systemProperties.getProperty("prism.reftype");
 
+        /* Directory of the ES2 shader program binary cache, no cache if unset */
+        shaderCacheDir = systemProperties.getProperty("prism.shadercache");
+
+        /* Build the ES2 Phong shaders for all light counts of a material at once */
+        prewarmPhongShaders = getBoolean(systemProperties, "prism.prewarmphongshaders", false);
+
+        /* Present D3D swap chains with the flip model, falls back to copy */
+        d3dFlipEx = getBoolean(systemProperties, "prism.d3d.flipex", false);
+
+        /* Number of frames the D3D device may queue, 0 keeps the driver default */
+        d3dMaxFrameLatency = Utils.clamp(0, getInt(systemProperties, "prism.d3d.maxframelatency", 0, null), 16);
+
+        /* D3D adapter used for all screens, -1 uses the adapter of each screen's monitor */
+        d3dAdapter = getInt(systemProperties, "prism.d3d.adapter", -1,
+                            "Try -Dprism.d3d.adapter=<number>");
+
         forcePow2 = getBoolean(systemProperties, "prism.forcepowerof2", false);
         noClampToZero = getBoolean(systemProperties, "prism.noclamptozero", false);
 
+        /* Sample images drawn well below their native size from mipmaps */
+        imageMipmaps = getBoolean(systemProperties, "prism.imagemipmaps",
+                                  !PlatformUtil.isEmbedded());
+
         allowHiDPIScaling = getBoolean(systemProperties, "prism.allowhidpi", true);
 
         maxVram = getLong(systemProperties, "prism.maxvram", 512 * 1024 * 1024,
@@ -322,6 +353,10 @@ public final class PrismSettings {
 
         disableEffects = getBoolean(systemProperties, "prism.disableEffects", false);
 
+        /* Memory budget for effect results that are kept while their input is unchanged */
+        effectCacheSize = getLong(systemProperties, "prism.effectcachesize", 32 * 1024 * 1024,
+                                  "Try -Dprism.effectcachesize=<long>[kKmMgG]");
+
         glyphCacheWidth = getInt(systemProperties, "prism.glyphCacheWidth", 1024,
                 "Try -Dprism.glyphCacheWidth=<number>");
         glyphCacheHeight = getInt(systemProperties, "prism.glyphCacheHeight", 1024,
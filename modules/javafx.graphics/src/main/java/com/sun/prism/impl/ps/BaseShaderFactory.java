@@ -45,9 +45,10 @@ public abstract class BaseShaderFactory extends BaseResourceFactory
 
     public BaseShaderFactory(Map<Image, Texture> clampTexCache,
                              Map<Image, Texture> repeatTexCache,
-                             Map<Image, Texture> mipmapTexCache)
+                             Map<Image, Texture> mipmapTexCache,
+                             Map<Image, Texture> clampMipmapTexCache)
     {
-        super(clampTexCache, repeatTexCache, mipmapTexCache);
+        super(clampTexCache, repeatTexCache, mipmapTexCache, clampMipmapTexCache);
     }
 
     @Override
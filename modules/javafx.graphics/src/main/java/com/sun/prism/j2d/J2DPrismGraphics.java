@@ -497,7 +497,7 @@ public class J2DPrismGraphics
     }
 
     private static AdaptorShape tmpAdaptor = new AdaptorShape();
-    private static java.awt.Shape tmpShape(Shape s) {
+    static java.awt.Shape tmpShape(Shape s) {
         tmpAdaptor.setShape(s);
         return tmpAdaptor;
     }
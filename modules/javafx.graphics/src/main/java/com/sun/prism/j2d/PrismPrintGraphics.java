@@ -25,7 +25,9 @@
 
 package com.sun.prism.j2d;
 
+import java.util.ArrayList;
 import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.geom.Shape;
 import com.sun.prism.PresentableState;
 import com.sun.prism.PrinterGraphics;
 
@@ -123,6 +125,43 @@ public final class PrismPrintGraphics
         origTx2D = g2d.getTransform();
     }
 
+    // Shape clips pushed by the scene graph, kept in device space and
+    // re-applied whenever the rectangular clip is replaced, since
+    // setClipRect() resets the whole Graphics2D clip.
+    private java.awt.geom.Area clipArea;
+    private final ArrayList<java.awt.geom.Area> savedClipAreas = new ArrayList<>();
+
+    @Override
+    public void pushClipShape(Shape devShape) {
+        savedClipAreas.add(clipArea);
+        java.awt.geom.Area area = new java.awt.geom.Area(tmpShape(devShape));
+        if (clipArea != null) {
+            area.intersect(clipArea);
+        }
+        clipArea = area;
+        applyClipArea();
+    }
+
+    @Override
+    public void popClipShape() {
+        clipArea = savedClipAreas.remove(savedClipAreas.size() - 1);
+        setClipRect(clipRect);
+    }
+
+    @Override
+    public void setClipRect(Rectangle clipRect) {
+        super.setClipRect(clipRect);
+        applyClipArea();
+    }
+
+    private void applyClipArea() {
+        if (clipArea != null) {
+            setTransformG2D(J2D_IDENTITY);
+            g2d.clip(clipArea);
+            setTransformG2D(tmpJ2DTransform(transform));
+        }
+    }
+
     public PrismPrintGraphics(java.awt.Graphics2D g2d, int width, int height) {
         super(new PagePresentable(width, height), g2d);
         setClipRect(new Rectangle(0,0,width,height));
@@ -209,6 +209,30 @@ public class ColorAdjust extends CoreEffect<RenderState> {
         this.contrast = contrast;
     }
 
+    /**
+     * Returns true if all adjustments are at their identity values, in which case
+     * the output is identical to the input.
+     */
+    private boolean isNop() {
+        return hue == 0f && saturation == 0f && brightness == 0f && contrast == 0f;
+    }
+
+    @Override
+    public ImageData filterImageDatas(FilterContext fctx,
+                                      BaseTransform transform,
+                                      Rectangle outputClip,
+                                      RenderState rstate,
+                                      ImageData... inputs)
+    {
+        if (isNop()) {
+            // Pass the input through rather than running the shader
+            // into an intermediate image that would hold the same pixels
+            inputs[0].addref();
+            return inputs[0];
+        }
+        return super.filterImageDatas(fctx, transform, outputClip, rstate, inputs);
+    }
+
     @Override
     public RenderState getRenderState(FilterContext fctx,
                                       BaseTransform transform,
@@ -111,6 +111,30 @@ public class SepiaTone extends CoreEffect<RenderState> {
         this.level = level;
     }
 
+    /**
+     * Returns true if the level is at its identity value, in which case
+     * the output is identical to the input.
+     */
+    private boolean isNop() {
+        return level == 0f;
+    }
+
+    @Override
+    public ImageData filterImageDatas(FilterContext fctx,
+                                      BaseTransform transform,
+                                      Rectangle outputClip,
+                                      RenderState rstate,
+                                      ImageData... inputs)
+    {
+        if (isNop()) {
+            // Pass the input through rather than running the shader
+            // into an intermediate image that would hold the same pixels
+            inputs[0].addref();
+            return inputs[0];
+        }
+        return super.filterImageDatas(fctx, transform, outputClip, rstate, inputs);
+    }
+
     @Override
     public RenderState getRenderState(FilterContext fctx,
                                       BaseTransform transform,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -182,6 +182,83 @@ public class PrEffectHelper {
         g.setTransform(origtx);
     }
 
+    /**
+     * Applies the given filter effect for the whole render target of the
+     * provided {@code Graphics} and returns the result, rather than rendering
+     * it, so that it can be drawn again with
+     * {@link #renderCached(ImageData, Graphics, Rectangle)} for as long as
+     * the effect and its inputs do not change.
+     * The result is computed as a device space image, so this only works for
+     * 2D transforms and returns {@code null} in any other case.
+     *
+     * @param effect the effect to be rendered
+     * @param g the {@code Graphics} to which the {@code Effect} will be
+     *          rendered
+     * @param defaultInput the default input {@code Effect}
+     * @param coverage set to the device space area covered by the result
+     * @return the filtered result, owned by the caller, or {@code null}
+     */
+    public static ImageData filterForCache(Effect effect, Graphics g,
+                                           Effect defaultInput,
+                                           Rectangle coverage)
+    {
+        BaseTransform origtx = g.getTransformNoClone();
+        Screen screen = g.getAssociatedScreen();
+        if (!origtx.is2D() || screen == null) {
+            return null;
+        }
+        BaseTransform transform = origtx.isIdentity()
+            ? BaseTransform.IDENTITY_TRANSFORM
+            : new Affine2D(origtx);
+        RenderTarget rt = g.getRenderTarget();
+        Rectangle rclip = new Rectangle(rt.getContentWidth(), rt.getContentHeight());
+        FilterContext fctx = PrFilterContext.getInstance(screen);
+        ImagePool.numEffects++;
+        // No PrRenderInfo, the result must end up in an image to be reused
+        ImageData res = effect.filter(fctx, transform, rclip, null, defaultInput);
+        if (res == null) {
+            return null;
+        }
+        if (!res.validate(fctx)) {
+            res.unref();
+            return null;
+        }
+        coverage.setBounds(rclip);
+        return res;
+    }
+
+    /**
+     * Renders a result returned by
+     * {@link #filterForCache(Effect, Graphics, Effect, Rectangle)} to the
+     * provided {@code Graphics}, which must use the same transform as when
+     * the result was computed.
+     *
+     * @param res the cached result
+     * @param g the {@code Graphics} to which the result will be rendered
+     * @param coverage the device space area covered by the result
+     * @return {@code false}, without rendering anything, if the result
+     *         cannot be used for this {@code Graphics} anymore
+     */
+    public static boolean renderCached(ImageData res, Graphics g,
+                                       Rectangle coverage)
+    {
+        Screen screen = g.getAssociatedScreen();
+        if (screen == null ||
+            !coverage.contains(getGraphicsClipNoClone(g)) ||
+            !res.validate(PrFilterContext.getInstance(screen)))
+        {
+            return false;
+        }
+        BaseTransform origtx = g.getTransformNoClone().copy();
+        Rectangle r = res.getUntransformedBounds();
+        Texture tex = ((PrTexture)res.getUntransformedImage()).getTextureObject();
+        g.setTransform(null);
+        g.transform(res.getTransform());
+        g.drawTexture(tex, r.x, r.y, r.width, r.height);
+        g.setTransform(origtx);
+        return true;
+    }
+
     static Point2D project(float x, float y, double vw, double vh,
                            NGCamera cam, BaseTransform inv,
                            PickRay tmpray, Vec3d tmpvec, Point2D ret)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -75,49 +75,38 @@ public class SSEBoxBlurPeer extends SSEEffectPeer<BoxRenderState> {
         HeapImage src = (HeapImage)inputs[0].getUntransformedImage();
         Rectangle srcr = inputs[0].getUntransformedBounds();
 
-        HeapImage cur = src;
-        int curw = srcr.width;
-        int curh = srcr.height;
-        int curscan = cur.getScanlineStride();
-        int[] curPixels = cur.getPixelArray();
+        int srcw = srcr.width;
+        int srch = srcr.height;
+        int srcscan = src.getScanlineStride();
+        int[] srcPixels = src.getPixelArray();
 
-        int finalw = curw + growx;
-        int finalh = curh + growy;
-        while (curw < finalw || curh < finalh) {
-            int neww = curw + hinc;
-            int newh = curh + vinc;
-            if (neww > finalw) neww = finalw;
-            if (newh > finalh) newh = finalh;
-            HeapImage dst = (HeapImage)getRenderer().getCompatibleImage(neww, newh);
-            int newscan = dst.getScanlineStride();
-            int[] newPixels = dst.getPixelArray();
-            if (horizontal) {
-                filterHorizontal(newPixels, neww, newh, newscan,
-                                 curPixels, curw, curh, curscan);
-            } else {
-                filterVertical(newPixels, neww, newh, newscan,
-                               curPixels, curw, curh, curscan);
-            }
-            if (cur != src) {
-                getRenderer().releaseCompatibleImage(cur);
-            }
-            cur = dst;
-            curw = neww;
-            curh = newh;
-            curPixels = newPixels;
-            curscan = newscan;
+        // All of the passes run in a single native call which keeps the
+        // intermediate lines in its own scratch buffers.
+        int finalw = srcw + growx;
+        int finalh = srch + growy;
+        HeapImage dst = (HeapImage)getRenderer().getCompatibleImage(finalw, finalh);
+        int dstscan = dst.getScanlineStride();
+        int[] dstPixels = dst.getPixelArray();
+        if (horizontal) {
+            filterHorizontal(dstPixels, finalw, finalh, dstscan,
+                             srcPixels, srcw, srch, srcscan, hinc);
+        } else {
+            filterVertical(dstPixels, finalw, finalh, dstscan,
+                           srcPixels, srcw, srch, srcscan, vinc);
         }
 
         Rectangle dstBounds =
-            new Rectangle(srcr.x - growx/2, srcr.y - growy/2, curw, curh);
-        return new ImageData(getFilterContext(), cur, dstBounds);
+            new Rectangle(srcr.x - growx/2, srcr.y - growy/2, finalw, finalh);
+        return new ImageData(getFilterContext(), dst, dstBounds);
     }
 
     private static native void
         filterHorizontal(int dstPixels[], int dstw, int dsth, int dstscan,
-                         int srcPixels[], int srcw, int srch, int srcscan);
+                         int srcPixels[], int srcw, int srch, int srcscan,
+                         int hinc);
 
     private static native void
         filterVertical(int dstPixels[], int dstw, int dsth, int dstscan,
-                       int srcPixels[], int srcw, int srch, int srcscan);
+                       int srcPixels[], int srcw, int srch, int srcscan,
+                       int vinc);
 }
@@ -33,6 +33,7 @@ import com.sun.javafx.geom.BoxBounds;
 import com.sun.javafx.geom.PickRay;
 import com.sun.javafx.geom.Vec3d;
 import com.sun.javafx.scene.input.PickResultChooser;
+import com.sun.javafx.scene.shape.TriangleMeshBVH;
 import com.sun.javafx.scene.shape.TriangleMeshHelper;
 import com.sun.javafx.sg.prism.NGTriangleMesh;
 import javafx.beans.property.ObjectProperty;
@@ -151,6 +152,12 @@ public class TriangleMesh extends Mesh {
 
     private BaseBounds cachedBounds;
 
+    // Meshes with at least this many faces get a bounding volume hierarchy
+    // for picking once they are picked twice without changing in between.
+    private static final int PICK_TREE_MIN_FACES = 64;
+    private TriangleMeshBVH pickTree;
+    private boolean pickedSinceChange;
+
     /**
      * Creates a new instance of {@code TriangleMesh} class with the default
      * {@code VertexFormat.POINT_TEXCOORD} format type.
@@ -217,6 +224,7 @@ public class TriangleMesh extends Mesh {
                 @Override
                 protected void invalidated() {
                     setDirty(true);
+                    invalidatePickTree();
                     // Need to mark faces and faceSmoothingGroups dirty too.
                     facesSyncer.setDirty(true);
                     faceSmoothingGroupsSyncer.setDirty(true);
@@ -835,6 +843,13 @@ public class TriangleMesh extends Mesh {
 
             final Vec3d d = pickRay.getDirectionNoClone();
 
+            final TriangleMeshBVH tree = getPickTree();
+            if (tree != null) {
+                return tree.intersects(o, d, pickRay.getNearClip(), pickRay.getFarClip(),
+                        i -> computeIntersectsFace(pickRay, o, d, i, cullFace, candidate,
+                                reportFace, pickResult));
+            }
+
             for (int i = 0; i < size; i += getFaceElementSize()) {
                 if (computeIntersectsFace(pickRay, o, d, i, cullFace, candidate,
                         reportFace, pickResult)) {
@@ -845,6 +860,31 @@ public class TriangleMesh extends Mesh {
         return found;
     }
 
+    /**
+     * Returns the picking tree of this mesh, building it if the mesh is large
+     * enough and has been picked before without changing its points or faces
+     * since, so that meshes animated every frame don't pay for a rebuild on
+     * each pick.
+     * @return the picking tree, or null to test all faces
+     */
+    private TriangleMeshBVH getPickTree() {
+        if (pickTree == null) {
+            final int numFaces = faces.size() / getFaceElementSize();
+            if (numFaces < PICK_TREE_MIN_FACES || !pickedSinceChange) {
+                pickedSinceChange = true;
+                return null;
+            }
+            pickTree = TriangleMeshBVH.build(points.toArray(null), getPointElementSize(),
+                    faces.toArray(null), getVertexFormat().getVertexIndexSize());
+        }
+        return pickTree;
+    }
+
+    private void invalidatePickTree() {
+        pickTree = null;
+        pickedSinceChange = false;
+    }
+
     private class Listener<T extends ObservableArray<T>> implements ArrayChangeListener<T>, FloatArraySyncer, IntegerArraySyncer {
 
         protected final T array;
@@ -889,6 +929,9 @@ public class TriangleMesh extends Mesh {
 
         @Override
         public void onChanged(T observableArray, boolean sizeChanged, int from, int to) {
+            if (array == points || array == faces) {
+                invalidatePickTree();
+            }
             if (sizeChanged) {
                 setDirty(true);
             } else {
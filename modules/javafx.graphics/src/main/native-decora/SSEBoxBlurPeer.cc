@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,19 +29,230 @@
  */
 
 #include <jni.h>
+#include <stdlib.h>
 #include "SSEUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer.h"
 
+/*
+ * Running per-channel sums of the box.  Each channel of a pixel occupies
+ * one 32-bit lane, in the byte order of the pixel, so a whole pixel is
+ * accumulated, scaled and repacked with a handful of vector operations.
+ */
+#if defined(DECORA_SSE2)
+
+typedef __m128i boxsum_t;
+
+static inline boxsum_t boxsum_zero() {
+    return _mm_setzero_si128();
+}
+
+static inline boxsum_t boxsum_unpack(jint rgb) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_unpacklo_epi8(_mm_cvtsi32_si128(rgb), zero);
+    return _mm_unpacklo_epi16(v, zero);
+}
+
+static inline boxsum_t boxsum_add(boxsum_t sum, jint rgb) {
+    return _mm_add_epi32(sum, boxsum_unpack(rgb));
+}
+
+static inline boxsum_t boxsum_sub(boxsum_t sum, jint rgb) {
+    return _mm_sub_epi32(sum, boxsum_unpack(rgb));
+}
+
+static inline jint boxsum_scale(boxsum_t sum, jint kscale) {
+    // SSE2 has no 32-bit low multiply, so multiply the even and the odd
+    // lanes separately; the products never exceed 31 bits.
+    __m128i k = _mm_set1_epi32(kscale);
+    __m128i even = _mm_mul_epu32(sum, k);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(sum, 32), k);
+    __m128i v = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                   _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    v = _mm_srli_epi32(v, 23);
+    v = _mm_packs_epi32(v, v);
+    return _mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+}
+
+#elif defined(DECORA_NEON)
+
+typedef int32x4_t boxsum_t;
+
+static inline boxsum_t boxsum_zero() {
+    return vdupq_n_s32(0);
+}
+
+static inline boxsum_t boxsum_unpack(jint rgb) {
+    uint8x8_t v = vreinterpret_u8_u32(vdup_n_u32((uint32_t) rgb));
+    return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(v))));
+}
+
+static inline boxsum_t boxsum_add(boxsum_t sum, jint rgb) {
+    return vaddq_s32(sum, boxsum_unpack(rgb));
+}
+
+static inline boxsum_t boxsum_sub(boxsum_t sum, jint rgb) {
+    return vsubq_s32(sum, boxsum_unpack(rgb));
+}
+
+static inline jint boxsum_scale(boxsum_t sum, jint kscale) {
+    uint32x4_t v = vreinterpretq_u32_s32(vshrq_n_s32(vmulq_n_s32(sum, kscale), 23));
+    uint16x4_t h = vmovn_u32(v);
+    uint8x8_t b = vmovn_u16(vcombine_u16(h, h));
+    return (jint) vget_lane_u32(vreinterpret_u32_u8(b), 0);
+}
+
+#else
+
+typedef struct {
+    jint a, r, g, b;
+} boxsum_t;
+
+static inline boxsum_t boxsum_zero() {
+    boxsum_t sum = { 0, 0, 0, 0 };
+    return sum;
+}
+
+static inline boxsum_t boxsum_add(boxsum_t sum, jint rgb) {
+    sum.a += (rgb >> 24) & 0xff;
+    sum.r += (rgb >> 16) & 0xff;
+    sum.g += (rgb >>  8) & 0xff;
+    sum.b += (rgb      ) & 0xff;
+    return sum;
+}
+
+static inline boxsum_t boxsum_sub(boxsum_t sum, jint rgb) {
+    sum.a -= (rgb >> 24) & 0xff;
+    sum.r -= (rgb >> 16) & 0xff;
+    sum.g -= (rgb >>  8) & 0xff;
+    sum.b -= (rgb      ) & 0xff;
+    return sum;
+}
+
+static inline jint boxsum_scale(boxsum_t sum, jint kscale) {
+    return
+        (((sum.a * kscale) >> 23) << 24) +
+        (((sum.r * kscale) >> 23) << 16) +
+        (((sum.g * kscale) >> 23) <<  8) +
+        (((sum.b * kscale) >> 23)      );
+}
+
+#endif
+
+/*
+ * Runs one box pass over a line of srclen pixels into a line of dstlen
+ * pixels, the box being (dstlen - srclen + 1) pixels wide.
+ */
+static void boxPass(jint *dst, jint dstinc, jint dstlen,
+                    jint *src, jint srcinc, jint srclen)
+{
+    jint ksize = dstlen - srclen + 1;
+    jint kscale = 0x7fffffff / (ksize * 255);
+    boxsum_t sum = boxsum_zero();
+    for (jint i = 0; i < dstlen; i++) {
+        // Un-accumulate the data for the i-ksize location into the sums.
+        if (i >= ksize) {
+            sum = boxsum_sub(sum, src[(i - ksize) * srcinc]);
+        }
+        // Accumulate the data for this location into the sums.
+        if (i < srclen) {
+            sum = boxsum_add(sum, src[i * srcinc]);
+        }
+        dst[i * dstinc] = boxsum_scale(sum, kscale);
+    }
+}
+
+/*
+ * Runs all of the passes of a multi-pass box blur over one line.  Each
+ * pass grows the line by inc pixels, the last one being cut short at
+ * dstlen.  The intermediate lines ping-pong between the two halves of
+ * scratch, which holds 2 * dstlen pixels, so only the source and the
+ * final destination line ever touch the images.
+ */
+static void boxPasses(jint *dst, jint dstinc, jint dstlen,
+                      jint *src, jint srcinc, jint srclen,
+                      jint inc, jint *scratch)
+{
+    jint *next = scratch;
+    while (srclen + inc < dstlen) {
+        boxPass(next, 1, srclen + inc, src, srcinc, srclen);
+        src = next;
+        srcinc = 1;
+        srclen += inc;
+        next = (next == scratch) ? scratch + dstlen : scratch;
+    }
+    boxPass(dst, dstinc, dstlen, src, srcinc, srclen);
+}
+
+struct BoxBlurData {
+    jint *dstPixels;
+    jint dstw, dsth, dstscan;
+    jint *srcPixels;
+    jint srcw, srch, srcscan;
+    jint inc;
+    jboolean outOfMemory;
+};
+
+static jint *allocScratch(BoxBlurData *data, jint srclen, jint dstlen)
+{
+    if (srclen + data->inc >= dstlen) {
+        // A single pass needs no intermediate lines.
+        return NULL;
+    }
+    jint *scratch = (jint *) malloc(2 * dstlen * sizeof(jint));
+    if (scratch == NULL) {
+        data->outOfMemory = JNI_TRUE;
+    }
+    return scratch;
+}
+
+static void filterHorizontalRows(void *pData, jint ystart, jint yend)
+{
+    BoxBlurData *data = (BoxBlurData *) pData;
+    jint *scratch = allocScratch(data, data->srcw, data->dstw);
+    if (scratch == NULL && data->outOfMemory) {
+        return;
+    }
+    for (jint y = ystart; y < yend; y++) {
+        boxPasses(data->dstPixels + y * data->dstscan, 1, data->dstw,
+                  data->srcPixels + y * data->srcscan, 1, data->srcw,
+                  data->inc, scratch);
+    }
+    free(scratch);
+}
+
+static void filterVerticalColumns(void *pData, jint xstart, jint xend)
+{
+    BoxBlurData *data = (BoxBlurData *) pData;
+    jint *scratch = allocScratch(data, data->srch, data->dsth);
+    if (scratch == NULL && data->outOfMemory) {
+        return;
+    }
+    for (jint x = xstart; x < xend; x++) {
+        boxPasses(data->dstPixels + x, data->dstscan, data->dsth,
+                  data->srcPixels + x, data->srcscan, data->srch,
+                  data->inc, scratch);
+    }
+    free(scratch);
+}
+
+/*
+ * Both methods run all of the passes of a box blur in one direction,
+ * growing the image by inc pixels per pass up to the size of the
+ * destination.
+ */
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
     (JNIEnv *env, jclass klass,
      jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan)
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint hinc)
 {
     if ((checkRange(env,
                     dstPixels_arr, dstw, dsth,
                     srcPixels_arr, srcw, srch)) ||
-        dsth > srch) { // We should not move out of source vertical bounds
+        dsth > srch || // We should not move out of source vertical bounds
+        hinc < 1 || dstw <= srcw)
+    {
         return;
     }
 
@@ -53,53 +264,42 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterHorizontal
         return;
     }
 
-    jint hsize = dstw - srcw + 1;
-    jint kscale = 0x7fffffff / (hsize * 255);
-    jint srcoff = 0;
-    jint dstoff = 0;
-    for (jint y = 0; y < dsth; y++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
-        for (jint x = 0; x < dstw; x++) {
-            jint rgb;
-            // Un-accumulate the data for col-hsize location into the sums.
-            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
-            dstPixels[dstoff + x] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
-        }
-        srcoff += srcscan;
-        dstoff += dstscan;
-    }
+    BoxBlurData data;
+    data.dstPixels = dstPixels;
+    data.dstw = dstw;
+    data.dsth = dsth;
+    data.dstscan = dstscan;
+    data.srcPixels = srcPixels;
+    data.srcw = srcw;
+    data.srch = srch;
+    data.srcscan = srcscan;
+    data.inc = hinc;
+    data.outOfMemory = JNI_FALSE;
+    // Rows are independent of each other.
+    runStripes(dsth, dstw, filterHorizontalRows, &data);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+
+    if (data.outOfMemory) {
+        env->ThrowNew(env->FindClass("java/lang/OutOfMemoryError"),
+                      "Allocation of box blur line buffer failed.");
+    }
 }
 
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
     (JNIEnv *env, jclass klass,
      jintArray dstPixels_arr, jint dstw, jint dsth, jint dstscan,
-     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan)
+     jintArray srcPixels_arr, jint srcw, jint srch, jint srcscan,
+     jint vinc)
 {
     if ((checkRange(env,
                     dstPixels_arr, dstw, dsth,
                     srcPixels_arr, srcw, srch)) ||
-        dstw > srcw) { // We should not move out of source horizontal bounds
+        dstw > srcw || // We should not move out of source horizontal bounds
+        vinc < 1 || dsth <= srch)
+    {
         return;
     }
 
@@ -111,42 +311,27 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxBlurPeer_filterVertical
         return;
     }
 
-    jint vsize = dsth - srch + 1;
-    jint kscale = 0x7fffffff / (vsize * 255);
-    jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint sumr = 0;
-        jint sumg = 0;
-        jint sumb = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            sumr -= (rgb >> 16) & 0xff;
-            sumg -= (rgb >>  8) & 0xff;
-            sumb -= (rgb      ) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            sumr += (rgb >> 16) & 0xff;
-            sumg += (rgb >>  8) & 0xff;
-            sumb += (rgb      ) & 0xff;
-            dstPixels[dstoff] =
-                (((suma * kscale) >> 23) << 24) +
-                (((sumr * kscale) >> 23) << 16) +
-                (((sumg * kscale) >> 23) <<  8) +
-                (((sumb * kscale) >> 23)      );
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+    BoxBlurData data;
+    data.dstPixels = dstPixels;
+    data.dstw = dstw;
+    data.dsth = dsth;
+    data.dstscan = dstscan;
+    data.srcPixels = srcPixels;
+    data.srcw = srcw;
+    data.srch = srch;
+    data.srcscan = srcscan;
+    data.inc = vinc;
+    data.outOfMemory = JNI_FALSE;
+    // Columns are independent of each other.
+    runStripes(dstw, dsth, filterVerticalColumns, &data);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
+
+    if (data.outOfMemory) {
+        env->ThrowNew(env->FindClass("java/lang/OutOfMemoryError"),
+                      "Allocation of box blur line buffer failed.");
+    }
 }
 
 #if 0
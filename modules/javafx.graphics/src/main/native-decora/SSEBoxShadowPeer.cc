@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,131 @@
 #include "SSEUtils.h"
 #include "com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer.h"
 
+struct BoxShadowData {
+    jint *dstPixels;
+    jint dstw, dsth, dstscan;
+    jint *srcPixels;
+    jint srcw, srch, srcscan;
+    jint amin, amax;
+    jint kscalea, kscaler, kscaleg, kscaleb;
+    jint shadowRGB;
+};
+
+static void filterHorizontalBlackRows(void *pData, jint ystart, jint yend)
+{
+    BoxShadowData *data = (BoxShadowData *) pData;
+    jint *srcPixels = data->srcPixels;
+    jint *dstPixels = data->dstPixels;
+    jint dstw = data->dstw;
+    jint srcw = data->srcw;
+    jint hsize = dstw - srcw + 1;
+    jint amin = data->amin;
+    jint amax = data->amax;
+    jint kscale = data->kscalea;
+    jint srcoff = ystart * data->srcscan;
+    jint dstoff = ystart * data->dstscan;
+    for (jint y = ystart; y < yend; y++) {
+        jint suma = 0;
+        for (jint x = 0; x < dstw; x++) {
+            jint rgb;
+            // Un-accumulate the data for col-hsize location into the sums.
+            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this col location into the sums.
+            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
+            suma += (rgb >> 24) & 0xff;
+            // Clamp, scale and convert the sum into a color.
+            dstPixels[dstoff + x] =
+                ((suma < amin) ? 0
+                 : ((suma >= amax) ? 0xff000000
+                    : (((suma * kscale) >> 23) << 24)));
+        }
+        srcoff += data->srcscan;
+        dstoff += data->dstscan;
+    }
+}
+
+static void filterVerticalBlackColumns(void *pData, jint xstart, jint xend)
+{
+    BoxShadowData *data = (BoxShadowData *) pData;
+    jint *srcPixels = data->srcPixels;
+    jint *dstPixels = data->dstPixels;
+    jint dsth = data->dsth;
+    jint srch = data->srch;
+    jint srcscan = data->srcscan;
+    jint dstscan = data->dstscan;
+    jint vsize = dsth - srch + 1;
+    jint amin = data->amin;
+    jint amax = data->amax;
+    jint kscale = data->kscalea;
+    jint voff = vsize * srcscan;
+    for (jint x = xstart; x < xend; x++) {
+        jint suma = 0;
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            jint rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this row location into the sums.
+            rgb = (y < srch) ? srcPixels[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            // Clamp, scale and convert the sum into a color.
+            dstPixels[dstoff] =
+                ((suma < amin) ? 0
+                 : ((suma >= amax) ? 0xff000000
+                    : (((suma * kscale) >> 23) << 24)));
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
+static void filterVerticalColumns(void *pData, jint xstart, jint xend)
+{
+    BoxShadowData *data = (BoxShadowData *) pData;
+    jint *srcPixels = data->srcPixels;
+    jint *dstPixels = data->dstPixels;
+    jint dsth = data->dsth;
+    jint srch = data->srch;
+    jint srcscan = data->srcscan;
+    jint dstscan = data->dstscan;
+    jint vsize = dsth - srch + 1;
+    jint amin = data->amin;
+    jint amax = data->amax;
+    jint kscalea = data->kscalea;
+    jint kscaler = data->kscaler;
+    jint kscaleg = data->kscaleg;
+    jint kscaleb = data->kscaleb;
+    jint shadowRGB = data->shadowRGB;
+    jint voff = vsize * srcscan;
+    for (jint x = xstart; x < xend; x++) {
+        jint suma = 0;
+        jint srcoff = x;
+        jint dstoff = x;
+        for (jint y = 0; y < dsth; y++) {
+            jint rgb;
+            // Un-accumulate the data for row-vsize location into the sums.
+            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
+            suma -= (rgb >> 24) & 0xff;
+            // Accumulate the data for this row location into the sums.
+            rgb = (y < srch) ? srcPixels[srcoff] : 0;
+            suma += (rgb >> 24) & 0xff;
+            // Clamp, scale and convert the sum into a color.
+            dstPixels[dstoff] =
+                ((suma < amin) ? 0
+                 : ((suma >= amax) ? shadowRGB
+                    : ((((suma * kscalea) >> 23) << 24) |
+                       (((suma * kscaler) >> 23) << 16) |
+                       (((suma * kscaleg) >> 23) <<  8) |
+                       (((suma * kscaleb) >> 23)      ))));
+            srcoff += srcscan;
+            dstoff += dstscan;
+        }
+    }
+}
+
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBlack
     (JNIEnv *env, jclass klass,
@@ -58,29 +183,21 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterHorizontalBlack
     // amax goes from hsize*255 to 255 as spread goes from 0 to 1
     jint amax = hsize * 255;
     amax += (jint) ((255 - amax) * spread);
-    jint kscale = 0x7fffffff / amax;
-    jint amin = (amax / 255);
-    jint srcoff = 0;
-    jint dstoff = 0;
-    for (jint y = 0; y < dsth; y++) {
-        jint suma = 0;
-        for (jint x = 0; x < dstw; x++) {
-            jint rgb;
-            // Un-accumulate the data for col-hsize location into the sums.
-            rgb = (x >= hsize) ? srcPixels[srcoff + x - hsize] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            // Accumulate the data for this col location into the sums.
-            rgb = (x < srcw) ? srcPixels[srcoff + x] : 0;
-            suma += (rgb >> 24) & 0xff;
-            // Clamp, scale and convert the sum into a color.
-            dstPixels[dstoff + x] =
-                ((suma < amin) ? 0
-                 : ((suma >= amax) ? 0xff000000
-                    : (((suma * kscale) >> 23) << 24)));
-        }
-        srcoff += srcscan;
-        dstoff += dstscan;
-    }
+
+    BoxShadowData data;
+    data.dstPixels = dstPixels;
+    data.dstw = dstw;
+    data.dsth = dsth;
+    data.dstscan = dstscan;
+    data.srcPixels = srcPixels;
+    data.srcw = srcw;
+    data.srch = srch;
+    data.srcscan = srcscan;
+    data.amax = amax;
+    data.amin = (amax / 255);
+    data.kscalea = 0x7fffffff / amax;
+    // Rows are independent of each other.
+    runStripes(dsth, dstw, filterHorizontalBlackRows, &data);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -112,30 +229,21 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVerticalBlack
     // amax goes from hsize*255 to 255 as spread goes from 0 to 1
     jint amax = vsize * 255;
     amax += (jint) ((255 - amax) * spread);
-    jint kscale = 0x7fffffff / amax;
-    jint amin = (amax / 255);
-    jint voff = vsize * srcscan;
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            // Accumulate the data for this row location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            // Clamp, scale and convert the sum into a color.
-            dstPixels[dstoff] =
-                ((suma < amin) ? 0
-                 : ((suma >= amax) ? 0xff000000
-                    : (((suma * kscale) >> 23) << 24)));
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+
+    BoxShadowData data;
+    data.dstPixels = dstPixels;
+    data.dstw = dstw;
+    data.dsth = dsth;
+    data.dstscan = dstscan;
+    data.srcPixels = srcPixels;
+    data.srcw = srcw;
+    data.srch = srch;
+    data.srcscan = srcscan;
+    data.amax = amax;
+    data.amin = (amax / 255);
+    data.kscalea = 0x7fffffff / amax;
+    // Columns are independent of each other.
+    runStripes(dstw, dsth, filterVerticalBlackColumns, &data);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
@@ -171,41 +279,29 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSEBoxShadowPeer_filterVertical
     jint amax = vsize * 255;
     amax += (jint) ((255 - amax) * spread);
     jint kscalea = 0x7fffffff / amax;
-    jint kscaler = (jint) (kscalea * shadowColor[0]);
-    jint kscaleg = (jint) (kscalea * shadowColor[1]);
-    jint kscaleb = (jint) (kscalea * shadowColor[2]);
-    kscalea = (jint) (kscalea * shadowColor[3]);
-    jint amin = (amax / 255);
-    jint voff = vsize * srcscan;
-    jint shadowRGB =
+
+    BoxShadowData data;
+    data.dstPixels = dstPixels;
+    data.dstw = dstw;
+    data.dsth = dsth;
+    data.dstscan = dstscan;
+    data.srcPixels = srcPixels;
+    data.srcw = srcw;
+    data.srch = srch;
+    data.srcscan = srcscan;
+    data.amax = amax;
+    data.amin = (amax / 255);
+    data.kscaler = (jint) (kscalea * shadowColor[0]);
+    data.kscaleg = (jint) (kscalea * shadowColor[1]);
+    data.kscaleb = (jint) (kscalea * shadowColor[2]);
+    data.kscalea = (jint) (kscalea * shadowColor[3]);
+    data.shadowRGB =
         (((jint) (shadowColor[0] * 255)) << 16) |
         (((jint) (shadowColor[1] * 255)) <<  8) |
         (((jint) (shadowColor[2] * 255))      ) |
         (((jint) (shadowColor[3] * 255)) << 24);
-    for (jint x = 0; x < dstw; x++) {
-        jint suma = 0;
-        jint srcoff = x;
-        jint dstoff = x;
-        for (jint y = 0; y < dsth; y++) {
-            jint rgb;
-            // Un-accumulate the data for row-vsize location into the sums.
-            rgb = (srcoff >= voff) ? srcPixels[srcoff - voff] : 0;
-            suma -= (rgb >> 24) & 0xff;
-            // Accumulate the data for this row location into the sums.
-            rgb = (y < srch) ? srcPixels[srcoff] : 0;
-            suma += (rgb >> 24) & 0xff;
-            // Clamp, scale and convert the sum into a color.
-            dstPixels[dstoff] =
-                ((suma < amin) ? 0
-                 : ((suma >= amax) ? shadowRGB
-                    : ((((suma * kscalea) >> 23) << 24) |
-                       (((suma * kscaler) >> 23) << 16) |
-                       (((suma * kscaleg) >> 23) <<  8) |
-                       (((suma * kscaleb) >> 23)      ))));
-            srcoff += srcscan;
-            dstoff += dstscan;
-        }
-    }
+    // Columns are independent of each other.
+    runStripes(dstw, dsth, filterVerticalColumns, &data);
 
     env->ReleasePrimitiveArrayCritical(dstPixels_arr, dstPixels, 0);
     env->ReleasePrimitiveArrayCritical(srcPixels_arr, srcPixels, JNI_ABORT);
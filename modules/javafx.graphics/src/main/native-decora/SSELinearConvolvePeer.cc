@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,6 +38,86 @@
 
 #define fvaltobyte(f) (((f) < cmin) ? 0 : (((f) > cmax) ? 255 : ((jint) (f))))
 
+/*
+ * Weighted per-channel sums for filterHV.  The channels are kept in the
+ * byte order of the pixel, b, g, r, a, so that a vector of sums maps
+ * directly back onto a packed ARGB value.
+ */
+#if defined(DECORA_SSE2)
+
+static inline void convsum_load(jfloat *cvals, jint rgb) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i v = _mm_unpacklo_epi8(_mm_cvtsi32_si128(rgb), zero);
+    _mm_storeu_ps(cvals, _mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)));
+}
+
+static inline jint convsum_accum(jfloat *cvals, jfloat *kvals, jint kernelSize) {
+    __m128 sum = _mm_setzero_ps();
+    for (jint i = 0; i < kernelSize; i++) {
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(cvals + i * 4),
+                                         _mm_set1_ps(kvals[i])));
+    }
+    // Same clamping as fvaltobyte: below cmin is 0, above cmax is 255.
+    __m128 high = _mm_cmpgt_ps(sum, _mm_set1_ps(cmax));
+    sum = _mm_max_ps(sum, _mm_setzero_ps());
+    sum = _mm_or_ps(_mm_and_ps(high, _mm_set1_ps(255.0f)),
+                    _mm_andnot_ps(high, sum));
+    __m128i v = _mm_cvttps_epi32(sum);
+    v = _mm_packs_epi32(v, v);
+    return _mm_cvtsi128_si32(_mm_packus_epi16(v, v));
+}
+
+#elif defined(DECORA_NEON)
+
+static inline void convsum_load(jfloat *cvals, jint rgb) {
+    uint8x8_t v = vreinterpret_u8_u32(vdup_n_u32((uint32_t) rgb));
+    vst1q_f32(cvals, vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(v)))));
+}
+
+static inline jint convsum_accum(jfloat *cvals, jfloat *kvals, jint kernelSize) {
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for (jint i = 0; i < kernelSize; i++) {
+        sum = vaddq_f32(sum, vmulq_n_f32(vld1q_f32(cvals + i * 4), kvals[i]));
+    }
+    // Same clamping as fvaltobyte: below cmin is 0, above cmax is 255.
+    uint32x4_t high = vcgtq_f32(sum, vdupq_n_f32(cmax));
+    sum = vmaxq_f32(sum, vdupq_n_f32(0.0f));
+    sum = vbslq_f32(high, vdupq_n_f32(255.0f), sum);
+    uint16x4_t h = vmovn_u32(vcvtq_u32_f32(sum));
+    uint8x8_t b = vmovn_u16(vcombine_u16(h, h));
+    return (jint) vget_lane_u32(vreinterpret_u32_u8(b), 0);
+}
+
+#else
+
+static inline void convsum_load(jfloat *cvals, jint rgb) {
+    cvals[0] = (jfloat) ((rgb      ) & 0xff);
+    cvals[1] = (jfloat) ((rgb >>  8) & 0xff);
+    cvals[2] = (jfloat) ((rgb >> 16) & 0xff);
+    cvals[3] = (jfloat) ((rgb >> 24) & 0xff);
+}
+
+static inline jint convsum_accum(jfloat *cvals, jfloat *kvals, jint kernelSize) {
+    jfloat sumb = 0.0f;
+    jfloat sumg = 0.0f;
+    jfloat sumr = 0.0f;
+    jfloat suma = 0.0f;
+    for (jint i = 0; i < kernelSize; i++) {
+        jfloat factor = kvals[i];
+        sumb += cvals[i*4+0] * factor;
+        sumg += cvals[i*4+1] * factor;
+        sumr += cvals[i*4+2] * factor;
+        suma += cvals[i*4+3] * factor;
+    }
+    return
+        (fvaltobyte(suma) << 24) +
+        (fvaltobyte(sumr) << 16) +
+        (fvaltobyte(sumg) <<  8) +
+        (fvaltobyte(sumb)      );
+}
+
+#endif
+
 JNIEXPORT void JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterVector
     (JNIEnv *env, jobject lcpthis,
@@ -147,32 +227,13 @@ Java_com_sun_scenario_effect_impl_sw_sse_SSELinearConvolvePeer_filterHV
         jint koff = kernelSize;
         for (jint c = 0; c < dstcols; c++) {
             // Load the data for this x location into the array.
-            jint i = (kernelSize - koff) * 4;
             jint rgb = (c < srccols) ? srcPixels[srcoff] : 0;
-            cvals[i+0] = (jfloat) ((rgb >> 24) & 0xff);
-            cvals[i+1] = (jfloat) ((rgb >> 16) & 0xff);
-            cvals[i+2] = (jfloat) ((rgb >>  8) & 0xff);
-            cvals[i+3] = (jfloat) ((rgb      ) & 0xff);
+            convsum_load(cvals + (kernelSize - koff) * 4, rgb);
             // Bump the koff to the next spot to align the coefficients.
             if (--koff <= 0) {
                 koff += kernelSize;
             }
-            jfloat suma = 0.0f;
-            jfloat sumr = 0.0f;
-            jfloat sumg = 0.0f;
-            jfloat sumb = 0.0f;
-            for (i = 0; i < kernelSize*4; i += 4) {
-                jfloat factor = kvals[koff + (i>>2)];
-                suma += cvals[i+0] * factor;
-                sumr += cvals[i+1] * factor;
-                sumg += cvals[i+2] * factor;
-                sumb += cvals[i+3] * factor;
-            }
-            dstPixels[dstoff] =
-                (((suma < cmin) ? 0 : ((suma > cmax) ? 255 : ((jint) suma))) << 24) +
-                (((sumr < cmin) ? 0 : ((sumr > cmax) ? 255 : ((jint) sumr))) << 16) +
-                (((sumg < cmin) ? 0 : ((sumg > cmax) ? 255 : ((jint) sumg))) <<  8) +
-                (((sumb < cmin) ? 0 : ((sumb > cmax) ? 255 : ((jint) sumb)))      );
+            dstPixels[dstoff] = convsum_accum(cvals, kvals + koff, kernelSize);
             dstoff += dcolinc;
             srcoff += scolinc;
         }
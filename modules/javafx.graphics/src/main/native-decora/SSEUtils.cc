@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2008, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2008, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,11 @@
 #include <windows.h>
 #endif
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 JNIEXPORT jboolean JNICALL
 Java_com_sun_scenario_effect_impl_sw_sse_SSERendererDelegate_isSupported
     (JNIEnv *env, jclass klass)
@@ -204,3 +209,129 @@ bool checkRange(JNIEnv *env,
             (srcw * srch) > env->GetArrayLength(srcPixels_arr) ||
             (dstw * dsth) > env->GetArrayLength(dstPixels_arr));
 }
+
+// Jobs smaller than this many pixels are not worth waking up the workers.
+#define STRIPE_MIN_PIXELS (128 * 1024)
+#define STRIPE_MAX_THREADS 8
+
+struct StripeJob {
+    StripeFunc stripeFunc;
+    void *data;
+    jint count;
+    jint numStripes;
+    std::atomic<jint> nextStripe;
+};
+
+static void doStripes(StripeJob *job)
+{
+    jint s;
+    while ((s = job->nextStripe.fetch_add(1)) < job->numStripes) {
+        jint start = (jint) (((jlong) job->count * s) / job->numStripes);
+        jint end = (jint) (((jlong) job->count * (s + 1)) / job->numStripes);
+        job->stripeFunc(job->data, start, end);
+    }
+}
+
+/*
+ * The worker threads are started on first use and live until the process
+ * exits.  The pool is never deleted so that no joinable thread is
+ * destroyed at exit.
+ */
+class StripePool {
+public:
+    StripePool(int numWorkers)
+        : numWorkers(numWorkers), job(NULL), generation(0), active(0)
+    {
+        for (int i = 0; i < numWorkers; i++) {
+            std::thread(&StripePool::work, this).detach();
+        }
+    }
+
+    int getNumThreads() {
+        return numWorkers + 1;
+    }
+
+    // Returns false without doing anything if another thread is
+    // already using the pool.
+    bool run(StripeJob *newJob) {
+        std::unique_lock<std::mutex> busy(runLock, std::try_to_lock);
+        if (!busy.owns_lock()) {
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> l(lock);
+            job = newJob;
+            active = numWorkers;
+            generation++;
+        }
+        wake.notify_all();
+        doStripes(newJob);
+        std::unique_lock<std::mutex> l(lock);
+        done.wait(l, [this] { return active == 0; });
+        job = NULL;
+        return true;
+    }
+
+private:
+    void work() {
+        unsigned int seen = 0;
+        for (;;) {
+            StripeJob *current;
+            {
+                std::unique_lock<std::mutex> l(lock);
+                wake.wait(l, [this, seen] { return generation != seen; });
+                seen = generation;
+                current = job;
+            }
+            doStripes(current);
+            std::lock_guard<std::mutex> l(lock);
+            if (--active == 0) {
+                done.notify_one();
+            }
+        }
+    }
+
+    const int numWorkers;
+    std::mutex runLock;
+    std::mutex lock;
+    std::condition_variable wake;
+    std::condition_variable done;
+    StripeJob *job;
+    unsigned int generation;
+    int active;
+};
+
+static StripePool *getStripePool()
+{
+    static StripePool *pool = [] {
+        unsigned int n = std::thread::hardware_concurrency();
+        if (n > STRIPE_MAX_THREADS) n = STRIPE_MAX_THREADS;
+        return (n > 1) ? new StripePool((int) n - 1) : (StripePool *) NULL;
+    }();
+    return pool;
+}
+
+void runStripes(jint count, jint unitCost, StripeFunc stripeFunc, void *data)
+{
+    if (count <= 0) {
+        return;
+    }
+    StripePool *pool = NULL;
+    if ((jlong) count * unitCost >= STRIPE_MIN_PIXELS) {
+        pool = getStripePool();
+    }
+    if (pool != NULL && count > 1) {
+        StripeJob job;
+        job.stripeFunc = stripeFunc;
+        job.data = data;
+        job.count = count;
+        // A few stripes per thread even out the load between them.
+        jint numStripes = pool->getNumThreads() * 4;
+        job.numStripes = (numStripes < count) ? numStripes : count;
+        job.nextStripe = 0;
+        if (pool->run(&job)) {
+            return;
+        }
+    }
+    stripeFunc(data, 0, count);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,19 @@
 #include <stddef.h>
 #include <jni.h>
 
+/*
+ * The hand written peers process the four channels of a pixel in one
+ * vector register where the target has a baseline vector unit, and fall
+ * back to plain scalar code otherwise.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DECORA_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DECORA_NEON
+#include <arm_neon.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -61,6 +74,17 @@ bool checkRange(JNIEnv *env,
                 jintArray dstPixels_arr, jint dstw, jint dsth,
                 jintArray srcPixels_arr, jint srcw, jint srch);
 
+/*
+ * Splits the range [0, count) into stripes and calls stripeFunc once for
+ * each of them.  When the whole job, count * unitCost pixels, is large
+ * enough the stripes are shared between the calling thread and a small
+ * persistent pool of worker threads, otherwise they all run inline.
+ * The stripes must be independent of each other.
+ */
+typedef void (*StripeFunc)(void *data, jint start, jint end);
+
+void runStripes(jint count, jint unitCost, StripeFunc stripeFunc, void *data);
+
 #ifdef __cplusplus
 };
 #endif /* __cplusplus */
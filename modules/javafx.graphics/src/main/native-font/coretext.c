@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -920,8 +920,11 @@ JNIEXPORT jbyteArray JNICALL OS_NATIVE(CGBitmapContextGetData)
         size_t srcStep = CGBitmapContextGetBitsPerPixel(context) / 8;
         size_t srcOffset = (srcHeight - dstHeight) * srcBytesPerRow;
 
+        /* Convert straight into the Java array, without a native copy */
         size_t size = dstWidth * dstHeight * dstStep;
-        jbyte* data = (jbyte*)calloc(size, sizeof(jbyte));
+        result = (*env)->NewByteArray(env, size);
+        if (result == NULL) return NULL;
+        jbyte* data = (jbyte*)(*env)->GetPrimitiveArrayCritical(env, result, NULL);
         if (data == NULL) return NULL;
 
         int x, y, sx;
@@ -940,12 +943,7 @@ JNIEXPORT jbyteArray JNICALL OS_NATIVE(CGBitmapContextGetData)
             }
             srcOffset += srcBytesPerRow;
         }
-
-        result = (*env)->NewByteArray(env, size);
-        if (result) {
-            (*env)->SetByteArrayRegion(env, result, 0, size, data);
-        }
-        free(data);
+        (*env)->ReleasePrimitiveArrayCritical(env, result, data, 0);
     }
     return result;
 }
@@ -973,6 +971,37 @@ JNIEXPORT void JNICALL OS_NATIVE(CTFontDrawGlyphs)
     CTFontDrawGlyphs((CTFontRef)arg0, glyphs, pos, 1, (CGContextRef)contextRef);
 }
 
+/*
+ * Draws the glyph in black over a white background into the top left
+ * dstWidth x dstHeight area of the context and returns its image, as
+ * CGBitmapContextGetData does.  Used for all the glyph images rendered
+ * into the reused bitmap context, replacing the several calls needed
+ * to clear, draw and read back each glyph.
+ */
+JNIEXPORT jbyteArray JNICALL OS_NATIVE(CTFontDrawGlyphImage)
+    (JNIEnv *env, jclass that, jlong fontRef, jshort glyph, jlong contextRef,
+     jdouble translateX, jdouble translateY, jdouble drawX, jdouble drawY,
+     jint dstWidth, jint dstHeight, jint bpp)
+{
+    CGContextRef context = (CGContextRef)contextRef;
+    if (context == NULL) return NULL;
+    if (dstWidth <= 0 || dstHeight <= 0) return NULL;
+
+    /* Fill background with white */
+    CGContextSetRGBFillColor(context, 1, 1, 1, 1);
+    CGContextFillRect(context, CGRectMake(0, 0, dstWidth, dstHeight));
+
+    /* Draw the glyph with black */
+    CGContextTranslateCTM(context, translateX, translateY);
+    CGContextSetRGBFillColor(context, 0, 0, 0, 1);
+    CGGlyph glyphs[] = {glyph};
+    CGPoint pos[] = {CGPointMake(drawX, drawY)};
+    CTFontDrawGlyphs((CTFontRef)fontRef, glyphs, pos, 1, context);
+    CGContextTranslateCTM(context, -translateX, -translateY);
+
+    return OS_NATIVE(CGBitmapContextGetData)(env, that, contextRef, dstWidth, dstHeight, bpp);
+}
+
 JNIEXPORT jobject JNICALL OS_NATIVE(CTFontGetBoundingRectForGlyphs)
     (JNIEnv *env, jclass that, jlong arg1, jshort arg2)
 {
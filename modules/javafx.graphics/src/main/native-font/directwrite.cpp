@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1291,16 +1291,20 @@ public:
                 void** ppvObject);
 
 public:
+    void Reset();
     BOOL Next();
     UINT32 GetStart();
     UINT32 GetLength();
     UINT32 GetGlyphCount();
     UINT32 GetTotalGlyphCount();
+    UINT32 GetTotalTextLength();
     IDWriteFontFace* GetFontFace();
     const UINT16* GetClusterMap();
     const UINT16* GetGlyphIndices();
     const FLOAT*  GetGlyphAdvances();
     const DWRITE_GLYPH_OFFSET* GetGlyphOffsets();
+    jlongArray GetRuns(JNIEnv *env, jintArray glyphsArray, jfloatArray advancesArray,
+                       jfloatArray offsetsArray, jshortArray clusterMapArray);
 
 private:
     ULONG cRefCount_;
@@ -1311,12 +1315,14 @@ private:
     std::vector<Run> runs_;
     INT32 position_;
     INT32 totalGlyphCount_;
+    UINT32 totalTextLength_;
 };
 
 JFXTextRenderer::JFXTextRenderer()
 : cRefCount_(0),
   position_(-1),
-  totalGlyphCount_(0) {
+  totalGlyphCount_(0),
+  totalTextLength_(0) {
 }
 
 JFXTextRenderer::~JFXTextRenderer() {
@@ -1337,6 +1343,7 @@ IFACEMETHODIMP JFXTextRenderer::DrawGlyphRun (
     run.glyphRun = *glyphRun;
     run.glyphRunDescription = *glyphRunDescription;
     totalGlyphCount_ += glyphRun->glyphCount;
+    totalTextLength_ += glyphRunDescription->stringLength;
     return S_OK;
 }
 
@@ -1427,6 +1434,17 @@ IFACEMETHODIMP JFXTextRenderer::QueryInterface(IID const& riid, void** ppvObject
     return S_OK;
 }
 
+void JFXTextRenderer::Reset() {
+    runs_.clear();
+    position_ = -1;
+    totalGlyphCount_ = 0;
+    totalTextLength_ = 0;
+}
+
+UINT32 JFXTextRenderer::GetTotalTextLength() {
+    return totalTextLength_;
+}
+
 BOOL JFXTextRenderer::Next() {
     position_++;
     return ((UINT32)position_) < runs_.size();
@@ -1482,6 +1500,11 @@ JNIEXPORT jlong JNICALL OS_NATIVE(_1NewJFXTextRenderer)
     return (jlong) new (std::nothrow) JFXTextRenderer();
 }
 
+JNIEXPORT void JNICALL OS_NATIVE(JFXTextRendererReset)
+(JNIEnv *env, jclass that, jlong arg0) {
+    ((JFXTextRenderer*)arg0)->Reset();
+}
+
 JNIEXPORT jboolean JNICALL OS_NATIVE(JFXTextRendererNext)
 (JNIEnv *env, jclass that, jlong arg0) {
     return ((JFXTextRenderer*)arg0)->Next();
@@ -1609,6 +1632,76 @@ JNIEXPORT jint JNICALL OS_NATIVE(JFXTextRendererGetClusterMap)
     return copiedCount;
 }
 
+/*
+ * Copies the glyph indices, advances, offsets and cluster maps of all the
+ * glyph runs at once, laid out one run after the other as the per run
+ * methods above do. Returns the font face and glyph count of each run as
+ * {face0, glyphCount0, face1, glyphCount1, ...}, or NULL if the arrays
+ * are too small.
+ */
+jlongArray JFXTextRenderer::GetRuns(JNIEnv *env, jintArray glyphsArray, jfloatArray advancesArray,
+                                    jfloatArray offsetsArray, jshortArray clusterMapArray) {
+    if (!glyphsArray || !advancesArray || !offsetsArray || !clusterMapArray) return NULL;
+
+    jint glyphCount = (jint) totalGlyphCount_;
+    jint textLength = (jint) totalTextLength_;
+    if (env->GetArrayLength(glyphsArray) < glyphCount) return NULL;
+    if (env->GetArrayLength(advancesArray) < glyphCount) return NULL;
+    if (env->GetArrayLength(offsetsArray) < glyphCount * 2) return NULL;
+    if (env->GetArrayLength(clusterMapArray) < textLength) return NULL;
+
+    jsize runCount = (jsize) runs_.size();
+    jlongArray result = env->NewLongArray(runCount * 2);
+    if (!result) return NULL;
+    jlong* info = env->GetLongArrayElements(result, NULL);
+    if (!info) return NULL;
+    jint* glyphs = env->GetIntArrayElements(glyphsArray, NULL);
+    jfloat* advances = env->GetFloatArrayElements(advancesArray, NULL);
+    jfloat* offsets = env->GetFloatArrayElements(offsetsArray, NULL);
+    jshort* clusterMap = env->GetShortArrayElements(clusterMapArray, NULL);
+
+    if (glyphs && advances && offsets && clusterMap) {
+        UINT32 glyphStart = 0, textStart = 0;
+        for (jsize r = 0; r < runCount; r++) {
+            const DWRITE_GLYPH_RUN& glyphRun = runs_[r].glyphRun;
+            const DWRITE_GLYPH_RUN_DESCRIPTION& desc = runs_[r].glyphRunDescription;
+            UINT32 count = glyphRun.glyphCount;
+            for (UINT32 i = 0; i < count; i++) {
+                glyphs[glyphStart + i] = glyphRun.glyphIndices[i];
+                advances[glyphStart + i] = glyphRun.glyphAdvances[i];
+                if (glyphRun.glyphOffsets) {
+                    offsets[(glyphStart + i) * 2] = glyphRun.glyphOffsets[i].advanceOffset;
+                    offsets[(glyphStart + i) * 2 + 1] = glyphRun.glyphOffsets[i].ascenderOffset;
+                } else {
+                    offsets[(glyphStart + i) * 2] = 0;
+                    offsets[(glyphStart + i) * 2 + 1] = 0;
+                }
+            }
+            /* Cluster map relative to the start of the TextRun, see GetClusterMap */
+            for (UINT32 i = 0; i < desc.stringLength; i++) {
+                clusterMap[textStart + i] = desc.clusterMap[i] + (jshort)glyphStart;
+            }
+            info[r * 2] = (jlong) glyphRun.fontFace;
+            info[r * 2 + 1] = (jlong) count;
+            glyphStart += count;
+            textStart += desc.stringLength;
+        }
+    }
+
+    if (clusterMap) env->ReleaseShortArrayElements(clusterMapArray, clusterMap, 0);
+    if (offsets) env->ReleaseFloatArrayElements(offsetsArray, offsets, 0);
+    if (advances) env->ReleaseFloatArrayElements(advancesArray, advances, 0);
+    if (glyphs) env->ReleaseIntArrayElements(glyphsArray, glyphs, 0);
+    env->ReleaseLongArrayElements(result, info, 0);
+    return (glyphs && advances && offsets && clusterMap) ? result : NULL;
+}
+
+JNIEXPORT jlongArray JNICALL OS_NATIVE(JFXTextRendererGetRuns)
+(JNIEnv *env, jclass that, jlong arg0, jintArray arg1, jfloatArray arg2,
+ jfloatArray arg3, jshortArray arg4) {
+    return ((JFXTextRenderer*)arg0)->GetRuns(env, arg1, arg2, arg3, arg4);
+}
+
 /***********************************************/
 /*                Glyph Outline                */
 /***********************************************/
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -552,11 +552,13 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
  jobject fontToFileMap,
  jobject fontToFamilyNameMap,
  jobject familyToFontListMap,
- jobject locale
+ jobject locale,
+ jstring familyName
  )
 {
     void *libfontconfig;
     const char *lang;
+    const char *familyNameUTF = NULL;
     int langLen, f;
     FcPatternBuildFuncType FcPatternBuild;
     FcObjectSetFuncType FcObjectSetBuild;
@@ -664,7 +666,19 @@ Java_com_sun_javafx_font_FontConfigManager_populateMapsNative
     if ((*env)->ExceptionOccurred(env) || toLowerCaseMID == NULL) {
         return JNI_FALSE;
     }
-    pattern = (*FcPatternBuild)(NULL, FC_OUTLINE, FcTypeBool, FcTrue, NULL);
+    if (familyName != NULL) {
+        /* Only list the fonts of the one requested family */
+        familyNameUTF = (*env)->GetStringUTFChars(env, familyName, NULL);
+        if (familyNameUTF == NULL) {
+            return JNI_FALSE;
+        }
+        pattern = (*FcPatternBuild)(NULL, FC_OUTLINE, FcTypeBool, FcTrue,
+                                    FC_FAMILY, FcTypeString, familyNameUTF,
+                                    NULL);
+        (*env)->ReleaseStringUTFChars(env, familyName, familyNameUTF);
+    } else {
+        pattern = (*FcPatternBuild)(NULL, FC_OUTLINE, FcTypeBool, FcTrue, NULL);
+    }
     objset = (*FcObjectSetBuild)(FC_FAMILY, FC_FAMILYLANG,
                                  FC_FULLNAME, FC_FULLNAMELANG,
                                  FC_FILE, FC_FONTFORMAT, NULL);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,12 @@
 #include <ft2build.h>
 #include <stdint.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include FT_FREETYPE_H
 #include FT_OUTLINE_H
 #include FT_LCD_FILTER_H
@@ -374,23 +380,54 @@ JNIEXPORT jobject JNICALL OS_NATIVE(getGlyphSlot)(JNIEnv *env, jclass that, jlon
     return result;
 }
 
-JNIEXPORT jbyteArray JNICALL OS_NATIVE(getBitmapData)(JNIEnv *env, jclass that, jlong facePtr)
+/*
+ * Loads and renders a glyph and returns its coverage data, compacted to
+ * width bytes per row, in a single call.  The slot fields needed to place
+ * the glyph are stored in info, see OSFreetype.GLYPH_INFO_*.
+ */
+JNIEXPORT jbyteArray JNICALL OS_NATIVE(loadGlyph)
+    (JNIEnv *env, jclass that, jlong facePtr, jint glyphCode, jint loadFlags, jintArray infoArray)
 {
-    if (!facePtr) return NULL;
+    jint info[9];
+    if (!facePtr || !infoArray) return NULL;
+    if ((*env)->GetArrayLength(env, infoArray) < 9) return NULL;
     FT_Face face = (FT_Face)facePtr;
+    FT_Error error = FT_Load_Glyph(face, (FT_UInt)glyphCode, (FT_Int32)loadFlags);
     FT_GlyphSlot slot = face->glyph;
-    if (!slot) return NULL;
+    memset(info, 0, sizeof(info));
+    info[0] = (jint)error;
+    if (error || !slot) {
+        (*env)->SetIntArrayRegion(env, infoArray, 0, 9, info);
+        return NULL;
+    }
     FT_Bitmap bitmap = slot->bitmap;
+    info[1] = (jint)bitmap.pixel_mode;
+    info[2] = (jint)bitmap.width;
+    info[3] = (jint)bitmap.rows;
+    info[4] = (jint)slot->bitmap_left;
+    info[5] = (jint)slot->bitmap_top;
+    info[6] = (jint)slot->advance.x;
+    info[7] = (jint)slot->advance.y;
+    info[8] = (jint)slot->linearHoriAdvance;
+    (*env)->SetIntArrayRegion(env, infoArray, 0, 9, info);
+
     unsigned char* src = bitmap.buffer;
-    if (!src) return NULL;
-    if (bitmap.pitch <= 0) return NULL;
-    if (bitmap.rows > INT_MAX / bitmap.pitch) return NULL;
-    size_t size = bitmap.pitch * bitmap.rows;
-    jbyteArray result = (*env)->NewByteArray(env, size);
+    if (!src || bitmap.width == 0 || bitmap.rows == 0) return NULL;
+    if (bitmap.pitch <= 0 || bitmap.width > (unsigned int)bitmap.pitch) return NULL;
+    if (bitmap.rows > INT_MAX / bitmap.width) return NULL;
+    jbyteArray result = (*env)->NewByteArray(env, bitmap.width * bitmap.rows);
     if (result) {
         unsigned char* dst = (*env)->GetPrimitiveArrayCritical(env, result, NULL);
         if (dst) {
-            memcpy(dst, src, size);
+            if ((unsigned int)bitmap.pitch == bitmap.width) {
+                memcpy(dst, src, bitmap.width * bitmap.rows);
+            } else {
+                /* Common for LCD glyphs */
+                unsigned int y;
+                for (y = 0; y < bitmap.rows; y++) {
+                    memcpy(dst + y * bitmap.width, src + y * bitmap.pitch, bitmap.width);
+                }
+            }
             (*env)->ReleasePrimitiveArrayCritical(env, result, dst, 0);
         }
     }
@@ -481,6 +518,122 @@ fail:
     return rc;
 }
 
+/*
+ * Font files mapped into memory, shared by all the faces opened from the
+ * same file.  Each face of a font collection, and each FT_Library that
+ * opens the same file, would otherwise map and parse the file on its own,
+ * which adds up for the large CJK collections.  A blob is unmapped when
+ * the last face using it is done, see finalizeSharedFace.
+ */
+typedef struct _FontBlob {
+    struct _FontBlob *next;
+    char *path;
+    void *data;
+    size_t size;
+    int refCount;
+} FontBlob;
+
+static FontBlob *fontBlobs = NULL;
+static pthread_mutex_t fontBlobsLock = PTHREAD_MUTEX_INITIALIZER;
+
+static FontBlob* acquireFontBlob(const char *path)
+{
+    FontBlob *blob;
+    pthread_mutex_lock(&fontBlobsLock);
+    for (blob = fontBlobs; blob != NULL; blob = blob->next) {
+        if (strcmp(blob->path, path) == 0) {
+            blob->refCount++;
+            pthread_mutex_unlock(&fontBlobsLock);
+            return blob;
+        }
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0) {
+        struct stat st;
+        void *data = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+        if (data != MAP_FAILED) {
+            blob = (FontBlob*)calloc(1, sizeof(FontBlob));
+            if (blob != NULL && (blob->path = strdup(path)) != NULL) {
+                blob->data = data;
+                blob->size = (size_t)st.st_size;
+                blob->refCount = 1;
+                blob->next = fontBlobs;
+                fontBlobs = blob;
+            } else {
+                SAFE_FREE(blob);
+                munmap(data, (size_t)st.st_size);
+            }
+        }
+    }
+    pthread_mutex_unlock(&fontBlobsLock);
+    return blob;
+}
+
+static void releaseFontBlob(FontBlob *blob)
+{
+    pthread_mutex_lock(&fontBlobsLock);
+    if (--blob->refCount == 0) {
+        FontBlob **prev = &fontBlobs;
+        while (*prev != blob) prev = &(*prev)->next;
+        *prev = blob->next;
+        munmap(blob->data, blob->size);
+        free(blob->path);
+        free(blob);
+    }
+    pthread_mutex_unlock(&fontBlobsLock);
+}
+
+/* FT_Generic_Finalizer, called by FT_Done_Face */
+static void finalizeSharedFace(void *object)
+{
+    FontBlob *blob = (FontBlob*)((FT_Face)object)->generic.data;
+    if (blob != NULL) {
+        releaseFontBlob(blob);
+    }
+}
+
+/*
+ * Same as FT_New_Face but creates the face from the shared mapping of the
+ * file, falling back to FT_New_Face when the file can not be mapped.
+ * The mapping is released by FT_Done_Face, through the face's finalizer.
+ */
+JNIEXPORT jint JNICALL OS_NATIVE(newSharedFace)
+    (JNIEnv *env, jclass that, jlong library, jbyteArray pathArray, jlong faceIndex, jlongArray faceArray)
+{
+    jbyte *path = NULL;
+    jlong *aface = NULL;
+    jint rc = FT_Err_Invalid_Argument;
+    if (!pathArray || !faceArray) return rc;
+    if ((path = (*env)->GetByteArrayElements(env, pathArray, NULL)) == NULL) goto fail;
+    if ((aface = (*env)->GetLongArrayElements(env, faceArray, NULL)) == NULL) goto fail;
+
+    FontBlob *blob = acquireFontBlob((const char*)path);
+    if (blob != NULL) {
+        FT_Face face = NULL;
+        rc = (jint)FT_New_Memory_Face((FT_Library)library, (const FT_Byte*)blob->data,
+                                      (FT_Long)blob->size, (FT_Long)faceIndex, &face);
+        if (rc == 0) {
+            face->generic.data = blob;
+            face->generic.finalizer = finalizeSharedFace;
+            aface[0] = (jlong)face;
+        } else {
+            releaseFontBlob(blob);
+        }
+    } else {
+        rc = (jint)FT_New_Face((FT_Library)library, (const char*)path, (FT_Long)faceIndex, (FT_Face*)aface);
+    }
+
+fail:
+    if (aface) (*env)->ReleaseLongArrayElements(env, faceArray, aface, 0);
+    if (path) (*env)->ReleaseByteArrayElements(env, pathArray, path, JNI_ABORT);
+    return rc;
+}
+
 JNIEXPORT jint JNICALL OS_NATIVE(FT_1Set_1Char_1Size)
     (JNIEnv *env, jclass that, jlong arg0, jlong arg1, jlong arg2, jint arg3, jint arg4)
 {
@@ -76,6 +76,25 @@ static GtkClipboard* clipboard = NULL;
 static gboolean is_clipboard_owner = FALSE;
 static gboolean is_clipboard_updated_by_glass = FALSE;
 
+// Conversions of the data we offer, kept while we own the clipboard. Clients
+// ask for several targets of the same kind (UTF8_STRING, TEXT, text/plain...)
+// and may paste repeatedly; each of those would otherwise convert the Java
+// data again. They are created on the first request and dropped when the
+// clipboard contents change.
+static gchar *owned_text = NULL;
+static GdkPixbuf *owned_pixbuf = NULL;
+
+static void clear_owned_conversions() {
+    if (owned_text != NULL) {
+        g_free(owned_text);
+        owned_text = NULL;
+    }
+    if (owned_pixbuf != NULL) {
+        g_object_unref(owned_pixbuf);
+        owned_pixbuf = NULL;
+    }
+}
+
 static GtkClipboard *get_clipboard() {
     if (clipboard == NULL) {
         clipboard = gtk_clipboard_get(GDK_SELECTION_CLIPBOARD);
@@ -153,11 +172,12 @@ static void data_to_targets(JNIEnv *env, jobject data, GtkTargetEntry **targets,
 
 static void set_text_data(GtkSelectionData *selection_data, jstring data)
 {
-    const char *text_data = getUTF(mainEnv, data);
-    guint ntext_data = strlen(text_data);
+    if (owned_text == NULL) {
+        owned_text = getUTF(mainEnv, data);
+    }
+    guint ntext_data = strlen(owned_text);
 
-    gtk_selection_data_set_text(selection_data, text_data, ntext_data);
-    g_free((gpointer)text_data);
+    gtk_selection_data_set_text(selection_data, owned_text, ntext_data);
 }
 
 static void set_jstring_data(GtkSelectionData *selection_data, GdkAtom target, jstring data)
@@ -257,14 +277,21 @@ static void set_uri_data(GtkSelectionData *selection_data, jobject data) {
 
 static void set_image_data(GtkSelectionData *selection_data, jobject pixels)
 {
-    GdkPixbuf *pixbuf = NULL;
-
-    mainEnv->CallVoidMethod(pixels, jPixelsAttachData, PTR_TO_JLONG(&pixbuf));
-    if (!EXCEPTION_OCCURED(mainEnv)) {
-        gtk_selection_data_set_pixbuf(selection_data, pixbuf);
+    if (owned_pixbuf == NULL) {
+        GdkPixbuf *pixbuf = NULL;
+        mainEnv->CallVoidMethod(pixels, jPixelsAttachData, PTR_TO_JLONG(&pixbuf));
+        if (EXCEPTION_OCCURED(mainEnv)) {
+            if (pixbuf != NULL) {
+                g_object_unref(pixbuf);
+            }
+            return;
+        }
+        owned_pixbuf = pixbuf;
     }
 
-    g_object_unref(pixbuf);
+    if (owned_pixbuf != NULL) {
+        gtk_selection_data_set_pixbuf(selection_data, owned_pixbuf);
+    }
 }
 
 static void set_data(GdkAtom target, GtkSelectionData *selection_data, jobject data)
@@ -325,6 +352,7 @@ static void clear_data_func(GtkClipboard *clipboard, gpointer user_data)
 
     jobject data =(jobject) user_data;
     mainEnv->DeleteGlobalRef(data);
+    clear_owned_conversions();
 }
 
 static jobject get_data_text(JNIEnv *env)
@@ -504,6 +532,7 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkSystemClipboard_pushToSystem
     init_atoms();
     data_to_targets(env, data, &targets, &ntargets);
     CHECK_JNI_EXCEPTION(env)
+    clear_owned_conversions();
     if (targets) {
         gtk_clipboard_set_with_data(get_clipboard(), targets, ntargets, set_data_func, clear_data_func, data);
         gtk_target_table_free(targets, ntargets);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,30 @@
 static gboolean call_runnable_in_timer
   (gpointer);
 
+static void run_runnable(jobject runnable);
+
+#ifdef GLASS_GTK3
+/*
+ * The vsync timer runs the pulse from the "update" phase of the frame clock
+ * of a visible glass window, which the compositor paces to the display
+ * refresh (_NET_WM_FRAME_DRAWN on X11, frame callbacks on Wayland).  A
+ * timeout at the nominal refresh period keeps the pulse going while no
+ * window is visible or its clock is not ticking, and (re)attaches to the
+ * clock of a window when there is one.
+ */
+#define VSYNC_FALLBACK_PERIOD 16
+
+typedef struct {
+    RunnableContext base;       // stopped through GtkTimer._stop
+    GdkWindow *window;          // weak pointer, cleared when destroyed
+    GdkFrameClock *clock;
+    gulong handler;
+    gint64 lastUpdate;          // monotonic time of the last clock pulse
+} VsyncContext;
+
+static gboolean call_runnable_in_vsync_timer(gpointer);
+#endif
+
 extern "C" {
 
 /*
@@ -57,6 +81,50 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1start
     }
 }
 
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkTimer
+ * Method:    _startVsync
+ * Signature: (Ljava/lang/Runnable;)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1startVsync
+  (JNIEnv * env, jobject obj, jobject runnable)
+{
+    (void)obj;
+
+#ifdef GLASS_GTK3
+    VsyncContext* context = (VsyncContext*) calloc(1, sizeof(VsyncContext));
+    if (context != NULL) {
+        context->base.runnable = env->NewGlobalRef(runnable);
+        gdk_threads_add_timeout_full(G_PRIORITY_HIGH_IDLE, VSYNC_FALLBACK_PERIOD,
+                                     call_runnable_in_vsync_timer, context, NULL);
+        return PTR_TO_JLONG(context);
+    }
+#else
+    (void)env;
+    (void)runnable;
+#endif
+    // we throw RuntimeException on Java side when we can't
+    // start the timer
+    return 0L;
+}
+
+/*
+ * Class:     com_sun_glass_ui_gtk_GtkTimer
+ * Method:    _isVsyncSupported
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1isVsyncSupported
+  (JNIEnv * env, jclass cls)
+{
+    (void)env;
+    (void)cls;
+#ifdef GLASS_GTK3
+    return JNI_TRUE;
+#else
+    return JNI_FALSE;
+#endif
+}
+
 /*
  * Class:     com_sun_glass_ui_gtk_GtkTimer
  * Method:    _stop
@@ -76,6 +144,22 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_gtk_GtkTimer__1stop
 } // extern "C"
 
 
+static void run_runnable(jobject runnable)
+{
+    JNIEnv *env;
+    int envStatus = javaVM->GetEnv((void **)&env, JNI_VERSION_1_6);
+    if (envStatus == JNI_EDETACHED) {
+        javaVM->AttachCurrentThread((void **)&env, NULL);
+    }
+
+    env->CallVoidMethod(runnable, jRunnableRun, NULL);
+    LOG_EXCEPTION(env);
+
+    if (envStatus == JNI_EDETACHED) {
+        javaVM->DetachCurrentThread();
+    }
+}
+
 static gboolean call_runnable_in_timer
   (gpointer data)
 {
@@ -85,19 +169,86 @@ static gboolean call_runnable_in_timer
         return FALSE;
     }
     else if (context->runnable) {
-        JNIEnv *env;
-        int envStatus = javaVM->GetEnv((void **)&env, JNI_VERSION_1_6);
-        if (envStatus == JNI_EDETACHED) {
-            javaVM->AttachCurrentThread((void **)&env, NULL);
-        }
+        run_runnable(context->runnable);
+    }
+    return TRUE;
+}
+
+#ifdef GLASS_GTK3
+static void vsync_clock_update(GdkFrameClock *clock, gpointer data)
+{
+    (void)clock;
+    VsyncContext* context = (VsyncContext*) data;
+    if (!context->base.flag && context->base.runnable) {
+        context->lastUpdate = g_get_monotonic_time();
+        run_runnable(context->base.runnable);
+    }
+}
 
-        env->CallVoidMethod(context->runnable, jRunnableRun, NULL);
-        LOG_EXCEPTION(env);
+static void vsync_detach(VsyncContext* context)
+{
+    if (context->clock != NULL) {
+        g_signal_handler_disconnect(context->clock, context->handler);
+        gdk_frame_clock_end_updating(context->clock);
+        g_object_unref(context->clock);
+        context->clock = NULL;
+    }
+    if (context->window != NULL) {
+        g_object_remove_weak_pointer(G_OBJECT(context->window),
+                                     (gpointer*)&context->window);
+        context->window = NULL;
+    }
+}
 
-        if (envStatus == JNI_EDETACHED) {
-            javaVM->DetachCurrentThread();
+static void vsync_attach(VsyncContext* context)
+{
+    GList *windows = gdk_screen_get_toplevel_windows(gdk_screen_get_default());
+    for (GList *l = windows; l != NULL; l = l->next) {
+        GdkWindow *window = GDK_WINDOW(l->data);
+        if (g_object_get_data(G_OBJECT(window), GDK_WINDOW_DATA_CONTEXT) == NULL ||
+            !gdk_window_is_viewable(window)) {
+            continue;
+        }
+        GdkFrameClock *clock = gdk_window_get_frame_clock(window);
+        if (clock == NULL) {
+            continue;
         }
+        context->window = window;
+        g_object_add_weak_pointer(G_OBJECT(window), (gpointer*)&context->window);
+        context->clock = GDK_FRAME_CLOCK(g_object_ref(clock));
+        context->handler = g_signal_connect(clock, "update",
+                                            G_CALLBACK(vsync_clock_update), context);
+        context->lastUpdate = g_get_monotonic_time();
+        gdk_frame_clock_begin_updating(clock);
+        break;
+    }
+    g_list_free(windows);
+}
+
+static gboolean call_runnable_in_vsync_timer
+  (gpointer data)
+{
+    VsyncContext* context = (VsyncContext*) data;
+    if (context->base.flag) {
+        vsync_detach(context);
+        free(context);
+        return FALSE;
+    }
+
+    if (context->clock != NULL && context->window == NULL) {
+        // the window of the clock is gone, look for another one
+        vsync_detach(context);
+    }
+    if (context->clock == NULL) {
+        vsync_attach(context);
+    }
+    gint64 sinceUpdate = g_get_monotonic_time() - context->lastUpdate;
+    if (context->base.runnable &&
+        (context->clock == NULL || sinceUpdate > 2 * VSYNC_FALLBACK_PERIOD * 1000)) {
+        // no clock, or it is not ticking, e.g. while the window is iconified
+        run_runnable(context->base.runnable);
     }
     return TRUE;
 }
+#endif
 
@@ -547,6 +547,9 @@ jobject dnd_target_get_data(JNIEnv *env, jstring mime)
 static jint dnd_performed_action;
 
 const char * const SOURCE_DND_DATA = "fx-dnd-data";
+// The pixbuf converted from the dragged image, kept for the whole drag as the
+// target may request several image formats
+const char * const SOURCE_DND_PIXBUF = "fx-dnd-pixbuf";
 
 static void dnd_set_performed_action(jint performed_action)
 {
@@ -664,21 +667,23 @@ static gboolean dnd_source_set_image(GtkWidget *widget, GtkSelectionData *data,
         return FALSE;
     }
 
-    gchar *buffer;
-    gsize size;
-    const char * type;
-    GdkPixbuf *pixbuf = NULL;
-    gboolean is_data_set;
+    GdkPixbuf *pixbuf = (GdkPixbuf *) g_object_get_data(G_OBJECT(widget), SOURCE_DND_PIXBUF);
 
-    mainEnv->CallVoidMethod(pixels, jPixelsAttachData, PTR_TO_JLONG(&pixbuf));
-
-    if (!EXCEPTION_OCCURED(mainEnv)) {
-        is_data_set = gtk_selection_data_set_pixbuf(data, pixbuf);
+    if (pixbuf == NULL) {
+        mainEnv->CallVoidMethod(pixels, jPixelsAttachData, PTR_TO_JLONG(&pixbuf));
+        if (EXCEPTION_OCCURED(mainEnv)) {
+            if (pixbuf != NULL) {
+                g_object_unref(pixbuf);
+            }
+            return FALSE;
+        }
+        if (pixbuf == NULL) {
+            return FALSE;
+        }
+        g_object_set_data_full(G_OBJECT(widget), SOURCE_DND_PIXBUF, pixbuf, g_object_unref);
     }
 
-    g_object_unref(pixbuf);
-
-    return is_data_set;
+    return gtk_selection_data_set_pixbuf(data, pixbuf);
 }
 
 static gboolean dnd_source_set_uri(GtkWidget *widget, GtkSelectionData *data, GdkAtom atom)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -337,7 +337,48 @@ void WindowContextBase::process_mouse_button(GdkEventButton* event) {
     }
 }
 
+/*
+ * High rate mice and touchpads can queue many motion and scroll events
+ * between two pulses.  Only the last queued position of a motion matters,
+ * so a motion event followed by another one of the same window, buttons
+ * and modifiers is dropped, and queued scroll steps are sent as one.
+ */
+static bool is_motion_superseded(GdkEventMotion* event) {
+    GdkEvent* next = gdk_event_peek();
+    bool superseded = next != NULL
+            && next->type == GDK_MOTION_NOTIFY
+            && next->motion.window == event->window
+            && next->motion.state == event->state;
+    if (next != NULL) {
+        gdk_event_free(next);
+    }
+    return superseded;
+}
+
+static GdkEventScroll* next_coalesced_scroll(GdkEventScroll* event) {
+    GdkEvent* next = gdk_event_peek();
+    if (next != NULL
+            && next->type == GDK_SCROLL
+            && next->scroll.window == event->window
+            && next->scroll.state == event->state
+            && next->scroll.direction == event->direction) {
+        gdk_event_free(next);
+        // remove it from the queue, it is sent as part of this one
+        next = gdk_event_get();
+        if (next != NULL) {
+            return &next->scroll;
+        }
+    } else if (next != NULL) {
+        gdk_event_free(next);
+    }
+    return NULL;
+}
+
 void WindowContextBase::process_mouse_motion(GdkEventMotion* event) {
+    if (is_motion_superseded(event)) {
+        return;
+    }
+
     jint glass_modifier = gdk_modifier_mask_to_glass(event->state);
     jint isDrag = glass_modifier & (
             com_sun_glass_events_KeyEvent_MODIFIER_BUTTON_PRIMARY |
@@ -404,6 +445,15 @@ void WindowContextBase::process_mouse_scroll(GdkEventScroll* event) {
             dx = -1;
             break;
     }
+    if (dx != 0 || dy != 0) {
+        jdouble stepX = dx, stepY = dy;
+        GdkEventScroll* next;
+        while ((next = next_coalesced_scroll(event)) != NULL) {
+            dx += stepX;
+            dy += stepY;
+            gdk_event_free((GdkEvent*)next);
+        }
+    }
     if (event->state & GDK_SHIFT_MASK) {
         jdouble t = dy;
         dy = dx;
@@ -495,11 +545,10 @@ void WindowContextBase::process_key(GdkEventKey* event) {
 }
 
 void WindowContextBase::paint(void* data, jint width, jint height) {
-#ifdef GLASS_GTK3
-    cairo_rectangle_int_t rect = {0, 0, width, height};
-    cairo_region_t *region = cairo_region_create_rectangle(&rect);
-    gdk_window_begin_paint_region(gdk_window, region);
-#endif
+    // The frame replaces the whole area with the SOURCE operator, so it is
+    // drawn straight to the window instead of through begin_paint, which
+    // would allocate and copy back a window sized offscreen buffer for every
+    // frame. cairo-xlib uploads the image with MIT-SHM where available.
     cairo_t* context = gdk_cairo_create(gdk_window);
 
     cairo_surface_t* cairo_surface =
@@ -512,12 +561,8 @@ void WindowContextBase::paint(void* data, jint width, jint height) {
 
     cairo_set_source_surface(context, cairo_surface, 0, 0);
     cairo_set_operator(context, CAIRO_OPERATOR_SOURCE);
-    cairo_paint(context);
-
-#ifdef GLASS_GTK3
-    gdk_window_end_paint(gdk_window);
-    cairo_region_destroy(region);
-#endif
+    cairo_rectangle(context, 0, 0, width, height);
+    cairo_fill(context);
 
     cairo_destroy(context);
     cairo_surface_destroy(cairo_surface);
@@ -946,7 +991,28 @@ void WindowContextTop::process_realize() {
     }
 }
 
+/*
+ * While a window is interactively moved or resized, the window manager can
+ * queue several configure events for it before they are dispatched.  Each
+ * one reported to Java makes the scene lay out again, so only the last one
+ * is processed.
+ */
+static bool is_configure_superseded(GdkEventConfigure* event) {
+    GdkEvent* next = gdk_event_peek();
+    bool superseded = next != NULL
+            && next->type == GDK_CONFIGURE
+            && next->configure.window == event->window;
+    if (next != NULL) {
+        gdk_event_free(next);
+    }
+    return superseded;
+}
+
 void WindowContextTop::process_configure(GdkEventConfigure* event) {
+    if (is_configure_superseded(event)) {
+        return;
+    }
+
     int ww = event->width + geometry.extents.left + geometry.extents.right;
     int wh = event->height + geometry.extents.top + geometry.extents.bottom;
 
@@ -977,6 +1043,10 @@ void WindowContextTop::process_configure(GdkEventConfigure* event) {
     gdk_window_get_root_origin(gdk_window, &root_x, &root_y);
     gdk_window_get_origin(gdk_window, &origin_x, &origin_y);
 
+    // Resizing from the right or bottom edge doesn't move the window
+    bool moved = geometry.x != root_x || geometry.y != root_y
+            || geometry.view_x != origin_x - root_x || geometry.view_y != origin_y - root_y;
+
     // x and y represent the position of the top-left corner of the window relative to the desktop area
     geometry.x = root_x;
     geometry.y = root_y;
@@ -985,7 +1055,9 @@ void WindowContextTop::process_configure(GdkEventConfigure* event) {
     // taking into account window decorations (such as title bars and borders) applied by the window manager.
     geometry.view_x = origin_x - root_x;
     geometry.view_y = origin_y - root_y;
-    notify_window_move();
+    if (moved) {
+        notify_window_move();
+    }
 
     glong to_screen = getScreenPtrForLocation(geometry.x, geometry.y);
     if (to_screen != -1) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -297,20 +297,36 @@ static void onStreamProcess(void *userdata) {
                          screen->bounds.width, screen->bounds.height
         );
 
-        GdkPixbuf *scaled = gdk_pixbuf_scale_simple(pixbuf,
-                                                         screen->bounds.width,
-                                                         screen->bounds.height,
-                                                         GDK_INTERP_BILINEAR);
+        // Scale only the captured area rather than the whole screen
+        // followed by a crop of the scaled copy
+        GdkPixbuf *scaled = gdk_pixbuf_new(GDK_COLORSPACE_RGB,
+                                           TRUE,
+                                           8,
+                                           captureArea.width,
+                                           captureArea.height);
+        if (scaled) {
+            gdk_pixbuf_scale(pixbuf,
+                             scaled,
+                             0, 0,
+                             captureArea.width,
+                             captureArea.height,
+                             -captureArea.x,
+                             -captureArea.y,
+                             (double) screenBounds.width / streamWidth,
+                             (double) screenBounds.height / streamHeight,
+                             GDK_INTERP_BILINEAR);
+        } else {
+            ERR("Cannot create a new pixbuf.\n");
+        }
 
         g_object_unref(pixbuf);
-        pixbuf = scaled;
-    }
+        pixbuf = NULL;
 
-    GdkPixbuf *cropped = NULL;
-    if (captureArea.width != screenBounds.width
+        data->screenProps->captureDataPixbuf = scaled;
+    } else if (captureArea.width != screenBounds.width
         || captureArea.height != screenBounds.height) {
 
-        cropped = gdk_pixbuf_new(GDK_COLORSPACE_RGB,
+        GdkPixbuf *cropped = gdk_pixbuf_new(GDK_COLORSPACE_RGB,
                                       TRUE,
                                       8,
                                       captureArea.width,
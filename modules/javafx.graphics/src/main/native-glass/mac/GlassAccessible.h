@@ -29,9 +29,14 @@
 @interface GlassAccessible : NSObject {
 @private
     jobject jAccessible;
+    /* Role based lists, kept until the next notification for the element */
+    NSArray *attributeNames;
+    NSArray *parameterizedAttributeNames;
+    NSArray *actionNames;
 }
 - (id)initWithEnv:(JNIEnv*)env accessible:(jobject)jAccessible;
 - (jobject)getJAccessible;
+- (void)invalidateCache;
 @end
 
 /* The following blocks are used by jArrayToNSArray() to convert java types
@@ -48,6 +48,7 @@
         GLASS_CHECK_EXCEPTION(env);
     }
     jAccessible = NULL;
+    [self invalidateCache];
     [super dealloc];
 }
 
@@ -56,16 +57,28 @@
     return self->jAccessible;
 }
 
+- (void)invalidateCache
+{
+    [attributeNames release];
+    attributeNames = nil;
+    [parameterizedAttributeNames release];
+    parameterizedAttributeNames = nil;
+    [actionNames release];
+    actionNames = nil;
+}
+
 /* Attributes */
 
 - (NSArray *)accessibilityAttributeNames
 {
+    if (attributeNames != nil) return attributeNames;
     jlongArray jresult = NULL;
     GET_MAIN_JENV;
     if (env == NULL) return NULL;
     jresult = (jlongArray)(*env)->CallObjectMethod(env, self->jAccessible, jAccessibilityAttributeNames);
     GLASS_CHECK_EXCEPTION(env);
-    return jArrayToNSArray(env, jresult, jLongToID);
+    attributeNames = [jArrayToNSArray(env, jresult, jLongToID) retain];
+    return attributeNames;
 }
 
 - (id)accessibilityAttributeValue:(NSString *)attribute
@@ -137,12 +150,14 @@
 
 - (NSArray *)accessibilityParameterizedAttributeNames
 {
+    if (parameterizedAttributeNames != nil) return parameterizedAttributeNames;
     jlongArray jresult = NULL;
     GET_MAIN_JENV;
     if (env == NULL) return NULL;
     jresult = (jlongArray)(*env)->CallObjectMethod(env, self->jAccessible, jAccessibilityParameterizedAttributeNames);
     GLASS_CHECK_EXCEPTION(env);
-    return jArrayToNSArray(env, jresult, jLongToID);
+    parameterizedAttributeNames = [jArrayToNSArray(env, jresult, jLongToID) retain];
+    return parameterizedAttributeNames;
 }
 
 - (id)accessibilityAttributeValue:(NSString *)attribute forParameter:(id)parameter
@@ -159,12 +174,14 @@
 
 - (NSArray *)accessibilityActionNames
 {
+    if (actionNames != nil) return actionNames;
     jlongArray jresult = NULL;
     GET_MAIN_JENV;
     if (env == NULL) return NULL;
     jresult = (jlongArray)(*env)->CallObjectMethod(env, self->jAccessible, jAccessibilityActionNames);
     GLASS_CHECK_EXCEPTION(env);
-    return jArrayToNSArray(env, jresult, jLongToID);
+    actionNames = [jArrayToNSArray(env, jresult, jLongToID) retain];
+    return actionNames;
 }
 
 - (NSString *)accessibilityActionDescription:(NSString *)action
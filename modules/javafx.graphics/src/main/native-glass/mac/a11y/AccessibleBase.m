@@ -294,3 +294,17 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_mac_MacAccessible__1invalidateParen
         [((AccessibleBase*) accessible) clearParent];
     }
 }
+
+/*
+ * Class:     com_sun_glass_ui_mac_MacAccessible
+ * Method:    _invalidateCache
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_mac_MacAccessible__1invalidateCache
+(JNIEnv *env, jobject jAccessible, jlong macAccessible)
+{
+    NSObject* accessible = (NSObject*)jlong_to_ptr(macAccessible);
+    if ([accessible isKindOfClass: [GlassAccessible class]]) {
+        [((GlassAccessible*) accessible) invalidateCache];
+    }
+}
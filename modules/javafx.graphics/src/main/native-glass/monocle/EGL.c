@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include "Monocle.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 //Builtin library entrypoint
 JNIEXPORT jint JNICALL
@@ -202,6 +203,38 @@ JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_EGL_eglSwapBuffers
     }
 }
 
+typedef EGLBoolean (*SwapBuffersWithDamageFunc)(EGLDisplay dpy, EGLSurface surface,
+                                                 EGLint *rects, EGLint n_rects);
+static SwapBuffersWithDamageFunc swapBuffersWithDamage = NULL;
+
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_EGL_eglHasSwapBuffersWithDamage
+    (JNIEnv *UNUSED(env), jclass UNUSED(clazz), jlong eglDisplay) {
+    const char *extensions = eglQueryString(asPtr(eglDisplay), EGL_EXTENSIONS);
+    if (extensions == NULL) {
+        return JNI_FALSE;
+    }
+    if (strstr(extensions, "EGL_KHR_swap_buffers_with_damage") != NULL) {
+        swapBuffersWithDamage = (SwapBuffersWithDamageFunc)
+                eglGetProcAddress("eglSwapBuffersWithDamageKHR");
+    } else if (strstr(extensions, "EGL_EXT_swap_buffers_with_damage") != NULL) {
+        swapBuffersWithDamage = (SwapBuffersWithDamageFunc)
+                eglGetProcAddress("eglSwapBuffersWithDamageEXT");
+    }
+    return swapBuffersWithDamage != NULL ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_EGL_eglSwapBuffersWithDamage
+    (JNIEnv *UNUSED(env), jclass UNUSED(clazz), jlong eglDisplay, jlong eglSurface,
+     jint x, jint y, jint width, jint height) {
+    EGLint rect[4] = { x, y, width, height };
+    if (swapBuffersWithDamage == NULL) {
+        return eglSwapBuffers(asPtr(eglDisplay), asPtr(eglSurface))
+                ? JNI_TRUE : JNI_FALSE;
+    }
+    return swapBuffersWithDamage(asPtr(eglDisplay), asPtr(eglSurface), rect, 1)
+            ? JNI_TRUE : JNI_FALSE;
+}
+
 JNIEXPORT jint  JNICALL Java_com_sun_glass_ui_monocle_EGL_eglGetError
     (JNIEnv *UNUSED(env), jclass UNUSED(clazz)) {
     return (jint)eglGetError();
@@ -0,0 +1,233 @@
+/* Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "com_sun_glass_ui_monocle_DispmanVideoOverlay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Monocle.h"
+
+#ifdef USE_DISPMAN
+#include "wrapped_bcm.h"
+
+#define ALIGN_UP(x, a) (((x) + (a) - 1) & ~((a) - 1))
+
+/* Bits of the change_flags of vc_dispmanx_element_change_attributes */
+#define ELEMENT_CHANGE_DEST_RECT (1 << 2)
+#define ELEMENT_CHANGE_SRC_RECT  (1 << 3)
+
+typedef struct {
+    DISPMANX_DISPLAY_HANDLE_T display;
+    DISPMANX_ELEMENT_HANDLE_T element;
+    DISPMANX_RESOURCE_HANDLE_T resource;
+    int layer;
+    jboolean planar;
+    int width, height;
+    /* YUV420 resources take the three planes in one block, each plane
+     * padded to the pitch and height the VideoCore expects. */
+    int pitch, alignedHeight;
+    unsigned char *staging;
+} DispmanVideoOverlay;
+
+static void removeElement(DispmanVideoOverlay *overlay) {
+    if (overlay->element) {
+        DISPMANX_UPDATE_HANDLE_T update = vc_dispmanx_update_start(0);
+        vc_dispmanx_element_remove(update, overlay->element);
+        vc_dispmanx_update_submit_sync(update);
+        overlay->element = 0;
+    }
+}
+
+static void deleteResource(DispmanVideoOverlay *overlay) {
+    if (overlay->resource) {
+        vc_dispmanx_resource_delete(overlay->resource);
+        overlay->resource = 0;
+    }
+    free(overlay->staging);
+    overlay->staging = NULL;
+}
+
+static int ensureResource(DispmanVideoOverlay *overlay, jboolean planar,
+                          int width, int height) {
+    uint32_t imagePtr;
+    if (overlay->resource && overlay->planar == planar
+            && overlay->width == width && overlay->height == height) {
+        return 1;
+    }
+    /* The element keeps showing the old resource until it is removed */
+    removeElement(overlay);
+    deleteResource(overlay);
+
+    overlay->resource = vc_dispmanx_resource_create(
+            planar ? VC_IMAGE_YUV420 : VC_IMAGE_ARGB8888,
+            width, height, &imagePtr);
+    if (overlay->resource == 0) {
+        fprintf(stderr, "Cannot create video overlay resource\n");
+        return 0;
+    }
+    if (planar) {
+        overlay->pitch = ALIGN_UP(width, 32);
+        overlay->alignedHeight = ALIGN_UP(height, 16);
+        overlay->staging = (unsigned char *)malloc(
+                overlay->pitch * overlay->alignedHeight * 3 / 2);
+        if (overlay->staging == NULL) {
+            deleteResource(overlay);
+            return 0;
+        }
+    }
+    overlay->planar = planar;
+    overlay->width = width;
+    overlay->height = height;
+    return 1;
+}
+
+static void copyPlane(unsigned char *dst, int dstPitch,
+                      const unsigned char *src, int srcStride,
+                      int width, int height) {
+    int y;
+    for (y = 0; y < height; y++) {
+        memcpy(dst + y * dstPitch, src + y * srcStride, width);
+    }
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_monocle_DispmanVideoOverlay__1create
+    (JNIEnv *env, jobject obj, jint displayID, jint layerID) {
+    DispmanVideoOverlay *overlay;
+
+    load_bcm_symbols();
+
+    overlay = (DispmanVideoOverlay *)calloc(1, sizeof(DispmanVideoOverlay));
+    if (overlay == NULL) {
+        return 0;
+    }
+    overlay->display = vc_dispmanx_display_open(displayID);
+    if (overlay->display == 0) {
+        fprintf(stderr, "Cannot open display for video overlay\n");
+        free(overlay);
+        return 0;
+    }
+    overlay->layer = layerID;
+    return asJLong(overlay);
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_monocle_DispmanVideoOverlay__1show
+    (JNIEnv *env, jobject obj, jlong nativeOverlay, jboolean planar,
+     jobject plane0, jint stride0, jobject plane1, jint stride1,
+     jobject plane2, jint stride2, jint width, jint height,
+     jint srcX, jint srcY, jint srcWidth, jint srcHeight,
+     jint dstX, jint dstY, jint dstWidth, jint dstHeight) {
+    DispmanVideoOverlay *overlay = (DispmanVideoOverlay *)asPtr(nativeOverlay);
+    VC_RECT_T pixelRect = { 0, 0, width, height };
+    VC_RECT_T src = { srcX << 16, srcY << 16, srcWidth << 16, srcHeight << 16 };
+    VC_RECT_T dst = { dstX, dstY, dstWidth, dstHeight };
+    DISPMANX_UPDATE_HANDLE_T update;
+    unsigned char *pixels = (unsigned char *)(*env)->GetDirectBufferAddress(env, plane0);
+    int rc;
+
+    if (overlay == NULL || pixels == NULL || width <= 0 || height <= 0) {
+        return JNI_FALSE;
+    }
+    if (!ensureResource(overlay, planar, width, height)) {
+        return JNI_FALSE;
+    }
+
+    if (planar) {
+        unsigned char *u = (unsigned char *)(*env)->GetDirectBufferAddress(env, plane1);
+        unsigned char *v = (unsigned char *)(*env)->GetDirectBufferAddress(env, plane2);
+        int pitch = overlay->pitch;
+        int lumaSize = pitch * overlay->alignedHeight;
+        int chromaSize = lumaSize / 4;
+        if (u == NULL || v == NULL) {
+            return JNI_FALSE;
+        }
+        copyPlane(overlay->staging, pitch, pixels, stride0, width, height);
+        copyPlane(overlay->staging + lumaSize, pitch / 2,
+                  u, stride1, (width + 1) / 2, (height + 1) / 2);
+        copyPlane(overlay->staging + lumaSize + chromaSize, pitch / 2,
+                  v, stride2, (width + 1) / 2, (height + 1) / 2);
+        rc = vc_dispmanx_resource_write_data(overlay->resource,
+                                             VC_IMAGE_YUV420, pitch,
+                                             overlay->staging, &pixelRect);
+    } else {
+        rc = vc_dispmanx_resource_write_data(overlay->resource,
+                                             VC_IMAGE_ARGB8888, stride0,
+                                             pixels, &pixelRect);
+    }
+    if (rc != 0) {
+        fprintf(stderr, "Cannot write video overlay pixels\n");
+        return JNI_FALSE;
+    }
+
+    update = vc_dispmanx_update_start(0);
+    if (overlay->element == 0) {
+        VC_DISPMANX_ALPHA_T alpha;
+        alpha.flags = DISPMANX_FLAGS_ALPHA_FIXED_ALL_PIXELS;
+        alpha.opacity = 0xff;
+        alpha.mask = (DISPMANX_RESOURCE_HANDLE_T) 0;
+        overlay->element = vc_dispmanx_element_add(
+                               update,
+                               overlay->display,
+                               overlay->layer,
+                               &dst,
+                               overlay->resource,
+                               &src,
+                               DISPMANX_PROTECTION_NONE,
+                               &alpha,
+                               0 /*clamp*/,
+                               0 /*transform*/);
+    } else {
+        vc_dispmanx_element_change_attributes(update,
+                                              overlay->element,
+                                              ELEMENT_CHANGE_DEST_RECT | ELEMENT_CHANGE_SRC_RECT,
+                                              0, 0,
+                                              &dst,
+                                              &src,
+                                              0, 0);
+    }
+    /* Don't wait for the vsync here, the render thread still has to
+     * swap the buffers of the window layer. */
+    vc_dispmanx_update_submit(update, NULL, NULL);
+    return overlay->element != 0 ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanVideoOverlay__1hide
+    (JNIEnv *env, jobject obj, jlong nativeOverlay) {
+    DispmanVideoOverlay *overlay = (DispmanVideoOverlay *)asPtr(nativeOverlay);
+    if (overlay != NULL) {
+        removeElement(overlay);
+    }
+}
+
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_monocle_DispmanVideoOverlay__1dispose
+    (JNIEnv *env, jobject obj, jlong nativeOverlay) {
+    DispmanVideoOverlay *overlay = (DispmanVideoOverlay *)asPtr(nativeOverlay);
+    if (overlay != NULL) {
+        removeElement(overlay);
+        deleteResource(overlay);
+        vc_dispmanx_display_close(overlay->display);
+        free(overlay);
+    }
+}
+
+#endif // USE_DISPMAN
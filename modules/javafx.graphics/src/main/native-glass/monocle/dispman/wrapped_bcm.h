@@ -38,6 +38,7 @@
 #if !defined(_VC_DISPMANX_H_)
 /* for Debian 6.0 libraries */
 typedef enum {
+   VC_IMAGE_YUV420 = 20,    /* planar Y, U, V with the chroma planes subsampled 2x2 */
    VC_IMAGE_ARGB8888 = 43,  /* 32bpp with 8bit alpha at MS byte, with R, G, B (LS byte) */
 } VC_IMAGE_TYPE_T;
 #endif
@@ -52,6 +53,8 @@ typedef enum {
 
 #define vc_dispmanx_update_submit_sync(update) (*wr_vc_dispmanx_update_submit_sync)(update)
 
+#define vc_dispmanx_update_submit(update, cb_func, cb_arg) (*wr_vc_dispmanx_update_submit)(update, cb_func, cb_arg)
+
 #define vc_dispmanx_resource_read_data(handle, p_rect, dst_address, dst_pitch) (*wr_vc_dispmanx_resource_read_data) (handle, p_rect, dst_address, dst_pitch)
 
 #define vc_dispmanx_resource_write_data(res, src_type, src_pitch, src_address, rect) (*wr_vc_dispmanx_resource_write_data)(res, src_type,src_pitch, src_address, rect)
@@ -92,6 +95,10 @@ WRAPPEDAPI DISPMANX_UPDATE_HANDLE_T (*wr_vc_dispmanx_update_start)
 WRAPPEDAPI int (*wr_vc_dispmanx_update_submit_sync)
                 (DISPMANX_UPDATE_HANDLE_T update);
 
+WRAPPEDAPI int (*wr_vc_dispmanx_update_submit)
+                (DISPMANX_UPDATE_HANDLE_T update,
+                 DISPMANX_CALLBACK_FUNC_T cb_func, void *cb_arg);
+
 WRAPPEDAPI int (*wr_vc_dispmanx_resource_read_data)
                 (DISPMANX_RESOURCE_HANDLE_T handle,
                  const VC_RECT_T *p_rect, void *dst_address, uint32_t dst_pitch);
@@ -251,19 +251,54 @@ HRESULT GlassAccessible::callArrayMethod(jmethodID mid, VARTYPE vt, SAFEARRAY **
 }
 
 GlassAccessible::GlassAccessible(JNIEnv* env, jobject jAccessible)
-: m_refCount(1)
+: m_refCount(1), m_runtimeId(NULL)
 {
     m_jAccessible = env->NewGlobalRef(jAccessible);
+    for (int i = 0; i < CACHED_PROPERTY_COUNT; i++) {
+        VariantInit(&m_propertyCache[i]);
+    }
     GlassApplication::IncrementAccessibility();
 }
 
 GlassAccessible::~GlassAccessible()
 {
+    InvalidatePropertyCache();
     JNIEnv* env = GetEnv();
     if (env) env->DeleteGlobalRef(m_jAccessible);
     GlassApplication::DecrementAccessibility();
 }
 
+/*
+ * UIA clients walking a large tree query these properties on every element.
+ * They are derived from the role and the identity of the node, so they are
+ * kept natively and answered without a round trip to the FX side until
+ * the next notification for the node.
+ */
+/* static */ int GlassAccessible::cachedPropertyIndex(PROPERTYID propertyId)
+{
+    switch (propertyId) {
+        case UIA_ControlTypePropertyId: return 0;
+        case UIA_LocalizedControlTypePropertyId: return 1;
+        case UIA_AutomationIdPropertyId: return 2;
+        case UIA_ProviderDescriptionPropertyId: return 3;
+        case UIA_IsPasswordPropertyId: return 4;
+        case UIA_IsDialogPropertyId: return 5;
+        case UIA_IsKeyboardFocusablePropertyId: return 6;
+        default: return -1;
+    }
+}
+
+void GlassAccessible::InvalidatePropertyCache()
+{
+    for (int i = 0; i < CACHED_PROPERTY_COUNT; i++) {
+        VariantClear(&m_propertyCache[i]);
+    }
+    if (m_runtimeId != NULL) {
+        SafeArrayDestroy(m_runtimeId);
+        m_runtimeId = NULL;
+    }
+}
+
 /***********************************************/
 /*                  IUnknown                   */
 /***********************************************/
@@ -375,12 +410,21 @@ IFACEMETHODIMP GlassAccessible::GetPatternProvider(PATTERNID patternId, IUnknown
 IFACEMETHODIMP GlassAccessible::GetPropertyValue(PROPERTYID propertyId, VARIANT* pRetVal)
 {
     if (pRetVal == NULL) return E_INVALIDARG;
+    int index = cachedPropertyIndex(propertyId);
+    if (index != -1 && m_propertyCache[index].vt != VT_EMPTY) {
+        VariantInit(pRetVal);
+        return VariantCopy(pRetVal, &m_propertyCache[index]);
+    }
     JNIEnv* env = GetEnv();
     if (env == NULL) return E_FAIL;
     jobject jVariant = env->CallObjectMethod(m_jAccessible, mid_GetPropertyValue, propertyId);
     if (CheckAndClearException(env)) return E_FAIL;
 
-    return copyVariant(env, jVariant, pRetVal);
+    HRESULT hr = copyVariant(env, jVariant, pRetVal);
+    if (SUCCEEDED(hr) && index != -1) {
+        VariantCopy(&m_propertyCache[index], pRetVal);
+    }
+    return hr;
 }
 
 /***********************************************/
@@ -423,7 +467,18 @@ IFACEMETHODIMP GlassAccessible::GetEmbeddedFragmentRoots(SAFEARRAY **pRetVal)
 IFACEMETHODIMP GlassAccessible::GetRuntimeId(SAFEARRAY **pRetVal)
 {
     if (pRetVal == NULL) return E_INVALIDARG;
-    return callArrayMethod(mid_GetRuntimeId, VT_I4, pRetVal);
+    if (m_runtimeId != NULL) {
+        return SafeArrayCopy(m_runtimeId, pRetVal);
+    }
+    *pRetVal = NULL;
+    HRESULT hr = callArrayMethod(mid_GetRuntimeId, VT_I4, pRetVal);
+    if (SUCCEEDED(hr) && *pRetVal != NULL) {
+        /* The runtime id never changes, the cache only drops it on dispose */
+        if (FAILED(SafeArrayCopy(*pRetVal, &m_runtimeId))) {
+            m_runtimeId = NULL;
+        }
+    }
+    return hr;
 }
 
 IFACEMETHODIMP GlassAccessible::Navigate(NavigateDirection direction, IRawElementProviderFragment **pRetVal)
@@ -1291,9 +1346,22 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinAccessible__1destroyGlassAcc
   (JNIEnv *env, jobject jAccessible, jlong winAccessible)
 {
     GlassAccessible* acc = reinterpret_cast<GlassAccessible*>(winAccessible);
+    acc->InvalidatePropertyCache();
     acc->Release();
 }
 
+/*
+ * Class:     com_sun_glass_ui_win_WinAccessible
+ * Method:    _invalidatePropertyCache
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinAccessible__1invalidatePropertyCache
+  (JNIEnv *env, jobject jAccessible, jlong winAccessible)
+{
+    GlassAccessible* acc = reinterpret_cast<GlassAccessible*>(winAccessible);
+    if (acc) acc->InvalidatePropertyCache();
+}
+
 /*
  * Class:     com_sun_glass_ui_win_WinAccessible
  * Method:    UiaRaiseAutomationEvent
@@ -167,6 +167,9 @@ public:
     // IScrollItemProvider
     IFACEMETHODIMP ScrollIntoView();
 
+    /* Drops the property values and runtime id cached by GetPropertyValue() and GetRuntimeId() */
+    void InvalidatePropertyCache();
+
     static HRESULT copyVariant(JNIEnv *env, jobject jVariant, VARIANT* pRetVal);
     static HRESULT copyString(JNIEnv *env, jstring jString, BSTR* pbstrVal);
     static HRESULT copyList(JNIEnv *env, jarray list, SAFEARRAY** pparrayVal, VARTYPE vt);
@@ -183,6 +186,12 @@ private:
     ULONG m_refCount;
     jobject m_jAccessible;  // The GlobalRef Java side object
 
+    /* Properties whose values only change along with a notification from the FX side */
+    static const int CACHED_PROPERTY_COUNT = 7;
+    static int cachedPropertyIndex(PROPERTYID propertyId);
+    VARIANT m_propertyCache[CACHED_PROPERTY_COUNT];  // VT_EMPTY when not cached
+    SAFEARRAY* m_runtimeId;
+
 };
 
 #endif //_GLASSACCESSIBLE_
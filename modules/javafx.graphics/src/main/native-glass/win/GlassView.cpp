@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -471,17 +471,20 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinView__1uploadPixels
             bf.BlendOp = AC_SRC_OVER;
             bf.BlendFlags = 0;
 
-            DIBitmap bitmap(pixels);
+            // The window keeps its frame DIB and DC between uploads, so a
+            // frame costs a single copy rather than new GDI objects each time
+            void *bits = NULL;
+            HDC hdcSrc = pWindow->GetLayeredDC(size.cx, size.cy, &bits);
+            if (!hdcSrc) {
+                return;
+            }
+            memcpy(bits, pixels.GetBits(), size.cx * size.cy * 4);
 
             HDC hdcDst = ::GetDC(NULL);
-            HDC hdcSrc = ::CreateCompatibleDC(NULL);
-            HBITMAP oldBitmap = (HBITMAP)::SelectObject(hdcSrc, bitmap);
 
             ::UpdateLayeredWindow(hWnd, hdcDst, &ptDst, &size, hdcSrc, &ptSrc,
                     RGB(0, 0, 0), &bf, ULW_ALPHA);
 
-            ::SelectObject(hdcSrc, oldBitmap);
-            ::DeleteDC(hdcSrc);
             ::ReleaseDC(NULL, hdcDst);
         }
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -82,12 +82,17 @@ GlassWindow::GlassWindow(jobject jrefThis, bool isTransparent, bool isDecorated,
     m_beforeFullScreenStyle(0),
     m_beforeFullScreenExStyle(0),
     m_beforeFullScreenMenu(NULL),
-    m_hIcon(NULL)
+    m_hIcon(NULL),
+    m_hLayeredDC(NULL),
+    m_hLayeredBitmap(NULL),
+    m_hLayeredOldBitmap(NULL),
+    m_layeredBits(NULL)
 {
     m_grefThis = GetEnv()->NewGlobalRef(jrefThis);
     m_minSize.x = m_minSize.y = -1;   // "not set" value
     m_maxSize.x = m_maxSize.y = -1;   // "not set" value
     m_hMonitor = NULL;
+    m_layeredSize.cx = m_layeredSize.cy = 0;
     m_insets.left = m_insets.top = m_insets.right = m_insets.bottom = 0;
     m_beforeFullScreenRect.left = m_beforeFullScreenRect.top =
         m_beforeFullScreenRect.right = m_beforeFullScreenRect.bottom = 0;
@@ -106,6 +111,8 @@ GlassWindow::~GlassWindow()
         ::DestroyIcon(m_hIcon);
     }
 
+    ReleaseLayeredBuffer();
+
     if (m_grefThis) {
         GetEnv()->DeleteGlobalRef(m_grefThis);
     }
@@ -115,6 +122,59 @@ GlassWindow::~GlassWindow()
     }
 }
 
+HDC GlassWindow::GetLayeredDC(int width, int height, void **bits)
+{
+    if (m_hLayeredDC && m_layeredSize.cx == width && m_layeredSize.cy == height) {
+        // Make sure GDI is done with the previous frame before it's overwritten
+        ::GdiFlush();
+        *bits = m_layeredBits;
+        return m_hLayeredDC;
+    }
+
+    ReleaseLayeredBuffer();
+
+    BITMAPINFOHEADER bmi = {0};
+    bmi.biSize = sizeof(bmi);
+    bmi.biWidth = width;
+    bmi.biHeight = -height;
+    bmi.biPlanes = 1;
+    bmi.biBitCount = 32;
+    bmi.biCompression = BI_RGB;
+
+    m_hLayeredBitmap = ::CreateDIBSection(NULL, (BITMAPINFO *)&bmi, DIB_RGB_COLORS, &m_layeredBits, NULL, 0);
+    if (!m_hLayeredBitmap || !m_layeredBits) {
+        ReleaseLayeredBuffer();
+        return NULL;
+    }
+    m_hLayeredDC = ::CreateCompatibleDC(NULL);
+    if (!m_hLayeredDC) {
+        ReleaseLayeredBuffer();
+        return NULL;
+    }
+    m_hLayeredOldBitmap = (HBITMAP)::SelectObject(m_hLayeredDC, m_hLayeredBitmap);
+    m_layeredSize.cx = width;
+    m_layeredSize.cy = height;
+
+    *bits = m_layeredBits;
+    return m_hLayeredDC;
+}
+
+void GlassWindow::ReleaseLayeredBuffer()
+{
+    if (m_hLayeredDC) {
+        ::SelectObject(m_hLayeredDC, m_hLayeredOldBitmap);
+        ::DeleteDC(m_hLayeredDC);
+        m_hLayeredDC = NULL;
+    }
+    if (m_hLayeredBitmap) {
+        ::DeleteObject(m_hLayeredBitmap);
+        m_hLayeredBitmap = NULL;
+    }
+    m_hLayeredOldBitmap = NULL;
+    m_layeredBits = NULL;
+    m_layeredSize.cx = m_layeredSize.cy = 0;
+}
+
 LPCTSTR GlassWindow::GetWindowClassNameSuffix()
 {
     return szGlassWindowClassName;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -103,6 +103,11 @@ public:
     void SetIcon(HICON hIcon);
     void HandleWindowPosChangedEvent();
 
+    // Returns a memory DC with a 32-bit top-down DIB of the given size
+    // selected into it, to be passed to UpdateLayeredWindow(). The DIB is
+    // kept between frames and only reallocated when the size changes.
+    HDC GetLayeredDC(int width, int height, void **bits);
+
 protected:
     virtual LRESULT WindowProc(UINT msg, WPARAM wParam, LPARAM lParam);
 
@@ -153,6 +158,15 @@ private:
 
     HICON m_hIcon;
 
+    // Frame buffer of a transparent window, see GetLayeredDC()
+    HDC m_hLayeredDC;
+    HBITMAP m_hLayeredBitmap;
+    HBITMAP m_hLayeredOldBitmap;
+    void *m_layeredBits;
+    SIZE m_layeredSize;
+
+    void ReleaseLayeredBuffer();
+
     //NOTE: this is not a rectangle. The left, top, right, and bottom
     //components contain corresponding insets values.
     RECT m_insets;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -77,6 +77,83 @@ class RunnableTimer : public Timer {
         }
 };
 
+/*
+ * Runs the runnable on a dedicated thread once per frame of the desktop
+ * compositor, so that the pulse follows the refresh rate of the display
+ * (60, 120, 144 Hz...) instead of the multimedia timer period.
+ *
+ * Stop() only flags the timer, the thread deletes it when it notices, so
+ * that a runnable in progress is never waited for on the stopping thread.
+ */
+class VsyncTimer {
+    public:
+        static bool IsSupported()
+        {
+            BOOL enabled = FALSE;
+            return SUCCEEDED(::DwmIsCompositionEnabled(&enabled)) && enabled;
+        }
+
+        static jlong Start(jobject r)
+        {
+            VsyncTimer *timer = new (std::nothrow) VsyncTimer(r);
+            if (!timer) {
+                return 0;
+            }
+            HANDLE thread = ::CreateThread(NULL, 0, StaticThreadProc, timer, 0, NULL);
+            if (!thread) {
+                delete timer;
+                return 0;
+            }
+            ::SetThreadPriority(thread, THREAD_PRIORITY_ABOVE_NORMAL);
+            ::CloseHandle(thread);
+            return ptr_to_jlong(timer);
+        }
+
+        static void Stop(jlong timer)
+        {
+            ::InterlockedExchange(&((VsyncTimer*)jlong_to_ptr(timer))->stopped, TRUE);
+        }
+
+    private:
+        VsyncTimer(jobject r) : runnable(r), stopped(FALSE) {}
+
+        static DWORD WINAPI StaticThreadProc(LPVOID param)
+        {
+            VsyncTimer *timer = (VsyncTimer*)param;
+            timer->Run();
+            delete timer;
+            return 0;
+        }
+
+        void Run()
+        {
+            JNIEnv *env = NULL;
+            // Attach as daemon so that a running timer doesn't keep the VM alive
+            GetJVM()->AttachCurrentThreadAsDaemon((void**)&env, NULL);
+
+            while (!stopped) {
+                // DwmFlush() returns at the next compositor frame. It fails
+                // while composition is off (e.g. on a remote session), fall
+                // back to the nominal frame period then.
+                if (FAILED(::DwmFlush())) {
+                    ::Sleep(16);
+                }
+                if (stopped) {
+                    break;
+                }
+                env->CallVoidMethod(runnable, javaIDs.Runnable.run);
+                CheckAndClearException(env);
+            }
+
+            // Release the runnable while still attached, then let the thread go
+            runnable.Attach(env, NULL);
+            GetJVM()->DetachCurrentThread();
+        }
+
+        JGlobalRef<jobject> runnable;
+        volatile LONG stopped;
+};
+
 extern "C" {
 
 /*
@@ -92,10 +169,43 @@ JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_win_WinTimer__1start
 
 /*
  * Class:     com_sun_glass_ui_win_WinTimer
- * Method:    _stop
+ * Method:    _startVsync
+ * Signature: (Ljava/lang/Runnable;)J
+ */
+JNIEXPORT jlong JNICALL Java_com_sun_glass_ui_win_WinTimer__1startVsync
+  (JNIEnv * env, jobject jThis, jobject runnable)
+{
+    return VsyncTimer::Start(runnable);
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinTimer
+ * Method:    _stopVsync
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinTimer__1stopVsync
+  (JNIEnv * env, jobject jThis, jlong timer)
+{
+    VsyncTimer::Stop(timer);
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinTimer
+ * Method:    _isVsyncSupported
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_glass_ui_win_WinTimer__1isVsyncSupported
+  (JNIEnv * env, jclass cls)
+{
+    return VsyncTimer::IsSupported() ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_sun_glass_ui_win_WinTimer
+ * Method:    _stopTimer
  * Signature: (J)V
  */
-JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinTimer__1stop
+JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinTimer__1stopTimer
   (JNIEnv * env, jobject jThis, jlong timer)
 {
     RunnableTimer::Stop(timer);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -539,9 +539,7 @@ typedef struct _tagJavaIDs {
     struct {
         jmethodID gesturePerformedMID;
         jmethodID inertiaGestureFinishedMID;
-        jmethodID notifyBeginTouchEventMID;
-        jmethodID notifyNextTouchEventMID;
-        jmethodID notifyEndTouchEventMID;
+        jmethodID notifyTouchEventsMID;
     } Gestures;
     struct {
         jmethodID init;
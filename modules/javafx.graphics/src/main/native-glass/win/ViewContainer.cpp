@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1219,15 +1219,19 @@ void NotifyTouchInput(
     const bool isDirect = (ti->dwFlags & TOUCHEVENTF_PEN) == 0;
 
     jint modifiers = GetModifiers();
-    env->CallStaticObjectMethod(gestureSupportCls,
-                                javaIDs.Gestures.notifyBeginTouchEventMID,
-                                view, modifiers, jboolean(isDirect),
-                                jint(count));
-    CheckAndClearException(env);
 
-    for (; count; --count, ++ti) {
-        jlong touchID = jlong(ti->dwID);
+    // All the touch points of the message are passed in a single upcall,
+    // see WinGestureSupport.notifyTouchEvents() for the layout
+    const unsigned stride = 6;
+    std::vector<jint> data(count * stride);
 
+    LONG style = ::GetWindowLong(hWnd, GWL_EXSTYLE);
+    RECT rect = {0};
+    if (style & WS_EX_LAYOUTRTL) {
+        ::GetClientRect(hWnd, &rect);
+    }
+
+    for (unsigned i = 0; i < count; ++i, ++ti) {
         jint eventID = 0;
         if (ti->dwFlags & TOUCHEVENTF_MOVE) {
             eventID = com_sun_glass_events_TouchEvent_TOUCH_MOVED;
@@ -1246,24 +1250,31 @@ void NotifyTouchInput(
         ScreenToClient(hWnd, &client);
 
         // unmirror the x coordinate
-        LONG style = ::GetWindowLong(hWnd, GWL_EXSTYLE);
         if (style & WS_EX_LAYOUTRTL) {
-            RECT rect = {0};
-            ::GetClientRect(hWnd, &rect);
             client.x = max(0, rect.right - rect.left) - client.x;
         }
 
-        env->CallStaticObjectMethod(gestureSupportCls,
-                                    javaIDs.Gestures.notifyNextTouchEventMID,
-                                    view, eventID, touchID,
-                                    jint(client.x), jint(client.y),
-                                    jint(screen.x), jint(screen.y));
-        CheckAndClearException(env);
+        jint *point = &data[i * stride];
+        point[0] = eventID;
+        point[1] = jint(ti->dwID);
+        point[2] = jint(client.x);
+        point[3] = jint(client.y);
+        point[4] = jint(screen.x);
+        point[5] = jint(screen.y);
     }
 
-    env->CallStaticObjectMethod(
-            gestureSupportCls, javaIDs.Gestures.notifyEndTouchEventMID, view);
+    jintArray jdata = env->NewIntArray(jsize(data.size()));
+    if (CheckAndClearException(env) || !jdata) {
+        return;
+    }
+    env->SetIntArrayRegion(jdata, 0, jsize(data.size()), data.data());
+
+    env->CallStaticVoidMethod(gestureSupportCls,
+                              javaIDs.Gestures.notifyTouchEventsMID,
+                              view, modifiers, jboolean(isDirect), jdata);
     CheckAndClearException(env);
+
+    env->DeleteLocalRef(jdata);
 }
 
 void NotifyManipulationProcessor(
@@ -1549,19 +1560,9 @@ JNIEXPORT void JNICALL Java_com_sun_glass_ui_win_WinGestureSupport__1initIDs(
                                 "(Lcom/sun/glass/ui/View;)V");
     CheckAndClearException(env);
 
-    javaIDs.Gestures.notifyBeginTouchEventMID =
-        env->GetStaticMethodID(cls, "notifyBeginTouchEvent",
-                                "(Lcom/sun/glass/ui/View;IZI)V");
-    CheckAndClearException(env);
-
-    javaIDs.Gestures.notifyNextTouchEventMID =
-        env->GetStaticMethodID(cls, "notifyNextTouchEvent",
-                                "(Lcom/sun/glass/ui/View;IJIIII)V");
-    CheckAndClearException(env);
-
-    javaIDs.Gestures.notifyEndTouchEventMID =
-        env->GetStaticMethodID(cls, "notifyEndTouchEvent",
-                                "(Lcom/sun/glass/ui/View;)V");
+    javaIDs.Gestures.notifyTouchEventsMID =
+        env->GetStaticMethodID(cls, "notifyTouchEvents",
+                                "(Lcom/sun/glass/ui/View;IZ[I)V");
     CheckAndClearException(env);
 }
 
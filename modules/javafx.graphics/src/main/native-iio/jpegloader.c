@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1535,6 +1535,8 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
     jfloat x_scale;
     jfloat y_scale;
     jfloat max_scale;
+    unsigned long x_eighths;
+    unsigned long y_eighths;
 
     if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
         ThrowByName(env,
@@ -1564,32 +1566,39 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
     cinfo->out_color_space = outCS;
 
     /* decide how much we want to sub-sample the incoming jpeg image.
-     * The libjpeg docs say:
-     *
-     *     unsigned int scale_num, scale_denom
-     *
-     *     Scale the image by the fraction scale_num/scale_denom.  Default is
-     *     1/1, or no scaling.  Currently, the only supported scaling ratios
-     *     are 1/1, 1/2, 1/4, and 1/8.  (The library design allows for arbitrary
-     *     scaling ratios but this is not likely to be implemented any time soon.)
-     *     Smaller scaling ratios permit significantly faster decoding since
-     *     fewer pixels need be processed and a simpler IDCT method can be used.
+     * The bundled libjpeg (version 9) scales in the IDCT by any fraction
+     * scale_num/8 with scale_num between 1 and 16, so pick the smallest
+     * eighth that still yields at least the requested size.  The remaining
+     * scaling is done by the caller, on a far smaller image than the source.
+     * Smaller scaling ratios permit significantly faster decoding since
+     * fewer pixels need be processed and a simpler IDCT method can be used.
      */
 
-    cinfo->scale_num = 1;
-
+    cinfo->scale_denom = 8;
     x_scale = (jfloat) dest_width / (jfloat) cinfo->image_width;
     y_scale = (jfloat) dest_height / (jfloat) cinfo->image_height;
     max_scale = x_scale > y_scale ? x_scale : y_scale;
 
-    if (max_scale > 0.5) {
-        cinfo->scale_denom = 1;
-    } else if (max_scale > 0.25) {
-        cinfo->scale_denom = 2;
-    } else if (max_scale > 0.125) {
-        cinfo->scale_denom = 4;
+    if (max_scale >= 1.0f) {
+        cinfo->scale_num = 8;
     } else {
-        cinfo->scale_denom = 8;
+        x_eighths = ((unsigned long) dest_width * 8 + cinfo->image_width - 1)
+                / cinfo->image_width;
+        y_eighths = ((unsigned long) dest_height * 8 + cinfo->image_height - 1)
+                / cinfo->image_height;
+        cinfo->scale_num = (unsigned int) (x_eighths > y_eighths ? x_eighths : y_eighths);
+        if (cinfo->scale_num < 1) {
+            cinfo->scale_num = 1;
+        } else if (cinfo->scale_num > 8) {
+            cinfo->scale_num = 8;
+        }
+    }
+
+    if (cinfo->scale_num < 8) {
+        /* The output is reduced further anyway, so the smooth chroma
+         * upsampling would not be visible in the result.
+         */
+        cinfo->do_fancy_upsampling = FALSE;
     }
 
     jpeg_start_decompress(cinfo);
@@ -1610,6 +1619,9 @@ JNIEXPORT jint JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_startDecompr
         (PTR) = NULL;     \
     }
 
+/* Maximum number of rows decoded before they are copied to the Java array */
+#define SCANLINES_PER_STRIP 16
+
 JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompressIndirect
 (JNIEnv *env, jobject this, jlong ptr, jboolean report_progress, jbyteArray barray) {
     imageIODataPtr data = (imageIODataPtr) jlong_to_ptr(ptr);
@@ -1618,7 +1630,11 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
     sun_jpeg_error_ptr jerr;
     int bytes_per_row = cinfo->output_width * cinfo->output_components;
     int offset = 0;
+    int strip_rows;
+    int last_percent = -1;
+    int i;
     JSAMPROW scanline_ptr = NULL;
+    JSAMPROW scanlines[SCANLINES_PER_STRIP];
 
     if (!SAFE_TO_MULT(cinfo->output_width, cinfo->output_components) ||
         !SAFE_TO_MULT(bytes_per_row, cinfo->output_height) ||
@@ -1655,7 +1671,16 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
-    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * sizeof(JSAMPLE));
+    /*
+     * Decode a strip of rows at a time so that the Java array is pinned once
+     * per strip rather than once per row.
+     */
+    strip_rows = cinfo->output_height < SCANLINES_PER_STRIP
+            ? cinfo->output_height : SCANLINES_PER_STRIP;
+    if (strip_rows < 1) {
+        strip_rows = 1;
+    }
+    scanline_ptr = (JSAMPROW) malloc(bytes_per_row * strip_rows * sizeof(JSAMPLE));
     if (scanline_ptr == NULL) {
         RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
         ThrowByName(env,
@@ -1664,28 +1689,49 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
         return JNI_FALSE;
     }
 
+    for (i = 0; i < strip_rows; i++) {
+        scanlines[i] = scanline_ptr + i * bytes_per_row;
+    }
+
     while (cinfo->output_scanline < cinfo->output_height) {
-        int num_scanlines;
+        int num_scanlines = 0;
+        int max_scanlines;
         if (report_progress == JNI_TRUE) {
-            RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
-            (*env)->CallVoidMethod(env, this,
-                    JPEGImageLoader_updateImageProgressID,
-                    cinfo->output_scanline);
-            if ((*env)->ExceptionCheck(env)) {
-                SAFE_FREE(scanline_ptr);
-                return JNI_FALSE;
-            }
-            if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
-                SAFE_FREE(scanline_ptr);
-                ThrowByName(env,
-                          "java/io/IOException",
-                          "Array pin failed");
-                return JNI_FALSE;
+            // Only call back when the reported percentage changes
+            int percent = (int) (((jlong) cinfo->output_scanline * 100) / cinfo->output_height);
+            if (percent != last_percent) {
+                last_percent = percent;
+                RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
+                (*env)->CallVoidMethod(env, this,
+                        JPEGImageLoader_updateImageProgressID,
+                        cinfo->output_scanline);
+                if ((*env)->ExceptionCheck(env)) {
+                    SAFE_FREE(scanline_ptr);
+                    return JNI_FALSE;
+                }
+                if (GET_ARRAYS(env, data, &cinfo->src->next_input_byte) == NOT_OK) {
+                    SAFE_FREE(scanline_ptr);
+                    ThrowByName(env,
+                              "java/io/IOException",
+                              "Array pin failed");
+                    return JNI_FALSE;
+                }
             }
         }
 
-        num_scanlines = jpeg_read_scanlines(cinfo, &scanline_ptr, 1);
-        if (num_scanlines == 1) {
+        max_scanlines = cinfo->output_height - cinfo->output_scanline;
+        if (max_scanlines > strip_rows) {
+            max_scanlines = strip_rows;
+        }
+        while (num_scanlines < max_scanlines) {
+            int n = jpeg_read_scanlines(cinfo, scanlines + num_scanlines,
+                                        max_scanlines - num_scanlines);
+            if (n <= 0) {
+                break;
+            }
+            num_scanlines += n;
+        }
+        if (num_scanlines > 0) {
             jbyte *body = (*env)->GetPrimitiveArrayCritical(env, barray, NULL);
             if (body == NULL) {
                 RELEASE_ARRAYS(env, data, cinfo->src->next_input_byte);
@@ -1693,9 +1739,9 @@ JNIEXPORT jboolean JNICALL Java_com_sun_javafx_iio_jpeg_JPEGImageLoader_decompre
                 SAFE_FREE(scanline_ptr);
                 return JNI_FALSE;
             }
-            memcpy(body+offset,scanline_ptr, bytes_per_row);
-            (*env)->ReleasePrimitiveArrayCritical(env, barray, body, JNI_ABORT);
-            offset += bytes_per_row;
+            memcpy(body+offset, scanline_ptr, bytes_per_row * num_scanlines);
+            (*env)->ReleasePrimitiveArrayCritical(env, barray, body, 0);
+            offset += bytes_per_row * num_scanlines;
         }
     }
     SAFE_FREE(scanline_ptr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2007, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -102,6 +102,12 @@ D3DContext::D3DContext(IDirect3D9Ex *pd3d9, UINT adapter)
     ZeroMemory(&devCaps, sizeof(D3DCAPS9));
     ZeroMemory(&curParams, sizeof(curParams));
     ZeroMemory(textureCache, sizeof(textureCache));
+
+    ZeroMemory(frameTimers, sizeof(frameTimers));
+    frameTimerIndex = 0;
+    bFrameTimingEnabled = false;
+    bFrameTimingStarted = false;
+    gpuFrameTime = -1.0f;
 }
 
 /**
@@ -132,6 +138,9 @@ void D3DContext::ReleaseContextResources(int releaseType)
 
     EndScene();
 
+    // queries do not survive a device reset, they are created again on demand
+    ReleaseFrameTimers();
+
     if (releaseType == RELEASE_DEFAULT) {
         if (pVertexBufferRes != NULL && pVertexBufferRes->IsDefaultPool()) {
             // if VB is in the default pool it will be released by the RM
@@ -287,6 +296,40 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DContext_nBuildNativeGeometr
     return result;
 }
 
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nUpdateNativeVertexBuffer
+ * Signature: (JJ[FII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DContext_nUpdateNativeVertexBuffer
+  (JNIEnv *env, jclass, jlong ctx, jlong nativeMesh, jfloatArray vb, jint offset, jint length)
+{
+    TraceLn(NWT_TRACE_INFO, "D3DContext_nUpdateNativeVertexBuffer");
+    D3DMesh *mesh = (D3DMesh *) jlong_to_ptr(nativeMesh);
+    RETURN_STATUS_IF_NULL(mesh, JNI_FALSE);
+
+    if (offset < 0 || length < 0) {
+        return JNI_FALSE;
+    }
+
+    UINT uOffset = (UINT) offset;
+    UINT uLength = (UINT) length;
+    UINT vertexBufferSize = env->GetArrayLength(vb);
+    if (uOffset > vertexBufferSize || uLength > vertexBufferSize - uOffset) {
+        return JNI_FALSE;
+    }
+
+    float *vertexBuffer = (float *) (env->GetPrimitiveArrayCritical(vb, NULL));
+    if (vertexBuffer == NULL) {
+        return JNI_FALSE;
+    }
+
+    boolean result = mesh->updateVertexBuffer(vertexBuffer, uOffset, uLength);
+    env->ReleasePrimitiveArrayCritical(vb, vertexBuffer, JNI_ABORT);
+
+    return result;
+}
+
 /*
  * Class:     com_sun_prism_d3d_D3DContext
  * Method:    nCreateD3DPhongMaterial
@@ -570,9 +613,9 @@ HRESULT D3DContext::setDeviceParametersFor2D() {
     if (res == S_OK) {
         // Note: No need to restore blend and scissor states as the 2D states were
         //       invalidated on the Java side.
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE)) &&
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID)) &&
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_LIGHTING, FALSE));
+        SUCCEEDED(res = SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_LIGHTING, FALSE));
     }
     return res;
 }
@@ -606,22 +649,22 @@ HRESULT D3DContext::setDeviceParametersFor3D() {
     state.wireframe = false;
     state.cullMode = D3DCULL_NONE;
     if (res == S_OK) {
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE)) &&
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID)) &&
         // This setting matches 2D ((1,1-alpha); premultiplied alpha case.
         // Will need to evaluate when support proper 3D blending (alpha,1-alpha).
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_SRCBLEND, D3DBLEND_ONE)) &&
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA)) &&
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, TRUE)) &&
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE)) &&
-        SUCCEEDED(res = pd3dDevice->SetRenderState(D3DRS_LIGHTING, TRUE)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_SRCBLEND, D3DBLEND_ONE)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_DESTBLEND, D3DBLEND_INVSRCALPHA)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_ALPHABLENDENABLE, TRUE)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE)) &&
+        SUCCEEDED(res = SetRenderState(D3DRS_LIGHTING, TRUE)) &&
         // TODO: 3D - JDK-8092272: [D3D 3D] Need a robust 3D states management for texture
         // Set texture unit 0 to its default texture addressing mode for Prism
-        SUCCEEDED(res = pd3dDevice->SetSamplerState(0, D3DSAMP_ADDRESSU, D3DTADDRESS_WRAP)) &&
-        SUCCEEDED(res = pd3dDevice->SetSamplerState(0, D3DSAMP_ADDRESSV, D3DTADDRESS_WRAP)) &&
+        SUCCEEDED(res = SetSamplerState(0, D3DSAMP_ADDRESSU, D3DTADDRESS_WRAP)) &&
+        SUCCEEDED(res = SetSamplerState(0, D3DSAMP_ADDRESSV, D3DTADDRESS_WRAP)) &&
         // Set texture filter to bilinear for 3D rendering
-        SUCCEEDED(res = pd3dDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR)) &&
-        SUCCEEDED(res = pd3dDevice->SetSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR));
+        SUCCEEDED(res = SetSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_LINEAR)) &&
+        SUCCEEDED(res = SetSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_LINEAR));
     }
     return res;
 }
@@ -661,24 +704,27 @@ HRESULT D3DContext::InitDevice(IDirect3DDevice9Ex *pd3dDevice)
 
     HRESULT res = S_OK;
 
+    // the device states are back to their defaults after creation or a reset
+    InvalidateStateCache();
+
     pd3dDevice->GetDeviceCaps(&devCaps);
 
     RlsTraceLn1(NWT_TRACE_INFO,
                    "D3DContext::InitDevice: device %d", adapterOrdinal);
 
     // disable some of the unneeded and costly d3d functionality
-    pd3dDevice->SetRenderState(D3DRS_SPECULARENABLE, FALSE);
-    pd3dDevice->SetRenderState(D3DRS_LIGHTING,  FALSE);
-    pd3dDevice->SetRenderState(D3DRS_ZENABLE, D3DZB_FALSE);
-    pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_FALSE);
-    pd3dDevice->SetRenderState(D3DRS_COLORVERTEX, FALSE);
-    pd3dDevice->SetRenderState(D3DRS_STENCILENABLE, FALSE);
+    SetRenderState(D3DRS_SPECULARENABLE, FALSE);
+    SetRenderState(D3DRS_LIGHTING,  FALSE);
+    SetRenderState(D3DRS_ZENABLE, D3DZB_FALSE);
+    SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_FALSE);
+    SetRenderState(D3DRS_COLORVERTEX, FALSE);
+    SetRenderState(D3DRS_STENCILENABLE, FALSE);
 
     // set clipping to true inorder support near and far clipping
-    pd3dDevice->SetRenderState(D3DRS_CLIPPING,  TRUE);
+    SetRenderState(D3DRS_CLIPPING,  TRUE);
 
-    pd3dDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
-    pd3dDevice->SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID);
+    SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
+    SetRenderState(D3DRS_FILLMODE, D3DFILL_SOLID);
     state.wireframe = false;
     state.cullMode = D3DCULL_NONE;
 
@@ -784,7 +830,7 @@ D3DContext::Clear(DWORD colorArgbPre, BOOL clearDepth, BOOL ignoreScissor)
         // scissor test affects Clear so it needs to be disabled first
         pd3dDevice->GetRenderState(D3DRS_SCISSORTESTENABLE, &bSE);
         if (bSE) {
-            pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
+            SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
         }
     }
     if (clearDepth) {
@@ -799,7 +845,7 @@ D3DContext::Clear(DWORD colorArgbPre, BOOL clearDepth, BOOL ignoreScissor)
         // also make sure depth writes are enabled for the clear operation
         pd3dDevice->GetRenderState(D3DRS_ZWRITEENABLE, &bDE);
         if (!bDE) {
-            pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_TRUE);
+            SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_TRUE);
         }
     }
 
@@ -807,10 +853,10 @@ D3DContext::Clear(DWORD colorArgbPre, BOOL clearDepth, BOOL ignoreScissor)
 
     // restore previous state
     if (ignoreScissor && bSE) {
-        pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, TRUE);
+        SetRenderState(D3DRS_SCISSORTESTENABLE, TRUE);
     }
     if (clearDepth && !bDE) {
-        pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_FALSE);
+        SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_FALSE);
     }
     return res;
 }
@@ -955,7 +1001,7 @@ D3DContext::SetRenderTarget(IDirect3DSurface9 *pSurface,
                 // Depth buffer must be cleared after it is created, also
                 // if depth buffer was not attached when render target was
                 // cleared, then the depth buffer will contain garbage
-                pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_TRUE);
+                SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_TRUE);
                 res = pd3dDevice->Clear(0, NULL, D3DCLEAR_ZBUFFER, NULL , 1.0f, 0x0L);
                 if (FAILED(res)) {
                     DebugPrintD3DError(res,
@@ -967,7 +1013,7 @@ D3DContext::SetRenderTarget(IDirect3DSurface9 *pSurface,
             return S_FALSE; // Indicates that call succeeded, but render target was not changed
         }
         SAFE_RELEASE(pCurrentDepth);
-        pd3dDevice->SetRenderState(D3DRS_MULTISAMPLEANTIALIAS, msaa);
+        SetRenderState(D3DRS_MULTISAMPLEANTIALIAS, msaa);
     }
     // NOTE PRISM: changed to only recalculate the matrix if current target is
     // different for now
@@ -1066,12 +1112,12 @@ D3DContext::SetProjViewMatrix(BOOL depthTest,
 //    fprintf(stderr, "  %5f %5f %5f %5f\n", projection._41, projection._42, projection._43, projection._44);
 
     if (depthTest && !this->depthTest) {
-        pd3dDevice->SetRenderState(D3DRS_ZENABLE, D3DZB_TRUE);
-        pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_TRUE);
-        pd3dDevice->SetRenderState(D3DRS_ZFUNC, D3DCMP_LESSEQUAL);
+        SetRenderState(D3DRS_ZENABLE, D3DZB_TRUE);
+        SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_TRUE);
+        SetRenderState(D3DRS_ZFUNC, D3DCMP_LESSEQUAL);
     } else if (!depthTest && this->depthTest) {
-        pd3dDevice->SetRenderState(D3DRS_ZENABLE, D3DZB_FALSE);
-        pd3dDevice->SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_FALSE);
+        SetRenderState(D3DRS_ZENABLE, D3DZB_FALSE);
+        SetRenderState(D3DRS_ZWRITEENABLE, D3DZB_FALSE);
     }
     this->depthTest = depthTest;
 
@@ -1208,7 +1254,7 @@ D3DContext::SetRectClip(int x1, int y1, int x2, int y2)
     {
         TraceLn(NWT_TRACE_VERBOSE,
                    "  disabling clip (== render target dimensions)");
-        return pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
+        return SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
     }
 
     // clip to the dimensions of the target surface, otherwise
@@ -1221,7 +1267,7 @@ D3DContext::SetRectClip(int x1, int y1, int x2, int y2)
     if (y1 > y2)                y2 = y1 = 0;
     RECT newRect = { x1, y1, x2, y2 };
     if (SUCCEEDED(res = pd3dDevice->SetScissorRect(&newRect))) {
-        res = pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, TRUE);
+        res = SetRenderState(D3DRS_SCISSORTESTENABLE, TRUE);
     } else {
         DebugPrintD3DError(res, "Error setting scissor rect");
         RlsTraceLn4(NWT_TRACE_ERROR,
@@ -1239,7 +1285,101 @@ D3DContext::ResetClip()
 
     RETURN_STATUS_IF_NULL(pd3dDevice, E_FAIL);
 
-    return pd3dDevice->SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
+    return SetRenderState(D3DRS_SCISSORTESTENABLE, FALSE);
+}
+
+HRESULT
+D3DContext::SetRenderState(D3DRENDERSTATETYPE state, DWORD value)
+{
+    RETURN_STATUS_IF_NULL(pd3dDevice, E_FAIL);
+
+    if ((UINT)state < NUM_CACHED_RENDER_STATES) {
+        if (stateCache.renderStateValid[state] &&
+            stateCache.renderStates[state] == value)
+        {
+#if defined PERF_COUNTERS
+            stats.numStateChangesSkipped++;
+#endif
+            return S_OK;
+        }
+        stateCache.renderStateValid[state] = false;
+    }
+
+#if defined PERF_COUNTERS
+    stats.numStateChanges++;
+#endif
+    HRESULT res = pd3dDevice->SetRenderState(state, value);
+    if (SUCCEEDED(res) && (UINT)state < NUM_CACHED_RENDER_STATES) {
+        stateCache.renderStates[state] = value;
+        stateCache.renderStateValid[state] = true;
+    }
+    return res;
+}
+
+HRESULT
+D3DContext::SetSamplerState(DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD value)
+{
+    RETURN_STATUS_IF_NULL(pd3dDevice, E_FAIL);
+
+    bool cached = sampler < NUM_CACHED_SAMPLERS &&
+                  (UINT)type < NUM_CACHED_SAMPLER_STATES;
+    if (cached) {
+        if (stateCache.samplerStateValid[sampler][type] &&
+            stateCache.samplerStates[sampler][type] == value)
+        {
+#if defined PERF_COUNTERS
+            stats.numStateChangesSkipped++;
+#endif
+            return S_OK;
+        }
+        stateCache.samplerStateValid[sampler][type] = false;
+    }
+
+#if defined PERF_COUNTERS
+    stats.numStateChanges++;
+#endif
+    HRESULT res = pd3dDevice->SetSamplerState(sampler, type, value);
+    if (SUCCEEDED(res) && cached) {
+        stateCache.samplerStates[sampler][type] = value;
+        stateCache.samplerStateValid[sampler][type] = true;
+    }
+    return res;
+}
+
+HRESULT
+D3DContext::SetTexture(DWORD stage, IDirect3DBaseTexture9 *pTexture)
+{
+    RETURN_STATUS_IF_NULL(pd3dDevice, E_FAIL);
+
+    // the device keeps a reference to the bound texture, so a cached
+    // pointer cannot be reused by another texture while it is bound
+    if (stage < NUM_CACHED_SAMPLERS) {
+        if (stateCache.textureValid[stage] &&
+            stateCache.textures[stage] == pTexture)
+        {
+#if defined PERF_COUNTERS
+            stats.numStateChangesSkipped++;
+#endif
+            return S_OK;
+        }
+        stateCache.textureValid[stage] = false;
+    }
+
+#if defined PERF_COUNTERS
+    stats.numStateChanges++;
+#endif
+    HRESULT res = pd3dDevice->SetTexture(stage, pTexture);
+    if (SUCCEEDED(res) && stage < NUM_CACHED_SAMPLERS) {
+        stateCache.textures[stage] = pTexture;
+        stateCache.textureValid[stage] = true;
+    }
+    return res;
+}
+
+void
+D3DContext::InvalidateStateCache()
+{
+    ZeroMemory(&stateCache, sizeof(stateCache));
 }
 
 HRESULT D3DContext::BeginScene()
@@ -1248,6 +1388,9 @@ HRESULT D3DContext::BeginScene()
 
     if (!bBeginScenePending) {
         bBeginScenePending = TRUE;
+        if (bFrameTimingEnabled && !bFrameTimingStarted) {
+            BeginFrameTiming();
+        }
         HRESULT res = pd3dDevice->BeginScene();
         TraceLn(NWT_TRACE_INFO, "D3DContext::BeginScene");
         return res;
@@ -1265,6 +1408,96 @@ HRESULT D3DContext::EndScene()
     return S_OK;
 }
 
+void D3DContext::BeginFrameTiming()
+{
+    bFrameTimingStarted = true;
+
+    FrameTimer &timer = frameTimers[frameTimerIndex];
+    if (timer.pending) {
+        // the GPU is more than NUM_FRAME_TIMERS frames behind, skip this one
+        return;
+    }
+    if (timer.disjoint == NULL) {
+        if (FAILED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPDISJOINT, &timer.disjoint)) ||
+            FAILED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMPFREQ, &timer.frequency)) ||
+            FAILED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMP, &timer.begin)) ||
+            FAILED(pd3dDevice->CreateQuery(D3DQUERYTYPE_TIMESTAMP, &timer.end)))
+        {
+            RlsTraceLn(NWT_TRACE_WARNING, "D3DContext: timestamp queries are not supported");
+            ReleaseFrameTimers();
+            bFrameTimingEnabled = false;
+            bFrameTimingStarted = false;
+            return;
+        }
+    }
+    timer.disjoint->Issue(D3DISSUE_BEGIN);
+    timer.begin->Issue(D3DISSUE_END);
+}
+
+void D3DContext::EndFrameTiming()
+{
+    if (!bFrameTimingEnabled) {
+        return;
+    }
+    if (bFrameTimingStarted) {
+        bFrameTimingStarted = false;
+        FrameTimer &timer = frameTimers[frameTimerIndex];
+        if (!timer.pending && timer.disjoint != NULL) {
+            timer.end->Issue(D3DISSUE_END);
+            timer.frequency->Issue(D3DISSUE_END);
+            timer.disjoint->Issue(D3DISSUE_END);
+            timer.pending = true;
+            frameTimerIndex = (frameTimerIndex + 1) % NUM_FRAME_TIMERS;
+        }
+    }
+    CollectFrameTimings();
+}
+
+void D3DContext::CollectFrameTimings()
+{
+    // oldest first, without D3DGETDATA_FLUSH so this never waits for the GPU
+    for (int n = 0; n != NUM_FRAME_TIMERS; ++n) {
+        FrameTimer &timer = frameTimers[(frameTimerIndex + n) % NUM_FRAME_TIMERS];
+        if (!timer.pending) {
+            continue;
+        }
+        BOOL disjoint;
+        UINT64 frequency, begin, end;
+        if (timer.disjoint->GetData(&disjoint, sizeof(disjoint), 0) != S_OK ||
+            timer.frequency->GetData(&frequency, sizeof(frequency), 0) != S_OK ||
+            timer.begin->GetData(&begin, sizeof(begin), 0) != S_OK ||
+            timer.end->GetData(&end, sizeof(end), 0) != S_OK)
+        {
+            // later frames cannot have completed either
+            break;
+        }
+        timer.pending = false;
+        if (!disjoint && frequency != 0 && end >= begin) {
+            gpuFrameTime = float(double(end - begin) * 1000.0 / double(frequency));
+        }
+    }
+}
+
+void D3DContext::ReleaseFrameTimers()
+{
+    for (int i = 0; i != NUM_FRAME_TIMERS; ++i) {
+        SAFE_RELEASE(frameTimers[i].disjoint);
+        SAFE_RELEASE(frameTimers[i].frequency);
+        SAFE_RELEASE(frameTimers[i].begin);
+        SAFE_RELEASE(frameTimers[i].end);
+        frameTimers[i].pending = false;
+    }
+    bFrameTimingStarted = false;
+}
+
+float D3DContext::GetGpuFrameTime()
+{
+    bFrameTimingEnabled = true;
+    float time = gpuFrameTime;
+    gpuFrameTime = -1.0f;
+    return time;
+}
+
 HRESULT D3DContext::InitContextCaps() {
     if (!IsPow2TexturesOnly()) {
         RlsTraceLn(NWT_TRACE_VERBOSE, "  CAPS_TEXNONPOW2");
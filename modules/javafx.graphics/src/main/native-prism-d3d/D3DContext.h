@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2007, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2007, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,8 +38,17 @@
 
 // allow for 256 quads to match the size of the D3DVertexBuffer's nio buffer
 
-#define MAX_BATCH_QUADS 256
-#define MAX_VERTICES (MAX_BATCH_QUADS*4)
+#define MAX_BATCH_QUADS 2048
+
+// number of render states, samplers and sampler states shadowed by D3DContext
+#define NUM_CACHED_RENDER_STATES (D3DRS_BLENDOPALPHA + 1)
+#define NUM_CACHED_SAMPLERS 8
+#define NUM_CACHED_SAMPLER_STATES (D3DSAMP_DMAPOFFSET + 1)
+
+// number of presented frames whose GPU timing queries can be in flight
+#define NUM_FRAME_TIMERS 4
+// the dynamic vertex buffer holds several batches and is only discarded on wrap
+#define MAX_VERTICES (MAX_BATCH_QUADS*4*4)
 
 struct PRISM_VERTEX_2D {
     float x, y, z;
@@ -161,6 +170,15 @@ public:
     HRESULT SetRectClip(int x1, int y1, int x2, int y2);
     HRESULT ResetClip();
 
+    // device state setters that skip calls which would not change
+    // the current state; all render state, sampler state and texture
+    // changes must go through these so the shadow copy stays valid
+    HRESULT SetRenderState(D3DRENDERSTATETYPE state, DWORD value);
+    HRESULT SetSamplerState(DWORD sampler, D3DSAMPLERSTATETYPE type, DWORD value);
+    HRESULT SetTexture(DWORD stage, IDirect3DBaseTexture9 *pTexture);
+    // forgets the shadowed states, e.g. after the device was reset
+    void    InvalidateStateCache();
+
     BOOL IsPow2TexturesOnly()
         { return devCaps.TextureCaps & D3DPTEXTURECAPS_POW2; };
     BOOL IsSquareTexturesOnly()
@@ -196,6 +214,17 @@ public:
      */
     HRESULT EndScene();
 
+    /**
+     * GPU timing of presented frames. A timestamp is issued when the first
+     * scene of a frame begins and when the frame is presented; the results
+     * are collected a few frames later without stalling the pipeline.
+     * Timing starts with the first call to GetGpuFrameTime, which returns
+     * the GPU time in milliseconds of the most recently completed frame,
+     * or -1 if none is available.
+     */
+    void    EndFrameTiming();
+    float   GetGpuFrameTime();
+
 #if defined PERF_COUNTERS
     struct FrameStats {
         int numTrianglesDrawn;
@@ -206,6 +235,8 @@ public:
         int numSetTexture;
         int numSetPixelShader;
         int numRenderTargetSwitch;
+        int numStateChanges;
+        int numStateChangesSkipped;
 
         void clear() {
             numTrianglesDrawn = 0;
@@ -216,6 +247,8 @@ public:
             numSetTexture = 0;
             numSetPixelShader = 0;
             numRenderTargetSwitch = 0;
+            numStateChanges = 0;
+            numStateChangesSkipped = 0;
         }
     } stats;
 
@@ -287,6 +320,35 @@ private:
      */
     D3DPhongShader *phongShader;
 
+    /**
+     * Shadow copy of the device states set through SetRenderState,
+     * SetSamplerState and SetTexture.
+     */
+    struct StateCache {
+        DWORD renderStates[NUM_CACHED_RENDER_STATES];
+        bool renderStateValid[NUM_CACHED_RENDER_STATES];
+        DWORD samplerStates[NUM_CACHED_SAMPLERS][NUM_CACHED_SAMPLER_STATES];
+        bool samplerStateValid[NUM_CACHED_SAMPLERS][NUM_CACHED_SAMPLER_STATES];
+        IDirect3DBaseTexture9 *textures[NUM_CACHED_SAMPLERS];
+        bool textureValid[NUM_CACHED_SAMPLERS];
+    } stateCache;
+
+    struct FrameTimer {
+        IDirect3DQuery9 *disjoint;
+        IDirect3DQuery9 *frequency;
+        IDirect3DQuery9 *begin;
+        IDirect3DQuery9 *end;
+        bool pending;
+    } frameTimers[NUM_FRAME_TIMERS];
+    int   frameTimerIndex;
+    bool  bFrameTimingEnabled;
+    bool  bFrameTimingStarted;
+    float gpuFrameTime;
+
+    void    BeginFrameTiming();
+    void    CollectFrameTimings();
+    void    ReleaseFrameTimers();
+
     struct TextureUpdateCache {
         IDirect3DTexture9 *texture;
         IDirect3DSurface9 *surface;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -50,9 +50,33 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DSwapChain_nPresent
     RETURN_STATUS_IF_NULL(pSwapChainRes, E_FAIL);
 
     pCtx->EndScene();
+    pCtx->EndFrameTiming();
+
+    IDirect3DSwapChain9 *pSwapChain = pSwapChainRes->GetSwapChain();
+    D3DPRESENT_PARAMETERS params;
+    if (SUCCEEDED(pSwapChain->GetPresentParameters(&params)) &&
+        params.SwapEffect != D3DSWAPEFFECT_COPY)
+    {
+        // a source rectangle is only allowed with the copy swap effect
+        return pSwapChain->Present(0, 0, 0, 0, 0);
+    }
 
     RECT r = { 0, 0, pSwapChainRes->GetDesc()->Width, pSwapChainRes->GetDesc()->Height };
-    return pSwapChainRes->GetSwapChain()->Present(0, &r, 0, 0, 0);
+    return pSwapChain->Present(0, &r, 0, 0, 0);
+}
+
+/*
+ * Class:     com_sun_prism_d3d_D3DContext
+ * Method:    nGetGpuFrameTime
+ * Signature: (J)F
+ */
+JNIEXPORT jfloat JNICALL Java_com_sun_prism_d3d_D3DContext_nGetGpuFrameTime
+  (JNIEnv *, jclass, jlong ctx)
+{
+    D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
+    RETURN_STATUS_IF_NULL(pCtx, -1.0f);
+
+    return pCtx->GetGpuFrameTime();
 }
 
 void setIntField(JNIEnv *env, jobject object, jclass clazz, const char *name, int value);
@@ -83,6 +107,8 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_d3d_D3DContext_nGetFrameStats
     setIntField(env, pResultObject, pResultClass, "numSetTexture", st.numSetTexture);
     setIntField(env, pResultObject, pResultClass, "numSetPixelShader", st.numSetPixelShader);
     setIntField(env, pResultObject, pResultClass, "numRenderTargetSwitch", st.numRenderTargetSwitch);
+    setIntField(env, pResultObject, pResultClass, "numStateChanges", st.numStateChanges);
+    setIntField(env, pResultObject, pResultClass, "numStateChangesSkipped", st.numStateChangesSkipped);
 
     if (bReset) st.clear();
 
@@ -222,9 +248,11 @@ HRESULT D3DContext::drawIndexedQuads(PrismSourceVertex const *pSrcFloats, BYTE c
             stats.numTrianglesDrawn += quadsInBatch * 2;
 #endif
 
-            res = pd3dDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0,
-                firstIndex, numQuads * 4,
-                (firstIndex / 4) * 6, quadsInBatch * 2);
+            // the index buffer only covers one batch, so the batch
+            // is addressed through the base vertex index
+            res = pd3dDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, firstIndex,
+                0, vertsInBatch,
+                0, quadsInBatch * 2);
 
             firstIndex += vertsInBatch;
             numQuads -= quadsInBatch;
@@ -293,10 +321,10 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetBlendEnabled
             dstBlend = D3DBLEND_ONE;
             break;
     }
-    res = pd3dDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, enable);
+    res = pCtx->SetRenderState(D3DRS_ALPHABLENDENABLE, enable);
     if (enable) {
-        res = pd3dDevice->SetRenderState(D3DRS_SRCBLEND, srcBlend);
-        res = pd3dDevice->SetRenderState(D3DRS_DESTBLEND, dstBlend);
+        res = pCtx->SetRenderState(D3DRS_SRCBLEND, srcBlend);
+        res = pCtx->SetRenderState(D3DRS_DESTBLEND, dstBlend);
     }
 
     return res;
@@ -345,21 +373,18 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DContext_nSetTexture
     HRESULT res = pCtx->BeginScene();
     RETURN_STATUS_IF_FAILED(res);
 
-    IDirect3DDevice9Ex *pd3dDevice = pCtx->Get3DDevice();
-    RETURN_STATUS_IF_NULL(pd3dDevice, E_FAIL);
-
     IDirect3DTexture9 *pTex = pRes == NULL ? NULL : pRes->GetTexture();
-    res = pd3dDevice->SetTexture(texUnit, pTex);
+    res = pCtx->SetTexture(texUnit, pTex);
     RETURN_STATUS_IF_FAILED(res);
 
     if (pTex != NULL) {
         D3DTEXTUREFILTERTYPE fhint = linear ? D3DTEXF_LINEAR : D3DTEXF_POINT;
-        pd3dDevice->SetSamplerState(texUnit, D3DSAMP_MAGFILTER, fhint);
-        pd3dDevice->SetSamplerState(texUnit, D3DSAMP_MINFILTER, fhint);
-        pd3dDevice->SetSamplerState(texUnit, D3DSAMP_MIPFILTER, fhint);
+        pCtx->SetSamplerState(texUnit, D3DSAMP_MAGFILTER, fhint);
+        pCtx->SetSamplerState(texUnit, D3DSAMP_MINFILTER, fhint);
+        pCtx->SetSamplerState(texUnit, D3DSAMP_MIPFILTER, fhint);
         if (wrapMode != 0) {
-            pd3dDevice->SetSamplerState(texUnit, D3DSAMP_ADDRESSU, wrapMode);
-            pd3dDevice->SetSamplerState(texUnit, D3DSAMP_ADDRESSV, wrapMode);
+            pCtx->SetSamplerState(texUnit, D3DSAMP_ADDRESSU, wrapMode);
+            pCtx->SetSamplerState(texUnit, D3DSAMP_ADDRESSV, wrapMode);
         }
     }
 
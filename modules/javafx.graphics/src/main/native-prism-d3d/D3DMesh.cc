@@ -196,6 +196,28 @@ boolean D3DMesh::buildBuffers(float *vb, UINT vbSize, UINT *ib, UINT ibSize) {
 
 }
 
+boolean D3DMesh::updateVertexBuffer(float *vb, UINT offset, UINT length) {
+    // offset and length are in floats; the range must fit in the buffer
+    // created by the last buildBuffers call.
+    UINT capacity = numVertices * PRIMITIVE_VERTEX_SIZE / sizeof (float);
+    if (vertexBuffer == NULL || offset > capacity || length > capacity - offset) {
+        return false;
+    }
+    if (length == 0) {
+        return true;
+    }
+
+    UINT offsetBytes = offset * sizeof (float);
+    UINT size = length * sizeof (float);
+    float *data;
+    HRESULT result = vertexBuffer->Lock(offsetBytes, size, (void **) &data, 0);
+    if (SUCCEEDED(result)) {
+        memcpy_s(data, size, vb + offset, size);
+        result = vertexBuffer->Unlock();
+    }
+    return SUCCEEDED(result);
+}
+
 DWORD D3DMesh::getVertexFVF() {
     return fvf;
 }
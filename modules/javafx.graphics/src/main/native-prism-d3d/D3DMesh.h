@@ -40,6 +40,7 @@ public:
             USHORT *indexBuffer, UINT indexBufferSize);
     boolean buildBuffers(float *vertexBuffer, UINT vertexBufferSize,
             UINT *indexBuffer, UINT indexBufferSize);
+    boolean updateVertexBuffer(float *vertexBuffer, UINT offset, UINT length);
     DWORD getVertexFVF();
     IDirect3DIndexBuffer9 *getIndexBuffer();
     IDirect3DVertexBuffer9 *getVertexBuffer();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -289,18 +289,18 @@ void D3DMeshView::render() {
         return;
     }
 
-    SUCCEEDED(device->SetTexture(SR_DIFFUSE_MAP, material->getMap(DIFFUSE)));
-    SUCCEEDED(device->SetTexture(SR_SPECULAR_MAP, material->getMap(SPECULAR)));
-    SUCCEEDED(device->SetTexture(SR_BUMPHEIGHT_MAP, material->getMap(BUMP)));
-    SUCCEEDED(device->SetTexture(SR_SELFILLUM_MAP, material->getMap(SELFILLUMINATION)));
+    SUCCEEDED(context->SetTexture(SR_DIFFUSE_MAP, material->getMap(DIFFUSE)));
+    SUCCEEDED(context->SetTexture(SR_SPECULAR_MAP, material->getMap(SPECULAR)));
+    SUCCEEDED(context->SetTexture(SR_BUMPHEIGHT_MAP, material->getMap(BUMP)));
+    SUCCEEDED(context->SetTexture(SR_SELFILLUM_MAP, material->getMap(SELFILLUMINATION)));
 
     if (context->state.cullMode != cullMode) {
         context->state.cullMode = cullMode;
-        SUCCEEDED(device->SetRenderState(D3DRS_CULLMODE, D3DCULL(cullMode)));
+        SUCCEEDED(context->SetRenderState(D3DRS_CULLMODE, D3DCULL(cullMode)));
     }
     if (context->state.wireframe != wireframe) {
         context->state.wireframe = wireframe;
-        SUCCEEDED(device->SetRenderState(D3DRS_FILLMODE,
+        SUCCEEDED(context->SetRenderState(D3DRS_FILLMODE,
                 wireframe ? D3DFILL_WIREFRAME : D3DFILL_SOLID));
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2009, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2009, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -134,10 +134,11 @@ Java_com_sun_prism_d3d_D3DResourceFactory_nCreateTexture
 /*
  * Class:     com_sun_prism_d3d_D3DResourceFactory
  * Method:    nCreateSwapChain
- * Signature: (JJ)J
+ * Signature: (JJZZI)J
  */
 JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nCreateSwapChain
-  (JNIEnv *jEnv, jclass, jlong ctx, jlong hwnd, jboolean isVsyncEnabled)
+  (JNIEnv *jEnv, jclass, jlong ctx, jlong hwnd, jboolean isVsyncEnabled,
+   jboolean useFlipEx, jint maxFrameLatency)
 {
     D3DContext *pCtx = (D3DContext*)jlong_to_ptr(ctx);
     RETURN_STATUS_IF_NULL(pCtx, 0L);
@@ -148,17 +149,34 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nCreateSwapCha
         return 0L;
     }
 
-    D3DResource *pSwapChainRes = NULL;
-    HRESULT res = pCtx->GetResourceManager()->
-            CreateSwapChain(hWnd, 1,
-            0, 0,
-            // have to use COPY since we don't re-render the scene
-            // if it didn't change
-            D3DSWAPEFFECT_COPY,
-            isVsyncEnabled ?
+    if (maxFrameLatency > 0) {
+        pCtx->Get3DDevice()->SetMaximumFrameLatency(maxFrameLatency);
+    }
+
+    UINT presentationInterval = isVsyncEnabled ?
             D3DPRESENT_INTERVAL_ONE :
-            D3DPRESENT_INTERVAL_IMMEDIATE,
-            &pSwapChainRes);
+            D3DPRESENT_INTERVAL_IMMEDIATE;
+
+    D3DResource *pSwapChainRes = NULL;
+    HRESULT res = E_FAIL;
+    if (useFlipEx) {
+        // the whole back buffer is redrawn from the RTT on every present,
+        // so the undefined contents after a flip do not matter
+        res = pCtx->GetResourceManager()->
+                CreateSwapChain(hWnd, 2, 0, 0,
+                D3DSWAPEFFECT_FLIPEX, presentationInterval,
+                &pSwapChainRes);
+    }
+    if (FAILED(res)) {
+        res = pCtx->GetResourceManager()->
+                CreateSwapChain(hWnd, 1,
+                0, 0,
+                // have to use COPY since we don't re-render the scene
+                // if it didn't change
+                D3DSWAPEFFECT_COPY,
+                presentationInterval,
+                &pSwapChainRes);
+    }
 
     if (SUCCEEDED(res)) {
         return ptr_to_jlong(pSwapChainRes);
@@ -385,12 +403,6 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_d3d_D3DResourceFactory_nUpdateTextureF
 
 
 
-static void copy_X8R8G8B8(DWORD *pDstPixels, DWORD const *pSrcPixels, int n) {
-    for (int i = 0; i!=n; ++i) {
-        pDstPixels[i] = pSrcPixels[i] | 0xff000000;
-    }
-}
-
 /*
  * Note: this method assumes that pCtx, pResource and pixels are not null
  */
@@ -453,7 +465,7 @@ static HRESULT D3DResourceFactory_nReadPixels(D3DContext *pCtx, D3DResource *pRe
             case D3DFMT_X8R8G8B8:
                 for (int y=0; y!=cntH; ++y) {
                     // cntW, cntH are sanity checked in ReadPixelsHelper function
-                    copy_X8R8G8B8(PDWORD(pDstPixels), (DWORD const*)(pSrcPixels), cntW*4);
+                    TextureUpdater::transferX8R8G8B8toA8R8G8B8((DWORD const*)(pSrcPixels), PDWORD(pDstPixels), cntW);
                     pSrcPixels += lockedRect.Pitch;
                     pDstPixels += cntW*4;
                 }
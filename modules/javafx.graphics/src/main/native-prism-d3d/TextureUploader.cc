@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,12 @@
 #include "D3DPipelineManager.h"
 #include "TextureUploader.h"
 
+// SSE2 is always available on x64 and is the compiler default on x86
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TEXTURE_UPDATER_SSE2
+#include <emmintrin.h>
+#endif
+
 void TextureUpdater::transferBytes( BYTE const *pSrcPixels, int srcStride, BYTE *pDstPixels, int dstStride, int w, int h) {
     for (int i = 0; i < h; ++i) {
         memcpy(pDstPixels, pSrcPixels, w);
@@ -36,7 +42,21 @@ void TextureUpdater::transferBytes( BYTE const *pSrcPixels, int srcStride, BYTE
 
 void TextureUpdater::transferA8toA8R8G8B8( BYTE const *pSrcPixels, int srcStride, DWORD *pDstPixels, int dstStride, int w, int h) {
     for (int y = 0; y < h; y++) {
-        for (int x = 0; x < w; x++) {
+        int x = 0;
+#ifdef TEXTURE_UPDATER_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        for (; x + 16 <= w; x += 16) {
+            // only need to set the alpha channel, widen each byte to the top of a DWORD
+            __m128i a = _mm_loadu_si128((__m128i const *)(pSrcPixels + x));
+            __m128i lo = _mm_unpacklo_epi8(zero, a);
+            __m128i hi = _mm_unpackhi_epi8(zero, a);
+            _mm_storeu_si128((__m128i *)(pDstPixels + x +  0), _mm_unpacklo_epi16(zero, lo));
+            _mm_storeu_si128((__m128i *)(pDstPixels + x +  4), _mm_unpackhi_epi16(zero, lo));
+            _mm_storeu_si128((__m128i *)(pDstPixels + x +  8), _mm_unpacklo_epi16(zero, hi));
+            _mm_storeu_si128((__m128i *)(pDstPixels + x + 12), _mm_unpackhi_epi16(zero, hi));
+        }
+#endif
+        for (; x < w; x++) {
             // only need to set the alpha channel
             pDstPixels[x] = DWORD(pSrcPixels[x]) << 24;
         }
@@ -58,6 +78,20 @@ void TextureUpdater::transferRGBtoA8R8G8B8( BYTE const *pSrcPixels, int srcStrid
     }
 }
 
+void TextureUpdater::transferX8R8G8B8toA8R8G8B8( DWORD const *pSrcPixels, DWORD *pDstPixels, int n) {
+    int i = 0;
+#ifdef TEXTURE_UPDATER_SSE2
+    const __m128i alpha = _mm_set1_epi32(0xff000000);
+    for (; i + 4 <= n; i += 4) {
+        __m128i p = _mm_loadu_si128((__m128i const *)(pSrcPixels + i));
+        _mm_storeu_si128((__m128i *)(pDstPixels + i), _mm_or_si128(p, alpha));
+    }
+#endif
+    for (; i < n; i++) {
+        pDstPixels[i] = pSrcPixels[i] | 0xff000000;
+    }
+}
+
 void TextureUpdater::unimplementedError() {
     RlsTrace(NWT_TRACE_ERROR, "Texture transfer is not implemented\n");
 }
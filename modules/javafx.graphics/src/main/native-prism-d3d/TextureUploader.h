@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -113,6 +113,9 @@ struct TextureUpdater {
     int updateLockableTexture();
     int updateD3D9ExTexture(D3DContext *pCtx);
 
+    // copies n pixels forcing the alpha channel to opaque
+    static void transferX8R8G8B8toA8R8G8B8( DWORD const *pSrcPixels, DWORD *pDstPixels, int n);
+
 private:
 
     static void transferBytes( BYTE const *pSrcPixels, int srcStride, BYTE *pDstPixels, int dstStride, int w, int h);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -153,6 +153,42 @@ void initState(ContextInfo *ctxInfo) {
     ctxInfo->state.fbo = 0;
 }
 
+/*
+ * Tells the driver that the contents of the given buffers of the bound
+ * framebuffer are no longer needed, so that tile based GPUs neither load
+ * them into tile memory nor write them back to memory.
+ */
+static void discardBuffers(ContextInfo *ctxInfo,
+        jboolean discardColor, jboolean discardDepth) {
+    GLenum attachments[3];
+    GLsizei count = 0;
+
+    if (ctxInfo->glInvalidateFramebuffer == NULL) {
+        return;
+    }
+
+    if (ctxInfo->state.fbo == 0) {
+        // The window surface uses buffer names rather than attachments
+        if (discardColor) {
+            attachments[count++] = GL_COLOR;
+        }
+        if (discardDepth) {
+            attachments[count++] = GL_DEPTH;
+            attachments[count++] = GL_STENCIL;
+        }
+    } else {
+        if (discardColor) {
+            attachments[count++] = GL_COLOR_ATTACHMENT0;
+        }
+        if (discardDepth) {
+            attachments[count++] = GL_DEPTH_ATTACHMENT;
+        }
+    }
+    if (count > 0) {
+        ctxInfo->glInvalidateFramebuffer(GL_FRAMEBUFFER, count, attachments);
+    }
+}
+
 void clearBuffers(ContextInfo *ctxInfo,
         GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha,
         jboolean clearColor, jboolean clearDepth, jboolean ignoreScissor) {
@@ -168,6 +204,11 @@ void clearBuffers(ContextInfo *ctxInfo,
         glDisable(GL_SCISSOR_TEST);
     }
 
+    // A clear of the whole surface overwrites the old contents anyway
+    if (ignoreScissor || !ctxInfo->state.scissorEnabled) {
+        discardBuffers(ctxInfo, clearColor, clearDepth);
+    }
+
     if (clearColor) {
         clearBIT = GL_COLOR_BUFFER_BIT;
         if ((ctxInfo->state.clearColor[0] != red)
@@ -394,6 +435,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nBlit
      * coordinate system.
      */
 
+    // Only the color buffer is resolved, the depth buffer of the source
+    // is not used again before the next clear
+    if (ctxInfo->glInvalidateFramebuffer != NULL) {
+        GLenum depthAttachment = GL_DEPTH_ATTACHMENT;
+        ctxInfo->glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)srcFBO);
+        ctxInfo->glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, &depthAttachment);
+    }
+
     // Restore previous FBO
     ctxInfo->glBindFramebuffer(GL_FRAMEBUFFER, ctxInfo->state.fbo);
 
@@ -607,6 +656,87 @@ JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgram
     return shaderProgram;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nGetProgramBinary
+ * Signature: (JI[I)[B
+ */
+JNIEXPORT jbyteArray JNICALL Java_com_sun_prism_es2_GLContext_nGetProgramBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint shaderProgram,
+        jintArray formatArr) {
+    GLint length = 0;
+    GLsizei written = 0;
+    GLenum format = 0;
+    jint jformat;
+    void *binary;
+    jbyteArray result = NULL;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (formatArr == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)
+            || (ctxInfo->glGetProgramBinary == NULL)) {
+        return NULL;
+    }
+
+    ctxInfo->glGetProgramiv(shaderProgram, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return NULL;
+    }
+    binary = malloc(length);
+    if (binary == NULL) {
+        return NULL;
+    }
+    ctxInfo->glGetProgramBinary(shaderProgram, length, &written, &format, binary);
+    if (written > 0) {
+        result = (*env)->NewByteArray(env, written);
+        if (result != NULL) {
+            (*env)->SetByteArrayRegion(env, result, 0, written, (jbyte *) binary);
+            jformat = (jint) format;
+            (*env)->SetIntArrayRegion(env, formatArr, 0, 1, &jformat);
+        }
+    }
+    free(binary);
+    return result;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCreateProgramFromBinary
+ * Signature: (JI[B)I
+ */
+JNIEXPORT jint JNICALL Java_com_sun_prism_es2_GLContext_nCreateProgramFromBinary
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint format,
+        jbyteArray binaryArr) {
+    GLuint shaderProgram;
+    GLint success = GL_FALSE;
+    jbyte *binary;
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    if ((ctxInfo == NULL) || (binaryArr == NULL)
+            || (ctxInfo->glCreateProgram == NULL)
+            || (ctxInfo->glGetProgramiv == NULL)
+            || (ctxInfo->glDeleteProgram == NULL)
+            || (ctxInfo->glProgramBinary == NULL)) {
+        return 0;
+    }
+
+    binary = (*env)->GetByteArrayElements(env, binaryArr, NULL);
+    if (binary == NULL) {
+        return 0;
+    }
+    shaderProgram = ctxInfo->glCreateProgram();
+    ctxInfo->glProgramBinary(shaderProgram, (GLenum) format, binary,
+            (*env)->GetArrayLength(env, binaryArr));
+    (*env)->ReleaseByteArrayElements(env, binaryArr, binary, JNI_ABORT);
+
+    // A binary the driver no longer accepts, for instance after a driver
+    // update, fails to link. The caller then compiles from source again.
+    ctxInfo->glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (success == GL_FALSE) {
+        ctxInfo->glDeleteProgram(shaderProgram);
+        return 0;
+    }
+    return shaderProgram;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCompileShader
@@ -1033,9 +1163,20 @@ jboolean doReadPixels(JNIEnv *env, jlong nativeCtxInfo, jint length, jobject buf
         return JNI_FALSE;
     }
 
+    if (!ctxInfo->gl2 && (ctxInfo->readFormatBGRA == 0)) {
+        ctxInfo->readFormatBGRA = (ctxInfo->glExtensionStr != NULL) &&
+                isExtensionSupported(ctxInfo->glExtensionStr,
+                        "GL_EXT_read_format_bgra") ? 1 : -1;
+    }
+
     if (ctxInfo->gl2) {
         glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
                     GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, ptr);
+    } else if (ctxInfo->readFormatBGRA > 0) {
+        // The extension lets the GPU deliver the pixels in the order the
+        // Java side expects, so there is nothing to swap.
+        glReadPixels((GLint) x, (GLint) y, (GLsizei) width, (GLsizei) height,
+                GL_BGRA, GL_UNSIGNED_BYTE, ptr);
     } else {
         jint i;
         GLubyte* c = (GLubyte*) ptr;
@@ -1195,6 +1336,66 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nTexImage2D1
     return err == GL_NO_ERROR ? JNI_TRUE : JNI_FALSE;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCompressedTexImage2D0
+ * Signature: (JIIILjava/lang/Object;II)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nCompressedTexImage2D0
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint internalFormat,
+        jint width, jint height, jobject data, jint dataByteOffset, jint dataSize) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    GLvoid *ptr;
+    GLenum err;
+
+    if ((ctxInfo == NULL) || (ctxInfo->glCompressedTexImage2D == NULL)
+            || (data == NULL)) {
+        return JNI_FALSE;
+    }
+    ptr = (GLvoid *) (((char *) (*env)->GetDirectBufferAddress(env, data))
+            + dataByteOffset);
+
+    glGetError();
+    ctxInfo->glCompressedTexImage2D(GL_TEXTURE_2D, 0, (GLenum) internalFormat,
+            (GLsizei) width, (GLsizei) height, 0, (GLsizei) dataSize, ptr);
+    err = glGetError();
+
+    return err == GL_NO_ERROR ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nCompressedTexImage2D1
+ * Signature: (JIIILjava/lang/Object;II)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nCompressedTexImage2D1
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jint internalFormat,
+        jint width, jint height, jobject data, jint dataByteOffset, jint dataSize) {
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    char *ptr;
+    GLenum err;
+
+    if ((ctxInfo == NULL) || (ctxInfo->glCompressedTexImage2D == NULL)
+            || (data == NULL)) {
+        return JNI_FALSE;
+    }
+    ptr = (char *) (*env)->GetPrimitiveArrayCritical(env, data, NULL);
+    if (ptr == NULL) {
+        fprintf(stderr, "nCompressedTexImage2D1: GetPrimitiveArrayCritical returns NULL: out of memory\n");
+        return JNI_FALSE;
+    }
+
+    glGetError();
+    ctxInfo->glCompressedTexImage2D(GL_TEXTURE_2D, 0, (GLenum) internalFormat,
+            (GLsizei) width, (GLsizei) height, 0, (GLsizei) dataSize,
+            (GLvoid *) (ptr + dataByteOffset));
+    err = glGetError();
+
+    (*env)->ReleasePrimitiveArrayCritical(env, data, ptr, JNI_ABORT);
+
+    return err == GL_NO_ERROR ? JNI_TRUE : JNI_FALSE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nTexSubImage2D0
@@ -1650,6 +1851,69 @@ static void setVertexAttributePointers(ContextInfo *ctx, float *pFloat, char *pB
         ctx->vbByteData = pByte;
     }
 }
+/* Size of the ring buffer the quad vertices are streamed into. A full
+ * vertex batch of the Java side takes about half a megabyte.
+ */
+#define STREAM_VBO_SIZE (4 * 1024 * 1024)
+
+/*
+ * Copies the vertices of a quad batch into the streaming vertex buffer and
+ * points the vertex attributes at them, so that the driver does not have
+ * to copy client side arrays (and scan the indices for their range) on
+ * every draw. The buffer is filled front to back and orphaned with
+ * glBufferData when it is full, which lets the driver hand out fresh
+ * storage instead of waiting for the draws that still read the old one.
+ * Returns JNI_FALSE when the batch cannot be streamed, in which case the
+ * caller draws from the client side arrays.
+ */
+static jboolean uploadQuadVertices(ContextInfo *ctx, float *pFloat, char *pByte, int numVertices) {
+    GLsizeiptr floatSize = numVertices * coordStride;
+    GLsizeiptr byteSize = numVertices * colorStride;
+
+    if ((ctx->glGenBuffers == NULL) || (ctx->glBindBuffer == NULL) ||
+            (ctx->glBufferData == NULL) || (ctx->glBufferSubData == NULL) ||
+            (floatSize + byteSize > STREAM_VBO_SIZE)) {
+        return JNI_FALSE;
+    }
+
+    if (ctx->streamVBO == 0) {
+        ctx->glGenBuffers(1, &ctx->streamVBO);
+        if (ctx->streamVBO == 0) {
+            return JNI_FALSE;
+        }
+        ctx->glBindBuffer(GL_ARRAY_BUFFER, ctx->streamVBO);
+        ctx->glBufferData(GL_ARRAY_BUFFER, STREAM_VBO_SIZE, NULL, GL_STREAM_DRAW);
+        ctx->streamVBOOffset = 0;
+    } else {
+        ctx->glBindBuffer(GL_ARRAY_BUFFER, ctx->streamVBO);
+    }
+
+    if (ctx->streamVBOOffset + floatSize + byteSize > STREAM_VBO_SIZE) {
+        ctx->glBufferData(GL_ARRAY_BUFFER, STREAM_VBO_SIZE, NULL, GL_STREAM_DRAW);
+        ctx->streamVBOOffset = 0;
+    }
+
+    ctx->glBufferSubData(GL_ARRAY_BUFFER, ctx->streamVBOOffset, floatSize, pFloat);
+    ctx->glBufferSubData(GL_ARRAY_BUFFER, ctx->streamVBOOffset + floatSize, byteSize, pByte);
+
+    ctx->glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, coordStride,
+        (const GLvoid *) jlong_to_ptr((jlong) ctx->streamVBOOffset));
+    ctx->glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, coordStride,
+        (const GLvoid *) jlong_to_ptr((jlong) (ctx->streamVBOOffset
+            + FLOATS_PER_VC * sizeof(float))));
+    ctx->glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, coordStride,
+        (const GLvoid *) jlong_to_ptr((jlong) (ctx->streamVBOOffset
+            + (FLOATS_PER_VC + FLOATS_PER_TC) * sizeof(float))));
+    ctx->glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, colorStride,
+        (const GLvoid *) jlong_to_ptr((jlong) (ctx->streamVBOOffset + floatSize)));
+    /* The attributes no longer point at client side arrays */
+    ctx->vbFloatData = NULL;
+    ctx->vbByteData = NULL;
+
+    ctx->streamVBOOffset += floatSize + byteSize;
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nDrawIndexedQuads
@@ -1672,8 +1936,14 @@ JNIEXPORT void JNICALL Java_com_sun_prism_es2_GLContext_nDrawIndexedQuads
     pByte = (char *)(*env)->GetPrimitiveArrayCritical(env, datab, NULL);
 
     if (pFloat && pByte) {
-        setVertexAttributePointers(ctxInfo, pFloat, pByte);
-        glDrawElements(GL_TRIANGLES, numQuads * 2 * 3, GL_UNSIGNED_SHORT, 0);
+        if (uploadQuadVertices(ctxInfo, pFloat, pByte, numVertices)) {
+            glDrawElements(GL_TRIANGLES, numQuads * 2 * 3, GL_UNSIGNED_SHORT, 0);
+            /* Other draws expect client side arrays */
+            ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+        } else {
+            setVertexAttributePointers(ctxInfo, pFloat, pByte);
+            glDrawElements(GL_TRIANGLES, numQuads * 2 * 3, GL_UNSIGNED_SHORT, 0);
+        }
     }
 
     if (pByte)  (*env)->ReleasePrimitiveArrayCritical(env, datab, pByte, JNI_ABORT);
@@ -1822,6 +2092,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_GLContext_nCreateES2Mesh
     /* initialize the structure */
     meshInfo->vboIDArray[MESH_VERTEXBUFFER] = 0;
     meshInfo->vboIDArray[MESH_INDEXBUFFER] = 0;
+    meshInfo->vertexBufferSize = 0;
     meshInfo->indexBufferSize = 0;
     meshInfo->indexBufferType = 0;
 
@@ -1903,6 +2174,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
         ctxInfo->glBufferData(GL_ELEMENT_ARRAY_BUFFER, uibSize * sizeof (GLushort),
                 indexBuffer, GL_STATIC_DRAW);
+        meshInfo->vertexBufferSize = uvbSize;
         meshInfo->indexBufferSize = uibSize;
         meshInfo->indexBufferType = GL_UNSIGNED_SHORT;
 
@@ -1972,6 +2244,7 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
         ctxInfo->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_INDEXBUFFER]);
         ctxInfo->glBufferData(GL_ELEMENT_ARRAY_BUFFER, uibSize * sizeof (GLuint),
                 indexBuffer, GL_STATIC_DRAW);
+        meshInfo->vertexBufferSize = uvbSize;
         meshInfo->indexBufferSize = uibSize;
         meshInfo->indexBufferType = GL_UNSIGNED_INT;
 
@@ -1990,6 +2263,59 @@ JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nBuildNativeGeometry
     return status;
 }
 
+/*
+ * Class:     com_sun_prism_es2_GLContext
+ * Method:    nUpdateNativeVertexBuffer
+ * Signature: (JJ[FII)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_sun_prism_es2_GLContext_nUpdateNativeVertexBuffer
+(JNIEnv *env, jclass class, jlong nativeCtxInfo, jlong nativeMeshInfo,
+        jfloatArray vbArray, jint offset, jint length)
+{
+    GLuint vertexBufferSize;
+    GLfloat *vertexBuffer;
+    GLuint uOffset;
+    GLuint uLength;
+
+    ContextInfo *ctxInfo = (ContextInfo *) jlong_to_ptr(nativeCtxInfo);
+    MeshInfo *meshInfo = (MeshInfo *) jlong_to_ptr(nativeMeshInfo);
+    if ((ctxInfo == NULL) || (meshInfo == NULL) || (vbArray == NULL) ||
+            (ctxInfo->glBindBuffer == NULL) ||
+            (ctxInfo->glBufferSubData == NULL) ||
+            (meshInfo->vboIDArray[MESH_VERTEXBUFFER] == 0) ||
+            offset < 0 || length < 0) {
+        return JNI_FALSE;
+    }
+
+    uOffset = (GLuint) offset;
+    uLength = (GLuint) length;
+    vertexBufferSize = (*env)->GetArrayLength(env, vbArray);
+    // The range must lie within both the Java array and the data store
+    // allocated by the last full build; anything else needs a rebuild.
+    if (uOffset > meshInfo->vertexBufferSize
+            || uLength > meshInfo->vertexBufferSize - uOffset
+            || uOffset + uLength > vertexBufferSize) {
+        return JNI_FALSE;
+    }
+    if (uLength == 0) {
+        return JNI_TRUE;
+    }
+
+    vertexBuffer = (GLfloat *) ((*env)->GetPrimitiveArrayCritical(env, vbArray, NULL));
+    if (vertexBuffer == NULL) {
+        return JNI_FALSE;
+    }
+
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, meshInfo->vboIDArray[MESH_VERTEXBUFFER]);
+    ctxInfo->glBufferSubData(GL_ARRAY_BUFFER, uOffset * sizeof (GLfloat),
+            uLength * sizeof (GLfloat), vertexBuffer + uOffset);
+    ctxInfo->glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    (*env)->ReleasePrimitiveArrayCritical(env, vbArray, vertexBuffer, JNI_ABORT);
+
+    return JNI_TRUE;
+}
+
 /*
  * Class:     com_sun_prism_es2_GLContext
  * Method:    nCreateES2PhongMaterial
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -317,6 +317,14 @@ struct ContextInfoRec {
     PFNGLTEXIMAGE2DMULTISAMPLEPROC glTexImage2DMultisample;
     PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glRenderbufferStorageMultisample;
     PFNGLBLITFRAMEBUFFERPROC glBlitFramebuffer;
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC glCompressedTexImage2D;
+
+    /* GL_ARB_get_program_binary or GL_OES_get_program_binary, may be NULL */
+    PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+    PFNGLPROGRAMBINARYPROC glProgramBinary;
+
+    /* glInvalidateFramebuffer (GLES 3) or glDiscardFramebufferEXT, may be NULL */
+    PFNGLINVALIDATEFRAMEBUFFERPROC glInvalidateFramebuffer;
 
     /* For state caching */
     StateInfo state;
@@ -326,7 +334,13 @@ struct ContextInfoRec {
     /* see setVertexAttributePointers */
     float *vbFloatData;
     char  *vbByteData;
+
+    /* ring buffer the quad vertices are streamed into, see uploadQuadVertices */
+    GLuint streamVBO;
+    GLintptr streamVBOOffset;
     jboolean gl2;
+    /* GL_EXT_read_format_bgra: 0 if not checked yet, 1 if supported, -1 if not */
+    jint readFormatBGRA;
 
     /* Caching properties passed down from Java */
     jboolean vSyncRequested;
@@ -361,6 +375,7 @@ struct MeshInfoRec {
     // vboIDArray[MESH_VERTEXBUFFER] used to store interleave points and tex. coords.
     // vboIDArray[MESH_INDEXBUFFER] used to store element indices
     GLuint vboIDArray[MESH_MAX_BUFFERS];
+    GLuint vertexBufferSize;
     GLuint indexBufferSize;
     GLenum indexBufferType;
 };
@@ -256,6 +256,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_IOSGLContext_nInitialize
             getProcAddress("glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             getProcAddress("glBlitFramebuffer");
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+            getProcAddress("glCompressedTexImage2D");
 
     // initialize platform states and properties to match
     // cached states and properties
@@ -255,6 +255,8 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_MacGLContext_nInitialize
             dlsym(RTLD_DEFAULT, "glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             dlsym(RTLD_DEFAULT, "glBlitFramebuffer");
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+            dlsym(RTLD_DEFAULT, "glCompressedTexImage2D");
 
     // initialize platform states and properties to match
     // cached states and properties
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -217,6 +217,25 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_MonocleGLFactory_nPopulateNativeC
                             GET_DLSYM(handle, "glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
                             GET_DLSYM(handle, "glBlitFramebuffer");
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+                            GET_DLSYM(handle, "glCompressedTexImage2D");
+
+    if (isExtensionSupported(ctxInfo->glExtensionStr,
+            "GL_OES_get_program_binary")) {
+        ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                            GET_DLSYM(handle, "glGetProgramBinaryOES");
+        ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                            GET_DLSYM(handle, "glProgramBinaryOES");
+    }
+
+    if (strncmp(ctxInfo->versionStr, "OpenGL ES 3", 11) == 0) {
+        ctxInfo->glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)
+                            GET_DLSYM(handle, "glInvalidateFramebuffer");
+    } else if (isExtensionSupported(ctxInfo->glExtensionStr,
+            "GL_EXT_discard_framebuffer")) {
+        ctxInfo->glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)
+                            GET_DLSYM(handle, "glDiscardFramebufferEXT");
+    }
 
     initState(ctxInfo);
     return ctxInfo;
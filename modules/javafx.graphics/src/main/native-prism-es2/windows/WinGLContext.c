@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -280,6 +280,16 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_WinGLContext_nInitialize
             wglGetProcAddress("glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             wglGetProcAddress("glBlitFramebuffer");
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+            wglGetProcAddress("glCompressedTexImage2D");
+
+    if (isExtensionSupported(ctxInfo->glExtensionStr,
+            "GL_ARB_get_program_binary")) {
+        ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                wglGetProcAddress("glGetProgramBinary");
+        ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                wglGetProcAddress("glProgramBinary");
+    }
 
     if (isExtensionSupported(ctxInfo->wglExtensionStr,
             "WGL_EXT_swap_control")) {
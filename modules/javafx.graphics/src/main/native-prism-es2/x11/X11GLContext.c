@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -268,6 +268,16 @@ JNIEXPORT jlong JNICALL Java_com_sun_prism_es2_X11GLContext_nInitialize
             dlsym(RTLD_DEFAULT,"glRenderbufferStorageMultisample");
     ctxInfo->glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)
             dlsym(RTLD_DEFAULT,"glBlitFramebuffer");
+    ctxInfo->glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)
+            dlsym(RTLD_DEFAULT,"glCompressedTexImage2D");
+
+    if (isExtensionSupported(ctxInfo->glExtensionStr,
+            "GL_ARB_get_program_binary")) {
+        ctxInfo->glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)
+                dlsym(RTLD_DEFAULT, "glGetProgramBinary");
+        ctxInfo->glProgramBinary = (PFNGLPROGRAMBINARYPROC)
+                dlsym(RTLD_DEFAULT, "glProgramBinary");
+    }
 
     if (isExtensionSupported(ctxInfo->glxExtensionStr,
             "GLX_SGI_swap_control")) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -195,7 +195,7 @@ Java_com_sun_pisces_AbstractSurface_setRGBImpl(JNIEnv* env, jobject objectHandle
             surface_setRGB(surface, x, y, width, height, src, scanLength);
             RELEASE_SURFACE(surface, env, objectHandle);
 
-            (*env)->ReleasePrimitiveArrayCritical(env, arrayHandle, srcData, 0);
+            (*env)->ReleasePrimitiveArrayCritical(env, arrayHandle, srcData, JNI_ABORT);
 
             if (JNI_TRUE == readAndClearMemErrorFlag()) {
                 JNI_ThrowNew(env, "java/lang/OutOfMemoryError",
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -277,7 +277,7 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_setTextureImpl
         } else {
             setMemErrorFlag();
         }
-        (*env)->ReleasePrimitiveArrayCritical(env, dataArray, data, 0);
+        (*env)->ReleasePrimitiveArrayCritical(env, dataArray, data, JNI_ABORT);
     } else {
         setMemErrorFlag();
     }
@@ -620,7 +620,7 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_emitAndClearAlphaRowIm
         } else {
             setMemErrorFlag();
         }
-        (*env)->ReleasePrimitiveArrayCritical(env, jAlphaMap, alphaMap, 0);
+        (*env)->ReleasePrimitiveArrayCritical(env, jAlphaMap, alphaMap, JNI_ABORT);
     } else {
         setMemErrorFlag();
     }
@@ -665,7 +665,7 @@ JNIEXPORT void JNICALL Java_com_sun_pisces_PiscesRenderer_drawImageImpl
             lEdge, rEdge, tEdge, bEdge);
 
         rdr->_texture_intData = NULL;
-        (*env)->ReleasePrimitiveArrayCritical(env, dataArray, data, 0);
+        (*env)->ReleasePrimitiveArrayCritical(env, dataArray, data, JNI_ABORT);
     } else {
         setMemErrorFlag();
     }
@@ -844,7 +844,7 @@ static void fillAlphaMask(Renderer* rdr, jint minX, jint minY, jint maxX, jint m
             }
 
             renderer_removeMask(rdr);
-            (*env)->ReleasePrimitiveArrayCritical(env, jmask, mask, 0);
+            (*env)->ReleasePrimitiveArrayCritical(env, jmask, mask, JNI_ABORT);
         } else {
             setMemErrorFlag();
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -75,6 +75,41 @@ static INLINE jint B(jint x) {
     return x & 0xFF;
 }
 
+/*
+ * The coverage of a run of pixels only changes where the accumulated
+ * alpha row is non-zero. These helpers handle the pixel at iidx and all
+ * following pixels whose alpha row entry is zero (and so already clear),
+ * returning the image index past the run and advancing *pa to its end.
+ */
+static INLINE jint
+fillRun8888(jint *intData, jint iidx, jint imagePixelStride,
+            jint **pa, jint *am, jint cval)
+{
+    jint *a = *pa;
+    intData[iidx] = cval;
+    iidx += imagePixelStride;
+    while (a < am && *a == 0) {
+        intData[iidx] = cval;
+        iidx += imagePixelStride;
+        ++a;
+    }
+    *pa = a;
+    return iidx;
+}
+
+static INLINE jint
+skipRun(jint iidx, jint imagePixelStride, jint **pa, jint *am)
+{
+    jint *a = *pa;
+    iidx += imagePixelStride;
+    while (a < am && *a == 0) {
+        iidx += imagePixelStride;
+        ++a;
+    }
+    *pa = a;
+    return iidx;
+}
+
 void
 emitLineSource8888_pre(Renderer *rdr, jint height, jint frac) {
     jint j, minX, maxX, w, iidx;
@@ -386,8 +421,13 @@ blitSrc8888_pre(Renderer *rdr, jint height) {
             *a++ = 0;
             acoverage = alphaMap[aval_relative] & 0xff;
             if (acoverage == MAX_ALPHA) {
-                intData[iidx] = (calpha << 24) | (cred << 16) | (cgreen << 8) | cblue;
-            } else if (acoverage > 0) {
+                iidx = fillRun8888(intData, iidx, imagePixelStride, &a, am,
+                    (calpha << 24) | (cred << 16) | (cgreen << 8) | cblue);
+                continue;
+            } else if (acoverage == 0) {
+                iidx = skipRun(iidx, imagePixelStride, &a, am);
+                continue;
+            } else {
                 aval = ((acoverage+1) * calpha) >> 8;
                 blendSrc8888_pre(&intData[iidx], aval, 255 - acoverage,
                     cred, cgreen, cblue);
@@ -592,10 +632,15 @@ blitSrcOver8888_pre(Renderer *rdr, jint height) {
                 aval = alphaMap[aval_relative] & 0xff;
                 aval = ((aval+1) * calpha) >> 8;
                 if (aval == MAX_ALPHA) {
-                    intData[iidx] = 0xff000000 | (cred << 16) | (cgreen << 8) | cblue;
+                    iidx = fillRun8888(intData, iidx, imagePixelStride, &a, am,
+                        0xff000000 | (cred << 16) | (cgreen << 8) | cblue);
+                    continue;
                 } else if (aval > 0) {
                     blendSrcOver8888_pre(&intData[iidx], aval, cred, cgreen, cblue);
                 }
+            } else {
+                iidx = skipRun(iidx, imagePixelStride, &a, am);
+                continue;
             }
             iidx += imagePixelStride;
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -385,6 +385,29 @@ static INLINE void checkBoundsNoRepeat(jint *a, jlong *la, jint min, jint max) {
     }
 }
 
+/*
+ * Copies the texels of txtRow from tx on into [a, am), clamping the texel
+ * index to [MAX(0, min), max] like checkBoundsNoRepeat does per pixel.
+ */
+static INLINE void copyRowNoRepeat(jint *a, jint *am, jint *txtRow,
+    jint tx, jint min, jint max)
+{
+    jint len;
+    min = MAX(0, min);
+    while (tx < min && a < am) {
+        *a++ = txtRow[min];
+        ++tx;
+    }
+    len = MIN(am-a, max-tx+1);
+    if (len > 0) {
+        memcpy(a, txtRow + tx, sizeof(jint) * len);
+        a += len;
+    }
+    while (a < am) {
+        *a++ = txtRow[max];
+    }
+}
+
 static INLINE void getPointsToInterpolate(jint *pts, jint *data, jint sidx, jint stride, jint p00,
     jint tx, jint txMax, jint ty, jint tyMax)
 {
@@ -487,24 +510,9 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
 
             switch (repeatInterpolateMode) {
             case NO_REPEAT_NO_INTERPOLATE:
-            {
-                jint *txtRow = txtData + (MAX(0, ty) * txtStride);
-                jint len;
-                tx = (jint)(ltx >> 16);
-                while (tx < txMin && a < am) {
-                    *a++ = txtRow[txMin];
-                    ++tx;
-                }
-                len = MIN(am-a, txMax-tx+1);
-                if (len > 0) {
-                    memcpy(a, txtRow + tx, sizeof(jint) * len);
-                    a += len;
-                }
-                while (a < am) {
-                    *a++ = txtRow[txMax];
-                }
+                copyRowNoRepeat(a, am, txtData + (MAX(0, ty) * txtStride),
+                    (jint)(ltx >> 16), txMin, txMax);
                 break;
-            }
             case REPEAT_NO_INTERPOLATE:
                 while (a < am) {
                     tx = (jint)(ltx >> 16);
@@ -520,6 +528,12 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
                 } // while (a < am)
                 break;
             case NO_REPEAT_INTERPOLATE_ALPHA:
+                if (hfrac == 0 && vfrac == 0) {
+                    // integer translation, every pixel is its own sample
+                    copyRowNoRepeat(a, am, txtData + (MAX(0, ty) * txtStride),
+                        (jint)(ltx >> 16), txMin-1, txMax);
+                    break;
+                }
                 while (a < am) {
                     tx = (jint)(ltx >> 16);
                     checkBoundsNoRepeat(&tx, &ltx, txMin-1, txMax);
@@ -574,6 +588,12 @@ genTexturePaintTarget(Renderer *rdr, jint *paint, jint height) {
                 } // while (a < am)
                 break;
             case NO_REPEAT_INTERPOLATE_NO_ALPHA:
+                if (hfrac == 0 && vfrac == 0) {
+                    // integer translation, every pixel is its own sample
+                    copyRowNoRepeat(a, am, txtData + (MAX(0, ty) * txtStride),
+                        (jint)(ltx >> 16), txMin-1, txMax);
+                    break;
+                }
                 while (a < am) {
                     tx = (jint)(ltx >> 16);
                     checkBoundsNoRepeat(&tx, &ltx, txMin-1, txMax);
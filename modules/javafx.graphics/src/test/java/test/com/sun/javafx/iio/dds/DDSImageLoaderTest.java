@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.iio.dds;
+
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageLoader;
+import com.sun.javafx.iio.dds.DDSImageLoaderFactory;
+import com.sun.prism.Image;
+import java.io.ByteArrayInputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertNull;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+
+public class DDSImageLoaderTest {
+
+    static final int DXT1 = 0x31545844;
+    static final int DXT5 = 0x35545844;
+
+    static byte[] createDDS(int fourCC, int width, int height, byte[] blocks) {
+        ByteBuffer buf = ByteBuffer.allocate(128 + blocks.length).order(ByteOrder.LITTLE_ENDIAN);
+        buf.putInt(0x20534444);     // "DDS "
+        buf.putInt(124);            // dwSize
+        buf.putInt(0x1007);         // caps, height, width, pixel format
+        buf.putInt(height);
+        buf.putInt(width);
+        buf.position(76);
+        buf.putInt(32);             // ddspf.dwSize
+        buf.putInt(0x4);            // DDPF_FOURCC
+        buf.putInt(fourCC);
+        buf.position(128);
+        buf.put(blocks);
+        return buf.array();
+    }
+
+    static ImageFrame load(byte[] data, int w, int h) throws IOException {
+        ImageLoader loader = DDSImageLoaderFactory.getInstance()
+                .createImageLoader(new ByteArrayInputStream(data));
+        assertNotNull(loader);
+        return loader.load(0, w, h, true, true, 1, 1);
+    }
+
+    @Test
+    public void testBC1() throws IOException {
+        // red and blue endpoints, texel (1, 0) uses the blue one
+        byte[] block = { 0x00, (byte)0xF8, 0x1F, 0x00, 0x04, 0x00, 0x00, 0x00 };
+        ImageFrame frame = load(createDDS(DXT1, 4, 4, block), 0, 0);
+        CompressedImageData data = frame.getCompressedData();
+        assertNotNull(data);
+        assertEquals(CompressedImageData.Format.BC1_RGBA, data.getFormat());
+        assertEquals(8, data.getDataSize());
+
+        Image img = Image.convertImageFrame(frame);
+        assertEquals(4, img.getWidth());
+        assertEquals(0xFFFF0000, img.getArgb(0, 0));
+        assertEquals(0xFF0000FF, img.getArgb(1, 0));
+        assertEquals(0xFFFF0000, img.getArgb(3, 3));
+        assertNotNull(img.getCompressedData());
+    }
+
+    @Test
+    public void testBC1TransparentTexel() throws IOException {
+        // c0 <= c1 selects the 3 color mode, where index 3 is transparent
+        byte[] block = { 0x1F, 0x00, 0x00, (byte)0xF8, 0x03, 0x00, 0x00, 0x00 };
+        Image img = Image.convertImageFrame(load(createDDS(DXT1, 4, 4, block), 0, 0));
+        assertEquals(0x00000000, img.getArgb(0, 0));
+        assertEquals(0xFF0000FF, img.getArgb(1, 0));
+    }
+
+    @Test
+    public void testBC3PartialBlock() throws IOException {
+        // alpha endpoints 255 and 0 with every alpha index 1,
+        // color endpoints white and black with every color index 0
+        byte[] block = {
+            (byte)0xFF, 0x00, 0x49, (byte)0x92, 0x24, 0x49, (byte)0x92, 0x24,
+            (byte)0xFF, (byte)0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        };
+        ImageFrame frame = load(createDDS(DXT5, 3, 2, block), 0, 0);
+        assertEquals(3, frame.getWidth());
+        assertEquals(2, frame.getHeight());
+        // non-premultiplied alpha cannot be sampled by Prism as is
+        assertEquals(false, frame.getCompressedData().isPremultiplied());
+        Image img = Image.convertImageFrame(frame);
+        assertEquals(0x00000000, img.getArgb(2, 1));
+    }
+
+    @Test
+    public void testScaledImageHasNoCompressedData() throws IOException {
+        byte[] blocks = new byte[4 * 8];
+        ImageFrame frame = load(createDDS(DXT1, 8, 8, blocks), 4, 4);
+        assertEquals(4, frame.getWidth());
+        assertNull(frame.getCompressedData());
+    }
+
+    @Test
+    public void testUnsupportedFourCC() {
+        byte[] data = createDDS(0x31495441 /* ATI1 */, 4, 4, new byte[8]);
+        assertThrows(IOException.class, () -> load(data, 0, 0));
+    }
+}
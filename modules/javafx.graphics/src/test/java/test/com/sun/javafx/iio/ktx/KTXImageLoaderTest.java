@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.javafx.iio.ktx;
+
+import com.sun.javafx.iio.CompressedImageData;
+import com.sun.javafx.iio.ImageFrame;
+import com.sun.javafx.iio.ImageLoader;
+import com.sun.javafx.iio.ktx.KTXImageLoaderFactory;
+import com.sun.prism.Image;
+import java.io.ByteArrayInputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class KTXImageLoaderTest {
+
+    static final byte[] IDENTIFIER = {
+        (byte)0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, (byte)0xBB, 0x0D, 0x0A, 0x1A, 0x0A
+    };
+    static final int VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK = 147;
+    static final int VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK = 151;
+
+    static byte[] createKTX2(int vkFormat, int width, int height,
+                             int supercompression, int dfdFlags, byte[] blocks) {
+        int dfdOffset = 80 + 24;
+        int levelOffset = dfdOffset + 16;
+        ByteBuffer buf = ByteBuffer.allocate(levelOffset + blocks.length).order(ByteOrder.LITTLE_ENDIAN);
+        buf.put(IDENTIFIER);
+        buf.putInt(vkFormat);
+        buf.putInt(1);              // typeSize
+        buf.putInt(width);
+        buf.putInt(height);
+        buf.putInt(0);              // pixelDepth
+        buf.putInt(0);              // layerCount
+        buf.putInt(1);              // faceCount
+        buf.putInt(1);              // levelCount
+        buf.putInt(supercompression);
+        buf.putInt(dfdOffset);
+        buf.putInt(16);             // dfdByteLength
+        buf.position(80);
+        buf.putLong(levelOffset);
+        buf.putLong(blocks.length);
+        buf.putLong(blocks.length);
+        buf.putInt(16);             // dfdTotalSize
+        buf.position(dfdOffset + 15);
+        buf.put((byte) dfdFlags);
+        buf.position(levelOffset);
+        buf.put(blocks);
+        return buf.array();
+    }
+
+    static ImageFrame load(byte[] data) throws IOException {
+        ImageLoader loader = KTXImageLoaderFactory.getInstance()
+                .createImageLoader(new ByteArrayInputStream(data));
+        assertNotNull(loader);
+        return loader.load(0, 0, 0, true, true, 1, 1);
+    }
+
+    @Test
+    public void testETC2IndividualMode() throws IOException {
+        // base colors (255, 0, 0) and (0, 0, 0), codeword 0, all texels +2
+        byte[] block = { (byte)0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+        ImageFrame frame = load(createKTX2(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 4, 4, 0, 0, block));
+        CompressedImageData data = frame.getCompressedData();
+        assertNotNull(data);
+        assertEquals(CompressedImageData.Format.ETC2_RGB8, data.getFormat());
+        assertTrue(data.isPremultiplied());
+
+        Image img = Image.convertImageFrame(frame);
+        assertEquals(0xFFFF0202, img.getArgb(0, 0));
+        assertEquals(0xFFFF0202, img.getArgb(1, 3));
+        assertEquals(0xFF020202, img.getArgb(2, 0));
+        assertEquals(0xFF020202, img.getArgb(3, 3));
+    }
+
+    @Test
+    public void testETC2AlphaPremultipliedFlag() throws IOException {
+        // EAC base alpha 128 with multiplier 0, black color block
+        byte[] blocks = new byte[16];
+        blocks[0] = (byte) 0x80;
+        ImageFrame frame = load(createKTX2(VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK, 4, 4, 0, 1, blocks));
+        assertTrue(frame.getCompressedData().isPremultiplied());
+        Image img = Image.convertImageFrame(frame);
+        assertEquals(0x80, img.getArgb(0, 0) >>> 24);
+    }
+
+    @Test
+    public void testSupercompressionUnsupported() {
+        byte[] data = createKTX2(VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 4, 4, 2, 0, new byte[8]);
+        assertThrows(IOException.class, () -> load(data));
+    }
+}
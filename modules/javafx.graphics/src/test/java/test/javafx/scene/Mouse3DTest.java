@@ -1685,6 +1685,57 @@ public class Mouse3DTest {
                 m, point(60, 20, -7), 993, 1, point(0.6, 0.2));
     }
 
+    @Test
+    public void shouldPickLargeMeshRepeatedly() {
+        TestMesh m = meshGridXY(0f).handleMove(me);
+        Scene s = scene(group(m), perspective(), true);
+
+        // the first pick tests all faces, later ones go through the pick tree
+        for (int i = 0; i < 3; i++) {
+            me.clear();
+            makeParallel(s, 63, 27);
+            SceneHelper.processMouseEvent(s, generateMouseEvent(MouseEvent.MOUSE_MOVED));
+            MouseEvent e = me.event;
+            assertNotNull(e);
+            assertPickResult(e.getPickResult(),
+                    m, point(63, 27, 0), 1000, 53, point(0.63, 0.27));
+        }
+
+        me.clear();
+        makeParallel(s, 3, 97);
+        SceneHelper.processMouseEvent(s, generateMouseEvent(MouseEvent.MOUSE_MOVED));
+        assertNotNull(me.event);
+        assertPickResult(me.event.getPickResult(),
+                m, point(3, 97, 0), 1000, 181, point(0.03, 0.97));
+
+        me.clear();
+        makeParallel(s, 63, 120);
+        SceneHelper.processMouseEvent(s, generateMouseEvent(MouseEvent.MOUSE_MOVED));
+        assertNull(me.event);
+    }
+
+    @Test
+    public void shouldPickLargeMeshAfterPointsChange() {
+        TestMesh m = meshGridXY(0f).handleMove(me);
+        Scene s = scene(group(m), perspective(), true);
+        for (int i = 0; i < 2; i++) {
+            makeParallel(s, 63, 27);
+            SceneHelper.processMouseEvent(s, generateMouseEvent(MouseEvent.MOUSE_MOVED));
+        }
+
+        TriangleMesh mesh = (TriangleMesh) m.getMesh();
+        mesh.getPoints().setAll(meshGridXY(7f).getPointsArray());
+        for (int i = 0; i < 2; i++) {
+            me.clear();
+            makeParallel(s, 63, 27);
+            SceneHelper.processMouseEvent(s, generateMouseEvent(MouseEvent.MOUSE_MOVED));
+            MouseEvent e = me.event;
+            assertNotNull(e);
+            assertPickResult(e.getPickResult(),
+                    m, point(63, 27, 7), 1007, 53, point(0.63, 0.27));
+        }
+    }
+
     @Test
     public void shouldNotPickShapesIfNearerPickExists() {
         MeshView m = meshXY().handleMove(me);
@@ -2485,6 +2536,37 @@ public class Mouse3DTest {
             new int[] {0, 0, 2, 2, 1, 1});
     }
 
+    private static TestMesh meshGridXY(float z) {
+        // 10x10 cells of 10x10, two faces per cell, 200 faces in total
+        float[] points = new float[11 * 11 * 3];
+        float[] tex = new float[11 * 11 * 2];
+        for (int y = 0; y <= 10; y++) {
+            for (int x = 0; x <= 10; x++) {
+                int p = y * 11 + x;
+                points[p * 3] = x * 10f;
+                points[p * 3 + 1] = y * 10f;
+                points[p * 3 + 2] = z;
+                tex[p * 2] = x / 10f;
+                tex[p * 2 + 1] = y / 10f;
+            }
+        }
+        int[] faces = new int[10 * 10 * 2 * 6];
+        int f = 0;
+        for (int y = 0; y < 10; y++) {
+            for (int x = 0; x < 10; x++) {
+                int p00 = y * 11 + x;
+                int p10 = p00 + 1;
+                int p01 = p00 + 11;
+                int p11 = p01 + 1;
+                for (int p : new int[] {p00, p11, p10, p00, p01, p11}) {
+                    faces[f++] = p;
+                    faces[f++] = p;
+                }
+            }
+        }
+        return new TestMesh(points, tex, faces);
+    }
+
     private static TestMesh meshXYParallel() {
         return new TestMesh(
             new float[] {0f, 0f, 7f,   100f, 0f, 7f,   100f, 100f, 7f },
@@ -2730,6 +2812,10 @@ public class Mouse3DTest {
             mesh.getFaces().setAll(faces);
         }
 
+        public float[] getPointsArray() {
+            return ((TriangleMesh) getMesh()).getPoints().toArray(null);
+        }
+
         public TestMesh rotate(char ax, double angle) {
             doRotate(this, ax, angle);
             return this;
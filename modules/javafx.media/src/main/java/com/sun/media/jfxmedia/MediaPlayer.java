@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -46,6 +46,29 @@ import com.sun.media.jfxmedia.events.PlayerTimeListener;
  * @see MediaRecorder
  */
 public interface MediaPlayer {
+    //**************************************************************************
+    //***** Indices into the array returned by getStatistics()
+    //**************************************************************************
+
+    /** Number of audio buffers rendered by the audio sink. */
+    public static final int STAT_AUDIO_BUFFERS_RENDERED = 0;
+    /** Number of audio buffers dropped by the audio sink. */
+    public static final int STAT_AUDIO_BUFFERS_DROPPED = 1;
+    /** Number of video frames rendered by the video sink. */
+    public static final int STAT_VIDEO_FRAMES_RENDERED = 2;
+    /** Number of late video frames dropped by the video sink. */
+    public static final int STAT_VIDEO_FRAMES_DROPPED = 3;
+    /** Current number of buffers in the audio queue. */
+    public static final int STAT_AUDIO_QUEUE_LEVEL = 4;
+    /** Current number of buffers in the video queue. */
+    public static final int STAT_VIDEO_QUEUE_LEVEL = 5;
+    /** Number of times the audio queue ran empty. */
+    public static final int STAT_AUDIO_QUEUE_UNDERRUNS = 6;
+    /** Number of times the video queue ran empty. */
+    public static final int STAT_VIDEO_QUEUE_UNDERRUNS = 7;
+    /** Length of the array returned by getStatistics(). */
+    public static final int STAT_COUNT = 8;
+
     //**************************************************************************
     //***** Public control functions
     //**************************************************************************
@@ -206,6 +229,16 @@ public interface MediaPlayer {
      */
     public long getAudioSyncDelay();
 
+    /**
+     * Retrieves the playback counters of the native pipeline. The counters
+     * are maintained while playing regardless of whether they are queried.
+     *
+     * @return an array of <code>STAT_COUNT</code> values indexed by the
+     * <code>STAT_*</code> constants, where -1 marks a counter the platform
+     * does not provide, or <code>null</code> if statistics are not supported.
+     */
+    public long[] getStatistics();
+
     /**
      * Begins playing of the media.  To ensure smooth playback, catch the
      * onReady event in the MediaPlayerListener before playing.
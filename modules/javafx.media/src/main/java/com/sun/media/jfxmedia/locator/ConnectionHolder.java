@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,7 +45,13 @@ import java.util.Map;
  *
  */
 public abstract class ConnectionHolder {
-    private static int DEFAULT_BUFFER_SIZE = 4096;
+    // Size of the blocks streamed media is read in. Each block is one JNI
+    // upcall and one copy into a GStreamer buffer, so small blocks cost a lot
+    // of overhead on fast connections. Can be tuned with -Djfxmedia.blockSize.
+    private static final int MIN_BUFFER_SIZE = 4096;
+    private static final int MAX_BUFFER_SIZE = 1024 * 1024;
+    private static int DEFAULT_BUFFER_SIZE = Math.max(MIN_BUFFER_SIZE,
+            Math.min(MAX_BUFFER_SIZE, Integer.getInteger("jfxmedia.blockSize", 65536)));
 
     ReadableByteChannel channel;
     ByteBuffer          buffer = ByteBuffer.allocateDirect(DEFAULT_BUFFER_SIZE);
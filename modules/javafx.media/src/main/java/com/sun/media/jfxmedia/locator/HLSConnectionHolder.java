@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,7 +28,9 @@ import com.sun.media.jfxmedia.MediaError;
 import com.sun.media.jfxmedia.MediaException;
 import com.sun.media.jfxmediaimpl.MediaUtils;
 import java.io.BufferedReader;
+import java.io.ByteArrayInputStream;
 import java.io.IOException;
+import java.io.InputStream;
 import java.io.InputStreamReader;
 import java.net.HttpURLConnection;
 import java.net.MalformedURLException;
@@ -41,11 +43,17 @@ import java.nio.charset.Charset;
 import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Iterator;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.concurrent.BlockingQueue;
 import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Future;
 import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.Semaphore;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
 import java.util.stream.Stream;
 
 final class HLSConnectionHolder extends ConnectionHolder {
@@ -66,6 +74,14 @@ final class HLSConnectionHolder extends ConnectionHolder {
     private boolean isBitrateAdjustable = false;
     private boolean hasAudioExtStream = false;
     private long readStartTime = -1;
+    // Size of the segment being read and the time it took to download it
+    // if it was prefetched, -1 if it is read directly from the connection.
+    private int segmentLength = 0;
+    private long segmentFetchTime = -1;
+    // Smoothed download throughput in bits per second, -1 until the first
+    // segment is read.
+    private long throughput = -1;
+    private SegmentPrefetcher prefetcher = null;
     private boolean sendHeader = false;
     private boolean isInitialized = false;
     private int duration = -1;
@@ -87,6 +103,15 @@ final class HLSConnectionHolder extends ConnectionHolder {
     static final int HLS_VALUE_MIMETYPE_AAC = 4;
     static final String CHARSET_UTF_8 = "UTF-8";
     static final String CHARSET_US_ASCII = "US-ASCII";
+    // Number of segments downloaded ahead of the one being played.
+    // Can be tuned with -Djfxmedia.hls.prefetchSegments, 0 disables prefetch.
+    static final int PREFETCH_SEGMENTS = Math.max(0,
+            Math.min(8, Integer.getInteger("jfxmedia.hls.prefetchSegments", 2)));
+    // Weight of the last segment in the smoothed throughput and the share
+    // of the throughput a variant may use, so that a single fast or slow
+    // segment does not make the stream switch back and forth.
+    static final double THROUGHPUT_WEIGHT = 0.3;
+    static final double THROUGHPUT_SAFETY_FACTOR = 0.8;
 
     HLSConnectionHolder(URI uri) {
         playlistLoader = new PlaylistLoader();
@@ -196,6 +221,9 @@ final class HLSConnectionHolder extends ConnectionHolder {
         currentPlaylist.close();
         super.closeConnection();
         resetConnection();
+        if (prefetcher != null) {
+            prefetcher.shutdown();
+        }
         playlistLoader.putState(PlaylistLoader.STATE_EXIT);
     }
 
@@ -379,19 +407,55 @@ final class HLSConnectionHolder extends ConnectionHolder {
             return -1;
         }
 
-        try {
-            URI uri = new URI(mediaFile);
-            urlConnection = uri.toURL().openConnection();
-            channel = openChannel();
-        } catch (IOException | URISyntaxException e) {
-            return -1;
+        Segment segment = (prefetcher != null) ? prefetcher.take(mediaFile) : null;
+        if (segment != null) {
+            channel = Channels.newChannel(new ByteArrayInputStream(segment.data));
+            segmentLength = segment.data.length;
+            segmentFetchTime = segment.fetchTime;
+        } else {
+            try {
+                URI uri = new URI(mediaFile);
+                urlConnection = uri.toURL().openConnection();
+                channel = openChannel();
+            } catch (IOException | URISyntaxException e) {
+                return -1;
+            }
+            segmentLength = urlConnection.getContentLength();
+            segmentFetchTime = -1;
         }
 
+        prefetchSegments();
+
         if (currentPlaylist.isCurrentMediaFileDiscontinuity()) {
-            return (-1 * (urlConnection.getContentLength() + headerLength));
+            return (-1 * (segmentLength + headerLength));
         } else {
-            return (urlConnection.getContentLength() + headerLength);
+            return (segmentLength + headerLength);
+        }
+    }
+
+    // Starts downloading the segments that follow the current one, so the
+    // pipeline does not wait a full request round trip between segments.
+    private void prefetchSegments() {
+        if (PREFETCH_SEGMENTS == 0) {
+            return;
+        }
+
+        List<String> mediaFiles = new ArrayList<>(PREFETCH_SEGMENTS);
+        for (int i = 1; i <= PREFETCH_SEGMENTS; i++) {
+            String mediaFile = currentPlaylist.peekMediaFile(i);
+            if (mediaFile == null) {
+                break;
+            }
+            mediaFiles.add(mediaFile);
+        }
+
+        if (prefetcher == null) {
+            if (mediaFiles.isEmpty()) {
+                return;
+            }
+            prefetcher = new SegmentPrefetcher();
         }
+        prefetcher.prefetch(mediaFiles);
     }
 
     private ReadableByteChannel openChannel() throws IOException {
@@ -403,7 +467,25 @@ final class HLSConnectionHolder extends ConnectionHolder {
     }
 
     private void adjustBitrate(long readTime) {
-        int avgBitrate = (int) (((long) urlConnection.getContentLength() * 8 * 1000) / readTime);
+        // Reading a prefetched segment does not touch the network, use the
+        // time it took to download it instead.
+        if (segmentFetchTime != -1) {
+            readTime = segmentFetchTime;
+        }
+        if (segmentLength <= 0) {
+            return;
+        }
+
+        long bitrate = ((long) segmentLength * 8 * 1000) / Math.max(readTime, 1);
+        if (throughput == -1) {
+            throughput = bitrate;
+        } else {
+            throughput = (long) (THROUGHPUT_WEIGHT * bitrate
+                    + (1.0 - THROUGHPUT_WEIGHT) * throughput);
+        }
+
+        int avgBitrate = (int) Math.min(Integer.MAX_VALUE,
+                (long) (throughput * THROUGHPUT_SAFETY_FACTOR));
 
         Playlist playlist = variantPlaylist.getPlaylistBasedOnBitrate(avgBitrate);
         if (playlist != null && playlist != currentPlaylist) {
@@ -466,6 +548,93 @@ final class HLSConnectionHolder extends ConnectionHolder {
         return currentPlaylist;
     }
 
+    private static class Segment {
+
+        final byte[] data;
+        final long fetchTime;
+
+        Segment(byte[] data, long fetchTime) {
+            this.data = data;
+            this.fetchTime = fetchTime;
+        }
+    }
+
+    // Downloads upcoming media segments in the background. Segments are
+    // keyed by their location, so segments requested before a seek or a
+    // bitrate switch are simply not used and get cancelled.
+    private static class SegmentPrefetcher {
+
+        private final ThreadPoolExecutor executor;
+        private final Map<String, Future<Segment>> segments = new LinkedHashMap<>();
+
+        SegmentPrefetcher() {
+            executor = new ThreadPoolExecutor(PREFETCH_SEGMENTS, PREFETCH_SEGMENTS,
+                    5, TimeUnit.SECONDS, new LinkedBlockingQueue<>(), r -> {
+                        Thread t = new Thread(r, "JFXMedia HLS Prefetch Thread");
+                        t.setDaemon(true);
+                        return t;
+                    });
+            executor.allowCoreThreadTimeOut(true);
+        }
+
+        synchronized void prefetch(List<String> mediaFiles) {
+            Iterator<Map.Entry<String, Future<Segment>>> it = segments.entrySet().iterator();
+            while (it.hasNext()) {
+                Map.Entry<String, Future<Segment>> entry = it.next();
+                if (!mediaFiles.contains(entry.getKey())) {
+                    entry.getValue().cancel(true);
+                    it.remove();
+                }
+            }
+
+            for (String mediaFile : mediaFiles) {
+                if (!segments.containsKey(mediaFile)) {
+                    segments.put(mediaFile, executor.submit(() -> download(mediaFile)));
+                }
+            }
+        }
+
+        // Returns downloaded segment or null if it was not prefetched or
+        // download failed, in which case it should be read directly.
+        Segment take(String mediaFile) {
+            Future<Segment> future;
+            synchronized (this) {
+                future = segments.remove(mediaFile);
+            }
+            if (future == null) {
+                return null;
+            }
+
+            try {
+                return future.get();
+            } catch (ExecutionException e) {
+                return null;
+            } catch (InterruptedException e) {
+                Thread.currentThread().interrupt();
+                return null;
+            }
+        }
+
+        synchronized void shutdown() {
+            for (Future<Segment> future : segments.values()) {
+                future.cancel(true);
+            }
+            segments.clear();
+            executor.shutdownNow();
+        }
+
+        private static Segment download(String mediaFile) throws IOException, URISyntaxException {
+            long startTime = System.currentTimeMillis();
+            URLConnection connection = new URI(mediaFile).toURL().openConnection();
+            try (InputStream stream = connection.getInputStream()) {
+                byte[] data = stream.readAllBytes();
+                return new Segment(data, System.currentTimeMillis() - startTime);
+            } finally {
+                Locator.closeConnection(connection);
+            }
+        }
+    }
+
     private static class PlaylistLoader extends Thread {
 
         public static final int STATE_INIT = 0;
@@ -817,6 +986,7 @@ final class HLSConnectionHolder extends ConnectionHolder {
                         validateArray(tagParams, 2);
                         String[] params = tagParams[1].split(",");
                         String uri = getStringParams(TAG_PARAM_URI, params);
+                        getPlaylist().setHasInitSegment(true);
                         getPlaylist().addMediaFile(uri,
                                 getPlaylist().getTargetDuration(), true);
                         break;
@@ -1188,6 +1358,9 @@ final class HLSConnectionHolder extends ConnectionHolder {
         private boolean sequenceNumberUpdated = false;
         private boolean forceDiscontinuity = false;
         private int mimeType = HLS_VALUE_MIMETYPE_UNKNOWN;
+        // Set if playlist has EXT-X-MAP tag. Only fragmented MP4
+        // segments have init segment, whatever their extension is.
+        private boolean hasInitSegment = false;
         private int mediaFileIndex = -1;
         private final Semaphore liveSemaphore = new Semaphore(0);
         private boolean isPlaylistClosed = false;
@@ -1352,6 +1525,23 @@ final class HLSConnectionHolder extends ConnectionHolder {
             }
         }
 
+        // Returns location of media file which follows current one by
+        // offset without moving to it, or null if it is not known yet.
+        String peekMediaFile(int offset) {
+            synchronized (lock) {
+                int index = mediaFileIndex + offset;
+                if (index >= 0 && index < mediaFiles.size()) {
+                    if (baseURI != null) {
+                        return baseURI + mediaFiles.get(index);
+                    } else {
+                        return mediaFiles.get(index);
+                    }
+                }
+            }
+
+            return null;
+        }
+
         String getHeaderFile() {
             synchronized (lock) {
                 if (mediaFiles.size() > 0) {
@@ -1519,16 +1709,28 @@ final class HLSConnectionHolder extends ConnectionHolder {
             return -1;
         }
 
+        void setHasInitSegment(boolean value) {
+            synchronized (lock) {
+                hasInitSegment = value;
+            }
+        }
+
         int getMimeType() {
             synchronized (lock) {
                 if (mimeType == HLS_VALUE_MIMETYPE_UNKNOWN) {
-                    if (mediaFiles.size() > 0) {
+                    if (hasInitSegment) {
+                        mimeType = HLS_VALUE_MIMETYPE_FMP4;
+                    } else if (mediaFiles.size() > 0) {
                         if (stripParameters(mediaFiles.get(0)).endsWith(".ts")) {
                             mimeType = HLS_VALUE_MIMETYPE_MP2T;
                         } else if (stripParameters(mediaFiles.get(0)).endsWith(".mp3")) {
                             mimeType = HLS_VALUE_MIMETYPE_MP3;
                         } else if (stripParameters(mediaFiles.get(0)).endsWith(".mp4")
-                                || stripParameters(mediaFiles.get(0)).endsWith(".m4s")) {
+                                || stripParameters(mediaFiles.get(0)).endsWith(".m4s")
+                                || stripParameters(mediaFiles.get(0)).endsWith(".m4v")
+                                || stripParameters(mediaFiles.get(0)).endsWith(".m4a")
+                                || stripParameters(mediaFiles.get(0)).endsWith(".cmfv")
+                                || stripParameters(mediaFiles.get(0)).endsWith(".cmfa")) {
                             mimeType = HLS_VALUE_MIMETYPE_FMP4;
                         } else if (stripParameters(mediaFiles.get(0)).endsWith(".aac")) {
                             mimeType = HLS_VALUE_MIMETYPE_AAC;
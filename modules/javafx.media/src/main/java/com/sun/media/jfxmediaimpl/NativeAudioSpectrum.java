@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,7 +78,7 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     }
 
     @Override
-    public void setBandCount(int bands) {
+    public synchronized void setBandCount(int bands) {
         if (bands > 1) {
             magnitudes = new float[bands];
             for (int i = 0; i < magnitudes.length; i++) {
@@ -123,8 +123,12 @@ final class NativeAudioSpectrum implements AudioSpectrum {
         }
     }
 
+    // Native side keeps the latest spectrum and only copies it into the
+    // band arrays when they are read, so the thread producing spectrum
+    // never has to call into Java.
     @Override
-    public float[] getMagnitudes(float[] mag) {
+    public synchronized float[] getMagnitudes(float[] mag) {
+        nativeGetBands(nativeRef, magnitudes, phases);
         int size = magnitudes.length;
         if(mag == null || mag.length < size) {
             mag = new float[size];
@@ -134,7 +138,8 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     }
 
     @Override
-    public float[] getPhases(float[] phs) {
+    public synchronized float[] getPhases(float[] phs) {
+        nativeGetBands(nativeRef, magnitudes, phases);
         int size = phases.length;
         if(phs == null || phs.length < size) {
             phs = new float[size];
@@ -149,6 +154,7 @@ final class NativeAudioSpectrum implements AudioSpectrum {
     private native boolean nativeGetEnabled(long nativeRef);
     private native void    nativeSetEnabled(long nativeRef, boolean enable);
     private native void    nativeSetBands(long nativeRef, int bands, float[] magnitudes, float[] phases);
+    private native void    nativeGetBands(long nativeRef, float[] magnitudes, float[] phases);
     private native double  nativeGetInterval(long nativeRef);
     private native void    nativeSetInterval(long nativeRef, double interval);
     private native int     nativeGetThreshold(long nativeRef);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1023,6 +1023,16 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
         return 0;
     }
 
+    @Override
+    public long[] getStatistics() {
+        try {
+            return playerGetStatistics();
+        } catch (MediaException me) {
+            sendPlayerEvent(new MediaErrorEvent(this, me.getMediaError()));
+        }
+        return null;
+    }
+
     @Override
     public void play() {
         try {
@@ -1274,6 +1284,14 @@ public abstract class NativeMediaPlayer implements MediaPlayer, MarkerStateListe
 
     protected abstract void playerSetAudioSyncDelay(long delay) throws MediaException;
 
+    /**
+     * Returns the pipeline counters, see {@link MediaPlayer#getStatistics()}.
+     * Platforms which do not collect statistics keep this default.
+     */
+    protected long[] playerGetStatistics() throws MediaException {
+        return null;
+    }
+
     protected abstract void playerPlay() throws MediaException;
 
     protected abstract void playerStop() throws MediaException;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -104,6 +104,16 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
         }
     }
 
+    @Override
+    protected long[] playerGetStatistics() throws MediaException {
+        long[] statistics = new long[STAT_COUNT];
+        int rc = gstGetStatistics(gstMedia.getNativeMediaRef(), statistics);
+        if (0 != rc) {
+            throwMediaErrorException(rc, null);
+        }
+        return statistics;
+    }
+
     @Override
     protected void playerPlay() throws MediaException {
         int rc = gstPlay(gstMedia.getNativeMediaRef());
@@ -284,6 +294,7 @@ final class GSTMediaPlayer extends NativeMediaPlayer {
     private native long gstGetAudioSpectrum(long refNativeMedia);
     private native int gstGetAudioSyncDelay(long refNativeMedia, long[] syncDelay);
     private native int gstSetAudioSyncDelay(long refNativeMedia, long delay);
+    private native int gstGetStatistics(long refNativeMedia, long[] statistics);
     private native int gstPlay(long refNativeMedia);
     private native int gstPause(long refNativeMedia);
     private native int gstStop(long refNativeMedia);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -2668,7 +2668,13 @@ public final class MediaPlayer {
 
     private final Object renderLock = new Object();
     private VideoDataBuffer currentRenderFrame;
-    private VideoDataBuffer nextRenderFrame;
+    // Frames received but not yet shown, in presentation order. There is more
+    // than one only if the native player delivers frames ahead of time.
+    private final ArrayDeque<VideoDataBuffer> pendingRenderFrames = new ArrayDeque<>();
+    private static final int MAX_PENDING_FRAMES = 4;
+    // A frame is shown on the pulse preceding its timestamp by at most this
+    // many seconds, so it is on screen at about the vsync it belongs to.
+    private static final double FRAME_SELECT_AHEAD = 0.008;
 
     // NGMediaView will call this to get the frame to render
     /**
@@ -2706,10 +2712,10 @@ public final class MediaPlayer {
                         vdb.holdFrame();
 
                         // currentRenderFrame must not be touched, queue this one for later
-                        if (null != nextRenderFrame) {
-                            nextRenderFrame.releaseFrame();
+                        if (pendingRenderFrames.size() >= MAX_PENDING_FRAMES) {
+                            pendingRenderFrames.poll().releaseFrame();
                         }
-                        nextRenderFrame = vdb;
+                        pendingRenderFrames.add(vdb);
                     }
                     // make sure we get the next pulse so we can update our textures
                     Toolkit.getToolkit().requestNextPulse();
@@ -2727,13 +2733,40 @@ public final class MediaPlayer {
                     currentRenderFrame = null;
                 }
 
-                if (null != nextRenderFrame) {
-                    nextRenderFrame.releaseFrame();
-                    nextRenderFrame = null;
+                VideoDataBuffer frame;
+                while ((frame = pendingRenderFrames.poll()) != null) {
+                    frame.releaseFrame();
                 }
             }
         }
 
+        /*
+         * Takes the newest pending frame that is due by the upcoming vsync and
+         * drops the older ones, so frames delivered ahead of time get repeated
+         * and skipped in a regular pattern when the frame rate and the pulse
+         * rate differ. Frames delivered on time are always due.
+         */
+        private VideoDataBuffer takeDueFrame() {
+            boolean scheduled = getStatus() == Status.PLAYING && null != jfxPlayer;
+            double ahead = scheduled ? jfxPlayer.getPresentationTime() + FRAME_SELECT_AHEAD : 0;
+            VideoDataBuffer due = null;
+            VideoDataBuffer frame;
+            while ((frame = pendingRenderFrames.peek()) != null) {
+                double timestamp = frame.getTimestamp();
+                // a full queue or a timestamp far off means the frames are
+                // not scheduled against the current time, show them as before
+                if (scheduled && timestamp > ahead && timestamp < ahead + 1.0
+                        && pendingRenderFrames.size() < MAX_PENDING_FRAMES) {
+                    break;
+                }
+                if (null != due) {
+                    due.releaseFrame();
+                }
+                due = pendingRenderFrames.poll();
+            }
+            return due;
+        }
+
         @Override
         public void pulse() {
             if (updateMediaViews) {
@@ -2744,12 +2777,17 @@ public final class MediaPlayer {
                  * views display the same image.
                  */
                 synchronized (renderLock) {
+                    VideoDataBuffer nextRenderFrame = takeDueFrame();
                     if (null != nextRenderFrame) {
                         if (null != currentRenderFrame) {
                             currentRenderFrame.releaseFrame();
                         }
                         currentRenderFrame = nextRenderFrame;
-                        nextRenderFrame = null;
+                    }
+                    if (!pendingRenderFrames.isEmpty()) {
+                        // frames which are not due yet need the following pulses
+                        updateMediaViews = true;
+                        Toolkit.getToolkit().requestNextPulse();
                     }
                 }
 
@@ -24,24 +24,40 @@
  */
 package javafx.scene.media;
 
+import com.sun.glass.ui.Application;
+import com.sun.glass.ui.VideoOverlay;
 import com.sun.javafx.geom.RectBounds;
+import com.sun.javafx.geom.Rectangle;
+import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.media.PrismMediaFrameHandler;
 import com.sun.javafx.sg.prism.MediaFrameTracker;
 import com.sun.javafx.sg.prism.NGNode;
 import com.sun.media.jfxmedia.control.VideoDataBuffer;
+import com.sun.media.jfxmedia.control.VideoFormat;
 import com.sun.prism.Graphics;
+import com.sun.prism.Presentable;
 import com.sun.prism.Texture;
+import java.nio.ByteBuffer;
 
 /**
  */
 class NGMediaView extends NGNode {
 
+    // Show the video on a hardware plane when the platform has one, so that
+    // the display controller scales and blends it instead of Prism.
+    private static final boolean useVideoOverlay =
+            Boolean.getBoolean("jfxmedia.videoOverlay");
+
     private boolean smooth = true;
     private final RectBounds dimension = new RectBounds();
     private final RectBounds viewport = new RectBounds();
     private PrismMediaFrameHandler handler;
     private MediaPlayer player;
     private MediaFrameTracker frameTracker;
+    private VideoOverlay overlay;
+    private boolean overlayUnavailable;
+    private boolean overlayShown;
+    private final Rectangle overlayBounds = new Rectangle();
 
     public void renderNextFrame() {
         visualsChanged();
@@ -76,7 +92,16 @@ class NGMediaView extends NGNode {
         }
     }
 
+    @Override
+    public void setVisible(boolean value) {
+        if (!value) {
+            hideOverlay();
+        }
+        super.setVisible(value);
+    }
+
     public void setMediaProvider(Object provider) {
+        hideOverlay();
         if (provider == null) {
             player = null;
             handler = null;
@@ -157,6 +182,15 @@ class NGMediaView extends NGNode {
             return;
         }
 
+        if (useVideoOverlay && showOnOverlay(g, frame)) {
+            if (null != frameTracker) {
+                frameTracker.incrementRenderedFrameCount(1);
+            }
+            frame.releaseFrame();
+            return;
+        }
+        hideOverlay();
+
         Texture texture = handler.getTexture(g, frame);
         if (texture != null) {
             float iw = viewport.getWidth();
@@ -190,6 +224,112 @@ class NGMediaView extends NGNode {
         frame.releaseFrame();
     }
 
+    /*
+     * Shows the frame on the overlay and clears the node to transparent, so
+     * that the plane below the window shows through and the nodes above this
+     * one are still blended over the video. Returns false when the frame has
+     * to be rendered by Prism instead.
+     */
+    private boolean showOnOverlay(Graphics g, VideoDataBuffer frame) {
+        if (overlayUnavailable || dimension.isEmpty() || g.getExtraAlpha() < 1f
+                || !(g.getRenderTarget() instanceof Presentable)) {
+            return false;
+        }
+        // The plane can only be moved and scaled
+        BaseTransform tx = g.getTransformNoClone();
+        if ((tx.getType() & ~(BaseTransform.TYPE_TRANSLATION | BaseTransform.TYPE_MASK_SCALE)) != 0) {
+            return false;
+        }
+
+        int format;
+        ByteBuffer[] planes;
+        int[] strides;
+        VideoFormat videoFormat = frame.getFormat();
+        if (videoFormat == VideoFormat.BGRA_PRE) {
+            format = VideoOverlay.FORMAT_BGRA_PRE;
+            planes = new ByteBuffer[] {
+                frame.getBufferForPlane(VideoDataBuffer.PACKED_FORMAT_PLANE)
+            };
+            strides = new int[] {
+                frame.getStrideForPlane(VideoDataBuffer.PACKED_FORMAT_PLANE)
+            };
+        } else if (videoFormat == VideoFormat.YCbCr_420p && !frame.hasAlpha()) {
+            format = VideoOverlay.FORMAT_I420;
+            planes = new ByteBuffer[] {
+                frame.getBufferForPlane(VideoDataBuffer.YCBCR_PLANE_LUMA),
+                frame.getBufferForPlane(VideoDataBuffer.YCBCR_PLANE_CB),
+                frame.getBufferForPlane(VideoDataBuffer.YCBCR_PLANE_CR)
+            };
+            strides = new int[] {
+                frame.getStrideForPlane(VideoDataBuffer.YCBCR_PLANE_LUMA),
+                frame.getStrideForPlane(VideoDataBuffer.YCBCR_PLANE_CB),
+                frame.getStrideForPlane(VideoDataBuffer.YCBCR_PLANE_CR)
+            };
+        } else {
+            return false;
+        }
+
+        if (overlay == null) {
+            overlay = Application.GetApplication().createVideoOverlay();
+            if (overlay == null) {
+                overlayUnavailable = true;
+                return false;
+            }
+        }
+        if (!overlay.supportsFormat(format)) {
+            return false;
+        }
+
+        int x1 = (int) Math.round(tx.getMxx() * dimension.getMinX() + tx.getMxt());
+        int y1 = (int) Math.round(tx.getMyy() * dimension.getMinY() + tx.getMyt());
+        int x2 = (int) Math.round(tx.getMxx() * dimension.getMaxX() + tx.getMxt());
+        int y2 = (int) Math.round(tx.getMyy() * dimension.getMaxY() + tx.getMyt());
+        if (x2 <= x1 || y2 <= y1) {
+            return false;
+        }
+        // Only a clip covering the node can be honored, unless the plane is
+        // already there and the clip is just a dirty region of the window.
+        Rectangle clip = g.getClipRectNoClone();
+        boolean samePlace = overlayShown && overlayBounds.x == x1 && overlayBounds.y == y1
+                && overlayBounds.width == x2 - x1 && overlayBounds.height == y2 - y1;
+        if (clip != null && !clip.contains(x1, y1, x2 - x1, y2 - y1) && !samePlace) {
+            return false;
+        }
+
+        int width = frame.getWidth();
+        int height = frame.getHeight();
+        int sx = 0;
+        int sy = 0;
+        int sw = width;
+        int sh = height;
+        if (!viewport.isEmpty()) {
+            sx = (int) viewport.getMinX();
+            sy = (int) viewport.getMinY();
+            sw = Math.min((int) viewport.getWidth(), width - sx);
+            sh = Math.min((int) viewport.getHeight(), height - sy);
+        }
+        if (sw <= 0 || sh <= 0) {
+            return false;
+        }
+        if (!overlay.show(format, planes, strides, width, height,
+                          sx, sy, sw, sh, x1, y1, x2 - x1, y2 - y1)) {
+            return false;
+        }
+        overlayShown = true;
+        overlayBounds.setBounds(x1, y1, x2 - x1, y2 - y1);
+
+        g.clearQuad(dimension.getMinX(), dimension.getMinY(),
+                    dimension.getMaxX(), dimension.getMaxY());
+        return true;
+    }
+
+    private void hideOverlay() {
+        if (overlayShown) {
+            overlay.hide();
+            overlayShown = false;
+        }
+    }
+
     @Override
     protected boolean hasOverlappingContents() {
         return false;
@@ -643,6 +643,9 @@ update_coefficients (GstIirEqualizer * equ)
   }
 
   equ->need_new_coefficients = FALSE;
+#ifdef GSTREAMER_LITE
+  equ->have_coefficients = TRUE;
+#endif // GSTREAMER_LITE
 }
 
 /* Must be called with transform lock! */
@@ -654,6 +657,10 @@ alloc_history (GstIirEqualizer * equ, const GstAudioInfo * info)
   equ->history =
       g_malloc0 (equ->history_size * GST_AUDIO_INFO_CHANNELS (info) *
       equ->freq_band_count);
+#ifdef GSTREAMER_LITE
+  /* filters start from silence, nothing to ramp from */
+  equ->have_coefficients = FALSE;
+#endif // GSTREAMER_LITE
 }
 
 void
@@ -848,6 +855,78 @@ guint size, guint channels)                                             \
 CREATE_OPTIMIZED_FUNCTIONS_INT (gint16, gfloat, -32768.0, 32767.0);
 CREATE_OPTIMIZED_FUNCTIONS (gfloat);
 CREATE_OPTIMIZED_FUNCTIONS (gdouble);
+#ifdef GSTREAMER_LITE
+/* Number of steps and time over which coefficients are moved to new values
+ * when bands change while playing. Switching them at once clicks. */
+#define COEFFICIENTS_RAMP_STEPS 16
+#define COEFFICIENTS_RAMP_RATE_DIVIDER 100 /* 10 ms */
+
+static void
+get_coefficients (GstIirEqualizer * equ, gdouble * coefficients)
+{
+  guint f;
+
+  for (f = 0; f < equ->freq_band_count; f++, coefficients += 5) {
+    coefficients[0] = equ->bands[f]->a0;
+    coefficients[1] = equ->bands[f]->a1;
+    coefficients[2] = equ->bands[f]->a2;
+    coefficients[3] = equ->bands[f]->b1;
+    coefficients[4] = equ->bands[f]->b2;
+  }
+}
+
+static void
+mix_coefficients (GstIirEqualizer * equ, const gdouble * from,
+    const gdouble * to, gdouble t)
+{
+  guint f;
+
+  for (f = 0; f < equ->freq_band_count; f++, from += 5, to += 5) {
+    equ->bands[f]->a0 = from[0] + (to[0] - from[0]) * t;
+    equ->bands[f]->a1 = from[1] + (to[1] - from[1]) * t;
+    equ->bands[f]->a2 = from[2] + (to[2] - from[2]) * t;
+    equ->bands[f]->b1 = from[3] + (to[3] - from[3]) * t;
+    equ->bands[f]->b2 = from[4] + (to[4] - from[4]) * t;
+  }
+}
+
+/* Must be called with bands_lock! Processes beginning of buffer while
+ * moving coefficients from "from" to current ones, rest of buffer is
+ * processed with current coefficients. */
+static void
+process_with_ramp (GstIirEqualizer * equ, const gdouble * from,
+    guint8 * data, guint size, guint channels)
+{
+  guint bpf = GST_AUDIO_FILTER_BPF (equ);
+  guint frames = (bpf > 0) ? size / bpf : 0;
+  guint ramp_frames = MIN (frames,
+      GST_AUDIO_FILTER_RATE (equ) / COEFFICIENTS_RAMP_RATE_DIVIDER);
+  guint step_size = (ramp_frames / COEFFICIENTS_RAMP_STEPS) * bpf;
+  gdouble *to;
+  guint i;
+
+  if (step_size == 0) {
+    equ->process (equ, data, size, channels);
+    return;
+  }
+
+  to = g_new (gdouble, 5 * equ->freq_band_count);
+  get_coefficients (equ, to);
+
+  for (i = 1; i < COEFFICIENTS_RAMP_STEPS; i++) {
+    mix_coefficients (equ, from, to,
+        (gdouble) i / (gdouble) COEFFICIENTS_RAMP_STEPS);
+    equ->process (equ, data, step_size, channels);
+    data += step_size;
+    size -= step_size;
+  }
+
+  mix_coefficients (equ, to, to, 0.0);
+  equ->process (equ, data, size, channels);
+
+  g_free (to);
+}
+#endif // GSTREAMER_LITE
 
 static GstFlowReturn
 gst_iir_equalizer_transform_ip (GstBaseTransform * btrans, GstBuffer * buf)
@@ -883,6 +962,25 @@ gst_iir_equalizer_transform_ip (GstBaseTransform * btrans, GstBuffer * buf)
     }
   }
 
+#ifdef GSTREAMER_LITE
+  BANDS_LOCK (equ);
+  if (need_new_coefficients && equ->have_coefficients) {
+    gdouble *from = g_new (gdouble, 5 * equ->freq_band_count);
+
+    get_coefficients (equ, from);
+    update_coefficients (equ);
+
+    gst_buffer_map (buf, &map, GST_MAP_READWRITE);
+    process_with_ramp (equ, from, map.data, map.size, channels);
+    gst_buffer_unmap (buf, &map);
+
+    g_free (from);
+    BANDS_UNLOCK (equ);
+    return GST_FLOW_OK;
+  }
+  BANDS_UNLOCK (equ);
+#endif // GSTREAMER_LITE
+
   BANDS_LOCK (equ);
   if (need_new_coefficients) {
     update_coefficients (equ);
@@ -66,6 +66,10 @@ struct _GstIirEqualizer
   guint history_size;
 
   gboolean need_new_coefficients;
+#ifdef GSTREAMER_LITE
+  /* set once coefficients were computed for current bands and history */
+  gboolean have_coefficients;
+#endif // GSTREAMER_LITE
 
   ProcessFunc process;
 };
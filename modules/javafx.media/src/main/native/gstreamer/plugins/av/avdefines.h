@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,5 +61,9 @@
 // except frame_num is 64-bit and frame_number is 32-bit. Since 61.
 #define USE_FRAME_NUM          (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(61,0,0))
 
+// Packets returned by av_read_frame() are reference counted through
+// AVPacket.buf, so their data can be shared instead of copied.
+#define PACKET_BUF             (LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(57,0,0))
+
 #endif  /* AVDEFINES_H */
 
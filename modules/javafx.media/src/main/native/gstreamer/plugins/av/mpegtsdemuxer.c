@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -116,6 +116,7 @@ struct _MpegTSDemuxerClass
 /***********************************************************************************/
 
 #define BUFFER_SIZE   4096             // Bytes. Better take it from JavaSource.
+#define IO_BUFFER_SIZE 8 * BUFFER_SIZE // Bytes libavformat reads from the adapter per call.
 #define ADAPTER_LIMIT 40 * BUFFER_SIZE // Initial adapter limit. It grows if unlimited by adding LIMIT_STEP
 #define LIMIT_STEP    10 * BUFFER_SIZE
 
@@ -655,12 +656,34 @@ static void mpegts_demuxer_check_streams(MpegTSDemuxer *demuxer)
 /***********************************************************************************
  * Push functions
  ***********************************************************************************/
-static inline GstBuffer* packet_to_buffer(AVPacket *packet)
+#if PACKET_BUF
+static void packet_data_unref(gpointer data)
 {
-    GstBuffer* result = gst_buffer_new_allocate(NULL, packet->size, NULL);
-    if (result != NULL)
-        gst_buffer_fill(result, 0, packet->data, packet->size);
-    return result;
+    AVBufferRef *ref = (AVBufferRef*)data;
+    av_buffer_unref(&ref);
+}
+#endif
+
+// Returns a buffer for the packet payload. The buffer shares the packet
+// data when the packet is reference counted and holds a copy otherwise.
+static GstBuffer* packet_to_buffer(AVPacket *packet)
+{
+#if PACKET_BUF
+    if (packet->buf != NULL)
+    {
+        AVBufferRef *ref = av_buffer_ref(packet->buf);
+        if (ref != NULL)
+            return gst_buffer_new_wrapped_full(GST_MEMORY_FLAG_READONLY, packet->data, packet->size,
+                                               0, packet->size, ref, &packet_data_unref);
+    }
+#endif
+
+    void *buffer_data = av_mallocz(packet->size);
+    if (buffer_data == NULL)
+        return NULL;
+
+    memcpy(buffer_data, packet->data, packet->size);
+    return gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
 }
 
 static inline gboolean same_stream(MpegTSDemuxer *demuxer, Stream *stream, AVPacket *packet)
@@ -683,12 +706,9 @@ static GstFlowReturn process_video_packet(MpegTSDemuxer *demuxer, AVPacket *pack
     GstBuffer     *buffer = NULL;
 
     GstEvent *newsegment_event = NULL;
-    void *buffer_data = av_mallocz(packet->size);
-    if (buffer_data != NULL)
+    buffer = packet_to_buffer(packet);
+    if (buffer != NULL)
     {
-        memcpy(buffer_data, packet->data, packet->size);
-        buffer = gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
-
         if (packet->pts != AV_NOPTS_VALUE)
         {
             if (demuxer->base_pts == GST_CLOCK_TIME_NONE)
@@ -779,13 +799,10 @@ static GstFlowReturn process_audio_packet(MpegTSDemuxer *demuxer, AVPacket *pack
 
     GstBuffer *buffer = NULL;
     GstEvent *newsegment_event = NULL;
-    void *buffer_data = av_mallocz(packet->size);
+    buffer = packet_to_buffer(packet);
 
-    if (buffer_data != NULL)
+    if (buffer != NULL)
     {
-        memcpy(buffer_data, packet->data, packet->size);
-        buffer = gst_buffer_new_wrapped_full(0, buffer_data, packet->size, 0, packet->size, buffer_data, &av_free);
-
         if (packet->pts != AV_NOPTS_VALUE)
         {
             if (demuxer->base_pts == GST_CLOCK_TIME_NONE)
@@ -956,7 +973,7 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
                 g_print("MpegTS: action = PA_INIT\n");
 #endif
 
-                guchar      *io_buffer = (guchar*)av_malloc(BUFFER_SIZE);
+                guchar      *io_buffer = (guchar*)av_malloc(IO_BUFFER_SIZE);
                 if (!io_buffer)
                 {
                     post_error(demuxer, "LibAV input buffer alloc error", 0, GST_STREAM_ERROR_DEMUX);
@@ -964,7 +981,7 @@ static gpointer mpegts_demuxer_process_input(gpointer data)
                 }
 
                 AVIOContext *io_context = avio_alloc_context(io_buffer,            // buffer
-                                                             BUFFER_SIZE,          // buffer size
+                                                             IO_BUFFER_SIZE,       // buffer size
                                                              0,                    // read only
                                                              demuxer,              // opaque reference
                                                              mpegts_demuxer_read_packet, // read callback
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,8 +45,12 @@ enum
     PROP_0,
     PROP_CODEC_ID,
     PROP_IS_SUPPORTED,
+    PROP_THREAD_COUNT,
 };
 
+// init_context of BaseDecoder, called before the threading options are set.
+static void (*basedecoder_init_context_func)(BaseDecoder *decoder) = NULL;
+
 /*
  * The input capabilities.
  */
@@ -76,6 +80,9 @@ static GstStaticPadTemplate source_template =
 //#define DEBUG_OUTPUT
 //#define VERBOSE_DEBUG
 
+// Upper bound of the default thread count, libavcodec gains little beyond it
+#define MAX_DECODER_THREADS 16
+
 /***********************************************************************************
  * Substitution for
  * G_DEFINE_TYPE(VideoDecoder, videodecoder, BaseDecoder, TYPE_BASEDECODER);
@@ -115,6 +122,8 @@ GType videodecoder_get_type (void)
 static GstStateChangeReturn videodecoder_change_state(GstElement* element, GstStateChange transition);
 static gboolean             videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent *event);
 static GstFlowReturn        videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf);
+static void                 videodecoder_drain(VideoDecoder *decoder);
+static void                 videodecoder_init_context(BaseDecoder *base);
 
 static void                 videodecoder_init_state(VideoDecoder *decoder);
 static void                 videodecoder_state_reset(VideoDecoder *decoder);
@@ -129,6 +138,7 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
 {
     GstElementClass *element_class = GST_ELEMENT_CLASS(klass);
     GObjectClass *gobject_class = (GObjectClass*)klass;
+    BaseDecoderClass *base_class = BASEDECODER_CLASS(klass);
 
     gst_element_class_set_metadata(element_class,
                 "Videodecoder",
@@ -147,6 +157,9 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     gobject_class->set_property = videodecoder_set_property;
     gobject_class->get_property = videodecoder_get_property;
 
+    basedecoder_init_context_func = base_class->init_context;
+    base_class->init_context = videodecoder_init_context;
+
     g_object_class_install_property (gobject_class, PROP_CODEC_ID,
         g_param_spec_int ("codec-id", "Codec ID", "Codec ID", -1, G_MAXINT, 0,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
@@ -154,6 +167,27 @@ static void videodecoder_class_init(VideoDecoderClass *klass)
     g_object_class_install_property (gobject_class, PROP_IS_SUPPORTED,
         g_param_spec_boolean ("is-supported", "Is supported", "Is codec ID supported", FALSE,
         (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+
+    g_object_class_install_property (gobject_class, PROP_THREAD_COUNT,
+        g_param_spec_int ("thread-count", "Thread count", "Number of decoding threads, 0 for one per core", 0, G_MAXINT, 0,
+        (GParamFlags)(G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS)));
+}
+
+static void videodecoder_init_context(BaseDecoder *base)
+{
+    VideoDecoder *decoder = VIDEODECODER(base);
+    int thread_count = decoder->thread_count;
+
+    if (basedecoder_init_context_func)
+        basedecoder_init_context_func(base);
+
+    // libavcodec decodes on the calling thread unless asked otherwise, which
+    // leaves most cores idle on HEVC. Frame threading delays the output by a
+    // few frames; videodecoder_drain() collects them at the end of the stream.
+    if (thread_count <= 0)
+        thread_count = (int)MIN(g_get_num_processors(), MAX_DECODER_THREADS);
+    base->context->thread_count = thread_count;
+    base->context->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
 }
 
 static void videodecoder_init(VideoDecoder *decoder)
@@ -234,6 +268,9 @@ static void videodecoder_set_property(GObject *object, guint property_id, const
     case PROP_CODEC_ID:
         decoder->codec_id = g_value_get_int(value);
         break;
+    case PROP_THREAD_COUNT:
+        decoder->thread_count = g_value_get_int(value);
+        break;
     default:
         break;
     }
@@ -249,6 +286,9 @@ static void videodecoder_get_property(GObject *object, guint property_id, GValue
         is_supported = videodecoder_is_decoder_by_codec_id_supported(decoder->codec_id);
         g_value_set_boolean(value, is_supported);
         break;
+    case PROP_THREAD_COUNT:
+        g_value_set_int(value, decoder->thread_count);
+        break;
     default:
         break;
     }
@@ -316,6 +356,10 @@ static gboolean videodecoder_sink_event(GstPad *pad, GstObject *parent, GstEvent
             BASEDECODER(decoder)->is_flushing = FALSE;
             break;
 
+        case GST_EVENT_EOS:
+            videodecoder_drain(decoder);
+            break;
+
         case GST_EVENT_CAPS:
         {
             GstCaps *caps;
@@ -671,17 +715,14 @@ static gboolean videodecoder_configure_sourcepad(VideoDecoder *decoder)
     return TRUE;
 }
 /***********************************************************************************
- * chain
+ * Pushes the frame in base->frame downstream. buf is the input buffer the frame was
+ * decoded from, or NULL for a frame that was delayed until the decoder was drained.
  ***********************************************************************************/
-static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+static GstFlowReturn videodecoder_push_frame(VideoDecoder *decoder, GstBuffer *buf)
 {
-    VideoDecoder  *decoder = VIDEODECODER(parent);
     BaseDecoder   *base = BASEDECODER(decoder);
     GstFlowReturn  result = GST_FLOW_OK;
-    int            num_dec = NO_DATA_USED;
-    GstMapInfo     info;
     GstMapInfo     info2;
-    gboolean       unmap_buf = FALSE;
     gboolean       set_frame_values = TRUE;
     int64_t        pts = AV_NOPTS_VALUE;
     unsigned int   out_buf_size = 0;
@@ -690,6 +731,214 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
     uint8_t*       data1 = NULL;
     uint8_t*       data2 = NULL;
 
+    if (!videodecoder_configure_sourcepad(decoder))
+        result = GST_FLOW_ERROR;
+    else
+    {
+#if HEVC_SUPPORT
+        // Check to see if we need to convert frame to YUV420p
+        if (base->frame->format != AV_PIX_FMT_YUV420P)
+        {
+            if (!videodecoder_convert_frame(decoder))
+            {
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                         GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                         g_strdup("Video frame conversion failed"), NULL,
+                                         ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+
+                return GST_FLOW_ERROR;
+            }
+
+#if NO_REORDERED_OPAQUE
+            pts = decoder->dest_frame->pts;
+#else // NO_REORDERED_OPAQUE
+            pts = decoder->dest_frame->reordered_opaque;
+#endif // NO_REORDERED_OPAQUE
+            data0 = decoder->dest_frame->data[0];
+            data1 = decoder->dest_frame->data[1];
+            data2 = decoder->dest_frame->data[2];
+            set_frame_values = FALSE;
+        }
+#endif // HEVC_SUPPORTf
+
+        if (set_frame_values)
+        {
+#if NO_REORDERED_OPAQUE
+            pts = base->frame->pts;
+#else // NO_REORDERED_OPAQUE
+            pts = base->frame->reordered_opaque;
+#endif // NO_REORDERED_OPAQUE
+            data0 = base->frame->data[0];
+            data1 = base->frame->data[1];
+            data2 = base->frame->data[2];
+        }
+
+        GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
+        if (outbuf == NULL)
+        {
+            if (result != GST_FLOW_FLUSHING)
+            {
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
+                                         GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
+                                         g_strdup("Decoded video buffer allocation failed"), NULL,
+                                         ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+            }
+        }
+        else
+        {
+#if USE_FRAME_NUM
+            GST_BUFFER_OFFSET(outbuf) = base->context->frame_num;
+#else // USE_FRAME_NUM
+            GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
+#endif // USE_FRAME_NUM
+            if (pts != AV_NOPTS_VALUE)
+            {
+                GST_BUFFER_TIMESTAMP(outbuf) = pts;
+                GST_BUFFER_DURATION(outbuf) = buf ? GST_BUFFER_DURATION(buf) : GST_CLOCK_TIME_NONE; // Duration for video usually same
+            }
+
+            if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
+            {
+                // INLINE - gst_buffer_unref()
+                gst_buffer_unref(outbuf);
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                 g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+                return result;
+            }
+
+            // Copy image by parts from different arrays.
+            if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
+            {
+                gst_buffer_unmap(outbuf, &info2);
+                // INLINE - gst_buffer_unref()
+                gst_buffer_unref(outbuf);
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                 g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+                return result;
+            }
+
+            out_buf_size = decoder->frame_size;
+            if (out_buf_size >= decoder->u_offset)
+            {
+                memcpy(info2.data, data0, decoder->u_offset);
+                out_buf_size -= decoder->u_offset;
+                if (out_buf_size >= decoder->uv_blocksize &&
+                    decoder->uv_blocksize <= decoder->frame_size &&
+                    decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
+                {
+                    memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
+                    out_buf_size -= decoder->uv_blocksize;
+                    if (out_buf_size >= decoder->uv_blocksize &&
+                        decoder->uv_blocksize <= decoder->frame_size &&
+                        decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
+                    {
+                        memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
+                    }
+                    else
+                    {
+                        copy_error = TRUE;
+                    }
+                }
+                else
+                {
+                    copy_error = TRUE;
+                }
+            }
+            else
+            {
+                copy_error = TRUE;
+            }
+
+            gst_buffer_unmap(outbuf, &info2);
+
+            if (copy_error)
+            {
+                // INLINE - gst_buffer_unref()
+                gst_buffer_unref(outbuf);
+                gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
+                                 g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_push_frame"), 0);
+                return result;
+            }
+
+            GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
+
+            if (decoder->discont || (buf && GST_BUFFER_IS_DISCONT(buf)))
+            {
+#ifdef DEBUG_OUTPUT
+                g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
+#endif
+                GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
+                decoder->discont = FALSE;
+            }
+
+
+#ifdef VERBOSE_DEBUG
+            g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
+                GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
+                GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
+#endif
+            result = gst_pad_push(base->srcpad, outbuf);
+#ifdef VERBOSE_DEBUG
+            g_print(" done, res=%s\n", gst_flow_get_name(result));
+#endif
+        }
+    }
+    return result;
+}
+
+/***********************************************************************************
+ * Outputs the frames still held by the decoder at the end of the stream. With frame
+ * threading the decoder returns each frame several packets after it was sent, so
+ * the last frames of the stream only come out when the decoder is drained.
+ ***********************************************************************************/
+static void videodecoder_drain(VideoDecoder *decoder)
+{
+    BaseDecoder  *base = BASEDECODER(decoder);
+    GstFlowReturn result = GST_FLOW_OK;
+
+    if (!base->is_initialized || base->context == NULL)
+        return;
+
+#if USE_SEND_RECEIVE
+    if (avcodec_send_packet(base->context, NULL) < 0)
+        return;
+
+    while (result == GST_FLOW_OK && !base->is_flushing &&
+           avcodec_receive_frame(base->context, base->frame) == 0)
+    {
+        result = videodecoder_push_frame(decoder, NULL);
+    }
+#else // USE_SEND_RECEIVE
+    do
+    {
+        av_init_packet(&decoder->packet);
+        decoder->packet.data = NULL;
+        decoder->packet.size = 0;
+        decoder->frame_finished = 0;
+        if (avcodec_decode_video2(base->context, base->frame, &decoder->frame_finished, &decoder->packet) < 0)
+            break;
+        if (decoder->frame_finished > 0)
+            result = videodecoder_push_frame(decoder, NULL);
+    } while (decoder->frame_finished > 0 && result == GST_FLOW_OK && !base->is_flushing);
+#endif // USE_SEND_RECEIVE
+
+    // The decoder only accepts new packets after a flush once it has been drained.
+    videodecoder_state_reset(decoder);
+}
+
+/***********************************************************************************
+ * chain
+ ***********************************************************************************/
+static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffer *buf)
+{
+    VideoDecoder  *decoder = VIDEODECODER(parent);
+    BaseDecoder   *base = BASEDECODER(decoder);
+    GstFlowReturn  result = GST_FLOW_OK;
+    int            num_dec = NO_DATA_USED;
+    GstMapInfo     info;
+    gboolean       unmap_buf = FALSE;
+    gint64         decode_start = g_get_monotonic_time();
+
     if (base->is_flushing)  // Reject buffers in flushing state.
     {
         result = GST_FLOW_FLUSHING;
@@ -793,162 +1042,12 @@ static GstFlowReturn videodecoder_chain(GstPad *pad, GstObject *parent, GstBuffe
         goto _exit;
     }
 
-    if (decoder->frame_finished > 0)
-    {
-        if (!videodecoder_configure_sourcepad(decoder))
-            result = GST_FLOW_ERROR;
-        else
-        {
-#if HEVC_SUPPORT
-            // Check to see if we need to convert frame to YUV420p
-            if (base->frame->format != AV_PIX_FMT_YUV420P)
-            {
-                if (!videodecoder_convert_frame(decoder))
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Video frame conversion failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
+    GST_LOG_OBJECT(decoder, "decode time %" G_GINT64_FORMAT " us, frame %s",
+                   g_get_monotonic_time() - decode_start,
+                   decoder->frame_finished > 0 ? "ready" : "delayed");
 
-                    result = GST_FLOW_ERROR;
-                    goto _exit;
-                }
-
-#if NO_REORDERED_OPAQUE
-                pts = decoder->dest_frame->pts;
-#else // NO_REORDERED_OPAQUE
-                pts = decoder->dest_frame->reordered_opaque;
-#endif // NO_REORDERED_OPAQUE
-                data0 = decoder->dest_frame->data[0];
-                data1 = decoder->dest_frame->data[1];
-                data2 = decoder->dest_frame->data[2];
-                set_frame_values = FALSE;
-            }
-#endif // HEVC_SUPPORTf
-
-            if (set_frame_values)
-            {
-#if NO_REORDERED_OPAQUE
-                pts = base->frame->pts;
-#else // NO_REORDERED_OPAQUE
-                pts = base->frame->reordered_opaque;
-#endif // NO_REORDERED_OPAQUE
-                data0 = base->frame->data[0];
-                data1 = base->frame->data[1];
-                data2 = base->frame->data[2];
-            }
-
-            GstBuffer *outbuf = gst_buffer_new_allocate(NULL, decoder->frame_size, NULL);
-            if (outbuf == NULL)
-            {
-                if (result != GST_FLOW_FLUSHING)
-                {
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR,
-                                             GST_STREAM_ERROR, GST_STREAM_ERROR_DECODE,
-                                             g_strdup("Decoded video buffer allocation failed"), NULL,
-                                             ("videodecoder.c"), ("videodecoder_chain"), 0);
-                }
-            }
-            else
-            {
-#if USE_FRAME_NUM
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_num;
-#else // USE_FRAME_NUM
-                GST_BUFFER_OFFSET(outbuf) = base->context->frame_number;
-#endif // USE_FRAME_NUM
-                if (pts != AV_NOPTS_VALUE)
-                {
-                    GST_BUFFER_TIMESTAMP(outbuf) = pts;
-                    GST_BUFFER_DURATION(outbuf) = GST_BUFFER_DURATION(buf); // Duration for video usually same
-                }
-
-                if (!gst_buffer_map(outbuf, &info2, GST_MAP_WRITE))
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Decoded video buffer allocation failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                // Copy image by parts from different arrays.
-                if (decoder->frame_size > (unsigned int)info2.maxsize) // maxsize should be same or more due to alignment
-                {
-                    gst_buffer_unmap(outbuf, &info2);
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Wrong buffer size"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                out_buf_size = decoder->frame_size;
-                if (out_buf_size >= decoder->u_offset)
-                {
-                    memcpy(info2.data, data0, decoder->u_offset);
-                    out_buf_size -= decoder->u_offset;
-                    if (out_buf_size >= decoder->uv_blocksize &&
-                        decoder->uv_blocksize <= decoder->frame_size &&
-                        decoder->u_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                    {
-                        memcpy(info2.data + decoder->u_offset, data1, decoder->uv_blocksize);
-                        out_buf_size -= decoder->uv_blocksize;
-                        if (out_buf_size >= decoder->uv_blocksize &&
-                            decoder->uv_blocksize <= decoder->frame_size &&
-                            decoder->v_offset <= (decoder->frame_size - decoder->uv_blocksize))
-                        {
-                            memcpy(info2.data + decoder->v_offset, data2, decoder->uv_blocksize);
-                        }
-                        else
-                        {
-                            copy_error = TRUE;
-                        }
-                    }
-                    else
-                    {
-                        copy_error = TRUE;
-                    }
-                }
-                else
-                {
-                    copy_error = TRUE;
-                }
-
-                gst_buffer_unmap(outbuf, &info2);
-
-                if (copy_error)
-                {
-                    // INLINE - gst_buffer_unref()
-                    gst_buffer_unref(outbuf);
-                    gst_element_message_full(GST_ELEMENT(decoder), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_NO_SPACE_LEFT,
-                                     g_strdup("Copy data failed"), NULL, ("videodecoder.c"), ("videodecoder_chain"), 0);
-                    goto _exit;
-                }
-
-                GST_BUFFER_OFFSET_END(outbuf) = GST_BUFFER_OFFSET_NONE;
-
-                if (decoder->discont || GST_BUFFER_IS_DISCONT(buf))
-                {
-#ifdef DEBUG_OUTPUT
-                    g_print("Video discont: frame size=%dx%d\n", base->context->width, base->context->height);
-#endif
-                    GST_BUFFER_FLAG_SET(outbuf, GST_BUFFER_FLAG_DISCONT);
-                    decoder->discont = FALSE;
-                }
-
-
-#ifdef VERBOSE_DEBUG
-                g_print("videodecoder: pushing buffer ts=%.4f, duration=%.4f\n",
-                    GST_BUFFER_TIMESTAMP_IS_VALID(outbuf) ? (double)GST_BUFFER_TIMESTAMP(outbuf)/GST_SECOND : -1.0,
-                    GST_BUFFER_DURATION_IS_VALID(outbuf) ? (double)GST_BUFFER_DURATION(outbuf)/GST_SECOND : -1.0);
-#endif
-                result = gst_pad_push(base->srcpad, outbuf);
-#ifdef VERBOSE_DEBUG
-                g_print(" done, res=%s\n", gst_flow_get_name(result));
-#endif
-            }
-        }
-    }
+    if (decoder->frame_finished > 0)
+        result = videodecoder_push_frame(decoder, buf);
 
 _exit:
     if (unmap_buf)
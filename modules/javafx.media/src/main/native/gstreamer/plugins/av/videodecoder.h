@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -80,6 +80,7 @@ struct _VideoDecoder {
     AVPacket     packet;
 
     gint         codec_id;
+    gint         thread_count;   // 0 means one thread per core
 
 #if HEVC_SUPPORT
     struct SwsContext *sws_context;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -216,6 +216,22 @@ HRESULT CMFGSTBuffer::GetGstBuffer(GstBuffer **ppBuffer)
     return S_OK;
 }
 
+// Wraps existing GStreamer buffer instead of getting one from callback.
+// Takes ownership of the buffer reference.
+HRESULT CMFGSTBuffer::SetGstBuffer(GstBuffer *pBuffer)
+{
+    if (pBuffer == NULL)
+        return E_INVALIDARG;
+
+    if (m_pGstBuffer != NULL || gst_buffer_get_size(pBuffer) > m_cbMaxLength)
+        return E_UNEXPECTED;
+
+    m_pGstBuffer = pBuffer;
+    m_cbCurrentLength = (DWORD)gst_buffer_get_size(pBuffer);
+
+    return S_OK;
+}
+
 HRESULT CMFGSTBuffer::SetCallbackData(sCallbackData *pCallbackData)
 {
     if (pCallbackData == NULL)
@@ -242,9 +258,9 @@ HRESULT CMFGSTBuffer::AllocateOrGetBuffer(BYTE **ppbBuffer)
     if (ppbBuffer == NULL)
         return E_INVALIDARG;
 
-    // If we have GStreamer get buffer callback set, then call it to get
-    // buffer. Otherwise allocate memory internally.
-    if (GetGstBufferCallback != NULL)
+    // If we have GStreamer buffer or get buffer callback set, then use it.
+    // Otherwise allocate memory internally.
+    if (m_pGstBuffer != NULL || GetGstBufferCallback != NULL)
     {
         // Get buffer if needed
         if (m_pGstBuffer == NULL)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2025, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,6 +59,7 @@ public:
 
     // GStreamer interface
     HRESULT GetGstBuffer(GstBuffer **ppBuffer);
+    HRESULT SetGstBuffer(GstBuffer *pBuffer);
     HRESULT SetCallbackData(sCallbackData *pCallbackData);
     HRESULT SetGetGstBufferCallback(void (*function)(GstBuffer **ppBuffer,
             long lSize, sCallbackData *pCallbackData));
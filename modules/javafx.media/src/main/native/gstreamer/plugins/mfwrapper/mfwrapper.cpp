@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -518,11 +518,13 @@ static gboolean mfwrapper_process_input(GstMFWrapper *decoder, GstBuffer *buf)
 {
     IMFSample *pSample = NULL;
     IMFMediaBuffer *pBuffer = NULL;
+    CMFGSTBuffer *pMFGSTBuffer = NULL;
     DWORD dwBufferSize = 0;
     BYTE *pbBuffer = NULL;
     GstMapInfo info;
     gboolean unmap_buf = FALSE;
     gboolean unlock_buf = FALSE;
+    gboolean send_header = FALSE;
 
     if (!decoder->pDecoder)
         return FALSE;
@@ -541,6 +543,67 @@ static gboolean mfwrapper_process_input(GstMFWrapper *decoder, GstBuffer *buf)
     if (SUCCEEDED(hr) && GST_BUFFER_DURATION_IS_VALID(buf))
         hr = pSample->SetSampleDuration(GST_BUFFER_DURATION(buf) / 100);
 
+    send_header = (decoder->is_send_header &&
+            decoder->header != NULL && decoder->header_size > 0);
+
+    // Header needs to be prepended to first buffer, so data is copied in
+    // such case. All other buffers are wrapped and given to decoder as is.
+    // NALU lengths are replaced with start codes in place, so buffer should
+    // be writable. It is not copied unless someone else holds it.
+    if (SUCCEEDED(hr) && !send_header)
+    {
+        buf = gst_buffer_make_writable(buf);
+        dwBufferSize = (DWORD)gst_buffer_get_size(buf);
+        if (dwBufferSize == 0)
+            hr = E_FAIL;
+
+        if (SUCCEEDED(hr))
+        {
+            pMFGSTBuffer = new (nothrow) CMFGSTBuffer(dwBufferSize);
+            if (pMFGSTBuffer == NULL)
+                hr = E_OUTOFMEMORY;
+        }
+
+        if (SUCCEEDED(hr))
+        {
+            hr = pMFGSTBuffer->QueryInterface(IID_IMFMediaBuffer, (void **)&pBuffer);
+            if (FAILED(hr))
+                delete pMFGSTBuffer;
+        }
+
+        if (SUCCEEDED(hr))
+            hr = pMFGSTBuffer->SetGstBuffer(buf);
+
+        if (SUCCEEDED(hr))
+        {
+            buf = NULL; // Owned by pMFGSTBuffer now
+            hr = pBuffer->Lock(&pbBuffer, NULL, NULL);
+        }
+
+        if (SUCCEEDED(hr))
+        {
+            mfwrapper_nalu_to_start_code(pbBuffer, dwBufferSize);
+            hr = pBuffer->Unlock();
+        }
+
+        if (SUCCEEDED(hr))
+            hr = pSample->AddBuffer(pBuffer);
+
+        if (SUCCEEDED(hr))
+            hr = decoder->pDecoder->ProcessInput(0, pSample, 0);
+
+        if (buf != NULL)
+            gst_buffer_unref(buf);
+
+        SafeRelease(&pBuffer);
+        SafeRelease(&pSample);
+
+        if (SUCCEEDED(hr))
+            return TRUE;
+        else
+            return FALSE;
+    }
+
     if (SUCCEEDED(hr) && gst_buffer_map(buf, &info, GST_MAP_READ))
         unmap_buf = TRUE;
     else
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,6 +33,8 @@ typedef struct _Cache Cache;
 void      cache_static_init(void); // Must be called only once from the ProgressBuffer class initializer
 
 Cache*    create_cache();
+// Creates a cache that holds up to size bytes in memory instead of a temporary file.
+Cache*    create_memory_cache(gint64 size);
 void      destroy_cache(Cache* instance);
 
 // Writes a buffer.
@@ -60,4 +62,7 @@ gboolean       cache_set_read_position(Cache* cache, gint64 position);
 // Returns true if the cache has enough data for fluent reading, but we can't expect more than total.
 gboolean       cache_has_enough_data(Cache* cache);
 
+// Returns the number of bytes written to the cache from its start.
+gint64         cache_get_write_position(Cache* cache);
+
 #endif // __CACHE_H__
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "memorycache.h"
+#include <string.h>
+
+#define DEFAULT_BUFFER_SIZE 4096
+
+struct _MemoryCache
+{
+    guint8  *data;
+    gint64  capacity;
+    gint64  filled;          // end of the data written so far
+
+    gint64  read_position;
+    gint64  write_position;
+};
+
+MemoryCache* memory_cache_create(gint64 size)
+{
+    MemoryCache* result = NULL;
+
+    if (size <= 0 || (guint64)size > G_MAXSIZE)
+        return NULL;
+
+    result = (MemoryCache*)g_try_malloc(sizeof(MemoryCache));
+    if (result)
+    {
+        result->data = (guint8*)g_try_malloc((gsize)size);
+        if (result->data == NULL)
+        {
+            g_free(result);
+            return NULL;
+        }
+
+        result->capacity = size;
+        result->filled = 0;
+        result->read_position = result->write_position = 0;
+    }
+    return result;
+}
+
+void memory_cache_destroy(MemoryCache* cache)
+{
+    g_free(cache->data);
+    g_free(cache);
+}
+
+void memory_cache_write_buffer(MemoryCache* cache, GstBuffer* buffer)
+{
+    GstMapInfo info;
+    if (gst_buffer_map(buffer, &info, GST_MAP_READ))
+    {
+        gint64 end = cache->write_position + info.size;
+        if (end > cache->capacity)
+        {
+            // The stream turned out longer than announced.
+            gint64 capacity = MAX(end, cache->capacity + cache->capacity / 2);
+            guint8 *data = ((guint64)capacity <= G_MAXSIZE) ? (guint8*)g_try_realloc(cache->data, (gsize)capacity) : NULL;
+            if (data)
+            {
+                cache->data = data;
+                cache->capacity = capacity;
+            }
+        }
+
+        if (end <= cache->capacity)
+        {
+            memcpy(cache->data + cache->write_position, info.data, info.size);
+            cache->write_position = end;
+            if (end > cache->filled)
+                cache->filled = end;
+        }
+        gst_buffer_unmap(buffer, &info);
+    }
+}
+
+static GstBuffer* memory_cache_copy_buffer(MemoryCache* cache, gint64 position, gint64 size)
+{
+    guint8 *data = (guint8*)g_try_malloc((gsize)size);
+    GstBuffer *buffer = NULL;
+
+    if (data)
+    {
+        memcpy(data, cache->data + position, (gsize)size);
+        buffer = gst_buffer_new_wrapped_full(0, data, (gsize)size, 0, (gsize)size, data, g_free);
+        if (buffer != NULL)
+            GST_BUFFER_OFFSET(buffer) = position;
+        else
+            g_free(data);
+    }
+    return buffer;
+}
+
+gint64 memory_cache_read_buffer(MemoryCache* cache, GstBuffer** buffer)
+{
+    gint64 size = MIN(cache->filled - cache->read_position, DEFAULT_BUFFER_SIZE);
+    *buffer = NULL;
+
+    if (size > 0)
+    {
+        *buffer = memory_cache_copy_buffer(cache, cache->read_position, size);
+        if (*buffer != NULL)
+        {
+            cache->read_position += size;
+            return cache->read_position;
+        }
+    }
+
+    return 0;
+}
+
+GstFlowReturn memory_cache_read_buffer_from_position(MemoryCache* cache, gint64 start_position, guint size, GstBuffer** buffer)
+{
+    *buffer = NULL;
+
+    if (memory_cache_set_read_position(cache, start_position) &&
+        (gint64)size <= cache->filled - start_position)
+    {
+        *buffer = memory_cache_copy_buffer(cache, start_position, size);
+        if (*buffer != NULL)
+        {
+            cache->read_position += size;
+            return GST_FLOW_OK;
+        }
+    }
+    return GST_FLOW_ERROR;
+}
+
+gboolean memory_cache_set_write_position(MemoryCache* cache, gint64 position)
+{
+    if (position < 0 || position > cache->capacity)
+        return FALSE;
+
+    cache->write_position = position;
+    return TRUE;
+}
+
+gboolean memory_cache_set_read_position(MemoryCache* cache, gint64 position)
+{
+    if (position < 0)
+        return FALSE;
+
+    cache->read_position = position;
+    return TRUE;
+}
+
+gboolean memory_cache_has_enough_data(MemoryCache* cache)
+{
+    return cache->read_position < cache->write_position;
+}
+
+gint64 memory_cache_get_write_position(MemoryCache* cache)
+{
+    return cache->write_position;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef __MEMORY_CACHE_H__
+#define __MEMORY_CACHE_H__
+
+#include <gst/gst.h>
+
+/* In-memory backend of Cache, used when the content is small enough or the
+ * temporary directory is not writable. The functions have the semantics of
+ * the cache_* functions in cache.h they back.
+ */
+typedef struct _MemoryCache MemoryCache;
+
+MemoryCache*   memory_cache_create(gint64 size);
+void           memory_cache_destroy(MemoryCache* cache);
+
+void           memory_cache_write_buffer(MemoryCache* cache, GstBuffer* buffer);
+gint64         memory_cache_read_buffer(MemoryCache* cache, GstBuffer** buffer);
+GstFlowReturn  memory_cache_read_buffer_from_position(MemoryCache* cache, gint64 start_position, guint size, GstBuffer** buffer);
+gboolean       memory_cache_set_write_position(MemoryCache* cache, gint64 position);
+gboolean       memory_cache_set_read_position(MemoryCache* cache, gint64 position);
+gboolean       memory_cache_has_enough_data(MemoryCache* cache);
+gint64         memory_cache_get_write_position(MemoryCache* cache);
+
+#endif // __MEMORY_CACHE_H__
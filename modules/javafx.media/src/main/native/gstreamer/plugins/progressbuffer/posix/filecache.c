@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,7 @@
  */
 
 #include <cache.h>
+#include "../memorycache.h"
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -34,6 +35,8 @@ static const char *tempDir = NULL;
 
 struct _Cache
 {
+    MemoryCache* memory;  // not NULL for caches that are kept in memory
+
     char*   filename;
     int     readHandle;
     int     writeHandle;
@@ -52,6 +55,7 @@ Cache* create_cache()
     Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
     if (result)
     {
+        result->memory = NULL;
         result->filename = g_build_filename(tempDir, "jfxmpbXXXXXX", NULL);
         if (result->filename == NULL)
             goto _error_exit;
@@ -80,8 +84,33 @@ _error_exit:
     return NULL;
 }
 
+Cache* create_memory_cache(gint64 size)
+{
+    Cache* result = (Cache*)g_try_malloc(sizeof(Cache));
+    if (result)
+    {
+        result->memory = memory_cache_create(size);
+        if (result->memory == NULL)
+        {
+            g_free(result);
+            return NULL;
+        }
+        result->filename = NULL;
+        result->readHandle = result->writeHandle = -1;
+        result->read_position = result->write_position = 0;
+    }
+    return result;
+}
+
 void destroy_cache(Cache* instance)
 {
+    if (instance->memory)
+    {
+        memory_cache_destroy(instance->memory);
+        g_free(instance);
+        return;
+    }
+
     close(instance->writeHandle);
     close(instance->readHandle);
     g_free(instance->filename);
@@ -92,6 +121,11 @@ void destroy_cache(Cache* instance)
 void cache_write_buffer(Cache* cache, GstBuffer* buffer)
 {
     GstMapInfo info;
+    if (cache->memory)
+    {
+        memory_cache_write_buffer(cache->memory, buffer);
+        return;
+    }
     if (gst_buffer_map(buffer, &info, GST_MAP_READ))
     {
         ssize_t written = write(cache->writeHandle, info.data, info.size);
@@ -103,7 +137,11 @@ void cache_write_buffer(Cache* cache, GstBuffer* buffer)
 
 gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
 {
-    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
+    guint8 *data = NULL;
+    if (cache->memory)
+        return memory_cache_read_buffer(cache->memory, buffer);
+
+    data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
     *buffer = NULL;
 
     if (data)
@@ -135,6 +173,9 @@ gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
 GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
 {
     GstFlowReturn result = GST_FLOW_ERROR;
+    if (cache->memory)
+        return memory_cache_read_buffer_from_position(cache->memory, start_position, size, buffer);
+
     *buffer = NULL;
 
     if (cache_set_read_position(cache, start_position))
@@ -168,7 +209,11 @@ static inline gboolean cache_set_handler_position(int handle, guint64 position)
 
 gboolean cache_set_write_position(Cache* cache, gint64 position)
 {
-    gboolean result = (position == cache->write_position);
+    gboolean result = FALSE;
+    if (cache->memory)
+        return memory_cache_set_write_position(cache->memory, position);
+
+    result = (position == cache->write_position);
     if (!result)
     {
         result = cache_set_handler_position(cache->writeHandle, position);
@@ -180,7 +225,11 @@ gboolean cache_set_write_position(Cache* cache, gint64 position)
 
 gboolean cache_set_read_position(Cache* cache, gint64 position)
 {
-    gboolean result = (position == cache->read_position);
+    gboolean result = FALSE;
+    if (cache->memory)
+        return memory_cache_set_read_position(cache->memory, position);
+
+    result = (position == cache->read_position);
     if (!result)
     {
         result = cache_set_handler_position(cache->readHandle, position);
@@ -192,5 +241,16 @@ gboolean cache_set_read_position(Cache* cache, gint64 position)
 
 gboolean cache_has_enough_data(Cache* cache)
 {
+    if (cache->memory)
+        return memory_cache_has_enough_data(cache->memory);
+
     return cache->read_position < cache->write_position;
 }
+
+gint64 cache_get_write_position(Cache* cache)
+{
+    if (cache->memory)
+        return memory_cache_get_write_position(cache->memory);
+
+    return cache->write_position;
+}
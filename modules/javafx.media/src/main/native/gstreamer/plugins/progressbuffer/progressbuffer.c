@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,7 +48,9 @@ enum
     PROP_THRESHOLD,
     PROP_BANDWIDTH,
     PROP_PREBUFFER_TIME,
-    PROP_WAIT_TOLERANCE
+    PROP_WAIT_TOLERANCE,
+    PROP_MEMORY_CACHE_LIMIT,
+    PROP_CACHED_BYTES
 };
 
 /***********************************************************************************
@@ -85,6 +87,7 @@ struct _ProgressBuffer
     gdouble       bandwidth; // property accessible.
     gdouble       prebuffer_time; // property controlled.
     gdouble       wait_tolerance; // property controlled.
+    gint64        memory_cache_limit; // property controlled.
     GTimer        *bandwidth_timer;
 
     gboolean      unexpected;
@@ -238,6 +241,24 @@ static void progress_buffer_class_init (ProgressBufferClass *klass)
                                                           2.0  /* default value */,
                                                           G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
 
+    g_object_class_install_property (gobject_class, PROP_MEMORY_CACHE_LIMIT,
+                                     g_param_spec_int64 ("memory-cache-limit",
+                                                         "Memory cache limit",
+                                                         "Content of up to this many bytes is cached in memory instead of a temporary file.",
+                                                         0  /* minimum value */,
+                                                         G_MAXINT64 /* maximum value */,
+                                                         0  /* default value */,
+                                                         G_PARAM_READWRITE | G_PARAM_CONSTRUCT));
+
+    g_object_class_install_property (gobject_class, PROP_CACHED_BYTES,
+                                     g_param_spec_int64 ("cached-bytes",
+                                                         "Cached bytes",
+                                                         "Number of bytes of the current segment stored in the cache.",
+                                                         0  /* minimum value */,
+                                                         G_MAXINT64 /* maximum value */,
+                                                         0  /* default value */,
+                                                         G_PARAM_READABLE));
+
     cache_static_init();
 }
 
@@ -289,6 +310,9 @@ static void progress_buffer_set_property (GObject *object, guint property_id,
         case PROP_WAIT_TOLERANCE:
             element->wait_tolerance = g_value_get_double(value);
             break;
+        case PROP_MEMORY_CACHE_LIMIT:
+            element->memory_cache_limit = g_value_get_int64(value);
+            break;
 
         default:
             break;
@@ -322,6 +346,16 @@ static void progress_buffer_get_property (GObject *object, guint property_id,
             g_value_set_double(value, element->wait_tolerance);
             break;
 
+        case PROP_MEMORY_CACHE_LIMIT:
+            g_value_set_int64(value, element->memory_cache_limit);
+            break;
+
+        case PROP_CACHED_BYTES:
+            g_mutex_lock(&element->lock);
+            g_value_set_int64(value, element->cache ? cache_get_write_position(element->cache) : 0);
+            g_mutex_unlock(&element->lock);
+            break;
+
         default:
             break;
     }
@@ -637,10 +671,22 @@ static GstFlowReturn progress_buffer_enqueue_item(ProgressBuffer *element, GstMi
 
                 if ((segment.flags & GST_SEGMENT_FLAG_UPDATE) == GST_SEGMENT_FLAG_UPDATE) // Updating segments create new cache.
                 {
+                    gint64 content_size = segment.stop - segment.start;
+
                     if (element->cache)
                         destroy_cache(element->cache);
 
-                    element->cache = create_cache();
+                    element->cache = NULL;
+                    if (content_size <= element->memory_cache_limit)
+                        element->cache = create_memory_cache(content_size);
+                    if (!element->cache)
+                        element->cache = create_cache();
+                    if (!element->cache)
+                    {
+                        // The temporary directory may not be writable, try to keep the content in memory.
+                        GST_WARNING_OBJECT(element, "Couldn't create cache file, caching %" G_GINT64_FORMAT " bytes in memory", content_size);
+                        element->cache = create_memory_cache(content_size);
+                    }
                     if (!element->cache)
                     {
                         gst_element_message_full(GST_ELEMENT(element), GST_MESSAGE_ERROR, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_OPEN_READ_WRITE,
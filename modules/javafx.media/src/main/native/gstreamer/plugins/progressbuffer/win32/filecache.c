@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2015, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,6 +24,7 @@
  */
 
 #include <cache.h>
+#include "../memorycache.h"
 #include <windows.h>
 
 #define DEFAULT_BUFFER_SIZE 4096
@@ -31,6 +32,8 @@ static char tempDir[MAX_PATH];
 
 struct _Cache
 {
+    MemoryCache* memory;  // not NULL for caches that are kept in memory
+
     char    filename[MAX_PATH];
     HANDLE  readHandle;
     HANDLE  writeHandle;
@@ -54,6 +57,7 @@ Cache* create_cache()
     Cache* result= (Cache*)g_try_malloc(sizeof(Cache));
     if (result)
     {
+        result->memory = NULL;
         UINT uRetVal = GetTempFileName(tempDir, "jfx", 0, result->filename);
         if (uRetVal == 0)
             goto _error_exit;
@@ -76,8 +80,33 @@ _error_exit:
     return NULL;
 }
 
+Cache* create_memory_cache(gint64 size)
+{
+    Cache* result = (Cache*)g_try_malloc(sizeof(Cache));
+    if (result)
+    {
+        result->memory = memory_cache_create(size);
+        if (result->memory == NULL)
+        {
+            g_free(result);
+            return NULL;
+        }
+        result->filename[0] = '\0';
+        result->readHandle = result->writeHandle = INVALID_HANDLE_VALUE;
+        result->read_position = result->write_position = 0;
+    }
+    return result;
+}
+
 void destroy_cache(Cache* instance)
 {
+    if (instance->memory)
+    {
+        memory_cache_destroy(instance->memory);
+        g_free(instance);
+        return;
+    }
+
     CloseHandle(instance->writeHandle);
     CloseHandle(instance->readHandle);
 
@@ -88,6 +117,11 @@ void cache_write_buffer(Cache* cache, GstBuffer* buffer)
 {
     DWORD written = 0;
     GstMapInfo info;
+    if (cache->memory)
+    {
+        memory_cache_write_buffer(cache->memory, buffer);
+        return;
+    }
     if (gst_buffer_map(buffer, &info, GST_MAP_READ))
     {
         if (WriteFile(cache->writeHandle, info.data, info.size, &written, NULL))
@@ -100,7 +134,11 @@ gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
 {
     DWORD read = 0;
     DWORD size = 0;
-    guint8 *data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
+    guint8 *data = NULL;
+    if (cache->memory)
+        return memory_cache_read_buffer(cache->memory, buffer);
+
+    data = (guint8*)g_try_malloc(DEFAULT_BUFFER_SIZE);
     *buffer = NULL;
 
     if ((cache->write_position - cache->read_position) > 0 && (cache->write_position - cache->read_position) < DEFAULT_BUFFER_SIZE)
@@ -126,6 +164,9 @@ gint64 cache_read_buffer(Cache* cache, GstBuffer** buffer)
 GstFlowReturn cache_read_buffer_from_position(Cache* cache, gint64 start_position, guint size, GstBuffer** buffer)
 {
     GstFlowReturn result = GST_FLOW_ERROR;
+    if (cache->memory)
+        return memory_cache_read_buffer_from_position(cache->memory, start_position, size, buffer);
+
     *buffer = NULL;
 
     if (cache_set_read_position(cache, start_position))
@@ -165,7 +206,11 @@ static gboolean cache_set_handler_position(HANDLE handle, guint64 position)
 
 gboolean cache_set_write_position(Cache* cache, gint64 position)
 {
-    gboolean result = (position == cache->write_position);
+    gboolean result = FALSE;
+    if (cache->memory)
+        return memory_cache_set_write_position(cache->memory, position);
+
+    result = (position == cache->write_position);
     if (!result)
     {
         result = cache_set_handler_position(cache->writeHandle, position);
@@ -177,7 +222,11 @@ gboolean cache_set_write_position(Cache* cache, gint64 position)
 
 gboolean cache_set_read_position(Cache* cache, gint64 position)
 {
-    gboolean result = (position == cache->read_position);
+    gboolean result = FALSE;
+    if (cache->memory)
+        return memory_cache_set_read_position(cache->memory, position);
+
+    result = (position == cache->read_position);
     if (!result)
     {
         result = cache_set_handler_position(cache->readHandle, position);
@@ -189,5 +238,16 @@ gboolean cache_set_read_position(Cache* cache, gint64 position)
 
 gboolean cache_has_enough_data(Cache* cache)
 {
+    if (cache->memory)
+        return memory_cache_has_enough_data(cache->memory);
+
     return cache->read_position < cache->write_position;
 }
+
+gint64 cache_get_write_position(Cache* cache)
+{
+    if (cache->memory)
+        return memory_cache_get_write_position(cache->memory);
+
+    return cache->write_position;
+}
@@ -49,11 +49,18 @@ const static ContentTypesList EMPTY_LIST;
 //********** class CMediaManager
 //*************************************************************************************************
 CMediaManager::CMediaManager()
-:   m_uInternalError(ERROR_NONE)
+:   m_uInternalError(ERROR_NONE),
+    m_pDecoderThreadLock(CJfxCriticalSection::Create()),
+    m_DecoderThreadBudget(0),
+    m_DecoderThreadsInUse(0),
+    m_DecoderCount(0)
 {}
 
 CMediaManager::~CMediaManager()
-{}
+{
+    if (NULL != m_pDecoderThreadLock)
+        delete m_pDecoderThreadLock;
+}
 
 /**
  * CMediaManager::GetInstance()
@@ -111,6 +118,65 @@ void CMediaManager::SetWarningListener(CMediaWarningListener* pWarningListener)
     m_pWarningListener = pWarningListener;
 }
 
+/**
+ * CMediaManager::SetDecoderThreadBudget()
+ *
+ * Sets how many video decoder threads all players of the process may use
+ * together, 0 for no limit.
+ *
+ * @param   threads The number of threads.
+ */
+void CMediaManager::SetDecoderThreadBudget(int threads)
+{
+    m_DecoderThreadBudget = threads > 0 ? threads : 0;
+}
+
+/**
+ * CMediaManager::AcquireDecoderThreads()
+ *
+ * Reserves threads for a new video decoder. Each decoder gets an equal
+ * share of the budget as far as it is not yet in use, and at least one
+ * thread so that it can always decode. The threads must be handed back
+ * with ReleaseDecoderThreads() when the decoder goes away.
+ *
+ * @return  The number of threads the decoder may use, 0 if there is no budget.
+ */
+int CMediaManager::AcquireDecoderThreads()
+{
+    if (m_DecoderThreadBudget <= 0 || NULL == m_pDecoderThreadLock)
+        return 0;
+
+    m_pDecoderThreadLock->Enter();
+    int threads = m_DecoderThreadBudget / (m_DecoderCount + 1);
+    if (threads > m_DecoderThreadBudget - m_DecoderThreadsInUse)
+        threads = m_DecoderThreadBudget - m_DecoderThreadsInUse;
+    if (threads < 1)
+        threads = 1;
+    m_DecoderThreadsInUse += threads;
+    m_DecoderCount++;
+    m_pDecoderThreadLock->Exit();
+
+    return threads;
+}
+
+/**
+ * CMediaManager::ReleaseDecoderThreads()
+ *
+ * Returns threads reserved by AcquireDecoderThreads() to the budget.
+ *
+ * @param   threads The value AcquireDecoderThreads() returned.
+ */
+void CMediaManager::ReleaseDecoderThreads(int threads)
+{
+    if (threads <= 0 || NULL == m_pDecoderThreadLock)
+        return;
+
+    m_pDecoderThreadLock->Enter();
+    m_DecoderThreadsInUse -= threads;
+    m_DecoderCount--;
+    m_pDecoderThreadLock->Exit();
+}
+
 /**
  * CMediaManager::CreatePlayer(CLocator locator)
  *
@@ -55,6 +55,13 @@ public:
 
     uint32_t    CreatePlayer(CLocator* pLocator, CPipelineOptions* pOptions, CMedia** ppMedia);
 
+    // Video decoder threads are shared out from a process wide budget so
+    // that many players together do not start more threads than there are
+    // cores. A budget of 0 lets every decoder pick its own count.
+    void        SetDecoderThreadBudget(int threads);
+    int         AcquireDecoderThreads();
+    void        ReleaseDecoderThreads(int threads);
+
 protected:
     CMediaManager();
 
@@ -68,6 +75,11 @@ private:
     static MMSingleton          s_Singleton;
     CMediaWarningListener*      m_pWarningListener;
     uint32_t                    m_uInternalError;
+
+    CJfxCriticalSection*        m_pDecoderThreadLock;
+    int                         m_DecoderThreadBudget;
+    int                         m_DecoderThreadsInUse;
+    int                         m_DecoderCount;
 };
 
 #endif  //_MEDIA_MANAGER_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,6 +59,8 @@ public:
 
     virtual void       SetBands(int bands, CBandsHolder* holder) = 0;
     virtual size_t     GetBands() = 0;
+    // Returns current holder with added reference, caller must release it.
+    virtual CBandsHolder* GetBandsHolder() = 0;
 
     virtual double     GetInterval() = 0;
     virtual void       SetInterval(double interval) = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,6 +54,10 @@ public:
         return (size_t)mBandCount;
     }
 
+    virtual CBandsHolder* GetBandsHolder() {
+        return NULL;
+    }
+
     virtual double GetInterval() {
         return mInterval;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -184,6 +184,23 @@ uint32_t CPipeline::GetAudioSyncDelay(long* plMillis)
     return ERROR_NONE;
 }
 
+/**
+ * CPipeline::GetStatistics()
+ *
+ * Fills pStatistics with up to count counters indexed by CPipeline::Statistic.
+ * Counters the pipeline does not track are set to -1.
+ */
+uint32_t CPipeline::GetStatistics(int64_t* pStatistics, int count)
+{
+    if (NULL == pStatistics)
+        return ERROR_FUNCTION_PARAM_NULL;
+
+    for (int i = 0; i < count; i++)
+        pStatistics[i] = -1;
+
+    return ERROR_NONE;
+}
+
 CAudioEqualizer* CPipeline::GetAudioEqualizer()
 {
     return NULL;
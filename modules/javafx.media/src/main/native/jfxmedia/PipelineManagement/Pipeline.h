@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,21 @@ public:
         Error = 7
     };
 
+    // Indices of the counters returned by GetStatistics(). These must be kept
+    // in sync with the STAT_* constants of com.sun.media.jfxmedia.MediaPlayer.
+    enum Statistic
+    {
+        AudioBuffersRendered = 0,
+        AudioBuffersDropped = 1,
+        VideoFramesRendered = 2,
+        VideoFramesDropped = 3,
+        AudioQueueLevel = 4,
+        VideoQueueLevel = 5,
+        AudioQueueUnderruns = 6,
+        VideoQueueUnderruns = 7,
+        StatisticsCount = 8
+    };
+
 public:
     CPipeline(CPipelineOptions* pOptions=NULL);
     virtual ~CPipeline();
@@ -89,6 +104,8 @@ public:
     virtual uint32_t        SetAudioSyncDelay(long lMillis);
     virtual uint32_t        GetAudioSyncDelay(long* plMillis);
 
+    virtual uint32_t        GetStatistics(int64_t* pStatistics, int count);
+
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
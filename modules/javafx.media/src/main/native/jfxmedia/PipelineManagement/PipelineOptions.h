@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,7 @@
 
 #include <list>
 #include <string>
+#include <stdint.h>
 
 using namespace std;
 typedef list<string> ContentTypesList;
@@ -47,7 +48,14 @@ public:
         m_StreamMimeType(-1),
         m_AudioStreamMimeType(-1),
         m_bHLSModeEnabled(false),
-        m_audioFlags(0)
+        m_audioFlags(0),
+        m_VideoDecoderThreads(0),
+        m_SharedDecoderThreads(0),
+        m_MemoryCacheLimit(0),
+        m_AudioLatency(0),
+        m_bSharedClock(false),
+        m_VideoLookahead(0),
+        m_bFreeRun(false)
     {}
 
     virtual ~CPipelineOptions() {}
@@ -90,6 +98,38 @@ public:
     inline const char* GetVideoDecoder() { return GetCharFromString(&m_VideoDecoder); }
     inline const char* GetAudioDecoder() { return GetCharFromString(&m_AudioDecoder); }
 
+    // Number of threads the video decoder may use, 0 for one per core.
+    inline void SetVideoDecoderThreads(int threads) { m_VideoDecoderThreads = threads; }
+    inline int  GetVideoDecoderThreads() { return m_VideoDecoderThreads; }
+
+    // Threads the video decoder took from the media manager's decoder budget,
+    // handed back when the pipeline goes away.
+    inline void SetSharedDecoderThreads(int threads) { m_SharedDecoderThreads = threads; }
+    inline int  GetSharedDecoderThreads() { return m_SharedDecoderThreads; }
+
+    // Streamed content of up to this many bytes is cached in memory rather
+    // than in a temporary file, 0 to always use a file.
+    inline void    SetMemoryCacheLimit(int64_t limit) { m_MemoryCacheLimit = limit; }
+    inline int64_t GetMemoryCacheLimit() { return m_MemoryCacheLimit; }
+
+    // Audio output latency in milliseconds, 0 for the audio sink default.
+    inline void SetAudioLatency(int latency) { m_AudioLatency = latency; }
+    inline int  GetAudioLatency() { return m_AudioLatency; }
+
+    // Run the pipeline on the process wide system clock shared by all players.
+    inline void SetSharedClockEnabled(bool enabled) { m_bSharedClock = enabled; }
+    inline bool GetSharedClockEnabled() { return m_bSharedClock; }
+
+    // How many milliseconds ahead of their presentation time video frames are
+    // handed to Java, 0 to deliver them when they are due.
+    inline void SetVideoLookahead(int lookahead) { m_VideoLookahead = lookahead; }
+    inline int  GetVideoLookahead() { return m_VideoLookahead; }
+
+    // Decode as fast as possible: the sinks do not wait for the clock and
+    // decoded audio is discarded instead of being played. Used to benchmark.
+    inline void SetFreeRunEnabled(bool enabled) { m_bFreeRun = enabled; }
+    inline bool GetFreeRunEnabled() { return m_bFreeRun; }
+
     inline const char* GetCharFromString(string *str) {
         if (str->empty())
             return NULL;
@@ -109,6 +149,13 @@ private:
     int         m_AudioStreamMimeType;
     bool        m_bHLSModeEnabled;
     int         m_audioFlags;
+    int         m_VideoDecoderThreads;
+    int         m_SharedDecoderThreads;
+    int64_t     m_MemoryCacheLimit;
+    int         m_AudioLatency;
+    bool        m_bSharedClock;
+    int         m_VideoLookahead;
+    bool        m_bFreeRun;
 
     // Audio parser or demultiplexer for main stream
     string      m_StreamParser;
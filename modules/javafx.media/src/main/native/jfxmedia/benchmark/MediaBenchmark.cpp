@@ -0,0 +1,550 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * jfxmediabench measures the native media engine without a Java player.
+ *
+ * It first times the ColorConvert_* routines on a synthetic frame, then plays
+ * every clip given on the command line through the pipelines built by
+ * CGstPipelineFactory, with the free run option so that the clips are decoded
+ * as fast as possible. Decoded video frames are converted to BGRA as the Java
+ * side would do. Every result is printed as one JSON object per line.
+ *
+ * Usage: jfxmediabench [-n iterations] [-s WIDTHxHEIGHT] [clip ...]
+ */
+
+#include <Common/ProductFlags.h>
+#include <MediaManagement/Media.h>
+#include <MediaManagement/MediaManager.h>
+#include <MediaManagement/MediaTypes.h>
+#include <PipelineManagement/Pipeline.h>
+#include <PipelineManagement/PipelineOptions.h>
+#include <PipelineManagement/PlayerEventDispatcher.h>
+#include <PipelineManagement/AudioTrack.h>
+#include <PipelineManagement/VideoTrack.h>
+#include <PipelineManagement/VideoFrame.h>
+#include <Locator/LocatorStream.h>
+#include <Utils/ColorConverter.h>
+#include <jfxmedia_errors.h>
+
+#include <glib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#define BLOCK_SIZE      65536
+#define CLIP_TIMEOUT    (600 * G_TIME_SPAN_SECOND)
+
+static gint64 GetCpuTime()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return (gint64)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * G_USEC_PER_SEC
+         + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+static double Percentile(vector<gint64> &samples, double p)
+{
+    if (samples.empty())
+        return 0.0;
+    sort(samples.begin(), samples.end());
+    size_t index = (size_t)(p * (samples.size() - 1));
+    return samples[index] / 1000.0;
+}
+
+/**
+ * Serves a clip held in memory to the javasource element of the pipeline.
+ * The pipeline deletes it when it closes the connection.
+ */
+class CMemoryStreamCallbacks : public CStreamCallbacks
+{
+public:
+    CMemoryStreamCallbacks(const guint8 *data, int64_t size)
+    :   m_pData(data), m_llSize(size), m_llPosition(0), m_pBlock(NULL)
+    {}
+
+    bool NeedBuffer() { return false; }
+
+    int ReadNextBlock()
+    {
+        int size = ReadBlock(m_llPosition, BLOCK_SIZE);
+        if (size > 0)
+            m_llPosition += size;
+        return size;
+    }
+
+    int ReadBlock(int64_t position, int size)
+    {
+        if (position < 0 || position >= m_llSize)
+            return -1;
+        m_pBlock = m_pData + position;
+        return (int)MIN((int64_t)size, m_llSize - position);
+    }
+
+    void CopyBlock(void* destination, int size)
+    {
+        if (NULL != m_pBlock)
+            memcpy(destination, m_pBlock, size);
+    }
+
+    bool IsSeekable() { return true; }
+    bool IsRandomAccess() { return true; }
+
+    int64_t Seek(int64_t position)
+    {
+        if (position < 0 || position > m_llSize)
+            return -1;
+        m_llPosition = position;
+        return position;
+    }
+
+    void CloseConnection() { m_pBlock = NULL; }
+
+    int Property(int prop, int value) { return 0; }
+
+private:
+    const guint8 *m_pData;
+    int64_t       m_llSize;
+    int64_t       m_llPosition;
+    const guint8 *m_pBlock;
+};
+
+/**
+ * Collects the frames and state changes of one pipeline.
+ */
+class CBenchmarkDispatcher : public CPlayerEventDispatcher
+{
+public:
+    CBenchmarkDispatcher()
+    :   m_iError(ERROR_NONE), m_llStartTime(0), m_llFirstFrameTime(0), m_llLastFrameTime(0),
+        m_uiFrames(0), m_uiWidth(0), m_uiHeight(0), m_bDone(false)
+    {
+        g_mutex_init(&m_Mutex);
+        g_cond_init(&m_Cond);
+    }
+
+    virtual ~CBenchmarkDispatcher()
+    {
+        g_cond_clear(&m_Cond);
+        g_mutex_clear(&m_Mutex);
+    }
+
+    void Start()
+    {
+        m_llStartTime = g_get_monotonic_time();
+    }
+
+    // Waits for the end of the clip, returns false on error or timeout.
+    bool WaitForEnd()
+    {
+        gint64 endTime = g_get_monotonic_time() + CLIP_TIMEOUT;
+        g_mutex_lock(&m_Mutex);
+        while (!m_bDone)
+        {
+            if (!g_cond_wait_until(&m_Cond, &m_Mutex, endTime))
+                break;
+        }
+        bool bResult = m_bDone && ERROR_NONE == m_iError;
+        g_mutex_unlock(&m_Mutex);
+        return bResult;
+    }
+
+    bool SendPlayerMediaErrorEvent(int errorCode)
+    {
+        Finish(errorCode);
+        return true;
+    }
+
+    bool SendPlayerHaltEvent(const char* message, double msgTime)
+    {
+        fprintf(stderr, "Halted: %s\n", message);
+        Finish(ERROR_PIPELINE_NULL);
+        return true;
+    }
+
+    bool SendPlayerStateEvent(int newState, double presentTime)
+    {
+        if (CPipeline::Finished == newState)
+            Finish(ERROR_NONE);
+        else if (CPipeline::Error == newState)
+            Finish(ERROR_PIPELINE_NULL);
+        return true;
+    }
+
+    bool SendNewFrameEvent(CVideoFrame* pVideoFrame)
+    {
+        gint64 now = g_get_monotonic_time();
+        if (0 == m_uiFrames)
+        {
+            m_llFirstFrameTime = now;
+            m_uiWidth = pVideoFrame->GetWidth();
+            m_uiHeight = pVideoFrame->GetHeight();
+        }
+        else
+        {
+            // Time the pipeline took to demux and decode the frame, not
+            // counting the conversion of the previous one.
+            m_DecodeTimes.push_back(now - m_llLastFrameTime);
+        }
+        m_uiFrames++;
+
+        // The conversion the Java side asks for before a frame is uploaded.
+        gint64 start = g_get_monotonic_time();
+        CVideoFrame *pConverted = pVideoFrame->ConvertToFormat(CVideoFrame::BGRA_PRE);
+        m_ConvertTimes.push_back(g_get_monotonic_time() - start);
+        if (pConverted != pVideoFrame)
+            delete pConverted;
+        delete pVideoFrame;
+
+        m_llLastFrameTime = g_get_monotonic_time();
+        return true;
+    }
+
+    bool SendFrameSizeChangedEvent(int width, int height) { return true; }
+
+    bool SendAudioTrackEvent(CAudioTrack* pTrack)
+    {
+        m_AudioCodec = EncodingName(pTrack->GetEncoding());
+        return true;
+    }
+
+    bool SendVideoTrackEvent(CVideoTrack* pTrack)
+    {
+        m_VideoCodec = EncodingName(pTrack->GetEncoding());
+        return true;
+    }
+
+    bool SendMarkerEvent(string name, double time) { return true; }
+    bool SendBufferProgressEvent(double clipDuration, int64_t start, int64_t stop, int64_t position) { return true; }
+    bool SendDurationUpdateEvent(double time) { return true; }
+    bool SendAudioSpectrumEvent(double time, double duration, bool queryTimestamp) { return true; }
+    void Warning(int warningCode, const char* warningMessage) {}
+
+    static const char* EncodingName(CTrack::Encoding encoding)
+    {
+        switch (encoding)
+        {
+            case CTrack::H264:   return "H.264";
+            case CTrack::H265:   return "HEVC";
+            case CTrack::AAC:    return "AAC";
+            case CTrack::MPEG1LAYER3: return "MP3";
+            case CTrack::PCM:    return "PCM";
+            default:             return "other";
+        }
+    }
+
+    int             m_iError;
+    gint64          m_llStartTime;
+    gint64          m_llFirstFrameTime;
+    gint64          m_llLastFrameTime;
+    guint           m_uiFrames;
+    guint           m_uiWidth;
+    guint           m_uiHeight;
+    string          m_VideoCodec;
+    string          m_AudioCodec;
+    vector<gint64>  m_DecodeTimes;
+    vector<gint64>  m_ConvertTimes;
+
+private:
+    void Finish(int error)
+    {
+        g_mutex_lock(&m_Mutex);
+        if (!m_bDone)
+        {
+            m_iError = error;
+            m_bDone = true;
+            g_cond_signal(&m_Cond);
+        }
+        g_mutex_unlock(&m_Mutex);
+    }
+
+    bool            m_bDone;
+    GMutex          m_Mutex;
+    GCond           m_Cond;
+};
+
+static const char* ContentTypeForClip(const char* path)
+{
+    if (g_str_has_suffix(path, ".m4a"))
+        return CONTENT_TYPE_M4A;
+    if (g_str_has_suffix(path, ".m4v"))
+        return CONTENT_TYPE_M4V;
+    if (g_str_has_suffix(path, ".aac"))
+        return CONTENT_TYPE_AAC;
+    if (g_str_has_suffix(path, ".mp3"))
+        return CONTENT_TYPE_MP3;
+    return CONTENT_TYPE_MP4;
+}
+
+typedef int (*ColorConvertNoAlpha)(uint8_t*, int32_t, int32_t, int32_t,
+                                   const uint8_t*, const uint8_t*, const uint8_t*,
+                                   int32_t, int32_t, int32_t);
+
+static void ReportConversion(const char* name, int width, int height, int iterations,
+                             gint64 elapsed)
+{
+    double seconds = elapsed / (double)G_USEC_PER_SEC;
+    double bytes = (double)width * height * 4 * iterations;
+    printf("{\"test\":\"ColorConvert\",\"function\":\"%s\",\"width\":%d,\"height\":%d,"
+           "\"msPerFrame\":%.3f,\"MBps\":%.1f}\n",
+           name, width, height, seconds * 1000 / iterations, bytes / seconds / 1e6);
+}
+
+static void BenchmarkColorConvert(int width, int height, int iterations)
+{
+    // Same layout as the decoders produce: strides rounded to 16 bytes.
+    int yStride = (width + 15) & ~15;
+    int uvStride = ((width + 1) / 2 + 15) & ~15;
+    int destStride = (width * 4 + 15) & ~15;
+
+    uint8_t *y = (uint8_t*)g_malloc(yStride * height);
+    uint8_t *u = (uint8_t*)g_malloc(uvStride * height);
+    uint8_t *v = (uint8_t*)g_malloc(uvStride * height);
+    uint8_t *a = (uint8_t*)g_malloc(yStride * height);
+    uint8_t *dest = (uint8_t*)g_malloc(destStride * height);
+
+    for (int i = 0; i < yStride * height; i++)
+    {
+        y[i] = (uint8_t)(16 + i % 220);
+        a[i] = (uint8_t)(i * 7);
+    }
+    for (int i = 0; i < uvStride * height; i++)
+    {
+        u[i] = (uint8_t)(i * 3);
+        v[i] = (uint8_t)(255 - i * 5);
+    }
+
+    static const struct {
+        const char* name;
+        ColorConvertNoAlpha function;
+    } noAlpha[] = {
+        { "ColorConvert_YCbCr420p_to_ARGB32_no_alpha", ColorConvert_YCbCr420p_to_ARGB32_no_alpha },
+        { "ColorConvert_YCbCr420p_to_BGRA32_no_alpha", ColorConvert_YCbCr420p_to_BGRA32_no_alpha },
+    };
+
+    for (size_t f = 0; f < G_N_ELEMENTS(noAlpha); f++)
+    {
+        gint64 start = g_get_monotonic_time();
+        for (int i = 0; i < iterations; i++)
+            noAlpha[f].function(dest, destStride, width, height, y, v, u,
+                                yStride, uvStride, uvStride);
+        ReportConversion(noAlpha[f].name, width, height, iterations, g_get_monotonic_time() - start);
+    }
+
+    gint64 start = g_get_monotonic_time();
+    for (int i = 0; i < iterations; i++)
+        ColorConvert_YCbCr420p_to_ARGB32(dest, destStride, width, height, y, v, u, a,
+                                         yStride, uvStride, uvStride, yStride);
+    ReportConversion("ColorConvert_YCbCr420p_to_ARGB32", width, height, iterations,
+                     g_get_monotonic_time() - start);
+
+    start = g_get_monotonic_time();
+    for (int i = 0; i < iterations; i++)
+        ColorConvert_YCbCr420p_to_BGRA32(dest, destStride, width, height, y, v, u, a,
+                                         yStride, uvStride, uvStride, yStride);
+    ReportConversion("ColorConvert_YCbCr420p_to_BGRA32", width, height, iterations,
+                     g_get_monotonic_time() - start);
+
+    // Packed 4:2:2, two bytes per pixel; the chroma pointers index into the
+    // same line as the luma.
+    int packedStride = (width * 2 + 15) & ~15;
+    uint8_t *packed = (uint8_t*)g_malloc(packedStride * height);
+    for (int i = 0; i < packedStride * height; i++)
+        packed[i] = (uint8_t)(i * 13);
+
+    start = g_get_monotonic_time();
+    for (int i = 0; i < iterations; i++)
+        ColorConvert_YCbCr422p_to_ARGB32_no_alpha(dest, destStride, width, height,
+                                                  packed + 1, packed + 2, packed, packedStride, packedStride);
+    ReportConversion("ColorConvert_YCbCr422p_to_ARGB32_no_alpha", width, height, iterations,
+                     g_get_monotonic_time() - start);
+
+    start = g_get_monotonic_time();
+    for (int i = 0; i < iterations; i++)
+        ColorConvert_YCbCr422p_to_BGRA32_no_alpha(dest, destStride, width, height,
+                                                  packed + 1, packed + 2, packed, packedStride, packedStride);
+    ReportConversion("ColorConvert_YCbCr422p_to_BGRA32_no_alpha", width, height, iterations,
+                     g_get_monotonic_time() - start);
+
+    g_free(packed);
+    g_free(dest);
+    g_free(a);
+    g_free(v);
+    g_free(u);
+    g_free(y);
+}
+
+static bool BenchmarkClip(const char* path)
+{
+    gchar *data = NULL;
+    gsize size = 0;
+    if (!g_file_get_contents(path, &data, &size, NULL))
+    {
+        fprintf(stderr, "Cannot read %s\n", path);
+        return false;
+    }
+
+    CMediaManager *pManager = NULL;
+    if (ERROR_NONE != CMediaManager::GetInstance(&pManager) || NULL == pManager)
+    {
+        fprintf(stderr, "Cannot initialize the media engine\n");
+        g_free(data);
+        return false;
+    }
+
+    CMemoryStreamCallbacks *callbacks = new (nothrow) CMemoryStreamCallbacks((const guint8*)data, (int64_t)size);
+    // Deleted by the pipeline
+    CPipelineOptions *pOptions = new (nothrow) CPipelineOptions();
+    if (NULL == callbacks || NULL == pOptions)
+    {
+        delete callbacks;
+        delete pOptions;
+        g_free(data);
+        return false;
+    }
+    pOptions->SetFreeRunEnabled(true);
+
+    CLocatorStream locator(callbacks, ContentTypeForClip(path), path, (int64_t)size);
+    CMedia *pMedia = NULL;
+    uint32_t uErrCode = pManager->CreatePlayer(&locator, pOptions, &pMedia);
+    if (ERROR_NONE != uErrCode || NULL == pMedia)
+    {
+        fprintf(stderr, "Cannot create a player for %s: error 0x%x\n", path, uErrCode);
+        delete pMedia;
+        g_free(data);
+        return false;
+    }
+
+    CBenchmarkDispatcher dispatcher;
+    CPipeline *pPipeline = pMedia->GetPipeline();
+    pPipeline->SetEventDispatcher(&dispatcher);
+
+    gint64 cpuStart = GetCpuTime();
+    dispatcher.Start();
+    bool bResult = ERROR_NONE == pPipeline->Init() && ERROR_NONE == pPipeline->Play()
+                   && dispatcher.WaitForEnd();
+    gint64 elapsed = g_get_monotonic_time() - dispatcher.m_llStartTime;
+    gint64 cpu = GetCpuTime() - cpuStart;
+
+    double duration = 0.0;
+    pPipeline->GetDuration(&duration);
+    int64_t stats[CPipeline::StatisticsCount] = { 0 };
+    pPipeline->GetStatistics(stats, CPipeline::StatisticsCount);
+
+    if (!bResult)
+    {
+        fprintf(stderr, "Playback of %s failed: error 0x%x\n", path, dispatcher.m_iError);
+    }
+    else
+    {
+        double seconds = elapsed / (double)G_USEC_PER_SEC;
+        guint frames = dispatcher.m_uiFrames;
+        int64_t audioBuffers = stats[CPipeline::AudioBuffersRendered];
+        guint units = frames > 0 ? frames : (guint)audioBuffers;
+        printf("{\"test\":\"Decode\",\"clip\":\"%s\",\"video\":\"%s\",\"audio\":\"%s\","
+               "\"width\":%u,\"height\":%u,\"frames\":%u,\"audioBuffers\":%lld,"
+               "\"fps\":%.1f,\"realtime\":%.2f,\"cpuMsPerFrame\":%.3f,"
+               "\"firstFrameMs\":%.1f,\"decodeP50Ms\":%.3f,\"decodeP90Ms\":%.3f,"
+               "\"convertP50Ms\":%.3f,\"convertP90Ms\":%.3f}\n",
+               path,
+               dispatcher.m_VideoCodec.empty() ? "none" : dispatcher.m_VideoCodec.c_str(),
+               dispatcher.m_AudioCodec.empty() ? "none" : dispatcher.m_AudioCodec.c_str(),
+               dispatcher.m_uiWidth, dispatcher.m_uiHeight, frames, (long long)audioBuffers,
+               frames / seconds, duration / seconds,
+               units > 0 ? cpu / 1000.0 / units : 0.0,
+               frames > 0 ? (dispatcher.m_llFirstFrameTime - dispatcher.m_llStartTime) / 1000.0 : 0.0,
+               Percentile(dispatcher.m_DecodeTimes, 0.5),
+               Percentile(dispatcher.m_DecodeTimes, 0.9),
+               Percentile(dispatcher.m_ConvertTimes, 0.5),
+               Percentile(dispatcher.m_ConvertTimes, 0.9));
+    }
+
+    delete pMedia;
+    g_free(data);
+    return bResult;
+}
+
+static void Usage()
+{
+    fprintf(stderr, "Usage: jfxmediabench [-n iterations] [-s WIDTHxHEIGHT] [clip ...]\n");
+}
+
+int main(int argc, char* argv[])
+{
+    int width = 1920;
+    int height = 1080;
+    int iterations = 200;
+    vector<const char*> clips;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (0 == strcmp(argv[i], "-n") && i + 1 < argc)
+        {
+            iterations = atoi(argv[++i]);
+        }
+        else if (0 == strcmp(argv[i], "-s") && i + 1 < argc)
+        {
+            if (2 != sscanf(argv[++i], "%dx%d", &width, &height))
+            {
+                Usage();
+                return 1;
+            }
+        }
+        else if ('-' == argv[i][0])
+        {
+            Usage();
+            return 1;
+        }
+        else
+        {
+            clips.push_back(argv[i]);
+        }
+    }
+
+    if (width <= 0 || height <= 0 || iterations <= 0)
+    {
+        Usage();
+        return 1;
+    }
+
+    BenchmarkColorConvert(width, height, iterations);
+
+    int failures = 0;
+    for (size_t i = 0; i < clips.size(); i++)
+    {
+        if (!BenchmarkClip(clips[i]))
+            failures++;
+    }
+
+    return failures > 0 ? 1 : 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,43 +25,43 @@
 
 #include "JavaBandsHolder.h"
 #include "JniUtils.h"
+#include <new>
+#include <string.h>
 
 CJavaBandsHolder::CJavaBandsHolder()
+    : m_Bands(0),
+      m_pData(NULL),
+      m_WriteSlot(0),
+      m_ReadSlot(1),
+      m_Published(2)
 {
 }
 
 CJavaBandsHolder::~CJavaBandsHolder()
 {
-    if (m_jvm != NULL) {
-        CJavaEnvironment jenv(m_jvm);
-        JNIEnv *pEnv = jenv.getEnvironment();
-
-        if (pEnv) {
-            if (m_Magnitudes) {
-                pEnv->DeleteGlobalRef(m_Magnitudes);
-                m_Magnitudes = NULL;
-            }
-
-            if (m_Phases) {
-                pEnv->DeleteGlobalRef(m_Phases);
-                m_Phases = NULL;
-            }
-        }
-    }
+    delete [] m_pData;
 }
 
 bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases)
 {
-    env->GetJavaVM(&m_jvm);
-    if (env->ExceptionCheck()) {
-        env->ExceptionClear();
-        m_jvm = NULL;
+    if (bands <= 0 || env->GetArrayLength(magnitudes) < bands || env->GetArrayLength(phases) < bands)
+        return false;
+
+    m_pData = new (std::nothrow) float[3 * 2 * bands];
+    if (m_pData == NULL) {
         return false;
     }
 
+    // Start all slots with initial values set by Java
     m_Bands = bands;
-    m_Magnitudes = (jfloatArray)env->NewGlobalRef(magnitudes);
-    m_Phases = (jfloatArray)env->NewGlobalRef(phases);
+    for (int i = 0; i < 3; i++) {
+        env->GetFloatArrayRegion(magnitudes, 0, bands, GetSlot(i));
+        env->GetFloatArrayRegion(phases, 0, bands, GetSlot(i) + bands);
+    }
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return false;
+    }
 
     InitRef(this);
 
@@ -70,25 +70,29 @@ bool CJavaBandsHolder::Init(JNIEnv* env, int bands, jfloatArray magnitudes, jflo
 
 void CJavaBandsHolder::UpdateBands(int size, const float* magnitudes, const float* phases)
 {
-    if (m_Bands != size || m_jvm == NULL)
+    if (m_Bands != size)
         return;
 
-    CJavaEnvironment jenv(m_jvm);
-    JNIEnv *pEnv = jenv.getEnvironment();
-    if (pEnv) {
-        // use local references due to threading issues
-        jfloatArray localMagnitudes = (jfloatArray)pEnv->NewLocalRef(m_Magnitudes);
-        jfloatArray localPhases = (jfloatArray)pEnv->NewLocalRef(m_Phases);
+    float *slot = GetSlot(m_WriteSlot);
+    memcpy(slot, magnitudes, size * sizeof(float));
+    memcpy(slot + size, phases, size * sizeof(float));
 
-        if (localMagnitudes && localPhases) {
-            pEnv->SetFloatArrayRegion(localMagnitudes, 0, size, magnitudes);
-            if (!jenv.clearException()) {
-                pEnv->SetFloatArrayRegion(localPhases, 0, size, phases);
-                jenv.clearException();
-            }
-        }
+    // Publish written slot and take over the one published before
+    int previous = m_Published.exchange(m_WriteSlot | FRESH_FLAG, std::memory_order_acq_rel);
+    m_WriteSlot = previous & INDEX_MASK;
+}
 
-        pEnv->DeleteLocalRef(localMagnitudes);
-        pEnv->DeleteLocalRef(localPhases);
+void CJavaBandsHolder::GetBands(JNIEnv* env, jfloatArray magnitudes, jfloatArray phases)
+{
+    if ((m_Published.load(std::memory_order_relaxed) & FRESH_FLAG) != 0) {
+        int previous = m_Published.exchange(m_ReadSlot, std::memory_order_acq_rel);
+        m_ReadSlot = previous & INDEX_MASK;
     }
+
+    if (env->GetArrayLength(magnitudes) < m_Bands || env->GetArrayLength(phases) < m_Bands)
+        return;
+
+    const float *slot = GetSlot(m_ReadSlot);
+    env->SetFloatArrayRegion(magnitudes, 0, m_Bands, slot);
+    env->SetFloatArrayRegion(phases, 0, m_Bands, slot + m_Bands);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,8 +27,15 @@
 #define _JAVA_SPECTRUM_UPDATER_H_
 
 #include <jni.h>
+#include <atomic>
 #include <PipelineManagement/AudioSpectrum.h>
 
+/*
+ * Keeps last spectrum in a triple buffer, so the thread producing spectrum
+ * never blocks on or calls into Java. UpdateBands() publishes new bands
+ * and GetBands() copies the latest published ones into Java arrays. There
+ * must be only one thread calling each of them at a time.
+ */
 class CJavaBandsHolder : public CBandsHolder
 {
 public:
@@ -38,12 +45,20 @@ public:
 public:
     bool Init(JNIEnv* env, int bands, jfloatArray magnitudes, jfloatArray phases);
     void UpdateBands(int size, const float* magnitudes, const float* phases);
+    void GetBands(JNIEnv* env, jfloatArray magnitudes, jfloatArray phases);
 
 private:
-    JavaVM      *m_jvm;
-    int         m_Bands;
-    jfloatArray m_Magnitudes;
-    jfloatArray m_Phases;
+    // Index of the published slot and whether it was not read yet
+    static const int FRESH_FLAG = 4;
+    static const int INDEX_MASK = 3;
+
+    float* GetSlot(int index) { return m_pData + index * 2 * m_Bands; }
+
+    int              m_Bands;
+    float*           m_pData;     // three slots of magnitudes followed by phases
+    int              m_WriteSlot; // owned by UpdateBands()
+    int              m_ReadSlot;  // owned by GetBands()
+    std::atomic<int> m_Published;
 };
 
 #endif // _JAVA_SPECTRUM_UPDATER_H_
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,22 @@ Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeSetBands(JNIEnv *env,
         pSpectrum->SetBands(bands, pHolder);
 }
 
+JNIEXPORT void JNICALL
+Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeGetBands(JNIEnv *env, jobject obj, jlong nativeRef,
+                                                                                jfloatArray magnitudes, jfloatArray phases)
+{
+    CAudioSpectrum *pSpectrum = (CAudioSpectrum*)jlong_to_ptr(nativeRef);
+    if (pSpectrum == NULL)
+        return;
+
+    // All holders are set by nativeSetBands() above
+    CBandsHolder *pHolder = pSpectrum->GetBandsHolder();
+    if (pHolder != NULL) {
+        static_cast<CJavaBandsHolder*>(pHolder)->GetBands(env, magnitudes, phases);
+        CBandsHolder::ReleaseRef(pHolder);
+    }
+}
+
 JNIEXPORT jdouble JNICALL
 Java_com_sun_media_jfxmediaimpl_NativeAudioSpectrum_nativeGetInterval(JNIEnv *env, jobject obj, jlong nativeRef)
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -64,6 +64,8 @@ CGstAVPlaybackPipeline::CGstAVPlaybackPipeline(const GstElementContainer& elemen
     m_videoCodecErrorCode = ERROR_NONE;
     m_bStaticPipeline = false; // For now all video pipelines are dynamic
     m_FirstPTS = GST_CLOCK_TIME_NONE;
+    m_AudioQueueUnderruns = 0;
+    m_VideoQueueUnderruns = 0;
 }
 
 /**
@@ -77,6 +79,9 @@ CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()
     g_print ("CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()\n");
 #endif
     LOGGER_LOGMSG(LOGGER_DEBUG, "CGstAVPlaybackPipeline::~CGstAVPlaybackPipeline()");
+
+    // Hand the video decoder threads back to the process wide budget.
+    CGstPipelineFactory::ReleaseDecoderThreads(m_pOptions);
 }
 
 /**
@@ -115,7 +120,12 @@ uint32_t CGstAVPlaybackPipeline::PostBuildInit()
     {
 #if ENABLE_APP_SINK && !ENABLE_NATIVE_SINK
         //Tell it to push signals to us in sync mode so that audio and video are sync'd
-        g_object_set (G_OBJECT (m_Elements[VIDEO_SINK]), "emit-signals", TRUE, "sync", TRUE, NULL);
+        g_object_set (G_OBJECT (m_Elements[VIDEO_SINK]), "emit-signals", TRUE,
+                      "sync", (gboolean)!m_pOptions->GetFreeRunEnabled(), NULL);
+
+        // Hand frames out early so they can be scheduled against the display pulse
+        if (m_pOptions->GetVideoLookahead() > 0)
+            g_object_set (G_OBJECT (m_Elements[VIDEO_SINK]), "ts-offset", -(gint64)m_pOptions->GetVideoLookahead()*GST_MSECOND, NULL);
 
         //Connect the callback
         g_signal_connect (m_Elements[VIDEO_SINK], "new-sample", G_CALLBACK (OnAppSinkHaveFrame), this);
@@ -763,6 +773,38 @@ void CGstAVPlaybackPipeline::CheckQueueSize(GstElement *element)
     }
 }
 
+/**
+ * CGstAVPlaybackPipeline::GetStatistics()
+ *
+ * Adds the video sink counters, the queue fill levels in buffers and the
+ * number of queue underruns to the audio pipeline statistics.
+ */
+uint32_t CGstAVPlaybackPipeline::GetStatistics(int64_t* pStatistics, int count)
+{
+    uint32_t uErrCode = CGstAudioPlaybackPipeline::GetStatistics(pStatistics, count);
+    if (ERROR_NONE != uErrCode || IsPlayerState(Error))
+        return uErrCode;
+
+    if (m_Elements[VIDEO_SINK] != NULL && m_bHasVideo)
+        GetSinkStatistics(m_Elements[VIDEO_SINK], &pStatistics[VideoFramesRendered], &pStatistics[VideoFramesDropped]);
+
+    guint current_level_buffers = 0;
+    if (m_Elements[AUDIO_QUEUE] != NULL)
+    {
+        g_object_get(m_Elements[AUDIO_QUEUE], "current-level-buffers", &current_level_buffers, NULL);
+        pStatistics[AudioQueueLevel] = current_level_buffers;
+        pStatistics[AudioQueueUnderruns] = g_atomic_int_get(&m_AudioQueueUnderruns);
+    }
+    if (m_Elements[VIDEO_QUEUE] != NULL)
+    {
+        g_object_get(m_Elements[VIDEO_QUEUE], "current-level-buffers", &current_level_buffers, NULL);
+        pStatistics[VideoQueueLevel] = current_level_buffers;
+        pStatistics[VideoQueueUnderruns] = g_atomic_int_get(&m_VideoQueueUnderruns);
+    }
+
+    return ERROR_NONE;
+}
+
 void CGstAVPlaybackPipeline::queue_overrun(GstElement *element, CGstAVPlaybackPipeline *pPipeline)
 {
     pPipeline->CheckQueueSize(element);
@@ -770,6 +812,11 @@ void CGstAVPlaybackPipeline::queue_overrun(GstElement *element, CGstAVPlaybackPi
 
 void CGstAVPlaybackPipeline::queue_underrun(GstElement *element, CGstAVPlaybackPipeline *pPipeline)
 {
+    if (pPipeline->m_Elements[AUDIO_QUEUE] == element)
+        g_atomic_int_inc(&pPipeline->m_AudioQueueUnderruns);
+    else if (pPipeline->m_Elements[VIDEO_QUEUE] == element)
+        g_atomic_int_inc(&pPipeline->m_VideoQueueUnderruns);
+
     if (pPipeline->m_pOptions->GetHLSModeEnabled())
     {
         if (pPipeline->m_Elements[AUDIO_QUEUE] == element)
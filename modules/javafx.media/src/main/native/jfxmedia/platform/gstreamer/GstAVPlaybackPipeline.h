@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,6 +53,8 @@ public:
 
     virtual void CheckQueueSize(GstElement *element);
 
+    virtual uint32_t GetStatistics(int64_t* pStatistics, int count);
+
     void         SetEncodedVideoFrameRate(float frameRate);
 
 protected:
@@ -83,6 +85,8 @@ private:
     gfloat                  m_EncodedVideoFrameRate;
     int                     m_videoCodecErrorCode;
     GstClockTime            m_FirstPTS;
+    volatile gint           m_AudioQueueUnderruns;
+    volatile gint           m_VideoQueueUnderruns;
 };
 
 #endif  //_GST_AV_PLAYBACK_PIPELINE_H_
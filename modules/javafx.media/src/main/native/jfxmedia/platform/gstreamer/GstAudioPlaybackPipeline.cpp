@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -129,6 +129,22 @@ uint32_t CGstAudioPlaybackPipeline::Init()
     if (m_pOptions->GetBufferingEnabled())
         m_bStaticPipeline = false; // Pipeline is dynamic if we have progress buffer
 
+    // With a shared clock the audio sink slaves to the system clock instead of
+    // providing its own, so every player in the process runs at the same rate.
+    if (m_pOptions->GetSharedClockEnabled())
+    {
+        GstClock *clock = gst_system_clock_obtain();
+        gst_pipeline_use_clock(GST_PIPELINE(m_Elements[PIPELINE]), clock);
+        gst_object_unref(clock);
+        m_bIsClockSet = true;
+    }
+    else if (m_pOptions->GetFreeRunEnabled())
+    {
+        // Without a clock every element runs as fast as it can.
+        gst_pipeline_use_clock(GST_PIPELINE(m_Elements[PIPELINE]), NULL);
+        m_bIsClockSet = true;
+    }
+
     CMediaManager *pManager = NULL;
     uint32_t ret = CMediaManager::GetInstance(&pManager);
     if (ret != ERROR_NONE)
@@ -988,6 +1004,51 @@ uint32_t CGstAudioPlaybackPipeline::GetAudioSyncDelay(long* audioSyncDelay)
     return ERROR_NONE;
 }
 
+/**
+ * CGstAudioPlaybackPipeline::GetStatistics()
+ *
+ * Gets the playback counters of the pipeline, see CPipeline::Statistic.
+ * The sink counters are kept by GstBaseSink anyway, so reading them costs
+ * nothing while playing.
+ */
+uint32_t CGstAudioPlaybackPipeline::GetStatistics(int64_t* pStatistics, int count)
+{
+    if (count < StatisticsCount)
+        return ERROR_FUNCTION_PARAM;
+
+    uint32_t uErrCode = CPipeline::GetStatistics(pStatistics, count);
+    if (ERROR_NONE != uErrCode || IsPlayerState(Error))
+        return uErrCode;
+
+    if (m_Elements[AUDIO_SINK] != NULL && m_bHasAudio)
+        GetSinkStatistics(m_Elements[AUDIO_SINK], &pStatistics[AudioBuffersRendered], &pStatistics[AudioBuffersDropped]);
+
+    return ERROR_NONE;
+}
+
+/**
+ * CGstAudioPlaybackPipeline::GetSinkStatistics()
+ *
+ * Reads the rendered and dropped buffer counts of a GstBaseSink.
+ */
+void CGstAudioPlaybackPipeline::GetSinkStatistics(GstElement* pSink, int64_t* pRendered, int64_t* pDropped)
+{
+    GstStructure* pStats = NULL;
+    guint64 rendered = 0;
+    guint64 dropped = 0;
+
+    g_object_get(pSink, "stats", &pStats, NULL);
+    if (NULL == pStats)
+        return;
+
+    if (gst_structure_get_uint64(pStats, "rendered", &rendered))
+        *pRendered = (int64_t)rendered;
+    if (gst_structure_get_uint64(pStats, "dropped", &dropped))
+        *pDropped = (int64_t)dropped;
+
+    gst_structure_free(pStats);
+}
+
 CAudioEqualizer* CGstAudioPlaybackPipeline::GetAudioEqualizer()
 {
     return m_pAudioEqualizer;
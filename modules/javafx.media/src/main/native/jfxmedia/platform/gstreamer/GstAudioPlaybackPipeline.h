@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -103,6 +103,8 @@ public:
     virtual uint32_t    SetAudioSyncDelay(long millis);
     virtual uint32_t    GetAudioSyncDelay(long* millis);
 
+    virtual uint32_t    GetStatistics(int64_t* pStatistics, int count);
+
     virtual CAudioEqualizer*    GetAudioEqualizer();
     virtual CAudioSpectrum*     GetAudioSpectrum();
 
@@ -124,6 +126,7 @@ protected:
     void                UpdatePlayerState(GstState newState, GstState oldState);
     bool                IsPlayerState(PlayerState state);
     bool                IsPlayerPendingState(PlayerState state);
+    static void         GetSinkStatistics(GstElement* pSink, int64_t* pRendered, int64_t* pDropped);
 
     sBusCallbackContent* m_pBusCallbackContent;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -99,6 +99,11 @@ void CGstAudioSpectrum::SetBands(int bands, CBandsHolder* holder)
     CBandsHolder::ReleaseRef(old_holder);
 }
 
+CBandsHolder* CGstAudioSpectrum::GetBandsHolder()
+{
+    return CBandsHolder::AddRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
+}
+
 void CGstAudioSpectrum::UpdateBands(int size, const float* magnitudes, const float* phases)
 {
     CBandsHolder *holder = CBandsHolder::AddRef((CBandsHolder*)g_atomic_pointer_get(&m_pHolder));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2013, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@ public:
 
     virtual void      SetBands(int bands, CBandsHolder* updater);
     virtual size_t    GetBands();
+    virtual CBandsHolder* GetBandsHolder();
     virtual void      UpdateBands(int size, const float* magnitudes, const float* phases);
 
     virtual double    GetInterval();
@@ -24,6 +24,7 @@
  */
 
 #include "GstMediaManager.h"
+#include <stdlib.h>
 #include <jfxmedia_errors.h>
 #include <jni/Logger.h>
 #include <Common/VSMemory.h>
@@ -137,6 +138,15 @@ uint32_t CGstMediaManager::Init()
     }
     LOWLEVELPERF_EXECTIMESTOP("gst_init_check()");
 
+    // Players share one budget of video decoder threads, by default one
+    // per core up to the 16 the libavcodec decoder uses on its own.
+    // JFXMEDIA_DECODER_THREADS sets another budget, 0 for none.
+    const char *decoderThreads = getenv("JFXMEDIA_DECODER_THREADS");
+    if (NULL != decoderThreads)
+        SetDecoderThreadBudget(atoi(decoderThreads));
+    else
+        SetDecoderThreadBudget(MIN((int)g_get_num_processors(), 16));
+
 #if ENABLE_VISUAL_STUDIO_MEMORY_LEAKS_DETECTION && TARGET_OS_WIN32
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif // ENABLE_VISUAL_STUDIO_MEMORY_LEAKS_DETECTION
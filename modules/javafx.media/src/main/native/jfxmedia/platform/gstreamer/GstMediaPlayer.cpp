@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -169,6 +169,42 @@ JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMed
     return iRet;
 }
 
+/**
+ * gstGetStatistics()
+ *
+ * Gets the playback counters of the pipeline.
+ */
+JNIEXPORT jint JNICALL Java_com_sun_media_jfxmediaimpl_platform_gstreamer_GSTMediaPlayer_gstGetStatistics
+(JNIEnv *env, jobject obj, jlong ref_media, jlongArray jrglStatistics)
+{
+    CMedia* pMedia = (CMedia*)jlong_to_ptr(ref_media);
+    if (NULL == pMedia)
+        return ERROR_MEDIA_NULL;
+
+    CPipeline* pPipeline = (CPipeline*)pMedia->GetPipeline();
+    if (NULL == pPipeline)
+        return ERROR_PIPELINE_NULL;
+
+    if (env->GetArrayLength(jrglStatistics) < CPipeline::StatisticsCount)
+        return ERROR_FUNCTION_PARAM;
+
+    int64_t statistics[CPipeline::StatisticsCount];
+    uint32_t uErrCode = pPipeline->GetStatistics(statistics, CPipeline::StatisticsCount);
+    if (ERROR_NONE != uErrCode)
+        return (jint)uErrCode;
+
+    jlong jlStatistics[CPipeline::StatisticsCount];
+    for (int i = 0; i < CPipeline::StatisticsCount; i++)
+        jlStatistics[i] = (jlong)statistics[i];
+    env->SetLongArrayRegion(jrglStatistics, 0, CPipeline::StatisticsCount, jlStatistics);
+    if (env->ExceptionCheck()) {
+        env->ExceptionClear();
+        return ERROR_JNI_UNEXPECTED;
+    }
+
+    return ERROR_NONE;
+}
+
 /**
  * gstPlay()
  *
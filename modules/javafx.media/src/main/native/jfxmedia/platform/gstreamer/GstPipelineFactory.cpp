@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,8 +26,10 @@
 
 #include "GstAudioPlaybackPipeline.h"
 #include "GstAVPlaybackPipeline.h"
+#include "GstMediaManager.h"
 
 #include <string>
+#include <stdlib.h>
 #include <Common/ProductFlags.h>
 #include <Common/VSMemory.h>
 #include <MediaManagement/MediaTypes.h>
@@ -96,6 +98,26 @@ uint32_t CGstPipelineFactory::CreatePlayerPipeline(CLocator* locator, CPipelineO
     int streamMimeType = callbacks->Property(HLS_PROP_GET_MIMETYPE, 0);
     pOptions->SetStreamMimeType(streamMimeType);
 
+    // Interactive applications can ask for smaller audio sink buffers,
+    // JFXMEDIA_AUDIO_LATENCY is in milliseconds.
+    const char *audioLatency = getenv("JFXMEDIA_AUDIO_LATENCY");
+    if (NULL != audioLatency && 0 == pOptions->GetAudioLatency())
+        pOptions->SetAudioLatency(atoi(audioLatency));
+
+    // Players which have to stay in sync with each other, e.g. the tiles of
+    // a video wall, drift apart on their own audio sink clocks.
+    // JFXMEDIA_SHARED_CLOCK=1 puts all of them on the same clock.
+    const char *sharedClock = getenv("JFXMEDIA_SHARED_CLOCK");
+    if (NULL != sharedClock && 0 != atoi(sharedClock))
+        pOptions->SetSharedClockEnabled(true);
+
+    // Frames delivered ahead of time are queued by the Java side, which then
+    // picks the frame matching each pulse. JFXMEDIA_VIDEO_LOOKAHEAD is in
+    // milliseconds.
+    const char *videoLookahead = getenv("JFXMEDIA_VIDEO_LOOKAHEAD");
+    if (NULL != videoLookahead)
+        pOptions->SetVideoLookahead(atoi(videoLookahead));
+
     // Create main source.
     GstElement* pSource = NULL;
     GstElement* pBuffer = NULL;
@@ -288,6 +310,9 @@ uint32_t CGstPipelineFactory::CreateSourceElement(CLocator *locator, CStreamCall
         if (NULL == buffer)
             return ERROR_GSTREAMER_ELEMENT_CREATE;
 
+        if (!pOptions->GetHLSModeEnabled() && pOptions->GetMemoryCacheLimit() > 0)
+            g_object_set(buffer, "memory-cache-limit", (gint64)pOptions->GetMemoryCacheLimit(), NULL);
+
         gst_bin_add_many(GST_BIN(source), javaSource, buffer, NULL);
 
         if (!gst_element_link(javaSource, buffer))
@@ -343,22 +368,46 @@ void CGstPipelineFactory::SourceCloseConnection(GstElement *src, gpointer data)
 }
 
 /**
-    * GstElement* CreateAudioSinkElement(char* name)
+    * GstElement* CreateAudioSinkElement(int latency, bool bFreeRun)
     *
-    * @param   name    The name to assign to the audio sink element.
+    * @param   latency The audio output latency in milliseconds, 0 for default.
+    * @param   bFreeRun true to discard the audio instead of playing it.
     * @return  The audio sink element.
     */
-GstElement* CGstPipelineFactory::CreateAudioSinkElement()
+GstElement* CGstPipelineFactory::CreateAudioSinkElement(int latency, bool bFreeRun)
 {
+    // An audio device consumes samples in real time, an appsink that
+    // drops everything lets the decoder run at full speed.
+    if (bFreeRun)
+    {
+        GstElement *appsink = CreateElement("appsink");
+        if (NULL != appsink)
+            g_object_set(appsink, "sync", FALSE, "drop", TRUE, "max-buffers", 1, NULL);
+        return appsink;
+    }
+
 #if TARGET_OS_WIN32
-    return CreateElement("directsoundsink");
+    GstElement *audiosink = CreateElement("directsoundsink");
 #elif  TARGET_OS_MAC
-    return CreateElement("osxaudiosink");
+    GstElement *audiosink = CreateElement("osxaudiosink");
 #elif  TARGET_OS_LINUX
-    return CreateElement("alsasink");
+    GstElement *audiosink = CreateElement("alsasink");
 #else
-    return NULL;
+    GstElement *audiosink = NULL;
 #endif
+
+    // Ring buffer of all audio sinks holds "buffer-time" of audio written
+    // in "latency-time" segments, both in microseconds. Default segment
+    // is 10 ms, so it is only reduced when it would not fit twice.
+    if (NULL != audiosink && latency > 0)
+    {
+        gint64 bufferTime = (gint64)latency * 1000;
+        gint64 latencyTime = MIN(bufferTime / 2, (gint64)10000);
+        g_object_set(audiosink, "buffer-time", bufferTime,
+                                "latency-time", latencyTime, NULL);
+    }
+
+    return audiosink;
 }
 
 void CGstPipelineFactory::OnBufferPadAdded(GstElement* element, GstPad* pad, GstElement* peer)
@@ -691,7 +740,8 @@ uint32_t CGstPipelineFactory::CreateAudioPipeline(bool bConvertFormat, CPipeline
     GstElement* audiobin;
     uRetCode = CreateAudioBin(pOptions->GetStreamParser(),
                               pOptions->GetAudioDecoder(),
-                              bConvertFormat, pElements, &flags, &audiobin);
+                              bConvertFormat, pOptions->GetAudioLatency(),
+                              pOptions->GetFreeRunEnabled(), pElements, &flags, &audiobin);
     if (ERROR_NONE != uRetCode)
         return uRetCode;
 
@@ -779,6 +829,7 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
     int audioFlags = 0;
     GstElement *audiobin = NULL;
     uRetCode = CreateAudioBin(NULL, pOptions->GetAudioDecoder(), bConvertFormat,
+                              pOptions->GetAudioLatency(), pOptions->GetFreeRunEnabled(),
                               pElements, &audioFlags, &audiobin);
     if (ERROR_NONE != uRetCode)
         return uRetCode;
@@ -807,9 +858,13 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
     }
 
     GstElement *videobin;
-    uRetCode = CreateVideoBin(pOptions->GetVideoDecoder(), pVideoSink, pElements, &videobin);
+    uRetCode = CreateVideoBin(pOptions->GetVideoDecoder(), pOptions,
+                              pVideoSink, pElements, &videobin);
     if (ERROR_NONE != uRetCode)
+    {
+        ReleaseDecoderThreads(pOptions);
         return uRetCode;
+    }
 
     pElements->add(PIPELINE, pipeline);
     pElements->add(AV_DEMUXER, demuxer);
@@ -818,13 +873,16 @@ uint32_t CGstPipelineFactory::CreateAVPipeline(bool bConvertFormat, GstElement*
 
     *ppPipeline = new CGstAVPlaybackPipeline(*pElements, audioFlags, pOptions);
     if( NULL == *ppPipeline)
+    {
+        ReleaseDecoderThreads(pOptions);
         return ERROR_MEMORY_ALLOCATION;
+    }
 
     return uRetCode;
 }
 
 uint32_t CGstPipelineFactory::CreateAudioBin(const char* strParserName, const char* strDecoderName,
-                                             bool bConvertFormat,
+                                             bool bConvertFormat, int audioLatency, bool bFreeRun,
                                              GstElementContainer* elements, int* pFlags,
                                              GstElement** ppAudiobin)
 {
@@ -894,7 +952,7 @@ uint32_t CGstPipelineFactory::CreateAudioBin(const char* strParserName, const ch
     if (NULL == audioequalizer || NULL == audiospectrum)
         return ERROR_GSTREAMER_ELEMENT_CREATE;
 
-    GstElement *audiosink  = CreateAudioSinkElement();
+    GstElement *audiosink  = CreateAudioSinkElement(audioLatency, bFreeRun);
     if (NULL == audiosink)
         return ERROR_GSTREAMER_AUDIO_SINK_CREATE;
 
@@ -969,7 +1027,21 @@ uint32_t CGstPipelineFactory::CreateAudioBin(const char* strParserName, const ch
     return ERROR_NONE;
 }
 
-uint32_t CGstPipelineFactory::CreateVideoBin(const char* strDecoderName, GstElement* pVideoSink,
+// Returns the video decoder threads the options took from the media manager's
+// budget, if any.
+void CGstPipelineFactory::ReleaseDecoderThreads(CPipelineOptions* pOptions)
+{
+    CMediaManager* pManager = NULL;
+    if (pOptions->GetSharedDecoderThreads() > 0 &&
+        ERROR_NONE == CMediaManager::GetInstance(&pManager) && NULL != pManager)
+    {
+        pManager->ReleaseDecoderThreads(pOptions->GetSharedDecoderThreads());
+        pOptions->SetSharedDecoderThreads(0);
+    }
+}
+
+uint32_t CGstPipelineFactory::CreateVideoBin(const char* strDecoderName, CPipelineOptions* pOptions,
+                                             GstElement* pVideoSink,
                                              GstElementContainer* elements, GstElement** ppVideobin)
 {
     *ppVideobin = gst_bin_new(NULL);
@@ -981,6 +1053,24 @@ uint32_t CGstPipelineFactory::CreateVideoBin(const char* strDecoderName, GstElem
     if ((NULL != strDecoderName && NULL == videodec) || NULL == videoqueue)
         return ERROR_GSTREAMER_ELEMENT_CREATE;
 
+    // Only the libavcodec based decoder can be told how many threads to use.
+    // Unless the options ask for a count it takes its share of the process
+    // wide budget, otherwise every player would start one thread per core.
+    if (NULL != videodec &&
+        NULL != g_object_class_find_property(G_OBJECT_GET_CLASS(videodec), "thread-count"))
+    {
+        int decoderThreads = pOptions->GetVideoDecoderThreads();
+        CMediaManager* pManager = NULL;
+        if (decoderThreads <= 0 &&
+            ERROR_NONE == CMediaManager::GetInstance(&pManager) && NULL != pManager)
+        {
+            decoderThreads = pManager->AcquireDecoderThreads();
+            pOptions->SetSharedDecoderThreads(decoderThreads);
+        }
+        if (decoderThreads > 0)
+            g_object_set(videodec, "thread-count", decoderThreads, NULL);
+    }
+
     if(NULL == pVideoSink)
     {
         pVideoSink = CreateElement ("autovideosink");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,6 +43,7 @@ class CGstPipelineFactory : public CPipelineFactory
 public:
     uint32_t           CreatePlayerPipeline(CLocator* locator, CPipelineOptions *pOptions, CPipeline** ppPipeline);
     static GstElement* GetByFactoryName(GstElement* bin, const char* strFactoryName);
+    static void        ReleaseDecoderThreads(CPipelineOptions* pOptions);
 
     virtual ~CGstPipelineFactory();
 
@@ -64,7 +65,7 @@ private:
 
     uint32_t    CreateSourceElement(CLocator *locator, CStreamCallbacks *callbacks, int streamMimeType,
                                     GstElement** ppElement, GstElement** ppBuffer, CPipelineOptions *pOptions);
-    GstElement* CreateAudioSinkElement();
+    GstElement* CreateAudioSinkElement(int latency, bool bFreeRun);
     uint32_t    AttachToSource(GstBin* bin, GstElement* source, GstElement* buffer, GstElement* demuxer);
 
     uint32_t    CreateAudioPipeline(bool bConvertFormat, CPipelineOptions *pOptions, GstElementContainer* pElements, CPipeline** ppPipeline);
@@ -72,8 +73,9 @@ private:
 
 
     uint32_t    CreateAudioBin(const char* strParserName, const char* strDecoderName, bool bConvertFormat,
-                               GstElementContainer* elements, int* pFlags, GstElement** pAudiobin);
-    uint32_t    CreateVideoBin(const char* strDecoderName, GstElement* pVideoSink,
+                               int audioLatency, bool bFreeRun, GstElementContainer* elements,
+                               int* pFlags, GstElement** pAudiobin);
+    uint32_t    CreateVideoBin(const char* strDecoderName, CPipelineOptions* pOptions, GstElement* pVideoSink,
                                GstElementContainer* elements, GstElement** ppVideobin);
 
     GstElement* CreateElement(const char* strFactoryName);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2010, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2010, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #include "GstVideoFrame.h"
 #include "GstPipelineFactory.h"
 #include <cstring>
+#include <cstdlib>
 #include <jni/Logger.h>
 #include <Common/ProductFlags.h>
 #include <Common/VSMemory.h>
@@ -73,6 +74,236 @@ static GstBuffer *alloc_aligned_buffer(guint size)
     return gst_buffer_new_wrapped_full((GstMemoryFlags)0, alignedData, alignedSize, 0, alignedSize, newData, free_aligned_buffer);
 }
 
+// Number of converted frames kept for reuse, JFXMEDIA_FRAME_POOL_SIZE overrides it
+#define DEFAULT_FRAME_POOL_SIZE 4
+
+G_LOCK_DEFINE_STATIC(frame_pool_lock);
+static GstBufferPool *frame_pool = NULL;
+static guint frame_pool_buffer_size = 0;
+
+static guint get_frame_pool_size()
+{
+    static gsize poolSize = 0;
+
+    if (g_once_init_enter(&poolSize)) {
+        gsize size = DEFAULT_FRAME_POOL_SIZE;
+        const char *value = getenv("JFXMEDIA_FRAME_POOL_SIZE");
+        if (value != NULL) {
+            size = (gsize)strtoul(value, NULL, 10);
+        }
+        // g_once_init_leave() does not accept zero, store the size plus one
+        g_once_init_leave(&poolSize, size + 1);
+    }
+    return (guint)(poolSize - 1);
+}
+
+/*
+ * Returns a 16 byte aligned buffer of the given size for a converted frame.
+ * Buffers come from a pool keyed by the frame size, so that playback does
+ * not allocate and free several megabytes per frame; a buffer goes back to
+ * the pool once the last reference, usually held by NativeVideoBuffer on
+ * the Java side, is released. When all pooled buffers are in use or the
+ * pool is disabled a one-off buffer is allocated.
+ */
+static GstBuffer *alloc_frame_buffer(guint size)
+{
+    GstBuffer *buffer = NULL;
+    guint poolSize = get_frame_pool_size();
+
+    if (poolSize == 0) {
+        return alloc_aligned_buffer(size);
+    }
+
+    G_LOCK(frame_pool_lock);
+    if (frame_pool == NULL || frame_pool_buffer_size != size) {
+        if (frame_pool != NULL) {
+            // Buffers still in use are freed when they are released.
+            gst_buffer_pool_set_active(frame_pool, FALSE);
+            gst_object_unref(frame_pool);
+            frame_pool = NULL;
+        }
+
+        GstBufferPool *pool = gst_buffer_pool_new();
+        GstStructure *config = gst_buffer_pool_get_config(pool);
+        GstAllocationParams params;
+
+        gst_allocation_params_init(&params);
+        params.align = 15;
+        gst_buffer_pool_config_set_params(config, NULL, size, 0, poolSize);
+        gst_buffer_pool_config_set_allocator(config, NULL, &params);
+        if (gst_buffer_pool_set_config(pool, config) && gst_buffer_pool_set_active(pool, TRUE)) {
+            frame_pool = pool;
+            frame_pool_buffer_size = size;
+        } else {
+            gst_object_unref(pool);
+        }
+    }
+
+    if (frame_pool != NULL) {
+        GstBufferPoolAcquireParams acquireParams = { GST_FORMAT_UNDEFINED, 0, 0, GST_BUFFER_POOL_ACQUIRE_FLAG_DONTWAIT };
+        if (gst_buffer_pool_acquire_buffer(frame_pool, &buffer, &acquireParams) != GST_FLOW_OK) {
+            buffer = NULL;
+        }
+    }
+    G_UNLOCK(frame_pool_lock);
+
+    if (buffer == NULL) {
+        buffer = alloc_aligned_buffer(size);
+    }
+    return buffer;
+}
+
+// Frames taller than this are converted in horizontal stripes on several threads
+#define STRIPED_CONVERT_MIN_HEIGHT 1088
+#define STRIPED_CONVERT_MAX_STRIPES 4
+
+typedef struct {
+    CVideoFrame::FrameType destType;
+    bool                   hasAlpha;
+    uint8_t               *dest;
+    int32_t                destStride;
+    int32_t                width;
+    int32_t                height;
+    const uint8_t         *y;
+    const uint8_t         *v;
+    const uint8_t         *u;
+    const uint8_t         *a;
+    int32_t                yStride;
+    int32_t                vStride;
+    int32_t                uStride;
+    int32_t                aStride;
+} YCbCr420pConvertJob;
+
+typedef struct {
+    YCbCr420pConvertJob    job;
+    GMutex                *lock;
+    GCond                 *cond;
+    int                   *pending;
+    int                   *status;
+} YCbCr420pConvertStripe;
+
+static int convert_YCbCr420p(const YCbCr420pConvertJob *job)
+{
+    if (job->destType == CVideoFrame::ARGB) {
+        if (job->hasAlpha) {
+            return ColorConvert_YCbCr420p_to_ARGB32(job->dest, job->destStride,
+                        job->width, job->height, job->y, job->v, job->u, job->a,
+                        job->yStride, job->vStride, job->uStride, job->aStride);
+        }
+        return ColorConvert_YCbCr420p_to_ARGB32_no_alpha(job->dest, job->destStride,
+                    job->width, job->height, job->y, job->v, job->u,
+                    job->yStride, job->vStride, job->uStride);
+    }
+
+    if (job->hasAlpha) {
+        return ColorConvert_YCbCr420p_to_BGRA32(job->dest, job->destStride,
+                    job->width, job->height, job->y, job->v, job->u, job->a,
+                    job->yStride, job->vStride, job->uStride, job->aStride);
+    }
+    return ColorConvert_YCbCr420p_to_BGRA32_no_alpha(job->dest, job->destStride,
+                job->width, job->height, job->y, job->v, job->u,
+                job->yStride, job->vStride, job->uStride);
+}
+
+static void convert_YCbCr420p_stripe(gpointer data, gpointer user_data)
+{
+    YCbCr420pConvertStripe *stripe = (YCbCr420pConvertStripe*)data;
+    int status = convert_YCbCr420p(&stripe->job);
+
+    g_mutex_lock(stripe->lock);
+    if (status != 0)
+        *stripe->status = status;
+    if (--(*stripe->pending) == 0)
+        g_cond_signal(stripe->cond);
+    g_mutex_unlock(stripe->lock);
+}
+
+static GThreadPool *get_convert_pool()
+{
+    static gsize pool = 0;
+
+    if (g_once_init_enter(&pool)) {
+        // The calling thread converts one stripe itself.
+        GThreadPool *newPool = g_thread_pool_new(convert_YCbCr420p_stripe, NULL,
+                                                 STRIPED_CONVERT_MAX_STRIPES - 1, FALSE, NULL);
+        g_once_init_leave(&pool, (gsize)newPool);
+    }
+    return (GThreadPool*)pool;
+}
+
+/*
+ * Converts the frame described by job, splitting frames above 1080p into
+ * stripes of even height on a small thread pool, since a single thread
+ * cannot keep up with 4K playback. Stripe boundaries are multiples of two
+ * rows so that each stripe starts on its own chroma row.
+ */
+static int convert_YCbCr420p_striped(const YCbCr420pConvertJob *job)
+{
+    YCbCr420pConvertStripe stripes[STRIPED_CONVERT_MAX_STRIPES];
+    GThreadPool *pool = NULL;
+    GMutex lock;
+    GCond cond;
+    int numStripes = (int)MIN(g_get_num_processors(), STRIPED_CONVERT_MAX_STRIPES);
+    int pending = 0;
+    int status = 0;
+    int32_t rowsPerStripe;
+    int32_t row = 0;
+    int i;
+
+    if (job->height <= STRIPED_CONVERT_MIN_HEIGHT || numStripes < 2 || (job->height & 1))
+        return convert_YCbCr420p(job);
+
+    pool = get_convert_pool();
+    if (pool == NULL)
+        return convert_YCbCr420p(job);
+
+    rowsPerStripe = ((job->height / numStripes) + 1) & ~1;
+
+    g_mutex_init(&lock);
+    g_cond_init(&cond);
+
+    for (i = 0; i < numStripes && row < job->height; i++) {
+        YCbCr420pConvertJob *stripeJob = &stripes[i].job;
+        int32_t rows = MIN(rowsPerStripe, job->height - row);
+
+        *stripeJob = *job;
+        stripeJob->height = rows;
+        stripeJob->dest = job->dest + (size_t)row * job->destStride;
+        stripeJob->y = job->y + (size_t)row * job->yStride;
+        stripeJob->v = job->v + (size_t)(row / 2) * job->vStride;
+        stripeJob->u = job->u + (size_t)(row / 2) * job->uStride;
+        if (job->a != NULL)
+            stripeJob->a = job->a + (size_t)row * job->aStride;
+
+        stripes[i].lock = &lock;
+        stripes[i].cond = &cond;
+        stripes[i].pending = &pending;
+        stripes[i].status = &status;
+        row += rows;
+    }
+    numStripes = i;
+
+    // Hand all stripes but the last to the pool and convert the last here.
+    g_mutex_lock(&lock);
+    pending = numStripes;
+    g_mutex_unlock(&lock);
+    for (i = 0; i < numStripes - 1; i++) {
+        if (!g_thread_pool_push(pool, &stripes[i], NULL))
+            convert_YCbCr420p_stripe(&stripes[i], NULL);
+    }
+    convert_YCbCr420p_stripe(&stripes[numStripes - 1], NULL);
+
+    g_mutex_lock(&lock);
+    while (pending > 0)
+        g_cond_wait(&cond, &lock);
+    g_mutex_unlock(&lock);
+
+    g_mutex_clear(&lock);
+    g_cond_clear(&cond);
+
+    return status;
+}
+
 GstCaps *create_RGB_caps(CVideoFrame::FrameType type, guint width, guint height, guint encodedWidth, guint encodedHeight, guint stride)
 {
     gint red_mask, green_mask, blue_mask, alpha_mask;
@@ -414,7 +645,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
         return NULL;
     }
 
-    destBuffer = alloc_aligned_buffer(alloc_size);
+    destBuffer = alloc_frame_buffer(alloc_size);
     if (!destBuffer) {
         return NULL;
     }
@@ -431,49 +662,22 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr420p(FrameType destType)
     }
 
     // now do the conversion
-    if (destType == ARGB) {
-        if (m_bHasAlpha) {
-            status = ColorConvert_YCbCr420p_to_ARGB32(
-                        info.data, stride,
-                        m_uiEncodedWidth, m_uiEncodedHeight,
-                        (const uint8_t*)m_pvPlaneData[0],
-                        (const uint8_t*)m_pvPlaneData[v_index],
-                        (const uint8_t*)m_pvPlaneData[u_index],
-                        (const uint8_t*)m_pvPlaneData[3],
-                        m_puiPlaneStrides[0], m_puiPlaneStrides[v_index],
-                        m_puiPlaneStrides[u_index], m_puiPlaneStrides[3]);
-        } else {
-            status = ColorConvert_YCbCr420p_to_ARGB32_no_alpha(
-                        info.data, stride,
-                        m_uiEncodedWidth, m_uiEncodedHeight,
-                        (const uint8_t*)m_pvPlaneData[0],
-                        (const uint8_t*)m_pvPlaneData[v_index],
-                        (const uint8_t*)m_pvPlaneData[u_index],
-                        m_puiPlaneStrides[0], m_puiPlaneStrides[v_index],
-                        m_puiPlaneStrides[u_index]);
-        }
-    } else {
-        if (m_bHasAlpha) {
-            status = ColorConvert_YCbCr420p_to_BGRA32(
-                        info.data, stride,
-                        m_uiEncodedWidth, m_uiEncodedHeight,
-                        (const uint8_t*)m_pvPlaneData[0],
-                        (const uint8_t*)m_pvPlaneData[v_index],
-                        (const uint8_t*)m_pvPlaneData[u_index],
-                        (const uint8_t*)m_pvPlaneData[3],
-                        m_puiPlaneStrides[0], m_puiPlaneStrides[v_index],
-                        m_puiPlaneStrides[u_index], m_puiPlaneStrides[3]);
-        } else {
-            status = ColorConvert_YCbCr420p_to_BGRA32_no_alpha(
-                        info.data, stride,
-                        m_uiEncodedWidth, m_uiEncodedHeight,
-                        (const uint8_t*)m_pvPlaneData[0],
-                        (const uint8_t*)m_pvPlaneData[v_index],
-                        (const uint8_t*)m_pvPlaneData[u_index],
-                        m_puiPlaneStrides[0], m_puiPlaneStrides[v_index],
-                        m_puiPlaneStrides[u_index]);
-        }
-    }
+    YCbCr420pConvertJob job;
+    job.destType = destType;
+    job.hasAlpha = m_bHasAlpha;
+    job.dest = info.data;
+    job.destStride = stride;
+    job.width = m_uiEncodedWidth;
+    job.height = m_uiEncodedHeight;
+    job.y = (const uint8_t*)m_pvPlaneData[0];
+    job.v = (const uint8_t*)m_pvPlaneData[v_index];
+    job.u = (const uint8_t*)m_pvPlaneData[u_index];
+    job.a = m_bHasAlpha ? (const uint8_t*)m_pvPlaneData[3] : NULL;
+    job.yStride = m_puiPlaneStrides[0];
+    job.vStride = m_puiPlaneStrides[v_index];
+    job.uStride = m_puiPlaneStrides[u_index];
+    job.aStride = m_bHasAlpha ? m_puiPlaneStrides[3] : 0;
+    status = convert_YCbCr420p_striped(&job);
 
     gst_buffer_unmap(destBuffer, &info);
 
@@ -545,7 +749,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertFromYCbCr422(FrameType destType)
         return NULL;
     }
 
-    destBuffer = alloc_aligned_buffer(alloc_size);
+    destBuffer = alloc_frame_buffer(alloc_size);
     if (!destBuffer) {
         return NULL;
     }
@@ -626,7 +830,7 @@ CGstVideoFrame *CGstVideoFrame::ConvertSwapRGB(FrameType destType)
 
     size = gst_buffer_get_size(m_pBuffer);
 
-    destBuffer = alloc_aligned_buffer(size);
+    destBuffer = alloc_frame_buffer(size);
     if (!destBuffer) {
         return NULL;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -155,6 +155,13 @@ size_t AVFAudioSpectrumUnit::GetBands() {
     return mBandCount;
 }
 
+CBandsHolder* AVFAudioSpectrumUnit::GetBandsHolder() {
+    lockBands();
+    CBandsHolder *holder = CBandsHolder::AddRef(mBands);
+    unlockBands();
+    return holder;
+}
+
 double AVFAudioSpectrumUnit::GetInterval() {
     return mUpdateInterval;
 }
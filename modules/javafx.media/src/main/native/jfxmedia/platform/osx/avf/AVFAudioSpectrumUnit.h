@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -68,6 +68,7 @@ public:
 
     virtual void SetBands(int bands, CBandsHolder* holder);
     virtual size_t GetBands();
+    virtual CBandsHolder* GetBandsHolder();
 
     virtual double GetInterval();
     virtual void SetInterval(double interval);
@@ -189,6 +189,11 @@ public class JFXPanel extends JComponent {
     @SuppressWarnings("doclint:missing")
     private BufferedImage pixelsIm;
 
+    // Set when the scene uploaded a new frame or pixelsIm was recreated,
+    // so that Swing repaints alone do not copy the unchanged frame again.
+    @SuppressWarnings("doclint:missing")
+    private volatile boolean pixelsDirty = true;
+
     @SuppressWarnings("doclint:missing")
     private volatile float opacity = 1.0f;
 
@@ -751,6 +756,7 @@ public class JFXPanel extends JComponent {
             BufferedImage oldIm = pixelsIm;
             int newPixelW = (int) Math.ceil(pWidth * newScaleFactorX);
             int newPixelH = (int) Math.ceil(pHeight * newScaleFactorY);
+            pixelsDirty = true;
             pixelsIm = new BufferedImage(newPixelW, newPixelH,
                                          SwingFXUtils.getBestBufferedImageType(
                                              scenePeer.getPixelFormat(), null, false));
@@ -813,11 +819,15 @@ public class JFXPanel extends JComponent {
                 return;
             }
         }
-        DataBufferInt dataBuf = (DataBufferInt)pixelsIm.getRaster().getDataBuffer();
-        int[] pixelsData = dataBuf.getData();
-        IntBuffer buf = IntBuffer.wrap(pixelsData);
-        if (!scenePeer.getPixels(buf, pWidth, pHeight)) {
-            // In this case we just render what we have so far in the buffer.
+        if (pixelsDirty) {
+            pixelsDirty = false;
+            DataBufferInt dataBuf = (DataBufferInt)pixelsIm.getRaster().getDataBuffer();
+            int[] pixelsData = dataBuf.getData();
+            IntBuffer buf = IntBuffer.wrap(pixelsData);
+            if (!scenePeer.getPixels(buf, pWidth, pHeight)) {
+                // In this case we just render what we have so far in the buffer.
+                pixelsDirty = true;
+            }
         }
 
         Graphics gg = null;
@@ -1077,6 +1087,7 @@ public class JFXPanel extends JComponent {
 
         @Override
         public void repaint() {
+            pixelsDirty = true;
             invokeOnClientEDT(() -> {
                 JFXPanel.this.repaint();
             });
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -179,6 +179,16 @@ public final class WebPageClientImpl implements WebPageClient<WebView> {
         return backBufferSupported;
     }
 
+    @Override public boolean isPulseDriven() {
+        // WebView updates the page from its stage pulse listener. While the
+        // window is showing, a hidden WebView skips those updates, which
+        // also holds back the rendering updates of its page.
+        WebView view = accessor.getView();
+        Scene scene = (view != null) ? view.getScene() : null;
+        Window window = (scene != null) ? scene.getWindow() : null;
+        return window != null && window.isShowing();
+    }
+
     @Override public void addMessageToConsole(String message, int lineNumber,
                                               String sourceId)
     {
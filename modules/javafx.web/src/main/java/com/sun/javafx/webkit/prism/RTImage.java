@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -51,6 +51,8 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
     private final int width, height;
     private WeakReference<ResourceFactory> registeredWithFactory = null;
     private ByteBuffer pixelBuffer;
+    // The part of [pixelBuffer] that is in sync with [txt]
+    private int validX, validY, validW, validH;
     private float pixelScale;
 
     private final static PlatformLogger log =
@@ -195,6 +197,13 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
 
     @Override
     public ByteBuffer getPixelBuffer() {
+        return getPixelBuffer(0, 0, width, height);
+    }
+
+    // This method is called from native [ImageBufferJavaBackend::getData]
+    // to read back only the part of the image requested by getImageData
+    @Override
+    protected ByteBuffer getPixelBuffer(int x, int y, int w, int h) {
         boolean isNew = false;
         if (pixelBuffer == null) {
             pixelBuffer = ByteBuffer.allocateDirect(width*height*4);
@@ -204,51 +213,108 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
             }
         }
         if (isNew || isDirty()) {
-            PrismInvoker.runOnRenderThread(() -> {
-                final ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
-                if (f == null || f.isDisposed()) {
-                    log.fine("RTImage::getPixelBuffer : skip because device disposed or not ready");
-                    return;
-                }
-                flushRQ();
-                if (txt != null && pixelBuffer != null) {
-                    PixelFormat pf = txt.getPixelFormat();
-                    if (pf != PixelFormat.INT_ARGB_PRE &&
-                        pf != PixelFormat.BYTE_BGRA_PRE) {
+            validW = validH = 0;
+        }
 
-                        throw new AssertionError("Unexpected pixel format: " + pf);
-                    }
+        final int x0 = Math.max(x, 0);
+        final int y0 = Math.max(y, 0);
+        final int x1 = Math.min(x + w, width);
+        final int y1 = Math.min(y + h, height);
+        if (x1 <= x0 || y1 <= y0 || (x0 >= validX && y0 >= validY
+                && x1 <= validX + validW && y1 <= validY + validH)) {
+            return pixelBuffer;
+        }
+        if (validW > 0 && validH > 0) {
+            // Extend the valid region to the bounds of both rectangles
+            readPixelBuffer(Math.min(x0, validX), Math.min(y0, validY),
+                    Math.max(x1, validX + validW), Math.max(y1, validY + validH));
+        } else {
+            readPixelBuffer(x0, y0, x1, y1);
+        }
+        return pixelBuffer;
+    }
 
-                    RTTexture t = txt;
-                    if (pixelScale != 1.0f) {
-                        // Convert [txt] to a texture the size of the image
-                        t = f.createRTTexture(width, height, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                        Graphics g = t.createGraphics();
-                        g.drawTexture(txt, 0, 0, width, height,
-                                0, 0, width * pixelScale, height * pixelScale);
-                    }
+    private void readPixelBuffer(int x0, int y0, int x1, int y1) {
+        final int w = x1 - x0;
+        final int h = y1 - y0;
+        final boolean full = (w == width && h == height);
+        PrismInvoker.runOnRenderThread(() -> {
+            final ResourceFactory f = GraphicsPipeline.getDefaultResourceFactory();
+            if (f == null || f.isDisposed()) {
+                log.fine("RTImage::getPixelBuffer : skip because device disposed or not ready");
+                return;
+            }
+            flushRQ();
+            if (txt != null && pixelBuffer != null) {
+                PixelFormat pf = txt.getPixelFormat();
+                if (pf != PixelFormat.INT_ARGB_PRE &&
+                    pf != PixelFormat.BYTE_BGRA_PRE) {
+
+                    throw new AssertionError("Unexpected pixel format: " + pf);
+                }
+
+                RTTexture t = txt;
+                if (pixelScale != 1.0f || !full) {
+                    // Convert the region of [txt] to a texture the size of the region
+                    t = f.createRTTexture(w, h, Texture.WrapMode.CLAMP_NOT_NEEDED);
+                    Graphics g = t.createGraphics();
+                    g.drawTexture(txt, 0, 0, w, h,
+                            x0 * pixelScale, y0 * pixelScale,
+                            x1 * pixelScale, y1 * pixelScale);
+                }
 
-                    pixelBuffer.rewind();
-                    int[] pixels = t.getPixels();
+                pixelBuffer.rewind();
+                int[] pixels = t.getPixels();
+                if (full) {
                     if (pixels != null) {
                         pixelBuffer.asIntBuffer().put(pixels);
                     } else {
                         t.readPixels(pixelBuffer);
                     }
-
-                    if (t != txt) {
-                        t.dispose();
+                } else {
+                    IntBuffer region = IntBuffer.allocate(w * h);
+                    if (pixels != null) {
+                        region.put(pixels, 0, w * h).rewind();
+                    } else {
+                        t.readPixels(region);
+                    }
+                    IntBuffer dst = pixelBuffer.asIntBuffer();
+                    for (int row = 0; row < h; row++) {
+                        region.limit((row + 1) * w).position(row * w);
+                        dst.position((y0 + row) * width + x0);
+                        dst.put(region);
                     }
                 }
-            });
-        }
-        return pixelBuffer;
+
+                if (t != txt) {
+                    t.dispose();
+                }
+            }
+        });
+        validX = x0;
+        validY = y0;
+        validW = w;
+        validH = h;
     }
 
     // This method is called from native [ImageBufferData::update]
     // while lazy painting procedure
     @Override
     protected void drawPixelBuffer() {
+        drawPixelBuffer(0, 0, width, height);
+    }
+
+    // This method is called from native [ImageBufferJavaBackend::update]
+    // after putImageData to upload only the changed rectangle
+    @Override
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
+        final int x0 = Math.max(x, 0);
+        final int y0 = Math.max(y, 0);
+        final int x1 = Math.min(x + w, width);
+        final int y1 = Math.min(y + h, height);
+        if (x1 <= x0 || y1 <= y0) {
+            return;
+        }
         PrismInvoker.invokeOnRenderThread(new Runnable() {
             @Override
             public void run() {
@@ -261,9 +327,12 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                             pixelBuffer,
                             width,
                             height);
+                    if (x1 - x0 != width || y1 - y0 != height) {
+                        img = img.createSubImage(x0, y0, x1 - x0, y1 - y0);
+                    }
                     Texture txt = g.getResourceFactory().createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                    g.clear();
-                    g.drawTexture(txt, 0, 0, width, height);
+                    g.setCompositeMode(CompositeMode.SRC);
+                    g.drawTexture(txt, x0, y0, x1, y1, 0, 0, x1 - x0, y1 - y0);
                     txt.dispose();
                 }
             }
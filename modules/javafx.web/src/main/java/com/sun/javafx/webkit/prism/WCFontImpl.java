@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,8 @@ import com.sun.webkit.graphics.WCFont;
 import com.sun.webkit.graphics.WCTextRun;
 import java.util.Arrays;
 import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.Map;
 
 final class WCFontImpl extends WCFont {
     private final static PlatformLogger log =
@@ -105,7 +107,51 @@ final class WCFontImpl extends WCFont {
         return strike;
     }
 
+    // Advances of the glyphs mapped by getGlyphCodes, indexed by glyph code.
+    // NaN marks a glyph whose advance is not known yet.
+    private float[] advances;
+
+    private float[] ensureAdvances(int maxGlyph) {
+        int length = advances == null ? 0 : advances.length;
+        if (maxGlyph >= length) {
+            int newLength = Math.max(maxGlyph + 1, Math.max(256, length * 2));
+            advances = (length == 0)
+                    ? new float[newLength]
+                    : Arrays.copyOf(advances, newLength);
+            Arrays.fill(advances, length, newLength, Float.NaN);
+        }
+        return advances;
+    }
+
+    /*
+     * Computes the advances of a whole glyph page at once while its glyph
+     * codes are known, so that the following getGlyphWidth calls for the
+     * page do not go through the font resource one by one.
+     */
+    private void cacheAdvances(int[] glyphs) {
+        int maxGlyph = 0;
+        for (int g : glyphs) {
+            if (g < CharToGlyphMapper.INVISIBLE_GLYPH_ID) {
+                maxGlyph = Math.max(maxGlyph, g);
+            }
+        }
+        float[] cache = ensureAdvances(maxGlyph);
+        FontResource resource = getFontStrike().getFontResource();
+        float size = font.getSize();
+        for (int g : glyphs) {
+            if (g > 0 && g <= maxGlyph && Float.isNaN(cache[g])) {
+                cache[g] = resource.getAdvance(g, size);
+            }
+        }
+    }
+
     @Override public double getGlyphWidth(int glyph) {
+        if (glyph >= 0 && advances != null && glyph < advances.length) {
+            float advance = advances[glyph];
+            if (!Float.isNaN(advance)) {
+                return advance;
+            }
+        }
         return getFontStrike().getFontResource().getAdvance(glyph, font.getSize());
     }
 
@@ -137,6 +183,7 @@ final class WCFontImpl extends WCFont {
             TextUtilities.createLayout(new String(chars), getPlatformFont()).getRuns();
             mapper.charsToGlyphs(chars.length, chars, glyphs);
         }
+        cacheAdvances(glyphs);
         return glyphs;
     }
 
@@ -202,15 +249,34 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getMetrics().getCapHeight();
     }
 
+    // Shaping results of the recently laid out strings of this font.
+    // The same words and labels are laid out over and over during layout
+    // and repaint, so even a small cache avoids most of the shaping.
+    private static final int TEXT_RUN_CACHE_SIZE = 256;
+    private final LinkedHashMap<String, WCTextRun[]> textRunCache =
+            new LinkedHashMap<>(16, 0.75f, true) {
+                @Override
+                protected boolean removeEldestEntry(Map.Entry<String, WCTextRun[]> eldest) {
+                    return size() > TEXT_RUN_CACHE_SIZE;
+                }
+            };
+
     @Override
     public WCTextRun[] getTextRuns(final String str) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format("str='%s' length=%d", str, str.length()));
         }
 
-        final TextLayout layout = TextUtilities.createLayout(str, getPlatformFont());
-        return Arrays.stream(layout.getRuns())
-                     .map(WCTextRunImpl::new)
-                     .toArray(WCTextRunImpl[]::new);
+        synchronized (textRunCache) {
+            WCTextRun[] runs = textRunCache.get(str);
+            if (runs == null) {
+                final TextLayout layout = TextUtilities.createLayout(str, getPlatformFont());
+                runs = Arrays.stream(layout.getRuns())
+                             .map(WCTextRunImpl::new)
+                             .toArray(WCTextRunImpl[]::new);
+                textRunCache.put(str, runs);
+            }
+            return runs;
+        }
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -865,6 +865,48 @@ class WCGraphicsPrismContext extends WCGraphicsContext {
         }
     }
 
+    @Override
+    public void drawImages(final WCImage img, final float[] rects) {
+        int op = state.getCompositeOperation();
+        if (!(img instanceof PrismImage)
+                || state.getShadowNoClone() != null
+                || (op != COMPOSITE_COPY && op != COMPOSITE_SOURCE_OVER)) {
+            // Shadows and blending are applied to every draw on its own.
+            for (int i = 0; i < rects.length; i += 8) {
+                drawImage(img,
+                          rects[i], rects[i + 1], rects[i + 2], rects[i + 3],
+                          rects[i + 4], rects[i + 5], rects[i + 6], rects[i + 7]);
+            }
+            return;
+        }
+        // Keep the visible draws only.
+        int length = 0;
+        for (int i = 0; i < rects.length; i += 8) {
+            if (shouldRenderRect(rects[i], rects[i + 1], rects[i + 2], rects[i + 3], null, null)) {
+                System.arraycopy(rects, i, rects, length, 8);
+                length += 8;
+            }
+        }
+        if (length == 0) {
+            return;
+        }
+        final int visibleLength = length;
+        // Draw the whole run within one composite, so that Prism can batch
+        // the consecutive draws of the same texture.
+        new Composite() {
+            @Override void doPaint(Graphics g) {
+                PrismImage pi = (PrismImage) img;
+                for (int i = 0; i < visibleLength; i += 8) {
+                    pi.draw(g,
+                            (int) rects[i], (int) rects[i + 1],
+                            (int) (rects[i] + rects[i + 2]), (int) (rects[i + 1] + rects[i + 3]),
+                            (int) rects[i + 4], (int) rects[i + 5],
+                            (int) (rects[i + 4] + rects[i + 6]), (int) (rects[i + 5] + rects[i + 7]));
+                }
+            }
+        }.paint();
+    }
+
     @Override
     public void drawBitmapImage(final ByteBuffer image, final int x, final int y, final int w, final int h) {
         if (!shouldRenderRect(x, y, w, h, null, null)) {
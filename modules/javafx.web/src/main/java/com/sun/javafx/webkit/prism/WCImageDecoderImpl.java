@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,7 +40,12 @@ import com.sun.webkit.graphics.WCImageFrame;
 import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
-import java.util.Arrays;
+import java.nio.ByteBuffer;
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
@@ -48,10 +53,22 @@ final class WCImageDecoderImpl extends WCImageDecoder {
 
     private final static PlatformLogger log;
 
+    // Decodes complete images in the background so that the frames are
+    // usually ready by the time the image is painted on the Event thread.
+    private final static ExecutorService decodeExecutor =
+            Executors.newFixedThreadPool(
+                    Math.max(1, Runtime.getRuntime().availableProcessors() / 2),
+                    r -> {
+                        Thread t = new Thread(r, "WebKit Image Decoder");
+                        t.setDaemon(true);
+                        return t;
+                    });
+
     private Service<ImageFrame[]> loader;
+    private Future<ImageFrame[]> pendingDecode;
 
-    private int imageWidth = 0;
-    private int imageHeight = 0;
+    private volatile int imageWidth = 0;
+    private volatile int imageHeight = 0;
     private ImageFrame[] frames;
     private int frameCount = 0; // keeps frame count when decoded frames are temporarily destroyed
     private boolean fullDataReceived = false;
@@ -59,7 +76,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     private PrismImage[] images;
     private volatile byte[] data;
     private volatile int dataSize = 0;
-    private String fileNameExtension;
+    private volatile String fileNameExtension;
 
     static {
         log = PlatformLogger.getLogger(WCImageDecoderImpl.class.getName());
@@ -77,11 +94,29 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
 
         destroyLoader();
+        cancelPendingDecode();
         frames = null;
         images = null;
         framesDecoded = false;
     }
 
+    @Override protected synchronized void destroyDecodedData(int keepIndex) {
+        if (log.isLoggable(Level.FINE)) {
+            log.fine(String.format("%X Destroy decoded data but frame %d", hashCode(), keepIndex));
+        }
+
+        // The frames of an image are decoded together, so their rasters
+        // stay until the decoder is destroyed. Their Prism images are
+        // converted from the rasters again when the frames are requested.
+        if (images != null) {
+            for (int i = 0; i < images.length; i++) {
+                if (i != keepIndex) {
+                    images[i] = null;
+                }
+            }
+        }
+    }
+
     @Override protected String getFilenameExtension() {
         return "." + fileNameExtension;
     }
@@ -90,20 +125,18 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    @Override protected void addImageData(ByteBuffer dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
+            int length = dataPortion.remaining();
             if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
-            } else {
-                int newDataSize = dataSize + dataPortion.length;
-                if (newDataSize > data.length) {
-                    resizeDataArray(Math.max(newDataSize, data.length * 2));
-                }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
-                dataSize = newDataSize;
+                data = new byte[length * 2];
+            } else if (dataSize + length > data.length) {
+                resizeDataArray(Math.max(dataSize + length, data.length * 2));
             }
+            // Copy straight from the native buffer, it is not valid after return
+            dataPortion.get(data, dataSize, length);
+            dataSize += length;
             // Try to decode the partial data until we get image size.
             if (!imageSizeAvilable()) {
                 loadFrames();
@@ -114,9 +147,45 @@ final class WCImageDecoderImpl extends WCImageDecoder {
                 resizeDataArray(dataSize);
             }
             fullDataReceived = true;
+            startPendingDecode();
+        }
+    }
+
+    private synchronized void startPendingDecode() {
+        if (pendingDecode == null && !framesDecoded) {
+            final byte[] fullData = data;
+            final int fullDataSize = dataSize;
+            pendingDecode = decodeExecutor.submit(() -> decodeFrames(
+                    new ByteArrayInputStream(fullData, 0, fullDataSize)));
         }
     }
 
+    private synchronized void cancelPendingDecode() {
+        if (pendingDecode != null) {
+            pendingDecode.cancel(false);
+            pendingDecode = null;
+        }
+    }
+
+    /*
+     * Returns the frames decoded in the background, or decodes them
+     * on the calling thread if there is no background decode.
+     */
+    private synchronized ImageFrame[] takeDecodedFrames() {
+        Future<ImageFrame[]> decode = pendingDecode;
+        pendingDecode = null;
+        if (decode != null) {
+            try {
+                return decode.get();
+            } catch (InterruptedException e) {
+                Thread.currentThread().interrupt();
+            } catch (CancellationException | ExecutionException e) {
+                // fall through to decode on this thread
+            }
+        }
+        return loadFrames();
+    }
+
     private void destroyLoader() {
         if (loader != null) {
             loader.cancel();
@@ -174,6 +243,11 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     }
 
     private synchronized ImageFrame[] loadFrames(InputStream in) {
+        return decodeFrames(in);
+    }
+
+    // Not synchronized, as it is also called from the decode executor
+    private ImageFrame[] decodeFrames(InputStream in) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format("%X Decoding frames", hashCode()));
         }
@@ -331,7 +405,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
             startLoader();
         } else if (fullDataReceived && !framesDecoded) {
             destroyLoader();
-            setFrames(loadFrames()); // re-decode frames if they have been destroyed
+            setFrames(takeDecodedFrames()); // re-decode frames if they have been destroyed
             framesDecoded = true;
         }
         return (idx >= 0) && (this.frames != null) && (this.frames.length > idx)
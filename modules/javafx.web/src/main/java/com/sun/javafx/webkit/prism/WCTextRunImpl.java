@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,4 +78,39 @@ public final class WCTextRunImpl implements WCTextRun {
     public int getCharOffset(int index) {
         return run.getCharOffset(index);
     }
+
+    // Runs are cached by WCFontImpl, so the bulk arrays are kept once built
+    private int[] glyphsAndCharOffsets;
+    private float[] positionsAndAdvances;
+
+    @Override
+    public synchronized int[] getGlyphsAndCharOffsets() {
+        if (glyphsAndCharOffsets == null) {
+            int count = run.getGlyphCount();
+            int[] data = new int[2 * count];
+            for (int i = 0; i < count; i++) {
+                data[2 * i] = run.getGlyphCode(i);
+                data[2 * i + 1] = run.getCharOffset(i);
+            }
+            glyphsAndCharOffsets = data;
+        }
+        return glyphsAndCharOffsets;
+    }
+
+    @Override
+    public synchronized float[] getGlyphPositionsAndAdvances() {
+        if (positionsAndAdvances == null) {
+            int count = run.getGlyphCount();
+            float[] data = new float[4 * count];
+            for (int i = 0; i < count; i++) {
+                data[4 * i] = run.getPosX(i);
+                data[4 * i + 1] = run.getPosY(i);
+                data[4 * i + 2] = run.getAdvance(i);
+                // FIXME: We don't yet support Y advance from prism.
+                data[4 * i + 3] = 0;
+            }
+            positionsAndAdvances = data;
+        }
+        return positionsAndAdvances;
+    }
 }
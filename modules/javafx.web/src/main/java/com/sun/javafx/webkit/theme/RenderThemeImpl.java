@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -235,6 +235,8 @@ public final class RenderThemeImpl extends RenderTheme {
         pool = new Pool<>(fc -> {
             // Remove the control from WebView when it's removed from the pool.
             accessor.removeChild(fc.asControl());
+            // Widgets cached natively may refer to the removed control.
+            widgetGeneration++;
         }, FormControl.class);
         accessor.addViewListener(new ViewListener(pool, accessor));
     }
@@ -267,6 +269,7 @@ public final class RenderThemeImpl extends RenderTheme {
             if (fc  != null) {
                 // Remove the unmatching control.
                 accessor.removeChild(fc.asControl());
+                widgetGeneration++;
             }
             switch (type) {
                 case TEXTFIELD:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,11 +39,6 @@ import java.nio.file.Paths;
 
 final class FileSystem {
 
-    // File type should match native FileMetadata Type
-    private static final int TYPE_UNKNOWN = 0;
-    private static final int TYPE_FILE = 1;
-    private static final int TYPE_DIRECTORY = 2;
-
     private final static PlatformLogger logger =
             PlatformLogger.getLogger(FileSystem.class.getName());
 
@@ -52,10 +47,6 @@ final class FileSystem {
         throw new AssertionError();
     }
 
-    private static boolean fwkFileExists(String path) {
-        return new File(path).exists();
-    }
-
     private static RandomAccessFile fwkOpenFile(String path, String mode) {
         try {
             return new RandomAccessFile(path, mode);
@@ -91,39 +82,6 @@ final class FileSystem {
         }
     }
 
-    private static long fwkGetFileSize(String path) {
-        try {
-            File file = new File(path);
-            if (file.exists()) {
-                return file.length();
-            }
-        } catch (SecurityException ex) {
-            logger.fine(format("Error determining size of file [%s]", path), ex);
-        }
-        return -1;
-    }
-
-    private static boolean fwkGetFileMetadata(String path, long[] metadataArray) {
-        try {
-            File file = new File(path);
-            if (file.exists()) {
-                metadataArray[0] = file.lastModified();
-                metadataArray[1] = file.length();
-                if (file.isDirectory()) {
-                    metadataArray[2] = TYPE_DIRECTORY;
-                } else if (file.isFile()) {
-                    metadataArray[2] = TYPE_FILE;
-                } else {
-                    metadataArray[2] = TYPE_UNKNOWN;
-                }
-                return true;
-            }
-        } catch (SecurityException ex) {
-            logger.fine(format("Error determining Metadata for file [%s]", path), ex);
-        }
-        return false;
-    }
-
     private static String fwkPathByAppendingComponent(String path,
                                                       String component)
     {
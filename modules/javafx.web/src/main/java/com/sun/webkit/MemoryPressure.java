@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+import java.lang.ref.SoftReference;
+
+/**
+ * Releases the WebCore and JavaScriptCore caches when memory gets low.
+ *
+ * The native monitor listens to the pressure stall information of the
+ * cgroup on Linux and to the low memory notification on Windows. The
+ * Java heap is watched with a softly reachable sentinel object, which the
+ * JVM clears sooner the less free heap is left.
+ */
+public final class MemoryPressure {
+
+    private static final boolean monitorEnabled = Boolean.valueOf(
+            System.getProperty("com.sun.webkit.memoryPressureMonitor", "true"));
+
+    // Fraction of the maximum heap above which the heap pressure is
+    // treated as critical.
+    private static final double CRITICAL_HEAP_USAGE = 0.9;
+
+    private static boolean installed;
+    private static SoftReference<Object> heapSentinel;
+
+    private MemoryPressure() {
+    }
+
+    /**
+     * Releases cached memory. A non-critical release drops the caches that
+     * are cheap to rebuild, a critical one also drops the decoded resources
+     * of the memory cache, the back/forward cache and compiled JavaScript
+     * code and collects the JavaScript heap.
+     *
+     * May be called on any thread; the release happens on the event thread.
+     *
+     * @param critical whether to release as much memory as possible
+     */
+    public static void releaseMemory(boolean critical) {
+        Invoker.getInvoker().invokeOnEventThread(() -> twkReleaseMemory(critical));
+    }
+
+    // Called on the event thread once the first page exists and WebCore
+    // is ready to take work from other threads.
+    static void install() {
+        Invoker.getInvoker().checkEventThread();
+        if (installed || !monitorEnabled) {
+            return;
+        }
+        installed = true;
+        twkStartMonitor();
+        watchHeap();
+    }
+
+    private static void watchHeap() {
+        Object sentinel = new Object();
+        heapSentinel = new SoftReference<>(sentinel);
+        Disposer.addRecord(sentinel, MemoryPressure::heapSentinelCleared);
+    }
+
+    private static void heapSentinelCleared() {
+        Runtime runtime = Runtime.getRuntime();
+        double used = runtime.totalMemory() - runtime.freeMemory();
+        twkHeapPressure(used > CRITICAL_HEAP_USAGE * runtime.maxMemory());
+        watchHeap();
+    }
+
+    private static native void twkStartMonitor();
+    private static native void twkHeapPressure(boolean critical);
+    private static native void twkReleaseMemory(boolean critical);
+}
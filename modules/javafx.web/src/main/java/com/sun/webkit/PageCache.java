@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -38,6 +38,8 @@ public final class PageCache {
     }
 
 
+    private static boolean capacitySet;
+
     /**
      * Returns the capacity of the page cache.
      * @return the current capacity of the page cache, in pages.
@@ -56,9 +58,30 @@ public final class PageCache {
             throw new IllegalArgumentException(
                     "capacity is negative:" + capacity);
         }
+        capacitySet = true;
         twkSetCapacity(capacity);
     }
 
+    /**
+     * Returns the number of pages currently held in the page cache.
+     * @return the number of cached pages.
+     */
+    public static int getPageCount() {
+        return twkGetPageCount();
+    }
+
+    /**
+     * Sizes the page cache according to the physical memory of the
+     * machine unless the capacity has been set explicitly.
+     */
+    static void initDefaultCapacity() {
+        if (!capacitySet) {
+            twkSetCapacity(twkGetDefaultCapacity());
+        }
+    }
+
     native private static int twkGetCapacity();
     native private static void twkSetCapacity(int capacity);
+    native private static int twkGetDefaultCapacity();
+    native private static int twkGetPageCount();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,14 +40,26 @@ import com.sun.webkit.event.WCMouseWheelEvent;
 import com.sun.webkit.graphics.*;
 import com.sun.webkit.network.CookieManager;
 import static com.sun.webkit.network.URLs.newURL;
+import java.io.IOException;
 import java.net.CookieHandler;
 import java.net.MalformedURLException;
 import java.net.URL;
+import java.nio.BufferOverflowException;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
+import java.nio.IntBuffer;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.InvalidPathException;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.HashSet;
+import java.util.HexFormat;
 import java.util.Iterator;
 import java.util.LinkedList;
 import java.util.List;
@@ -152,6 +164,27 @@ public final class WebPage {
         // Initialize WTF, WebCore and JavaScriptCore.
         twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
 
+        // Capacity of the memory cache in megabytes. It bounds the decoded
+        // image data held for the resources of the loaded pages.
+        final long memoryCacheSize = Long.getLong("com.sun.webkit.memoryCacheSize", 0);
+        if (memoryCacheSize > 0) {
+            twkSetMemoryCacheCapacity(memoryCacheSize * 1024 * 1024);
+        }
+
+        // Bytecode of large scripts is kept in this directory across runs.
+        // The directory is owned by the application, which is expected to
+        // clear it as needed.
+        final String bytecodeCacheDirectory = System.getProperty(
+                "com.sun.webkit.bytecodeCacheDirectory");
+        if (bytecodeCacheDirectory != null && !bytecodeCacheDirectory.isEmpty()) {
+            try {
+                Path directory = Files.createDirectories(Paths.get(bytecodeCacheDirectory));
+                twkSetBytecodeCacheDirectory(directory.toAbsolutePath().toString());
+            } catch (IOException | InvalidPathException ex) {
+                log.warning("Unable to use bytecode cache directory " + bytecodeCacheDirectory, ex);
+            }
+        }
+
         // Inform the native webkit code when either the JVM or the
         // JavaFX runtime is being shutdown
         final Runnable shutdownHook = () -> {
@@ -167,6 +200,141 @@ public final class WebPage {
 
     private static boolean firstWebPageCreated = false;
 
+    /**
+     * Returns statistics of the JavaScriptCore collections run so far as
+     * {@code {edenCollections, fullCollections, totalMillis, lastMillis,
+     * maxMillis, lastEndMillis}}. JavaScriptCore shares one heap between
+     * all pages. {@code lastEndMillis} is wall clock time since the epoch,
+     * so that collections can be correlated with the JVM GC log. The heap
+     * itself is tuned with the {@code jscOptions} preference, for example
+     * {@code "numberOfGCMarkers=2 useConcurrentGC=false"}.
+     */
+    public static double[] getJSGCStatistics() {
+        return twkGetJSGCStatistics();
+    }
+
+    /**
+     * Returns the JavaScriptCore execution tiers in use, separated by
+     * spaces: {@code CLoop} or {@code LLInt}, followed by {@code Baseline},
+     * {@code DFG} and {@code FTL} for the JIT tiers that are both built in
+     * and enabled. The JIT is disabled at run time when executable memory
+     * cannot be allocated, or with the {@code jscOptions} preference.
+     */
+    public static String getJSCTiers() {
+        return twkGetJSCTiers();
+    }
+
+    /**
+     * Returns where the native memory of WebKit goes as
+     * {@code {footprintBytes, jsHeapBytes, jsHeapCapacityBytes,
+     * jsExtraBytes, memoryCacheBytes, imageCacheBytes, decodedImageBytes,
+     * fontCount, inactiveFontCount, backForwardCachePages, renderingQueues,
+     * renderingQueueBufferBytes}}. The footprint is the dirty memory of the
+     * whole process as seen by the OS, the other values are the parts of it
+     * owned by JavaScriptCore and the WebCore caches, which are shared by
+     * all pages. The caches are dropped with
+     * {@link MemoryPressure#releaseMemory}.
+     *
+     * Executed on the Event Thread.
+     */
+    public static long[] getMemoryStatistics() {
+        Invoker.getInvoker().checkEventThread();
+        return twkGetMemoryStatistics();
+    }
+
+    /**
+     * Starts or stops recording trace events of all pages into a ring
+     * buffer that keeps the most recent events. Starting discards the
+     * events recorded before.
+     */
+    public static void setTracingEnabled(boolean enabled) {
+        twkSetTracingEnabled(enabled);
+    }
+
+    /**
+     * Returns the recorded trace events in the Chrome trace event format,
+     * which can be loaded into chrome://tracing or Perfetto. Style
+     * recalculation, layout, painting, JavaScript execution and
+     * RenderingQueue flushes are recorded, together with a counter of
+     * the JNI upcalls made in between.
+     */
+    public static String getTraceEvents() {
+        return twkGetTraceEvents();
+    }
+
+    /**
+     * Compiles a content rule list in the WebKit content blocker JSON
+     * format and applies it to the loads of all pages, replacing the rule
+     * list with the same identifier. Blocked resources are never requested.
+     * If the {@code com.sun.webkit.contentRuleListCacheDirectory} property
+     * is set, the compiled rules are kept in that directory and reused
+     * instead of compiling the same rules again.
+     *
+     * @throws IllegalArgumentException if the rules cannot be compiled
+     */
+    public static void addContentRuleList(String identifier, String json) {
+        Invoker.getInvoker().checkEventThread();
+        final Path cacheFile = contentRuleListCacheFile(json);
+        if (cacheFile != null && Files.isRegularFile(cacheFile)) {
+            try {
+                if (twkAddContentRuleList(identifier, Files.readAllBytes(cacheFile))) {
+                    return;
+                }
+            } catch (IOException ex) {
+                log.fine("Unable to read content rule list cache " + cacheFile, ex);
+            }
+        }
+
+        final byte[] compiled = twkCompileContentRuleList(json);
+        if (cacheFile != null) {
+            // Write next to the final name and move it into place, so that
+            // a concurrent reader never sees a partially written file.
+            try {
+                Path directory = Files.createDirectories(cacheFile.getParent());
+                Path temporaryFile = Files.createTempFile(directory, "rules", ".tmp");
+                Files.write(temporaryFile, compiled);
+                Files.move(temporaryFile, cacheFile, StandardCopyOption.REPLACE_EXISTING);
+            } catch (IOException ex) {
+                log.fine("Unable to write content rule list cache " + cacheFile, ex);
+            }
+        }
+        twkAddContentRuleList(identifier, compiled);
+    }
+
+    /**
+     * Removes the content rule list added with the given identifier.
+     */
+    public static void removeContentRuleList(String identifier) {
+        Invoker.getInvoker().checkEventThread();
+        twkRemoveContentRuleList(identifier);
+    }
+
+    private static Path contentRuleListCacheFile(String json) {
+        final String directory = System.getProperty(
+                "com.sun.webkit.contentRuleListCacheDirectory");
+        if (directory == null || directory.isEmpty()) {
+            return null;
+        }
+        // The name covers the runtime version, whose native code may
+        // compile the same rules differently, and the whole rule text.
+        final MessageDigest digest;
+        try {
+            digest = MessageDigest.getInstance("SHA-256");
+        } catch (NoSuchAlgorithmException ex) {
+            return null;
+        }
+        digest.update(System.getProperty("javafx.runtime.version", "")
+                .getBytes(StandardCharsets.UTF_8));
+        digest.update((byte) 0);
+        digest.update(json.getBytes(StandardCharsets.UTF_8));
+        try {
+            return Paths.get(directory, HexFormat.of().formatHex(digest.digest()) + ".rules");
+        } catch (InvalidPathException ex) {
+            log.warning("Unable to use content rule list cache directory " + directory, ex);
+            return null;
+        }
+    }
+
     private static void collectJSCGarbages() {
         Invoker.getInvoker().checkEventThread();
         // Add dummy object to get notification as soon as it is collected
@@ -211,6 +379,8 @@ public final class WebPage {
             // Add dummy object to get notification as soon as it is collected
             // by the JVM GC.
             Disposer.addRecord(new Object(), WebPage::collectJSCGarbages);
+            MemoryPressure.install();
+            PageCache.initDefaultCapacity();
             firstWebPageCreated = true;
         }
     }
@@ -239,6 +409,11 @@ public final class WebPage {
     private WCPageBackBuffer backbuffer;
     private List<WCRectangle> dirtyRects = new LinkedList<>();
 
+    // Set when WebCore asked for a rendering update, which then runs from
+    // the next updateContent so that requestAnimationFrame callbacks follow
+    // the pulse of the view.
+    private boolean renderingUpdateRequested;
+
     private void addDirtyRect(WCRectangle toPaint) {
         if (toPaint.getWidth() <= 0 || toPaint.getHeight() <= 0) {
             return;
@@ -271,7 +446,7 @@ public final class WebPage {
     public boolean isDirty() {
         lockPage();
         try {
-            return !dirtyRects.isEmpty();
+            return !dirtyRects.isEmpty() || renderingUpdateRequested;
         } finally {
             unlockPage();
         }
@@ -644,6 +819,7 @@ public final class WebPage {
                 return;
             }
             updateDirty(toPaint);
+            renderingUpdateRequested = false;
             updateRendering();
         } finally {
             unlockPage();
@@ -699,6 +875,52 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Lays out and paints the given rectangle of the page into {@code dest}
+     * as premultiplied ARGB pixels, {@code h} rows of {@code w} pixels.
+     * Unlike {@link #paint} this needs neither a WebView in a scene nor a
+     * pulse, so a page sized with {@link #setBounds} can be rendered to an
+     * image by a headless application.
+     *
+     * Executed on the Event Thread.
+     */
+    public void renderOffscreen(int x, int y, int w, int h, IntBuffer dest) {
+        Invoker.getInvoker().checkEventThread();
+        if (w <= 0 || h <= 0) {
+            throw new IllegalArgumentException("size must be positive");
+        }
+        if (dest.remaining() < (long) w * h) {
+            throw new BufferOverflowException();
+        }
+        lockPage();
+        try {
+            if (isDisposed) {
+                throw new IllegalStateException("Web page is disposed");
+            }
+            updateRendering();
+            twkPrePaint(getPage());
+
+            final WCImage image = WCGraphicsManager.getGraphicsManager()
+                    .createOffscreenImage(w, h);
+            image.ref();
+            try {
+                twkPaintOffscreen(getPage(), image.getRQ(), x, y, w, h);
+                // Decodes the render queue into the image on the render
+                // thread and reads the pixels back.
+                ByteBuffer pixels = image.getPixelBuffer();
+                if (pixels == null) {
+                    throw new IllegalStateException("Graphics device is not available");
+                }
+                pixels.rewind();
+                dest.put(pixels.asIntBuffer());
+            } finally {
+                image.deref();
+            }
+        } finally {
+            unlockPage();
+        }
+    }
+
     /*
      * Executed on the Render Thread.
      */
@@ -2150,6 +2372,21 @@ public final class WebPage {
         }
     }
 
+    private boolean fwkScheduleRenderingUpdate() {
+        // Without a showing view there are no pulses to align the update
+        // with, let WebCore run it right away.
+        if (pageClient == null || !pageClient.isPulseDriven()) {
+            return false;
+        }
+        lockPage();
+        try {
+            renderingUpdateRequested = true;
+        } finally {
+            unlockPage();
+        }
+        return true;
+    }
+
     private void fwkScroll(int x, int y, int w, int h, int deltaX, int deltaY) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Scroll: " + x + " " + y + " " + w + " " + h + "  " + deltaX + " " + deltaY);
@@ -2523,6 +2760,16 @@ public final class WebPage {
 
     private static native int twkWorkerThreadCount();
 
+    /**
+     * Returns the CPU time in milliseconds used by Web Worker threads
+     * that have already exited.
+     */
+    public static double getExitedWorkerThreadsCPUTime() {
+        return twkExitedWorkerThreadsCPUTime();
+    }
+
+    private static native double twkExitedWorkerThreadsCPUTime();
+
     private void fwkDidClearWindowObject(long pContext, long pWindowObject) {
         if (pageClient != null) {
             pageClient.didClearWindowObject(pContext, pWindowObject);
@@ -2595,6 +2842,8 @@ public final class WebPage {
     // *************************************************************************
 
     private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkSetMemoryCacheCapacity(long capacity);
+    private static native void twkSetBytecodeCacheDirectory(String directory);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2655,6 +2904,8 @@ public final class WebPage {
     private native void twkPrePaint(long pPage);
     private native void twkUpdateContent(long pPage, WCRenderQueue rq, int x, int y, int w, int h);
     private native void twkUpdateRendering(long pPage);
+    private native void twkPaintOffscreen(long pPage, WCRenderQueue rq,
+                                          int x, int y, int w, int h);
     private native void twkPostPaint(long pPage, WCRenderQueue rq,
                                      int x, int y, int w, int h);
 
@@ -2724,4 +2975,13 @@ public final class WebPage {
     private native void twkDispatchInspectorMessageFromFrontend(long pPage,
                                                                 String message);
     private static native void twkDoJSCGarbageCollection();
+    private static native String twkGetJSCTiers();
+    private static native double[] twkGetJSGCStatistics();
+    private static native long[] twkGetMemoryStatistics();
+    private static native void twkSetTracingEnabled(boolean enabled);
+    private static native String twkGetTraceEvents();
+    private static native byte[] twkCompileContentRuleList(String json);
+    private static native boolean twkAddContentRuleList(String identifier,
+                                                        byte[] compiled);
+    private static native void twkRemoveContentRuleList(String identifier);
 }
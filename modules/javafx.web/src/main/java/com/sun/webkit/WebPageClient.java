@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2014, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,15 @@ public interface WebPageClient<T> {
 
     public boolean isBackBufferSupported();
 
+    /**
+     * @return {@code true} if the container updates the page on every pulse
+     *         while it is showing, so that rendering updates can wait
+     *         for the next pulse
+     */
+    public default boolean isPulseDriven() {
+        return false;
+    }
+
     public void addMessageToConsole(String message, int lineNumber,
                                     String sourceId);
 
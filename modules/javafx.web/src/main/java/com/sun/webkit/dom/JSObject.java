@@ -123,6 +123,29 @@ class JSObject extends netscape.javascript.JSObject {
                                            int index, Object value,
                                            Object acc);
 
+    @Override
+    public Object[] getSlots(int index, int count) throws JSException {
+        Invoker.getInvoker().checkEventThread();
+        if (count < 0) {
+            throw new IllegalArgumentException("count must not be negative");
+        }
+        return getSlotsImpl(peer, peer_type, index, count);
+    }
+    private static native Object[] getSlotsImpl(long peer, int peer_type,
+                                                int index, int count);
+
+    @Override
+    public void setSlots(int index, Object... values) throws JSException {
+        Invoker.getInvoker().checkEventThread();
+        if (values == null) {
+            throw new NullPointerException("values");
+        }
+        setSlotsImpl(peer, peer_type, index, values, DUMMY_ACC);
+    }
+    private static native void setSlotsImpl(long peer, int peer_type,
+                                            int index, Object[] values,
+                                            Object acc);
+
     @Override
     public Object call(String methodName, Object... args) throws JSException {
         Invoker.getInvoker().checkEventThread();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import com.sun.prism.paint.Color;
 import java.lang.annotation.Native;
 import java.nio.ByteBuffer;
 import java.nio.ByteOrder;
+import java.util.Arrays;
 
 public final class GraphicsDecoder  {
     @Native public final static int FILLRECT_FFFFI         = 0;
@@ -86,6 +87,8 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    @Native public final static int FILLRECTS_FFFFI        = 57;
+    @Native public final static int DRAWIMAGES             = 58;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
@@ -119,6 +122,9 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         getColor(buf));
                     break;
+                case FILLRECTS_FFFFI:
+                    fillRects(gc, buf);
+                    break;
                 case FILL_ROUNDED_RECT:
                     gc.fillRoundedRect(
                         // base rectangle
@@ -201,6 +207,9 @@ public final class GraphicsDecoder  {
                         buf.getFloat(),
                         buf.getFloat());
                     break;
+                case DRAWIMAGES:
+                    drawImages(gc, gm.getRef(buf.getInt()), buf);
+                    break;
                 case DRAWICON:
                     gc.drawIcon((WCIcon)gm.getRef(buf.getInt()),
                         buf.getInt(),
@@ -448,6 +457,28 @@ public final class GraphicsDecoder  {
         }
     }
 
+    private static void drawImages(WCGraphicsContext gc, Object imgFrame, ByteBuffer buf) {
+        // dst and src rectangles of the first image, then the count and
+        // the rectangles of the following images
+        float[] rects = new float[8];
+        buf.asFloatBuffer().get(rects);
+        buf.position(buf.position() + 8 * Float.BYTES);
+        int count = buf.getInt();
+        rects = Arrays.copyOf(rects, 8 * (count + 1));
+        buf.asFloatBuffer().get(rects, 8, 8 * count);
+        buf.position(buf.position() + 8 * count * Float.BYTES);
+
+        WCImage img = WCImage.getImage(imgFrame);
+        if (img != null) {
+            // JDK-8111480: see drawImage
+            try {
+                gc.drawImages(img, rects);
+            } catch (OutOfMemoryError error) {
+                error.printStackTrace();
+            }
+        }
+    }
+
     private static boolean getBoolean(ByteBuffer buf) {
         return 0 != buf.getInt();
     }
@@ -478,6 +509,24 @@ public final class GraphicsDecoder  {
                                buf.getFloat());
     }
 
+    private static void fillRects(WCGraphicsContext gc, ByteBuffer buf) {
+        float x = buf.getFloat();
+        float y = buf.getFloat();
+        float w = buf.getFloat();
+        float h = buf.getFloat();
+        Color color = getColor(buf);
+        gc.fillRect(x, y, w, h, color);
+        int count = buf.getInt();
+        for (int i = 0; i < count; i++) {
+            gc.fillRect(
+                buf.getFloat(),
+                buf.getFloat(),
+                buf.getFloat(),
+                buf.getFloat(),
+                color);
+        }
+    }
+
     private static Color getColor(ByteBuffer buf) {
         return new Color(buf.getFloat(),
                          buf.getFloat(),
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,6 +52,12 @@ public abstract class RenderTheme extends Ref {
     @Native public static final int BACKGROUND = 0;
     @Native public static final int FOREGROUND = 1;
 
+    // Widgets returned by createWidget are cached natively and drawn again
+    // without calling createWidget while their parameters do not change.
+    // Increment this whenever previously created widgets may no longer be
+    // drawn, for example because their controls were released.
+    protected int widgetGeneration;
+
     protected abstract Ref createWidget(long id, int widgetIndex, int state, int w, int h, int bgColor, ByteBuffer extParams);
 
     public abstract void drawWidget(WCGraphicsContext g, Ref widget, int x, int y);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -77,6 +77,12 @@ public abstract class WCGraphicsContext {
                           float dstx, float dsty, float dstw, float dsth,
                           float srcx, float srcy, float srcw, float srch);
 
+    /**
+     * Draws the image several times. {@code rects} holds eight values per
+     * draw in the order of the {@link #drawImage} arguments.
+     */
+    public abstract void drawImages(WCImage img, float[] rects);
+
     public abstract void drawIcon(WCIcon icon, int x, int y);
 
     public abstract void drawPattern(WCImage texture, WCRectangle srcRect,
@@ -94,6 +94,16 @@ public abstract class WCGraphicsManager {
 
     protected abstract WCImage createRTImage(int w, int h);
 
+    /*
+     * Creates a render target image together with a render queue, returned
+     * by WCImage.getRQ(), that draws into the image when it is decoded.
+     */
+    public final WCImage createOffscreenImage(int w, int h) {
+        WCImage image = createRTImage(w, h);
+        createBufferedContextRQ(image);
+        return image;
+    }
+
     public abstract WCImage getIconImage(String iconURL);
 
     public abstract Object toPlatformImage(WCImage image);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -52,12 +52,31 @@ public abstract class WCImage extends Ref {
 
     public ByteBuffer getPixelBuffer() {return null;}
 
+    /*
+     * Returns the pixel buffer with at least the given rectangle
+     * in sync with the image content.
+     */
+    protected ByteBuffer getPixelBuffer(int x, int y, int w, int h) {
+        return getPixelBuffer();
+    }
+
     protected void drawPixelBuffer() {}
 
+    /*
+     * Uploads the given rectangle of the pixel buffer to the image.
+     */
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
+        drawPixelBuffer();
+    }
+
     public synchronized void setRQ(WCRenderQueue rq) {
         this.rq = rq;
     }
 
+    public synchronized WCRenderQueue getRQ() {
+        return rq;
+    }
+
     // should be called on render thread
     protected synchronized void flushRQ() {
         if (rq != null) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,19 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
 
 public abstract class WCImageDecoder {
 
     /**
      * Receives a portion of image data.
+     * The buffer wraps native memory and is only valid during the call,
+     * so the data has to be copied out before returning.
      *
      * @param data  a portion of image data,
      *              or {@code null} if all data received
      */
-    protected abstract void addImageData(byte[] data);
+    protected abstract void addImageData(ByteBuffer data);
 
     /**
      * Returns image size.
@@ -77,6 +80,15 @@ public abstract class WCImageDecoder {
 
     protected abstract void destroy();
 
+    /**
+     * Releases the decoded data of all frames but the given one.
+     * The image data is kept, so that the frames can be decoded again
+     * when they are requested.
+     *
+     * @param keepIndex index of the frame to keep
+     */
+    protected abstract void destroyDecodedData(int keepIndex);
+
     protected abstract String getFilenameExtension();
 
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -82,6 +82,42 @@ public abstract class WCPath<P> extends Ref {
 
     public abstract void closeSubpath();
 
+    /**
+     * Appends the segments the native path has collected since it last
+     * used this path. Each segment is stored as its
+     * {@link WCPathIterator} segment type followed by its coordinates.
+     */
+    public void appendSegments(double[] data) {
+        int i = 0;
+        while (i < data.length) {
+            switch ((int) data[i++]) {
+                case WCPathIterator.SEG_MOVETO:
+                    moveTo(data[i], data[i + 1]);
+                    i += 2;
+                    break;
+                case WCPathIterator.SEG_LINETO:
+                    addLineTo(data[i], data[i + 1]);
+                    i += 2;
+                    break;
+                case WCPathIterator.SEG_QUADTO:
+                    addQuadCurveTo(data[i], data[i + 1], data[i + 2], data[i + 3]);
+                    i += 4;
+                    break;
+                case WCPathIterator.SEG_CUBICTO:
+                    addBezierCurveTo(data[i], data[i + 1], data[i + 2],
+                                     data[i + 3], data[i + 4], data[i + 5]);
+                    i += 6;
+                    break;
+                case WCPathIterator.SEG_CLOSE:
+                    closeSubpath();
+                    break;
+                default:
+                    throw new IllegalArgumentException(
+                            "Unknown path segment type: " + data[i - 1]);
+            }
+        }
+    }
+
     public abstract boolean isEmpty();
 
     public abstract void translate(double x, double y);
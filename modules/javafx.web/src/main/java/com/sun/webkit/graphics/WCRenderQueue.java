@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,7 @@ import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.webkit.Invoker;
 import java.nio.ByteBuffer;
+import java.util.Arrays;
 import java.util.HashMap;
 import java.util.LinkedList;
 import java.util.concurrent.atomic.AtomicInteger;
@@ -66,14 +67,18 @@ public abstract class WCRenderQueue extends Ref {
     }
 
     public synchronized void addBuffer(ByteBuffer buffer) {
+        addBuffer(buffer, 0);
+    }
+
+    private synchronized void addBuffer(ByteBuffer buffer, int id) {
         if (log.isLoggable(Level.FINE) && buffers.isEmpty()) {
             log.fine("'{'WCRenderQueue{0}[{1}]",
                     new Object[]{hashCode(), idCountObj.incrementAndGet()});
         }
-        currentBuffer.setBuffer(buffer);
+        currentBuffer.setBuffer(buffer, id);
         buffers.addLast(currentBuffer);
         currentBuffer = new BufferData();
-        size += buffer.capacity();
+        size += buffer.limit();
         if (size > MAX_QUEUE_SIZE && gc!=null) {
             // It is isolated queue over the canvas image [image-gc!=null].
             // We need to flush the changes periodically
@@ -127,8 +132,11 @@ public abstract class WCRenderQueue extends Ref {
         flush();
     }
 
-    private void fwkAddBuffer(ByteBuffer buffer) {
-        addBuffer(buffer);
+    private void fwkAddBuffer(ByteBuffer buffer, int length, int id) {
+        // The native buffer may be recycled, so its wrapper spans the whole
+        // capacity and only the first length bytes hold commands.
+        buffer.clear().limit(length);
+        addBuffer(buffer, id);
     }
 
     public WCRectangle getClip() {
@@ -139,14 +147,20 @@ public abstract class WCRenderQueue extends Ref {
         int n = buffers.size();
         if (n > 0) {
             int i = 0;
-            final Object[] arr = new Object[n];
+            final int[] ids = new int[n];
             for (BufferData bdata: buffers) {
-                arr[i++] = bdata.getBuffer();
+                int id = bdata.getBufferID();
+                if (id != 0) {
+                    ids[i++] = id;
+                }
             }
             buffers.clear();
-            Invoker.getInvoker().invokeOnEventThread(() -> {
-                twkRelease(arr);
-            });
+            if (i > 0) {
+                final int[] arr = (i == n) ? ids : Arrays.copyOf(ids, i);
+                Invoker.getInvoker().invokeOnEventThread(() -> {
+                    twkRelease(arr);
+                });
+            }
             size = 0;
             if (log.isLoggable(Level.FINE)) {
                 log.fine("'}'WCRenderQueue{0}[{1}]",
@@ -161,7 +175,7 @@ public abstract class WCRenderQueue extends Ref {
         disposeGraphics();
     }
 
-    private native void twkRelease(Object[] bufs);
+    private native void twkRelease(int[] ids);
 
     /*is called from native*/
     private int refString(String str) {
@@ -202,6 +216,8 @@ final class BufferData {
             new HashMap<>();
 
     private ByteBuffer buffer;
+    /* Native id of the buffer, or 0 if the buffer is owned by Java */
+    private int bufferID;
 
     private int createID() {
         return idCount.incrementAndGet();
@@ -241,7 +257,12 @@ final class BufferData {
         return buffer;
     }
 
-    void setBuffer(ByteBuffer buffer) {
+    int getBufferID() {
+        return bufferID;
+    }
+
+    void setBuffer(ByteBuffer buffer, int bufferID) {
         this.buffer = buffer;
+        this.bufferID = bufferID;
     }
 }
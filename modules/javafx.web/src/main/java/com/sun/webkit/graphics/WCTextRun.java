@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,4 +33,16 @@ public interface WCTextRun {
     int getGlyph(int index);
     int getGlyphCount();
     int getStart();
+
+    /**
+     * Returns the glyph codes and character offsets of all glyphs
+     * interleaved as {@code {glyph0, offset0, glyph1, offset1, ...}}.
+     */
+    int[] getGlyphsAndCharOffsets();
+
+    /**
+     * Returns position and advance of all glyphs, four values per glyph
+     * in the same layout as {@link #getGlyphPosAndAdvance}.
+     */
+    float[] getGlyphPositionsAndAdvances();
 }
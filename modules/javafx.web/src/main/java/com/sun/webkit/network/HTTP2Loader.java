@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -514,15 +514,35 @@ final class HTTP2Loader extends URLLoaderBase {
     // another variant to use from createZIPEncodedBodySubscriber
     private void didReceiveData(final byte[] bytes, int size) {
         callBackIfNotCanceled(() -> {
-            notifyDidReceiveData(getDirectBuffer(size).put(bytes, 0, size).flip());
+            notifyDidReceiveData(bytes, 0, size);
         });
     }
 
     private void didReceiveData(final List<ByteBuffer> bytes) {
-        callBackIfNotCanceled(() -> bytes.stream()
-                                          .map(this::copyToDirectBuffer)
-                                          .forEach(this::notifyDidReceiveData)
-        );
+        callBackIfNotCanceled(() -> bytes.forEach(bb -> {
+            // Heap buffers are read by the native code directly
+            if (bb.hasArray()) {
+                notifyDidReceiveData(bb.array(), bb.arrayOffset() + bb.position(), bb.remaining());
+            } else {
+                notifyDidReceiveData(copyToDirectBuffer(bb));
+            }
+        }));
+    }
+
+    private void notifyDidReceiveData(byte[] array, int offset, int length) {
+        Invoker.getInvoker().checkEventThread();
+        if (logger.isLoggable(Level.FINEST)) {
+            logger.finest(String.format(
+                    "array: [%s], "
+                    + "offset: [%s], "
+                    + "length: [%s], "
+                    + "data: [0x%016X]",
+                    array,
+                    offset,
+                    length,
+                    data));
+        }
+        twkDidReceiveDataArray(array, offset, length, data);
     }
 
     private void notifyDidReceiveData(ByteBuffer byteBuffer) {
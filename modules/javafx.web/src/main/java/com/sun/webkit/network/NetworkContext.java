@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,7 +27,9 @@ package com.sun.webkit.network;
 
 import static com.sun.webkit.network.URLs.newURL;
 
+import java.net.InetAddress;
 import java.net.MalformedURLException;
+import java.net.ResponseCache;
 import java.util.Arrays;
 import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.ThreadFactory;
@@ -75,10 +77,34 @@ final class NetworkContext {
      */
     private static final ThreadPoolExecutor threadPool;
 
+    /**
+     * The maximum number of host names resolved speculatively at once.
+     */
+    private static final int DNS_PREFETCH_POOL_SIZE = 4;
+
+    /**
+     * The maximum number of host names waiting for speculative resolution.
+     */
+    private static final int DNS_PREFETCH_QUEUE_SIZE = 64;
+
+    /**
+     * The thread pool used to resolve host names ahead of their loads.
+     */
+    private static final ThreadPoolExecutor dnsPrefetchPool;
+
     /**
      * Can use HTTP2Loader
      */
     private static final boolean useHTTP2Loader;
+
+    /**
+     * Lets an application installed {@code ResponseCache}, e.g. a persistent
+     * disk cache, serve GET requests. Off by default as WebKit has its own
+     * memory cache.
+     */
+    private static final boolean useResponseCache =
+            Boolean.getBoolean("com.sun.webkit.useResponseCache");
+
     static {
         threadPool = new ThreadPoolExecutor(
                 THREAD_POOL_SIZE,
@@ -86,9 +112,19 @@ final class NetworkContext {
                 THREAD_POOL_KEEP_ALIVE_TIME,
                 TimeUnit.MILLISECONDS,
                 new LinkedBlockingQueue<Runnable>(),
-                new URLLoaderThreadFactory());
+                new URLLoaderThreadFactory("URL-Loader-"));
         threadPool.allowCoreThreadTimeOut(true);
 
+        dnsPrefetchPool = new ThreadPoolExecutor(
+                DNS_PREFETCH_POOL_SIZE,
+                DNS_PREFETCH_POOL_SIZE,
+                THREAD_POOL_KEEP_ALIVE_TIME,
+                TimeUnit.MILLISECONDS,
+                new LinkedBlockingQueue<Runnable>(DNS_PREFETCH_QUEUE_SIZE),
+                new URLLoaderThreadFactory("DNS-Prefetch-"),
+                new ThreadPoolExecutor.DiscardPolicy());
+        dnsPrefetchPool.allowCoreThreadTimeOut(true);
+
         // Use HTTP2 by default on JDK 12 or later
         final var version = Runtime.Version.parse(System.getProperty("java.version"));
         final String defaultUseHTTP2 = version.feature() >= 12 ? "true" : "false";
@@ -157,7 +193,9 @@ final class NetworkContext {
                     Util.formatHeaders(headers)));
         }
 
-        if (useHTTP2Loader) {
+        // HttpClient does not consult java.net.ResponseCache, so cacheable
+        // requests stay on URLLoader when the application installed a cache.
+        if (useHTTP2Loader && !useResponseCache(method)) {
             final URLLoaderBase loader = HTTP2Loader.create(
                 webPage,
                 byteBufferPool,
@@ -204,6 +242,50 @@ final class NetworkContext {
         }
     }
 
+    /**
+     * Checks whether a request with the given method can be served by the
+     * default {@code ResponseCache}.
+     */
+    static boolean useResponseCache(String method) {
+        return useResponseCache
+                && "GET".equals(method)
+                && ResponseCache.getDefault() != null;
+    }
+
+    /**
+     * Resolves a host name in the background so that the address is
+     * already in the {@code InetAddress} cache when the page loads
+     * a resource from it. Names that do not fit in the queue are dropped.
+     */
+    private static void fwkPrefetchDNS(final String host) {
+        dnsPrefetchPool.execute(() -> {
+            try {
+                InetAddress.getAllByName(host);
+            } catch (Exception ex) {
+                // Speculative only, the actual load reports any failure
+                if (logger.isLoggable(Level.FINEST)) {
+                    logger.finest("DNS prefetch failed for " + host, ex);
+                }
+            }
+        });
+    }
+
+    /**
+     * Checks whether requests are configured to go through a proxy, in which
+     * case resolving host names locally does not speed up the loads.
+     */
+    private static boolean fwkIsUsingProxy() {
+        return Boolean.getBoolean("java.net.useSystemProxies")
+                || isPropertySet("http.proxyHost")
+                || isPropertySet("https.proxyHost")
+                || isPropertySet("socksProxyHost");
+    }
+
+    private static boolean isPropertySet(String key) {
+        String value = System.getProperty(key);
+        return value != null && !value.isEmpty();
+    }
+
     /**
      * Returns the maximum allowed number of connections per host.
      */
@@ -225,14 +307,16 @@ final class NetworkContext {
     private static final class URLLoaderThreadFactory implements ThreadFactory {
         private final ThreadGroup group;
         private final AtomicInteger index = new AtomicInteger(1);
+        private final String prefix;
 
-        private URLLoaderThreadFactory() {
+        private URLLoaderThreadFactory(String prefix) {
             group = Thread.currentThread().getThreadGroup();
+            this.prefix = prefix;
         }
 
         @Override
         public Thread newThread(Runnable r) {
-            Thread t = new Thread(group, r, "URL-Loader-" + index.getAndIncrement());
+            Thread t = new Thread(group, r, prefix + index.getAndIncrement());
             t.setDaemon(true);
             if (t.getPriority() != Thread.NORM_PRIORITY) {
                 t.setPriority(Thread.NORM_PRIORITY);
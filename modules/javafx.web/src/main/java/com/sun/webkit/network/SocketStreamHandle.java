@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import com.sun.webkit.Invoker;
 import com.sun.webkit.WebPage;
 import java.io.IOException;
 import java.io.InputStream;
+import java.io.OutputStream;
 import static java.lang.String.format;
 import java.net.ConnectException;
 import java.net.InetSocketAddress;
@@ -43,6 +44,8 @@ import java.net.SocketException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.UnknownHostException;
+import java.util.ArrayDeque;
+import java.util.Arrays;
 import java.util.List;
 import java.util.concurrent.SynchronousQueue;
 import java.util.concurrent.ThreadFactory;
@@ -65,6 +68,9 @@ final class SocketStreamHandle {
             new SynchronousQueue<Runnable>(),
             new CustomThreadFactory());
 
+    private static final int READ_BUFFER_SIZE = 8192;
+    private static final int SEND_CHUNK_SIZE = 64 * 1024;
+
     private enum State {ACTIVE, CLOSE_REQUESTED, DISPOSED}
 
     private final String host;
@@ -76,6 +82,22 @@ final class SocketStreamHandle {
     private volatile State state = State.ACTIVE;
     private volatile boolean connected;
 
+    // Data read from the socket and not yet delivered to WebCore. The reader
+    // thread appends to it and posts a single delivery to the event thread
+    // for everything that arrives until that delivery runs.
+    private final Object receiveLock = new Object();
+    private byte[] receiveBuffer = new byte[READ_BUFFER_SIZE];
+    private byte[] spareReceiveBuffer;
+    private int receiveLength;
+    private boolean receivePosted;
+
+    // Data accepted by fwkSend and not yet written to the socket. A writer
+    // task drains it, combining small messages into fewer socket writes.
+    private final ArrayDeque<byte[]> sendQueue = new ArrayDeque<>();
+    private int sendQueueLength;
+    private boolean writerActive;
+    private boolean closeAfterSend;
+
     private SocketStreamHandle(String host, int port, boolean ssl,
                                WebPage webPage, long data)
     {
@@ -118,8 +140,8 @@ final class SocketStreamHandle {
             logger.finest("{0} connected", this);
             didOpen();
             InputStream is = socket.getInputStream();
+            byte[] buffer = new byte[READ_BUFFER_SIZE];
             while (true) {
-                byte[] buffer = new byte[8192];
                 int n = is.read(buffer);
                 if(n > 0) {
                     if (logger.isLoggable(Level.FINEST)) {
@@ -272,14 +294,19 @@ final class SocketStreamHandle {
                     this, buffer.length, dump(buffer, buffer.length)));
         }
         if (connected) {
-            try {
-                socket.getOutputStream().write(buffer);
-                return buffer.length;
-            } catch (IOException ex) {
-                logger.finest(format("%s exception", this), ex);
-                didFail(0, "I/O error");
-                return 0;
+            // The socket is written on a pool thread so that a slow peer
+            // does not block the event thread
+            synchronized (sendQueue) {
+                sendQueue.add(buffer);
+                sendQueueLength += buffer.length;
+                if (!writerActive) {
+                    writerActive = true;
+                    threadPool.submit(() -> {
+                        drainSendQueue();
+                    });
+                }
             }
+            return buffer.length;
         } else {
             logger.finest("{0} not connected", this);
             didFail(0, "Not connected");
@@ -287,18 +314,83 @@ final class SocketStreamHandle {
         }
     }
 
+    private void drainSendQueue() {
+        byte[] chunk = null;
+        try {
+            OutputStream os = socket.getOutputStream();
+            while (true) {
+                byte[] data;
+                int len;
+                synchronized (sendQueue) {
+                    if (sendQueue.isEmpty()) {
+                        writerActive = false;
+                        if (!closeAfterSend) {
+                            return;
+                        }
+                        break;
+                    }
+                    data = sendQueue.poll();
+                    len = data.length;
+                    if (len < SEND_CHUNK_SIZE && !sendQueue.isEmpty()) {
+                        // Gather the queued messages that fit into one write
+                        if (chunk == null) {
+                            chunk = new byte[SEND_CHUNK_SIZE];
+                        }
+                        System.arraycopy(data, 0, chunk, 0, len);
+                        byte[] next;
+                        while ((next = sendQueue.peek()) != null
+                                && len + next.length <= SEND_CHUNK_SIZE) {
+                            System.arraycopy(sendQueue.poll(), 0, chunk, len, next.length);
+                            len += next.length;
+                        }
+                        data = chunk;
+                    }
+                    sendQueueLength -= len;
+                }
+                if (logger.isLoggable(Level.FINEST)) {
+                    logger.finest(format("%s writing len: [%d]", this, len));
+                }
+                os.write(data, 0, len);
+            }
+        } catch (IOException ex) {
+            synchronized (sendQueue) {
+                sendQueue.clear();
+                sendQueueLength = 0;
+                writerActive = false;
+            }
+            if (state == State.ACTIVE) {
+                logger.finest(format("%s exception", this), ex);
+                didFail(0, "I/O error");
+                return;
+            }
+        }
+        closeSocket();
+    }
+
     private void fwkClose() {
         synchronized (this) {
             logger.finest("{0}", this);
             state = State.CLOSE_REQUESTED;
-            try {
-                if (socket != null) {
-                    socket.close();
+            synchronized (sendQueue) {
+                if (writerActive) {
+                    // Let the writer flush the queued data, the closing
+                    // handshake in particular, before closing the socket
+                    closeAfterSend = true;
+                    return;
                 }
-            } catch (IOException ignore) {}
+            }
+            closeSocket();
         }
     }
 
+    private void closeSocket() {
+        try {
+            if (socket != null) {
+                socket.close();
+            }
+        } catch (IOException ignore) {}
+    }
+
     private void fwkNotifyDisposed() {
         logger.finest("{0}", this);
         state = State.DISPOSED;
@@ -313,13 +405,42 @@ final class SocketStreamHandle {
     }
 
     private void didReceiveData(final byte[] buffer, final int len) {
-        Invoker.getInvoker().postOnEventThread(() -> {
-            if (state == State.ACTIVE) {
-                notifyDidReceiveData(buffer, len);
+        synchronized (receiveLock) {
+            if (receiveLength + len > receiveBuffer.length) {
+                receiveBuffer = Arrays.copyOf(receiveBuffer,
+                        Math.max(receiveLength + len, receiveBuffer.length * 2));
             }
+            System.arraycopy(buffer, 0, receiveBuffer, receiveLength, len);
+            receiveLength += len;
+            if (receivePosted) {
+                return;
+            }
+            receivePosted = true;
+        }
+        Invoker.getInvoker().postOnEventThread(() -> {
+            deliverReceivedData();
         });
     }
 
+    private void deliverReceivedData() {
+        byte[] buffer;
+        int len;
+        synchronized (receiveLock) {
+            buffer = receiveBuffer;
+            len = receiveLength;
+            // Deliveries only run on the event thread, so the buffer handed
+            // out last time is free again and can take the next data
+            receiveBuffer = spareReceiveBuffer != null
+                    ? spareReceiveBuffer : new byte[READ_BUFFER_SIZE];
+            spareReceiveBuffer = buffer;
+            receiveLength = 0;
+            receivePosted = false;
+        }
+        if (state == State.ACTIVE) {
+            notifyDidReceiveData(buffer, len);
+        }
+    }
+
     private void didFail(final int errorCode, final String errorDescription) {
         Invoker.getInvoker().postOnEventThread(() -> {
             if (state == State.ACTIVE) {
@@ -393,8 +514,31 @@ final class SocketStreamHandle {
     @Override
     public String toString() {
         return format("SocketStreamHandle{host=%s, port=%d, ssl=%s, "
-                + "data=0x%016X, state=%s, connected=%s}",
-                host, port, ssl, data, state, connected);
+                + "data=0x%016X, state=%s, connected=%s, "
+                + "pendingReceive=%d, pendingSend=%d}",
+                host, port, ssl, data, state, connected,
+                getPendingReceiveLength(), getPendingSendLength());
+    }
+
+    /**
+     * Returns the number of bytes read from the socket and waiting
+     * for delivery on the event thread.
+     */
+    int getPendingReceiveLength() {
+        synchronized (receiveLock) {
+            return receiveLength;
+        }
+    }
+
+    /**
+     * Returns the number of bytes accepted for sending and not yet
+     * written to the socket.
+     */
+    int getPendingSendLength() {
+        synchronized (sendQueue) {
+            return sendQueueLength;
+        }
+    }
     }
 
     private static final class CustomThreadFactory implements ThreadFactory {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -252,11 +252,12 @@ final class URLLoader extends URLLoaderBase implements Runnable {
         c.setReadTimeout(60000 * 60); // 60 minutes
 
         // Given that WebKit has its own cache, do not use
-        // any URLConnection caches, even if someone installs them.
+        // any URLConnection caches, even if someone installs them,
+        // unless explicitly enabled with com.sun.webkit.useResponseCache.
         // As a side effect, this fixes the problem of WebPane not
         // working well with the plug-in cache, which was one of
         // the causes for JDK-8112030.
-        c.setUseCaches(false);
+        c.setUseCaches(NetworkContext.useResponseCache(method));
 
         Locale loc = Locale.getDefault();
         String lang = "";
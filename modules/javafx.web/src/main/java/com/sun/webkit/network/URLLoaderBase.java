@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,6 +61,11 @@ abstract class URLLoaderBase {
                                                  int remaining,
                                                  long data);
 
+    protected static native void twkDidReceiveDataArray(byte[] array,
+                                                      int offset,
+                                                      int length,
+                                                      long data);
+
     protected static native void twkDidFinishLoading(long data);
 
     protected static native void twkDidFail(int errorCode,
@@ -36,6 +36,9 @@ import java.util.Map;
 public final class PerfLogger {
     private static Thread shutdownHook;
     private static Map<PlatformLogger, PerfLogger> loggers;
+    // Probes timed in native code, indexed by their native ID. Entries of
+    // probes whose logger is disabled are null.
+    private static final ArrayList<ProbeStat> nativeProbes = new ArrayList<>();
 
     private final HashMap<String, ProbeStat> probes =
             new HashMap<>();
@@ -99,6 +102,11 @@ public final class PerfLogger {
         private long totalTime;
         private long startTime;
         private boolean isRunning = false;
+        // Totals recorded in native code, and their values at the last reset
+        private volatile long nativeCount;
+        private volatile long nativeNanos;
+        private long nativeCountBase;
+        private long nativeNanosBase;
 
         private ProbeStat(String probe) {
             this.probe = probe;
@@ -109,16 +117,18 @@ public final class PerfLogger {
         }
 
         public int getCount() {
-            return count;
+            return count + (int) (nativeCount - nativeCountBase);
         }
 
         public long getTotalTime() {
-            return totalTime;
+            return totalTime + (nativeNanos - nativeNanosBase) / 1_000_000;
         }
 
         private void reset() {
             count = 0;
             totalTime = startTime = 0;
+            nativeCountBase = nativeCount;
+            nativeNanosBase = nativeNanos;
         }
 
         private void suspend() {
@@ -143,7 +153,7 @@ public final class PerfLogger {
 
         @Override
         public String toString() {
-            return super.toString() + "[count=" + count + ", time=" + totalTime + "]";
+            return super.toString() + "[count=" + getCount() + ", time=" + getTotalTime() + "]";
         }
     }
 
@@ -156,8 +166,8 @@ public final class PerfLogger {
     }
 
     private final Comparator timeComparator = (arg0, arg1) -> {
-        long t0 = probes.get(arg0).totalTime;
-        long t1 = probes.get(arg1).totalTime;
+        long t0 = probes.get(arg0).getTotalTime();
+        long t1 = probes.get(arg1).getTotalTime();
         if (t0 > t1) {
             return 1;
         } else if (t0 < t1) {
@@ -167,8 +177,8 @@ public final class PerfLogger {
     };
 
     private final Comparator countComparator = (arg0, arg1) -> {
-        long c0 = probes.get(arg0).count;
-        long c1 = probes.get(arg1).count;
+        long c0 = probes.get(arg0).getCount();
+        long c1 = probes.get(arg1).getCount();
         if (c0 > c1) {
             return 1;
         } else if (c0 < c1) {
@@ -177,10 +187,62 @@ public final class PerfLogger {
         return 0;
     };
 
+    /**
+     * Registers a probe that is timed in native code, see PerfProbeJava.h.
+     * Called once per probe from native code.
+     *
+     * @return whether the logger named {@code name} is enabled
+     */
+    private static boolean registerNativeProbe(String name, String probe, int id) {
+        PerfLogger l = getLogger(name);
+        ProbeStat stat = null;
+        if (l.isEnabled()) {
+            synchronized (l) {
+                String p = probe.intern();
+                stat = l.probes.get(p);
+                if (stat == null) {
+                    stat = l.registerProbe(p);
+                }
+            }
+        }
+        synchronized (nativeProbes) {
+            while (nativeProbes.size() <= id) {
+                nativeProbes.add(null);
+            }
+            nativeProbes.set(id, stat);
+        }
+        return stat != null;
+    }
+
+    /**
+     * Copies the totals of the probes timed in native code into their stats.
+     */
+    private static void updateNativeProbes() {
+        synchronized (nativeProbes) {
+            if (nativeProbes.isEmpty()) {
+                // No native probe registered, the native library may not
+                // even be loaded
+                return;
+            }
+            long[] stats = twkGetNativeProbeStats();
+            int n = Math.min(nativeProbes.size(), stats.length / 2);
+            for (int i = 0; i < n; i++) {
+                ProbeStat s = nativeProbes.get(i);
+                if (s != null) {
+                    s.nativeCount = stats[2 * i];
+                    s.nativeNanos = stats[2 * i + 1];
+                }
+            }
+        }
+    }
+
+    private static native long[] twkGetNativeProbeStats();
+
     /**
      * Resets perf statistics.
      */
     public synchronized void reset() {
+        updateNativeProbes();
         for (Map.Entry<String, ProbeStat> entry: probes.entrySet()) {
             entry.getValue().reset();
         }
@@ -206,6 +268,7 @@ public final class PerfLogger {
     }
 
     public synchronized ProbeStat getProbeStat(String probe) {
+        updateNativeProbes();
         String p = probe.intern();
         ProbeStat s = probes.get(p);
         if (s != null) {
@@ -279,9 +342,9 @@ public final class PerfLogger {
         Collections.sort(list, timeComparator);
         for (String p: list) {
             ProbeStat s = getProbeStat(p);
-            buf.append(String.format("%s: %dms", fullName(p), s.totalTime));
-            if (total.totalTime > 0){
-                buf.append(String.format(", %.2f%%%n", (float)100*s.totalTime/total.totalTime));
+            buf.append(String.format("%s: %dms", fullName(p), s.getTotalTime()));
+            if (total.getTotalTime() > 0){
+                buf.append(String.format(", %.2f%%%n", (float)100*s.getTotalTime()/total.getTotalTime()));
             } else {
                 buf.append("\n");
             }
@@ -290,7 +353,7 @@ public final class PerfLogger {
         buf.append("\nInvocations count:\n");
         Collections.sort(list, countComparator);
         for (String p: list) {
-            buf.append(String.format("%s: %d%n", fullName(p), getProbeStat(p).count));
+            buf.append(String.format("%s: %d%n", fullName(p), getProbeStat(p).getCount()));
         }
         buf.append("================================================\n");
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -238,6 +238,13 @@ public final class WCGraphicsPerfLogger extends WCGraphicsContext {
         logger.suspendCount("DRAWIMAGE");
     }
 
+    @Override
+    public void drawImages(WCImage img, float[] rects) {
+        logger.resumeCount("DRAWIMAGES");
+        gc.drawImages(img, rects);
+        logger.suspendCount("DRAWIMAGES");
+    }
+
     @Override
     public void drawIcon(WCIcon icon, int x, int y) {
         logger.resumeCount("DRAWICON");
@@ -12,6 +12,8 @@ list(APPEND WTF_PUBLIC_HEADERS
     java/JavaRef.h
     java/DbgUtils.h
     java/JavaMath.h
+    java/PerfProbeJava.h
+    java/TraceRecorderJava.h
     unicode/java/UnicodeJava.h
 )
 
@@ -25,8 +27,10 @@ list(APPEND WTF_SOURCES
     java/FileSystemJava.cpp
     java/JavaEnv.cpp
     java/MainThreadJava.cpp
+    java/PerfProbeJava.cpp
     java/StringJava.cpp
     java/TextBreakIteratorInternalICUJava.cpp
+    java/TraceRecorderJava.cpp
     java/CPUTimeJava.cpp
 )
 
@@ -184,6 +184,14 @@ enum TracePointCode {
     UpdateLayerContentBuffersEnd,
 #endif
 
+#if PLATFORM(JAVA)
+    JavaPortRange = 22000,
+
+    WebPagePaintStart,
+    WebPagePaintEnd,
+    RenderingQueueFlush,
+#endif
+
 };
 
 #ifdef __cplusplus
@@ -191,6 +199,8 @@ enum TracePointCode {
 // This has to be included after the TracePointCode enum.
 #if USE(SYSPROF_CAPTURE)
 #include <wtf/glib/SysprofAnnotator.h>
+#elif PLATFORM(JAVA)
+#include <wtf/java/TraceRecorderJava.h>
 #endif
 
 namespace WTF {
@@ -206,6 +216,12 @@ inline void tracePoint(TracePointCode code, uint64_t data1 = 0, uint64_t data2 =
     UNUSED_PARAM(data2);
     UNUSED_PARAM(data3);
     UNUSED_PARAM(data4);
+#elif PLATFORM(JAVA)
+    if (UNLIKELY(TraceRecorder::isEnabled()))
+        TraceRecorder::record(code, data1);
+    UNUSED_PARAM(data2);
+    UNUSED_PARAM(data3);
+    UNUSED_PARAM(data4);
 #else
     UNUSED_PARAM(code);
     UNUSED_PARAM(data1);
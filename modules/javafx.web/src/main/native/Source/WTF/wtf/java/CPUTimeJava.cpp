@@ -1,17 +1,36 @@
 #include "config.h"
 #include <wtf/CPUTime.h>
 
+// Windows builds use win/CPUTimeWin.cpp.
+#if !OS(WINDOWS)
+
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <time.h>
+
 namespace WTF {
 
+static Seconds timevalToSeconds(const struct timeval& value)
+{
+    return Seconds(value.tv_sec) + Seconds::fromMicroseconds(value.tv_usec);
+}
+
 std::optional<CPUTime> CPUTime::get()
 {
-    return std::nullopt;
+    struct rusage resource { };
+    if (getrusage(RUSAGE_SELF, &resource))
+        return std::nullopt;
+    return CPUTime { MonotonicTime::now(), timevalToSeconds(resource.ru_utime), timevalToSeconds(resource.ru_stime) };
 }
 
 Seconds CPUTime::forCurrentThread()
 {
-    return Seconds {};
+    struct timespec ts { };
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts))
+        return Seconds { };
+    return Seconds(ts.tv_sec) + Seconds::fromNanoseconds(ts.tv_nsec);
 }
 
 }
 
+#endif // !OS(WINDOWS)
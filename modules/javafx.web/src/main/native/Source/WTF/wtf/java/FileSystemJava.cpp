@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,56 +29,88 @@
 #include <wtf/java/JavaEnv.h>
 #include <wtf/text/CString.h>
 
+#if OS(WINDOWS)
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace WTF {
 
 namespace FileSystemImpl {
 
 
 // -----------------------------------------------------------------------
-//  Below methods use Java calls to implement the intended functionality.
+//  File queries are answered natively. They are issued for every storage
+//  and cache lookup and need nothing from the Java side.
 // -----------------------------------------------------------------------
+#if OS(WINDOWS)
+static Vector<wchar_t> widePath(const String& path)
+{
+    Vector<wchar_t> result;
+    result.reserveInitialCapacity(path.length() + 1);
+    for (auto c : StringView(path).codeUnits())
+        result.append(c);
+    result.append(0);
+    return result;
+}
+#endif
+
 bool fileExists(const String& path)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
+    if (path.isEmpty())
+        return false;
+#if OS(WINDOWS)
+    return GetFileAttributesW(widePath(path).data()) != INVALID_FILE_ATTRIBUTES;
+#else
+    return !access(path.utf8().data(), F_OK);
+#endif
+}
 
-    static jmethodID mid = env->GetStaticMethodID(
-            comSunWebkitFileSystem,
-            "fwkFileExists",
-            "(Ljava/lang/String;)Z");
-    ASSERT(mid);
+std::optional<FileMetadata> fileMetadata(const String& path)
+{
+    if (path.isEmpty())
+        return { };
 
-    jboolean result = env->CallStaticBooleanMethod(
-            comSunWebkitFileSystem,
-            mid,
-            (jstring)path.toJavaString(env));
-    WTF::CheckAndClearException(env);
+    FileMetadata metadata { };
+#if OS(WINDOWS)
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(widePath(path).data(), GetFileExInfoStandard, &data))
+        return { };
 
-    return jbool_to_bool(result);
-}
+    ULARGE_INTEGER size;
+    size.LowPart = data.nFileSizeLow;
+    size.HighPart = data.nFileSizeHigh;
+    ULARGE_INTEGER time;
+    time.LowPart = data.ftLastWriteTime.dwLowDateTime;
+    time.HighPart = data.ftLastWriteTime.dwHighDateTime;
+    // FILETIME counts 100ns intervals since January 1, 1601.
+    metadata.modificationTime = WallTime::fromRawSeconds(time.QuadPart / 10000000.0 - 11644473600.0);
+    metadata.length = size.QuadPart;
+    metadata.isHidden = data.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN;
+    metadata.type = (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? FileMetadata::Type::Directory : FileMetadata::Type::File;
+#else
+    struct stat fileInfo;
+    if (stat(path.utf8().data(), &fileInfo))
+        return { };
 
+    metadata.modificationTime = WallTime::fromRawSeconds(fileInfo.st_mtime);
+    metadata.length = fileInfo.st_size;
+    size_t separator = path.reverseFind('/');
+    metadata.isHidden = StringView(path).substring(separator == notFound ? 0 : separator + 1).startsWith('.');
+    metadata.type = S_ISDIR(fileInfo.st_mode) ? FileMetadata::Type::Directory : FileMetadata::Type::File;
+#endif
+    return metadata;
+}
 
 bool getFileSize(const String& path, long long& result)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetStaticMethodID(
-            comSunWebkitFileSystem,
-            "fwkGetFileSize",
-            "(Ljava/lang/String;)J");
-    ASSERT(mid);
-
-    jlong size = env->CallStaticLongMethod(
-            comSunWebkitFileSystem,
-            mid,
-            (jstring) path.toJavaString(env));
-    WTF::CheckAndClearException(env);
-
-    if (size >= 0) {
-        result = size;
-        return true;
-    } else {
+    auto metadata = fileMetadata(path);
+    if (!metadata)
         return false;
-    }
+    result = metadata->length;
+    return true;
 }
 
 std::optional<uint64_t> fileSize(const String& path)
@@ -88,36 +120,52 @@ std::optional<uint64_t> fileSize(const String& path)
     return size;
 }
 
-std::optional<FileMetadata> fileMetadata(const String& path)
+static std::optional<FileType> nativeFileType(const String& path, bool followSymlinks)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetStaticMethodID(
-            comSunWebkitFileSystem,
-            "fwkGetFileMetadata",
-            "(Ljava/lang/String;[J)Z");
-    ASSERT(mid);
+    if (path.isEmpty())
+        return { };
+#if OS(WINDOWS)
+    DWORD attributes = GetFileAttributesW(widePath(path).data());
+    if (attributes == INVALID_FILE_ATTRIBUTES)
+        return { };
+    if (!followSymlinks && (attributes & FILE_ATTRIBUTE_REPARSE_POINT))
+        return FileType::SymbolicLink;
+    return (attributes & FILE_ATTRIBUTE_DIRECTORY) ? FileType::Directory : FileType::Regular;
+#else
+    struct stat fileInfo;
+    if (followSymlinks ? stat(path.utf8().data(), &fileInfo) : lstat(path.utf8().data(), &fileInfo))
+        return { };
+    if (S_ISLNK(fileInfo.st_mode))
+        return FileType::SymbolicLink;
+    return S_ISDIR(fileInfo.st_mode) ? FileType::Directory : FileType::Regular;
+#endif
+}
 
-    JLocalRef<jlongArray> lArray(env->NewLongArray(3));
+std::optional<FileType> fileType(const String& path)
+{
+    return nativeFileType(path, false);
+}
 
-    jboolean result = env->CallStaticBooleanMethod(
-            comSunWebkitFileSystem,
-            mid,
-            (jstring)path.toJavaString(env), (jlongArray)lArray);
-    WTF::CheckAndClearException(env);
+std::optional<FileType> fileTypeFollowingSymlinks(const String& path)
+{
+    return nativeFileType(path, true);
+}
 
-    if (result) {
-        jlong* metadataResults = env->GetLongArrayElements(lArray, 0);
-        FileMetadata metadata {};
-        metadata.modificationTime = WallTime::fromRawSeconds(metadataResults[0] / 1000.0);
-        metadata.length = metadataResults[1];
-        metadata.type = static_cast<FileMetadata::Type>(metadataResults[2]);
-        env->ReleaseLongArrayElements(lArray, metadataResults, 0);
-        return metadata;
-    }
-    return {};
+bool deleteFile(const String& path)
+{
+    if (path.isEmpty())
+        return false;
+#if OS(WINDOWS)
+    return DeleteFileW(widePath(path).data());
+#else
+    return !unlink(path.utf8().data());
+#endif
 }
 
+
+// -----------------------------------------------------------------------
+//  Below methods use Java calls to implement the intended functionality.
+// -----------------------------------------------------------------------
 std::optional<WallTime> getFileModificationTime(const String& path)
 {
     std::optional<FileMetadata> metadata = fileMetadata(path);
@@ -397,12 +445,6 @@ MappedFileData::~MappedFileData()
     unmapViewOfFile(m_fileData, m_fileSize);
 }
 
-bool deleteFile(const String&)
-{
-    fprintf(stderr, "deleteFile(const String&) NOT IMPLEMENTED\n");
-    return false;
-}
-
 bool deleteEmptyDirectory(String const &)
 {
     fprintf(stderr, "deleteEmptyDirectory(String const &) NOT IMPLEMENTED\n");
@@ -450,20 +492,6 @@ bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath)
     return false;
 }
 
-std::optional<FileType> fileTypeFollowingSymlinks(const String& path)
-{
-    fprintf(stderr, "fileTypeFollowingSymlinks(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    return {};
-}
-
-std::optional<FileType> fileType(const String& path)
-{
-    fprintf(stderr, "fileType(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    return {};
-}
-
 void deleteAllFilesModifiedSince(const String& path, WallTime t)
 {
     fprintf(stderr, "deleteAllFilesModifiedSince(const String&, WallTime) NOT IMPLEMENTED\n");
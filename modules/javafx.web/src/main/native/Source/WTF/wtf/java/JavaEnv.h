@@ -26,6 +26,7 @@
 #pragma once
 
 #include <wtf/java/JavaRef.h>
+#include <wtf/java/PerfProbeJava.h>
 
 #include <jni.h>
 
@@ -47,36 +48,6 @@ ALWAYS_INLINE JNIEnv* JNICALL GetJavaEnv()
 
 bool CheckAndClearException(JNIEnv* env);
 
-JLObject PL_GetLogger(JNIEnv* env, const char* name);
-void PL_ResumeCount(JNIEnv* env, jobject perfLogger, const char* probe);
-void PL_SuspendCount(JNIEnv* env, jobject perfLogger, const char* probe);
-bool PL_IsEnabled(JNIEnv* env, jobject perfLogger);
-
-//Log wrapper
-struct EntryJavaLogger
-{
-    JNIEnv     *m_env;
-    jobject     m_perfLogger;
-    const char *m_probe;
-
-    EntryJavaLogger(
-         JNIEnv *env,
-         jobject global_perfLogger,
-         const char* probe
-    ) : m_env(env)
-      , m_perfLogger(global_perfLogger)
-      , m_probe(probe)
-    {
-        PL_ResumeCount(m_env, m_perfLogger, m_probe);
-    }
-
-    ~EntryJavaLogger()
-    {
-        PL_SuspendCount(m_env, m_perfLogger, m_probe);
-    }
-};
-
-
 } // namespace WTF
 
 namespace WTF {
@@ -122,8 +93,8 @@ using AttachThreadAsNonDaemonToJavaEnv = AttachThreadToJavaEnv<false>;
 //  com.sun.webkit.perf.XXXX.level = ALL
 //have to be added into the file <wk_root>/WebKitBuild/<Debug|Release>/dist/logging.properties
 #define LOG_PERF_RECORD(env, LOG_NAME, LOG_RECORD) \
-    static JGObject __logger__(WTF::PL_GetLogger(env, LOG_NAME)); \
-    WTF::EntryJavaLogger __el__(env, __logger__, LOG_RECORD);
+    static WTF::PerfProbe __probe__(env, LOG_NAME, LOG_RECORD); \
+    WTF::PerfProbeScope __el__(__probe__);
 
 #define jlong_to_ptr(a) ((void*)(uintptr_t)(a))
 #define ptr_to_jlong(a) ((jlong)(uintptr_t)(a))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@
 
 #include <wtf/java/JavaEnv.h>
 #include <wtf/java/JavaRef.h>
+#include <wtf/Atomics.h>
 #include <wtf/MainThread.h>
 #include <wtf/RunLoop.h>
 
@@ -38,6 +39,11 @@ namespace WTF {
 static JGClass jMainThreadCls;
 static jmethodID fwkScheduleDispatchFunctions;
 
+// Set while a dispatch is posted to the event thread and not yet run.
+// Functions queued in the meantime are drained by that same dispatch, so
+// worker threads do not attach to the JVM for every function they post.
+static Atomic<bool> s_dispatchScheduled { false };
+
 #if OS(UNIX)
 static pthread_t s_mainThread;
 #elif OS(WINDOWS)
@@ -46,12 +52,18 @@ static ThreadIdentifier s_mainThread { 0 };
 
 void scheduleDispatchFunctionsOnMainThread()
 {
+    if (s_dispatchScheduled.exchange(true))
+        return;
+
     AttachThreadAsNonDaemonToJavaEnv autoAttach;
     JNIEnv* env = autoAttach.env();
-    if (env) {
-        env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctions);
-        WTF::CheckAndClearException(env);
+    if (!env) {
+        s_dispatchScheduled.store(false);
+        return;
     }
+    env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctions);
+    if (WTF::CheckAndClearException(env))
+        s_dispatchScheduled.store(false);
 }
 
 void initializeMainThreadPlatform()
@@ -117,6 +129,9 @@ extern "C" {
 JNIEXPORT void JNICALL Java_com_sun_webkit_MainThread_twkScheduleDispatchFunctions
   (JNIEnv*, jobject)
 {
+    // Clear before draining so that functions posted while the batch runs
+    // schedule the next dispatch.
+    s_dispatchScheduled.store(false);
     RunLoop::main().dispatchFunctionsFromMainThread();
 }
 
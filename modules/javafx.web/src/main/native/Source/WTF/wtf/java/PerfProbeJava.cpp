@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include <wtf/java/PerfProbeJava.h>
+
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/java/JavaEnv.h>
+
+namespace WTF {
+
+namespace {
+
+class PerfProbeRegistry {
+public:
+    size_t add(PerfProbe& probe)
+    {
+        Locker locker { m_lock };
+        m_probes.append(&probe);
+        return m_probes.size() - 1;
+    }
+
+    Vector<PerfProbe*> probes()
+    {
+        Locker locker { m_lock };
+        return m_probes;
+    }
+
+private:
+    Lock m_lock;
+    Vector<PerfProbe*> m_probes WTF_GUARDED_BY_LOCK(m_lock);
+};
+
+PerfProbeRegistry& perfProbeRegistry()
+{
+    static NeverDestroyed<PerfProbeRegistry> registry;
+    return registry;
+}
+
+jclass perfLoggerClass(JNIEnv* env)
+{
+    static JGClass cls(
+        env->FindClass("com/sun/webkit/perf/PerfLogger"));
+    return cls;
+}
+
+} // namespace
+
+PerfProbe::PerfProbe(JNIEnv* env, const char* loggerName, const char* probeName)
+{
+    size_t id = perfProbeRegistry().add(*this);
+
+    static jmethodID mid =
+        env->GetStaticMethodID(perfLoggerClass(env),
+            "registerNativeProbe",
+            "(Ljava/lang/String;Ljava/lang/String;I)Z");
+    ASSERT(mid);
+
+    m_enabled = env->CallStaticBooleanMethod(perfLoggerClass(env), mid,
+        (jstring)JLString(env->NewStringUTF(loggerName)),
+        (jstring)JLString(env->NewStringUTF(probeName)),
+        static_cast<jint>(id)) == JNI_TRUE;
+    if (CheckAndClearException(env))
+        m_enabled = false;
+}
+
+Vector<uint64_t> PerfProbe::snapshot()
+{
+    auto probes = perfProbeRegistry().probes();
+    Vector<uint64_t> stats;
+    stats.reserveInitialCapacity(probes.size() * 2);
+    for (auto* probe : probes) {
+        stats.append(probe->m_count.load(std::memory_order_relaxed));
+        stats.append(probe->m_totalNanoseconds.load(std::memory_order_relaxed));
+    }
+    return stats;
+}
+
+extern "C" {
+
+/*
+ * Class:     com_sun_webkit_perf_PerfLogger
+ * Method:    twkGetNativeProbeStats
+ * Signature: ()[J
+ */
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_perf_PerfLogger_twkGetNativeProbeStats
+  (JNIEnv* env, jclass)
+{
+    auto stats = PerfProbe::snapshot();
+    jlongArray result = env->NewLongArray(static_cast<jsize>(stats.size()));
+    if (!result)
+        return nullptr;
+    env->SetLongArrayRegion(result, 0, static_cast<jsize>(stats.size()), reinterpret_cast<const jlong*>(stats.data()));
+    return result;
+}
+
+}
+
+} // namespace WTF
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <jni.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Vector.h>
+
+namespace WTF {
+
+// A com.sun.webkit.perf.PerfLogger probe that is timed in native code.
+// The probe is registered with its Java logger once, which also tells
+// whether the logger is enabled. After that entering and leaving the
+// probe only updates two atomic counters, and PerfLogger reads all of
+// them in one call when it reports its statistics.
+class PerfProbe {
+public:
+    WTF_EXPORT_PRIVATE PerfProbe(JNIEnv*, const char* loggerName, const char* probeName);
+
+    bool isEnabled() const { return m_enabled; }
+
+    void record(Seconds elapsed)
+    {
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_totalNanoseconds.fetch_add(static_cast<uint64_t>(elapsed.nanoseconds()), std::memory_order_relaxed);
+    }
+
+    // Returns the count and the total time in nanoseconds of every
+    // registered probe, in the order of their IDs.
+    WTF_EXPORT_PRIVATE static Vector<uint64_t> snapshot();
+
+private:
+    std::atomic<uint64_t> m_count { 0 };
+    std::atomic<uint64_t> m_totalNanoseconds { 0 };
+    bool m_enabled { false };
+};
+
+class PerfProbeScope {
+public:
+    explicit PerfProbeScope(PerfProbe& probe)
+        : m_probe(probe.isEnabled() ? &probe : nullptr)
+    {
+        if (m_probe)
+            m_start = MonotonicTime::now();
+    }
+
+    ~PerfProbeScope()
+    {
+        if (m_probe)
+            m_probe->record(MonotonicTime::now() - m_start);
+    }
+
+private:
+    PerfProbe* m_probe;
+    MonotonicTime m_start;
+};
+
+} // namespace WTF
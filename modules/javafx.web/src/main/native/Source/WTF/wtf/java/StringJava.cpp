@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,9 @@
 
 #include "config.h"
 
+#include <algorithm>
+#include <wtf/ASCIICType.h>
+#include <wtf/StdLibExtras.h>
 #include <wtf/Vector.h>
 #include <wtf/text/WTFString.h>
 
@@ -42,8 +45,10 @@ String::String(JNIEnv* env, const JLString &s)
         } else {
             const jchar* str = env->GetStringCritical(s, NULL);
             if (str) {
+                // Most strings coming from Java (URLs, tag and attribute
+                // names, script results) are Latin-1, keep them 8-bit.
                 std::span<const UChar> createSpan(reinterpret_cast<const UChar*>(str), len);
-                m_impl = StringImpl::create(createSpan);
+                m_impl = StringImpl::create8BitIfPossible(createSpan);
                 env->ReleaseStringCritical(s, str);
             } else {
                 std::span<const UChar> createSpan(reinterpret_cast<const UChar*>(str), 3);
@@ -60,10 +65,20 @@ JLString String::toJavaString(JNIEnv *env) const
     } else {
         const unsigned len = length();
         if (is8Bit()) {
+            std::span<const LChar> span = span8();
+            // ASCII without NULs is valid modified UTF-8. NewStringUTF lets
+            // the JVM build a compact Latin-1 string from it directly,
+            // without an intermediate UTF-16 copy.
+            if (std::ranges::all_of(span, [](auto c) { return c && isASCII(c); })) {
+                Vector<char> utf(len + 1);
+                memcpySpan(utf.mutableSpan(), span);
+                utf[len] = '\0';
+                return env->NewStringUTF(utf.data());
+            }
             // Convert latin1 chars to unicode.
             Vector<jchar> jchars(len);
             for (unsigned i = 0; i < len; i++) {
-                jchars[i] = characterAt(i);
+                jchars[i] = span[i];
             }
             return env->NewString(jchars.data(), len);
         } else {
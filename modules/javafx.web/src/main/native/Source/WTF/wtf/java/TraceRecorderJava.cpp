@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include <wtf/java/TraceRecorderJava.h>
+
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/SystemTracing.h>
+#include <wtf/Threading.h>
+#include <wtf/Vector.h>
+#include <wtf/text/StringBuilder.h>
+
+namespace WTF {
+
+std::atomic<bool> TraceRecorder::s_enabled { false };
+std::atomic<uint64_t> TraceRecorder::s_upcallCount { 0 };
+
+namespace {
+
+struct TraceEvent {
+    MonotonicTime time;
+    uint64_t data;
+    uint64_t upcallCount;
+    uint32_t threadID;
+    TracePointCode code;
+};
+
+// About 1.3 MB, enough for several seconds of a busy page.
+constexpr size_t maxEventCount = 32768;
+
+class TraceBuffer {
+public:
+    void clear()
+    {
+        Locker locker { m_lock };
+        m_events.clear();
+        m_next = 0;
+    }
+
+    void append(const TraceEvent& event)
+    {
+        Locker locker { m_lock };
+        if (m_events.size() < maxEventCount) {
+            m_events.append(event);
+            return;
+        }
+        m_events[m_next] = event;
+        m_next = (m_next + 1) % maxEventCount;
+    }
+
+    // Returns the events from the oldest to the newest.
+    Vector<TraceEvent> events()
+    {
+        Locker locker { m_lock };
+        Vector<TraceEvent> events;
+        events.reserveInitialCapacity(m_events.size());
+        events.append(m_events.span().subspan(m_next));
+        events.append(m_events.span().first(m_next));
+        return events;
+    }
+
+private:
+    Lock m_lock;
+    Vector<TraceEvent> m_events WTF_GUARDED_BY_LOCK(m_lock);
+    size_t m_next WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+};
+
+TraceBuffer& traceBuffer()
+{
+    static NeverDestroyed<TraceBuffer> buffer;
+    return buffer;
+}
+
+struct TraceEventDescription {
+    ASCIILiteral name;
+    char phase;
+};
+
+TraceEventDescription describe(TracePointCode code)
+{
+    switch (code) {
+    case VMEntryScopeStart: return { "JavaScript"_s, 'B' };
+    case VMEntryScopeEnd: return { "JavaScript"_s, 'E' };
+    case IncrementalSweepStart: return { "IncrementalSweep"_s, 'B' };
+    case IncrementalSweepEnd: return { "IncrementalSweep"_s, 'E' };
+    case MainResourceLoadDidStartProvisional: return { "MainResourceLoadStart"_s, 'i' };
+    case MainResourceLoadDidEnd: return { "MainResourceLoadEnd"_s, 'i' };
+    case StyleRecalcStart: return { "StyleRecalc"_s, 'B' };
+    case StyleRecalcEnd: return { "StyleRecalc"_s, 'E' };
+    case RenderTreeBuildStart: return { "RenderTreeBuild"_s, 'B' };
+    case RenderTreeBuildEnd: return { "RenderTreeBuild"_s, 'E' };
+    case PerformLayoutStart: return { "Layout"_s, 'B' };
+    case PerformLayoutEnd: return { "Layout"_s, 'E' };
+    case RenderTreeLayoutStart: return { "RenderTreeLayout"_s, 'B' };
+    case RenderTreeLayoutEnd: return { "RenderTreeLayout"_s, 'E' };
+    case AsyncImageDecodeStart: return { "ImageDecode"_s, 'B' };
+    case AsyncImageDecodeEnd: return { "ImageDecode"_s, 'E' };
+    case RAFCallbackStart: return { "RequestAnimationFrame"_s, 'B' };
+    case RAFCallbackEnd: return { "RequestAnimationFrame"_s, 'E' };
+    case MemoryPressureHandlerStart: return { "MemoryPressureHandler"_s, 'B' };
+    case MemoryPressureHandlerEnd: return { "MemoryPressureHandler"_s, 'E' };
+    case RenderingUpdateStart: return { "RenderingUpdate"_s, 'B' };
+    case RenderingUpdateEnd: return { "RenderingUpdate"_s, 'E' };
+    case ParseHTMLStart: return { "ParseHTML"_s, 'B' };
+    case ParseHTMLEnd: return { "ParseHTML"_s, 'E' };
+    case WebPagePaintStart: return { "Paint"_s, 'B' };
+    case WebPagePaintEnd: return { "Paint"_s, 'E' };
+    case RenderingQueueFlush: return { "RenderingQueueFlush"_s, 'i' };
+    default: return { { }, 'i' };
+    }
+}
+
+} // namespace
+
+void TraceRecorder::setEnabled(bool enabled)
+{
+    if (enabled && !isEnabled()) {
+        traceBuffer().clear();
+        s_upcallCount.store(0, std::memory_order_relaxed);
+    }
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void TraceRecorder::record(int code, uint64_t data)
+{
+    traceBuffer().append({
+        MonotonicTime::now(),
+        data,
+        s_upcallCount.load(std::memory_order_relaxed),
+        Thread::current().uid(),
+        static_cast<TracePointCode>(code)
+    });
+}
+
+String TraceRecorder::chromeTraceJSON()
+{
+    StringBuilder json;
+    json.append("{\"traceEvents\":["_s);
+    auto events = traceBuffer().events();
+    bool first = true;
+    uint64_t lastUpcallCount = events.isEmpty() ? 0 : events[0].upcallCount;
+    for (auto& event : events) {
+        auto description = describe(event.code);
+        if (description.name.isNull())
+            description.name = "TracePoint"_s;
+        if (!first)
+            json.append(',');
+        first = false;
+        json.append("{\"name\":\""_s, description.name, "\",\"ph\":\""_s, description.phase,
+            "\",\"ts\":"_s, static_cast<uint64_t>(event.time.secondsSinceEpoch().microseconds()),
+            ",\"pid\":1,\"tid\":"_s, event.threadID);
+        if (description.phase == 'i')
+            json.append(",\"s\":\"t\""_s);
+        if (event.code == RenderingQueueFlush)
+            json.append(",\"args\":{\"bytes\":"_s, event.data, '}');
+        else if (description.phase == 'i')
+            json.append(",\"args\":{\"code\":"_s, static_cast<unsigned>(event.code), '}');
+        json.append('}');
+
+        // The upcalls made between two events are reported as a counter.
+        if (event.upcallCount != lastUpcallCount) {
+            json.append(",{\"name\":\"JNIUpcalls\",\"ph\":\"C\",\"ts\":"_s,
+                static_cast<uint64_t>(event.time.secondsSinceEpoch().microseconds()),
+                ",\"pid\":1,\"args\":{\"count\":"_s, event.upcallCount - lastUpcallCount, "}}"_s);
+            lastUpcallCount = event.upcallCount;
+        }
+    }
+    json.append("]}"_s);
+    return json.toString();
+}
+
+} // namespace WTF
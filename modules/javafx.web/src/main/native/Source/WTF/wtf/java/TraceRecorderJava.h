@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <wtf/Forward.h>
+
+namespace WTF {
+
+// Keeps the trace points of the Java port in a fixed size ring buffer
+// while tracing is enabled, so that a timeline of the most recent work
+// can be dumped in the Chrome trace event format without a profiler.
+class TraceRecorder {
+public:
+    static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+    WTF_EXPORT_PRIVATE static void setEnabled(bool);
+
+    // Takes a TracePointCode, see SystemTracing.h which includes this header.
+    WTF_EXPORT_PRIVATE static void record(int code, uint64_t data);
+
+    // Called for every JNI upcall that checks for a pending exception.
+    static void countUpcall()
+    {
+        if (isEnabled())
+            s_upcallCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns the recorded events as a JSON object with a traceEvents array.
+    WTF_EXPORT_PRIVATE static String chromeTraceJSON();
+
+private:
+    WTF_EXPORT_PRIVATE static std::atomic<bool> s_enabled;
+    WTF_EXPORT_PRIVATE static std::atomic<uint64_t> s_upcallCount;
+};
+
+} // namespace WTF
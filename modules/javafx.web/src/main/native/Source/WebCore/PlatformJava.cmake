@@ -90,6 +90,7 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     bindings/java/JavaEventListener.h
     bindings/java/EventListenerManager.h
     bindings/java/JavaNodeFilterCondition.h
+    bindings/java/ScriptBytecodeCacheJava.h
     bridge/jni/jsc/BridgeUtils.h
     dom/DOMStringList.h
     platform/graphics/java/ImageBufferJavaBackend.h
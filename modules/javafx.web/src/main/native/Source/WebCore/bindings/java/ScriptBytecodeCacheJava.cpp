@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "ScriptBytecodeCacheJava.h"
+
+#include <JavaScriptCore/VM.h>
+#include <stdio.h>
+#include <wtf/FileSystem.h>
+#include <wtf/MainThread.h>
+#include <wtf/MallocPtr.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/SHA1.h>
+#include <wtf/Scope.h>
+#include <wtf/URL.h>
+#include <wtf/text/MakeString.h>
+#include <wtf/text/WTFString.h>
+
+#if OS(WINDOWS)
+#include <windows.h>
+#endif
+
+namespace WebCore {
+
+namespace ScriptBytecodeCacheJava {
+
+// Smaller scripts parse faster than their cache file can be looked up.
+static constexpr unsigned minimumSourceLength = 64 * 1024;
+
+static String& cacheDirectory()
+{
+    static NeverDestroyed<String> directory;
+    return directory;
+}
+
+void setDirectory(const String& directory)
+{
+    cacheDirectory() = directory;
+}
+
+bool isEnabledFor(const JSC::SourceProvider& provider)
+{
+    if (!isMainThread() || cacheDirectory().isEmpty())
+        return false;
+    const URL& url = provider.sourceOrigin().url();
+    if (!url.protocolIsInHTTPFamily() && !url.protocolIsFile())
+        return false;
+    return provider.source().length() >= minimumSourceLength;
+}
+
+static String cachePath(const JSC::SourceProvider& provider)
+{
+    // The name covers the URL and the whole source text, so that a changed
+    // script never picks up the bytecode of an older version of itself.
+    SHA1 sha1;
+    sha1.addUTF8Bytes(provider.sourceOrigin().url().string());
+    StringView source = provider.source();
+    uint8_t is8Bit = source.is8Bit();
+    sha1.addBytes(std::span { &is8Bit, 1 });
+    if (source.is8Bit())
+        sha1.addBytes(source.span8());
+    else
+        sha1.addBytes(std::as_bytes(source.span16()));
+    return FileSystem::pathByAppendingComponent(cacheDirectory(), makeString(String::fromLatin1(sha1.computeHexDigest().data()), ".jsbc"_s));
+}
+
+#if OS(WINDOWS)
+static Vector<wchar_t> widePath(const String& path)
+{
+    Vector<wchar_t> result;
+    result.reserveInitialCapacity(path.length() + 1);
+    for (auto c : StringView(path).codeUnits())
+        result.append(c);
+    result.append(0);
+    return result;
+}
+#endif
+
+static FILE* openFile(const String& path, bool forWriting)
+{
+#if OS(WINDOWS)
+    return _wfopen(widePath(path).data(), forWriting ? L"wb" : L"rb");
+#else
+    return fopen(path.utf8().data(), forWriting ? "wb" : "rb");
+#endif
+}
+
+static bool replaceFile(const String& from, const String& to)
+{
+#if OS(WINDOWS)
+    return MoveFileExW(widePath(from).data(), widePath(to).data(), MOVEFILE_REPLACE_EXISTING);
+#else
+    return !rename(from.utf8().data(), to.utf8().data());
+#endif
+}
+
+RefPtr<JSC::CachedBytecode> load(const JSC::SourceProvider& provider)
+{
+    FILE* file = openFile(cachePath(provider), false);
+    if (!file)
+        return nullptr;
+    auto closeFile = makeScopeExit([&] {
+        fclose(file);
+    });
+
+    if (fseek(file, 0, SEEK_END))
+        return nullptr;
+    long size = ftell(file);
+    if (size <= 0 || fseek(file, 0, SEEK_SET))
+        return nullptr;
+
+    auto data = MallocPtr<uint8_t, JSC::VMMalloc>::malloc(size);
+    if (fread(data.get(), 1, size, file) != static_cast<size_t>(size))
+        return nullptr;
+    // JavaScriptCore checks the version and the source key of the payload
+    // when decoding it and falls back to parsing if they do not match.
+    return JSC::CachedBytecode::create(WTFMove(data), size, { });
+}
+
+void store(const JSC::SourceProvider& provider, const JSC::CachedBytecode& bytecode)
+{
+    auto data = bytecode.span();
+    if (data.empty())
+        return;
+
+    // Write next to the final name and move it into place, so that a
+    // concurrent reader never sees a partially written file.
+    String path = cachePath(provider);
+    String temporaryPath = makeString(path, ".tmp"_s);
+    FILE* file = openFile(temporaryPath, true);
+    if (!file)
+        return;
+    bool written = fwrite(data.data(), 1, data.size(), file) == data.size();
+    written = !fclose(file) && written;
+    if (!written || !replaceFile(temporaryPath, path))
+        FileSystem::deleteFile(temporaryPath);
+}
+
+} // namespace ScriptBytecodeCacheJava
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,7 +61,7 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
                 NodeImpl node = (NodeImpl) disposer.get();
                 if (node != null) {
                     // the peer need to be deref'ed!
-                    NodeImpl.dispose(peer);
+                    releasePeer(peer);
                     return node;
                 }
                 if (prev != null)
@@ -84,6 +84,30 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
         return node;
     }
 
+    // A cache hit still owns the reference taken by the native getter.
+    // Releasing it costs a JNI transition per access, so the references
+    // are collected here and released in bulk instead. The nodes stay
+    // alive through their cached wrapper meanwhile.
+    private static final long[] pendingPeers = new long[256];
+    private static int pendingCount;
+
+    private static void releasePeer(long peer) {
+        pendingPeers[pendingCount++] = peer;
+        if (pendingCount == pendingPeers.length) {
+            releasePendingPeers();
+        }
+    }
+
+    private static void releasePendingPeers() {
+        if (pendingCount > 0) {
+            int count = pendingCount;
+            pendingCount = 0;
+            NodeImpl.disposePeers(pendingPeers, count);
+        }
+    }
+
+    native private static void disposePeers(long[] peers, int count);
+
     static int test_getHashCount() {
         return hashCount;
     }
@@ -133,6 +157,7 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
                 disposer = next;
             }
             NodeImpl.dispose(peer);
+            releasePendingPeers();
         }
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,19 +33,26 @@ import org.w3c.dom.NodeList;
 public class NodeListImpl implements NodeList {
     private static class SelfDisposer implements DisposerRecord {
         private final long peer;
+        private long[] items;
         SelfDisposer(final long peer) {
             this.peer = peer;
         }
 
         @Override
         public void dispose() {
+            if (items != null) {
+                NodeListImpl.releaseItemsImpl(items);
+            }
             NodeListImpl.dispose(peer);
         }
     }
 
+    private final SelfDisposer disposer;
+
     NodeListImpl(long peer) {
         this.peer = peer;
-        Disposer.addRecord(this, new SelfDisposer(peer));
+        this.disposer = new SelfDisposer(peer);
+        Disposer.addRecord(this, disposer);
     }
 
     static NodeList create(long peer) {
@@ -79,9 +86,34 @@ public class NodeListImpl implements NodeList {
     }
 
 
+// Static lists, such as querySelectorAll results, never change, so their
+// items are fetched with a single native call on first access. Peers that
+// have not been wrapped yet are released together with the list.
+    private boolean itemsFetched;
+    private Node[] nodes;
+
+    private boolean fetchItems() {
+        if (!itemsFetched) {
+            itemsFetched = true;
+            long[] items = itemsImpl(getPeer());
+            if (items != null) {
+                disposer.items = items;
+                nodes = new Node[items.length];
+            }
+        }
+        return nodes != null;
+    }
+
+    native static long[] itemsImpl(long peer);
+    native static void releaseItemsImpl(long[] items);
+
+
 // Attributes
     @Override
     public int getLength() {
+        if (fetchItems()) {
+            return nodes.length;
+        }
         return getLengthImpl(getPeer());
     }
     native static int getLengthImpl(long peer);
@@ -91,6 +123,17 @@ public class NodeListImpl implements NodeList {
     @Override
     public Node item(int index)
     {
+        if (fetchItems()) {
+            if (index < 0 || index >= nodes.length) {
+                return null;
+            }
+            if (nodes[index] == null) {
+                long[] items = disposer.items;
+                nodes[index] = NodeImpl.getImpl(items[index]);
+                items[index] = 0L;
+            }
+            return nodes[index];
+        }
         return NodeImpl.getImpl(itemImpl(getPeer()
             , index));
     }
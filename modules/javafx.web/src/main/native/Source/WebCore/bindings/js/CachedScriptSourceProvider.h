@@ -31,6 +31,10 @@
 #include "CachedScriptFetcher.h"
 #include <JavaScriptCore/SourceProvider.h>
 
+#if PLATFORM(JAVA)
+#include "ScriptBytecodeCacheJava.h"
+#endif
+
 namespace WebCore {
 
 class CachedScriptSourceProvider : public JSC::SourceProvider, public CachedResourceClient {
@@ -46,6 +50,23 @@ public:
     unsigned hash() const override;
     StringView source() const override;
 
+#if PLATFORM(JAVA)
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const final
+    {
+        if (!ScriptBytecodeCacheJava::isEnabledFor(*this))
+            return nullptr;
+        return ScriptBytecodeCacheJava::load(*this);
+    }
+
+    void cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const final
+    {
+        if (!ScriptBytecodeCacheJava::isEnabledFor(*this))
+            return;
+        if (auto bytecode = generator())
+            ScriptBytecodeCacheJava::store(*this, *bytecode);
+    }
+#endif
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), cachedScript->response().isRedirected() ? String(cachedScript->url().string()) : String(), JSC::SourceTaintedOrigin::Untainted, TextPosition(), sourceType)
@@ -433,6 +433,55 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_setSlotImpl
     JSObjectSetPropertyAtIndex(ctx, object, (unsigned) index, jsvalue, nullptr);
 }
 
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_dom_JSObject_getSlotsImpl
+  (JNIEnv *env, jclass, jlong peer, jint peer_type, jint index, jint count)
+{
+    JSObjectRef object;
+    JSContextRef ctx;
+    RefPtr<JSC::Bindings::RootObject> rootObject(checkJSPeer(peer, peer_type, object, ctx));
+    if (rootObject.get() == nullptr) {
+        throwNullPointerException(env);
+        return nullptr;
+    }
+
+    static JGClass objectClass(env->FindClass("java/lang/Object"));
+    jobjectArray result = env->NewObjectArray(count, objectClass, nullptr);
+    if (!result)
+        return nullptr;
+
+    // Hold the lock across the whole batch, so that the accessors below
+    // only re-enter it.
+    JSC::JSLockHolder lock(toJS(ctx));
+    for (jint i = 0; i < count; i++) {
+        JSValueRef value = JSObjectGetPropertyAtIndex(ctx, object, (unsigned) (index + i), nullptr);
+        JLObject jvalue(WebCore::JSValue_to_Java_Object(value, env, ctx, rootObject.get()));
+        if (env->ExceptionCheck())
+            return nullptr;
+        env->SetObjectArrayElement(result, i, jvalue);
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_JSObject_setSlotsImpl
+(JNIEnv *env, jclass, jlong peer, jint peer_type, jint index, jobjectArray values, jobject accessControlContext)
+{
+    JSObjectRef object;
+    JSContextRef ctx;
+    RefPtr<JSC::Bindings::RootObject> rootObject(checkJSPeer(peer, peer_type, object, ctx));
+    if (rootObject.get() == nullptr) {
+        throwNullPointerException(env);
+        return;
+    }
+
+    JSC::JSLockHolder lock(toJS(ctx));
+    jsize count = env->GetArrayLength(values);
+    for (jsize i = 0; i < count; i++) {
+        JLObject value(env->GetObjectArrayElement(values, i));
+        JSValueRef jsvalue = WebCore::Java_Object_to_JSValue(env, ctx, rootObject.get(), value, accessControlContext);
+        JSObjectSetPropertyAtIndex(ctx, object, (unsigned) (index + i), jsvalue, nullptr);
+    }
+}
+
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_JSObject_toStringImpl
 (JNIEnv *env, jclass, jlong peer, jint peer_type)
 {
@@ -34,6 +34,8 @@
 #include "runtime_object.h"
 #include "runtime_root.h"
 #include <JavaScriptCore/JSArray.h>
+#include <JavaScriptCore/JSArrayBuffer.h>
+#include <JavaScriptCore/JSArrayBufferViewInlines.h>
 #include <JavaScriptCore/JSLock.h>
 
 #include "JavaArrayJSC.h"
@@ -61,6 +63,80 @@ static jchar toJCharValue(const JSValue& value, JSGlobalObject* globalObject)
     return (jchar)value.toNumber(globalObject);
 }
 
+template<typename ArrayType, typename ElementType>
+static jobject copyToJavaArray(JNIEnv* env, std::span<const uint8_t> data,
+    ArrayType (JNIEnv::*newArray)(jsize),
+    void (JNIEnv::*setArrayRegion)(ArrayType, jsize, jsize, const ElementType*))
+{
+    size_t length = data.size() / sizeof(ElementType);
+    if (length > static_cast<size_t>(std::numeric_limits<jsize>::max()))
+        return nullptr;
+
+    ArrayType array = (env->*newArray)(length);
+    if (!array) {
+        env->ExceptionClear();
+        return nullptr;
+    }
+    (env->*setArrayRegion)(array, 0, length, reinterpret_cast<const ElementType*>(data.data()));
+    return array;
+}
+
+// Copies a typed array or an ArrayBuffer into a new Java array of the
+// matching primitive type in one go, e.g. a Float64Array into a double[].
+// Returns null if the element types do not match.
+static jobject convertTypedArrayToJavaArray(JSObject* object, const char* javaClassName)
+{
+    if (javaClassName[0] != '[' || !javaClassName[1] || javaClassName[2])
+        return nullptr;
+
+    std::span<const uint8_t> data;
+    TypedArrayType type = TypeDataView;
+    if (auto* view = jsDynamicCast<JSArrayBufferView*>(object)) {
+        if (view->isOutOfBounds())
+            return nullptr;
+        type = typedArrayType(view->type());
+        data = view->span();
+    } else if (auto* buffer = jsDynamicCast<JSArrayBuffer*>(object)) {
+        if (!buffer->impl() || buffer->impl()->isDetached())
+            return nullptr;
+        data = buffer->impl()->span();
+    } else
+        return nullptr;
+
+    JNIEnv* env = getJNIEnv();
+    switch (javaClassName[1]) {
+    case 'B':
+        if (type == TypeInt8 || type == TypeUint8 || type == TypeUint8Clamped || type == TypeDataView)
+            return copyToJavaArray(env, data, &JNIEnv::NewByteArray, &JNIEnv::SetByteArrayRegion);
+        break;
+    case 'S':
+        if (type == TypeInt16 || type == TypeUint16)
+            return copyToJavaArray(env, data, &JNIEnv::NewShortArray, &JNIEnv::SetShortArrayRegion);
+        break;
+    case 'C':
+        if (type == TypeUint16)
+            return copyToJavaArray(env, data, &JNIEnv::NewCharArray, &JNIEnv::SetCharArrayRegion);
+        break;
+    case 'I':
+        if (type == TypeInt32 || type == TypeUint32)
+            return copyToJavaArray(env, data, &JNIEnv::NewIntArray, &JNIEnv::SetIntArrayRegion);
+        break;
+    case 'J':
+        if (type == TypeBigInt64 || type == TypeBigUint64)
+            return copyToJavaArray(env, data, &JNIEnv::NewLongArray, &JNIEnv::SetLongArrayRegion);
+        break;
+    case 'F':
+        if (type == TypeFloat32)
+            return copyToJavaArray(env, data, &JNIEnv::NewFloatArray, &JNIEnv::SetFloatArrayRegion);
+        break;
+    case 'D':
+        if (type == TypeFloat64)
+            return copyToJavaArray(env, data, &JNIEnv::NewDoubleArray, &JNIEnv::SetDoubleArrayRegion);
+        break;
+    }
+    return nullptr;
+}
+
 jobject convertUndefinedToJObject()
 {
     static JGObject jgoUndefined;
@@ -115,6 +191,8 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
                         return result;
                     }
                     result.l = array->javaArray();
+                } else if (javaType == JavaTypeArray) {
+                    result.l = convertTypedArrayToJavaArray(object, javaClassName);
                 } else if ((!result.l && (!strcmp(javaClassName, "java.lang.Object")))
                            || (!strcmp(javaClassName, "netscape.javascript.JSObject"))) {
                     // Wrap objects in JSObject instances.
@@ -253,50 +331,49 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
 
 jobject jvalueToJObject(jvalue value, JavaType jtype) {
     JNIEnv* env = getJNIEnv();
-    jmethodID meth;
     switch (jtype) {
     case JavaTypeObject:
     case JavaTypeArray:
         return value.l;
     case JavaTypeBoolean: {
       static JGClass clsZ(env->FindClass("java/lang/Boolean"));
-      meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
+      static jmethodID meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
       return env->CallStaticObjectMethod(clsZ, meth, value.z);
     }
     case JavaTypeChar: {
       static JGClass clsC(env->FindClass("java/lang/Character"));
-      meth = env->GetStaticMethodID(clsC, "valueOf",
-                                    "(C)Ljava/lang/Character;");
+      static jmethodID meth = env->GetStaticMethodID(clsC, "valueOf",
+                                                     "(C)Ljava/lang/Character;");
       return env->CallStaticObjectMethod(clsC, meth, value.c);
     }
     case JavaTypeByte: {
       static JGClass clsB(env->FindClass("java/lang/Byte"));
-      meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
+      static jmethodID meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
       return env->CallStaticObjectMethod(clsB, meth, value.b);
     }
     case JavaTypeShort: {
       static JGClass clsS(env->FindClass("java/lang/Short"));
-      meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
+      static jmethodID meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
       return env->CallStaticObjectMethod(clsS, meth, value.s);
     }
     case JavaTypeInt: {
       static JGClass clsI(env->FindClass("java/lang/Integer"));
-      meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
+      static jmethodID meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
       return env->CallStaticObjectMethod(clsI, meth, value.i);
     }
     case JavaTypeLong: {
       static JGClass clsJ(env->FindClass("java/lang/Long"));
-      meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
+      static jmethodID meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
       return env->CallStaticObjectMethod(clsJ, meth, value.j);
     }
     case JavaTypeFloat: {
       static JGClass clsF(env->FindClass("java/lang/Float"));
-      meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
+      static jmethodID meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
       return env->CallStaticObjectMethod(clsF, meth, value.f);
     }
     case JavaTypeDouble: {
       static JGClass clsD(env->FindClass("java/lang/Double"));
-      meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
+      static jmethodID meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
       return env->CallStaticObjectMethod(clsD, meth, value.d);
     }
     default:
@@ -304,6 +381,12 @@ jobject jvalueToJObject(jvalue value, JavaType jtype) {
     }
 }
 
+static jmethodID numberValueMethod(JNIEnv* env, const char* name, const char* sig)
+{
+    static JGClass clsNumber(env->FindClass("java/lang/Number"));
+    return env->GetMethodID(clsNumber, name, sig);
+}
+
 jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
 
     // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
@@ -315,23 +398,39 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
-    jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
-    for (int i = 0;  i < count; i++)
-      env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
+    JLClass objClass(env->GetObjectClass(obj));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, isStatic));
+    return dispatchJNICall(count, obj, rmethod, returnType, args, result, accessControlContext);
+}
+
+jthrowable dispatchJNICall(int count, jobject obj, jobject reflectedMethod, JavaType returnType, jobject* args, jvalue& result, jobject accessControlContext) {
+
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+
+    if (!jlinstance) {
+        LOG_ERROR("Could not get javaInstance for %p in JNIUtilityPrivate::dispatchJNICall", (jobject)jlinstance);
+        return NULL;
+    }
+
+    JNIEnv* env = getJNIEnv();
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    static jmethodID invokeMethod =
         env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
                                "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+    JLObjectArray argsArray(env->NewObjectArray(count, objectCls, NULL));
+    for (int i = 0;  i < count; i++)
+      env->SetObjectArrayElement(argsArray, i, args[i]);
     jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
+                                            reflectedMethod, obj, (jobjectArray)argsArray,
                                             accessControlContext);
 
     jthrowable ex = env->ExceptionOccurred();
     env->ExceptionClear();
 
+    // Unbox primitive results with method IDs resolved once, the boxed
+    // value itself is not needed afterwards.
     switch (returnType) {
     case JavaTypeVoid:
         {
@@ -343,40 +442,58 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     // to treat it as JS foreign object.
     case JavaTypeChar:
         result.l = r;
+        r = NULL;
         break;
 
-    case JavaTypeBoolean:
-        result.z = callJNIMethod<jboolean>(r, "booleanValue", "()Z");
+    case JavaTypeBoolean: {
+        static JGClass clsBoolean(env->FindClass("java/lang/Boolean"));
+        static jmethodID mid = env->GetMethodID(clsBoolean, "booleanValue", "()Z");
+        result.z = r ? env->CallBooleanMethod(r, mid) : 0;
         break;
+    }
 
-    case JavaTypeByte:
-        result.b = callJNIMethod<jbyte>(r, "byteValue", "()B");
+    case JavaTypeByte: {
+        static jmethodID mid = numberValueMethod(env, "byteValue", "()B");
+        result.b = r ? env->CallByteMethod(r, mid) : 0;
         break;
+    }
 
-    case JavaTypeShort:
-        result.s = callJNIMethod<jshort>(r, "shortValue", "()S");
+    case JavaTypeShort: {
+        static jmethodID mid = numberValueMethod(env, "shortValue", "()S");
+        result.s = r ? env->CallShortMethod(r, mid) : 0;
         break;
+    }
 
-    case JavaTypeInt:
-        result.i = callJNIMethod<jint>(r, "intValue", "()I");
+    case JavaTypeInt: {
+        static jmethodID mid = numberValueMethod(env, "intValue", "()I");
+        result.i = r ? env->CallIntMethod(r, mid) : 0;
         break;
+    }
 
-    case JavaTypeLong:
-        result.j = callJNIMethod<jlong>(r, "longValue", "()J");
+    case JavaTypeLong: {
+        static jmethodID mid = numberValueMethod(env, "longValue", "()J");
+        result.j = r ? env->CallLongMethod(r, mid) : 0;
         break;
+    }
 
-    case JavaTypeFloat:
-        result.f = callJNIMethod<jfloat>(r, "floatValue", "()F");
+    case JavaTypeFloat: {
+        static jmethodID mid = numberValueMethod(env, "floatValue", "()F");
+        result.f = r ? env->CallFloatMethod(r, mid) : 0;
         break;
+    }
 
-    case JavaTypeDouble:
-        result.d = callJNIMethod<jdouble>(r, "doubleValue", "()D");
+    case JavaTypeDouble: {
+        static jmethodID mid = numberValueMethod(env, "doubleValue", "()D");
+        result.d = r ? env->CallDoubleMethod(r, mid) : 0;
         break;
+    }
 
     case JavaTypeInvalid:
         /* Nothing to do */
         break;
     }
+    if (r)
+        env->DeleteLocalRef(r);
     return ex;
 }
 
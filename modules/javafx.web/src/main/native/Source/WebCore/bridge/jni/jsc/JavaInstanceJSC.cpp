@@ -310,10 +310,9 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
     Vector<jobject> jArgs(count);
 
     for (int i = 0; i < count; i++) {
-        CString javaClassName = jMethod->parameterAt(i).utf8();
-        JavaType jtype = javaTypeFromClassName(javaClassName.data());
+        JavaType jtype = jMethod->parameterTypeAt(i);
         jvalue jarg = convertValueToJValue(globalObject, m_rootObject.get(),
-            callFrame->argument(i), jtype, javaClassName.data());
+            callFrame->argument(i), jtype, jMethod->parameterClassNameAt(i));
         jArgs[i] = jvalueToJObject(jarg, jtype);
 #if !PLATFORM(JAVA)
         LOG(LiveConnect, "JavaInstance::invokeMethod arg[%d] = %s", i, callFrame->argument(i).toString(globalObject)->value(globalObject).ascii().data());
@@ -343,13 +342,23 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         }
 
         // const char *callingURL = 0; // FIXME, need to propagate calling URL to Java
-        jmethodID methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
-
-        jthrowable ex = dispatchJNICall(callFrame->argumentCount(), rootObject,
-                                        obj, jMethod->isStatic(),
-                                        jMethod->returnType(), methodId,
+        // The reflected method is kept by JavaMethod, no need to look it up
+        // by name and signature on every call.
+        jthrowable ex = dispatchJNICall(callFrame->argumentCount(), obj,
+                                        jMethod->reflectedMethod(),
+                                        jMethod->returnType(),
                                         jArgs.data(), result,
                                         accessControlContext());
+
+        // Release the boxed primitive arguments right away, a script looping
+        // over a Java method would otherwise pile them up as local references.
+        JNIEnv* env = getJNIEnv();
+        for (int i = 0; i < count; i++) {
+            JavaType jtype = jMethod->parameterTypeAt(i);
+            if (jtype != JavaTypeObject && jtype != JavaTypeArray && jArgs[i])
+                env->DeleteLocalRef(jArgs[i]);
+        }
+
         if (ex != NULL) {
             JSValue exceptionDescription
               = (JavaInstance::create(ex, rootObject, accessControlContext())
@@ -32,6 +32,8 @@
 #include "JavaType.h"
 
 #include "JavaStringJSC.h"
+#include <wtf/java/JavaRef.h>
+#include <wtf/text/CString.h>
 
 namespace JSC {
 
@@ -47,15 +49,22 @@ public:
     const String name() const { return m_name.impl(); }
     RuntimeType returnTypeClassName() const { return m_returnTypeClassName.utf8(); }
     const String parameterAt(int i) const { return m_parameters[i]; }
+    const char* parameterClassNameAt(int i) const { return m_parameterClassNames[i].data(); }
+    JavaType parameterTypeAt(int i) const { return m_parameterTypes[i]; }
     const char* signature() const;
     JavaType returnType() const { return m_returnType; }
     bool isStatic() const { return m_isStatic; }
+    jobject reflectedMethod() const { return m_reflectedMethod; }
 
     // Method implementation
     int numParameters() const { return m_parameters.size(); }
 
 private:
     Vector<WTF::String> m_parameters;
+    // Resolved once so that invocations do not parse the class names again.
+    Vector<CString> m_parameterClassNames;
+    Vector<JavaType> m_parameterTypes;
+    JGObject m_reflectedMethod;
     JavaString m_name;
     mutable char* m_signature;
     JavaString m_returnTypeClassName;
@@ -56,7 +56,12 @@ void ImageFrameAnimator::destroyDecodedData(bool destroyAll)
 {
     // Animated images over a certain size are considered large enough that we'll
     // only hang on to one frame at a time.
+#if PLATFORM(JAVA)
+    // Every decoded frame is also held as an image on the Java heap.
+    static constexpr unsigned LargeAnimationCutoff = 5 * 1024 * 1024;
+#else
     static constexpr unsigned LargeAnimationCutoff = 30 * 1024 * 1024;
+#endif
 
     if (m_source.decodedSize() < LargeAnimationCutoff)
         return;
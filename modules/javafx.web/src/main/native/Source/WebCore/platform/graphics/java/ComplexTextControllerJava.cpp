@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -92,57 +92,63 @@ unsigned jGetEnd(jobject jRun)
     return env->CallIntMethod(jRun, mID);
 }
 
-unsigned jGetCharOffset(jobject jRun, unsigned glyphIndex)
+FloatRect jGetGlyphPosAndAdvance(jobject jRun, unsigned glyphIndex)
 {
     if (!jGetGlyphCount(jRun)) {
-        // Return same value as TextRun.getCharOffset() when there is
-        // no glyph information available.
-        return glyphIndex;
+        return { };
     }
 
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mID = env->GetMethodID(
         PG_GetTextRun(env),
-        "getCharOffset",
-        "(I)I");
+        "getGlyphPosAndAdvance",
+        "(I)[F");
     ASSERT(mID);
 
-    return env->CallIntMethod(jRun, mID, glyphIndex);
+    JLocalRef<jfloatArray> jpos = static_cast<jfloatArray> (env->CallObjectMethod(
+                                                              jRun, mID, glyphIndex));
+    WTF::CheckAndClearException(env);
+
+    jfloat* pos = static_cast<float*>(env->GetPrimitiveArrayCritical(jpos, 0));
+    FloatRect rect = { pos[0], pos[1], pos[2], pos[3] };
+    env->ReleasePrimitiveArrayCritical(jpos, pos, 0);
+    return rect;
 }
 
-CGGlyph jGetGlyph(jobject jRun, unsigned glyphIndex)
+Vector<jint> jGetGlyphsAndCharOffsets(jobject jRun)
 {
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mID = env->GetMethodID(
         PG_GetTextRun(env),
-        "getGlyph",
-        "(I)I");
+        "getGlyphsAndCharOffsets",
+        "()[I");
     ASSERT(mID);
 
-    return env->CallIntMethod(jRun, mID, glyphIndex);
-}
-
-FloatRect jGetGlyphPosAndAdvance(jobject jRun, unsigned glyphIndex)
-{
-    if (!jGetGlyphCount(jRun)) {
+    JLocalRef<jintArray> jdata(static_cast<jintArray>(env->CallObjectMethod(jRun, mID)));
+    if (WTF::CheckAndClearException(env) || !jdata) {
         return { };
     }
+    Vector<jint> data(env->GetArrayLength(jdata));
+    env->GetIntArrayRegion(jdata, 0, data.size(), data.data());
+    return data;
+}
 
+Vector<jfloat> jGetGlyphPositionsAndAdvances(jobject jRun)
+{
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mID = env->GetMethodID(
         PG_GetTextRun(env),
-        "getGlyphPosAndAdvance",
-        "(I)[F");
+        "getGlyphPositionsAndAdvances",
+        "()[F");
     ASSERT(mID);
 
-    JLocalRef<jfloatArray> jpos = static_cast<jfloatArray> (env->CallObjectMethod(
-                                                              jRun, mID, glyphIndex));
-    WTF::CheckAndClearException(env);
-
-    jfloat* pos = static_cast<float*>(env->GetPrimitiveArrayCritical(jpos, 0));
-    FloatRect rect = { pos[0], pos[1], pos[2], pos[3] };
-    env->ReleasePrimitiveArrayCritical(jpos, pos, 0);
-    return rect;
+    JLocalRef<jfloatArray> jdata(static_cast<jfloatArray>(env->CallObjectMethod(jRun, mID)));
+    if (WTF::CheckAndClearException(env) || !jdata) {
+        return { };
+    }
+    Vector<jfloat> data(env->GetArrayLength(jdata));
+    env->GetFloatArrayRegion(jdata, 0, data.size(), data.data());
+    return data;
 }
 
 FloatSize jGetInitialAdvance(JLObject jRun)
@@ -179,21 +185,33 @@ ComplexTextController::ComplexTextRun::ComplexTextRun(JLObject jRun, const Font&
     // m_glyphOrigins.grow(m_glyphCount);
     m_coreTextIndices.grow(m_glyphCount);
 
+    // Fetch the whole run at once rather than a few JNI calls per glyph.
+    auto glyphsAndOffsets = jGetGlyphsAndCharOffsets(jobject(jRun));
+    auto positionsAndAdvances = jGetGlyphPositionsAndAdvances(jobject(jRun));
+    if (glyphsAndOffsets.size() < 2 * m_glyphCount || positionsAndAdvances.size() < 4 * m_glyphCount) {
+        // No glyph information, see TextRun.getCharOffset()
+        for (unsigned i = 0; i < m_glyphCount; ++i) {
+            m_coreTextIndices[i] = m_indexBegin + i;
+            m_glyphs[i] = 0;
+            m_baseAdvances[i] = { };
+        }
+        return;
+    }
+
     for (unsigned i = 0; i < m_glyphCount; ++i) {
         // The given string will be broken down into multiple java TextRuns. Each
         // java TextRun will have indicies relative to it's text. So it has to
         // be converted to absolute index w.r.t WebCore String.
         // Refer {CTGlyphLayout, DWGlyphLayout, PangoGlyphLayout}.layout()
-        m_coreTextIndices[i] = m_indexBegin + jGetCharOffset(jRun, i);
+        m_coreTextIndices[i] = m_indexBegin + glyphsAndOffsets[2 * i + 1];
 
-        m_glyphs[i]= jGetGlyph(jRun, i);
+        m_glyphs[i] = glyphsAndOffsets[2 * i];
         if (m_font.isZeroWidthSpaceGlyph(m_glyphs[i])) {
             m_baseAdvances[i] = { };
             continue;
         }
 
-        auto glyphBox = jGetGlyphPosAndAdvance(jRun, i);
-        m_baseAdvances[i] = glyphBox.size();
+        m_baseAdvances[i] = { positionsAndAdvances[4 * i + 2], positionsAndAdvances[4 * i + 3] };
     }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,10 +45,7 @@ bool GlyphPage::fill(std::span<const UChar> characterBuffer)
     if (!jchars)
         return false;
 
-    jchar* chars = (jchar*)env->GetPrimitiveArrayCritical(jchars, NULL);
-    ASSERT(chars);
-    memcpy(chars, characterBuffer.data(), characterBuffer.size() * 2);
-    env->ReleasePrimitiveArrayCritical(jchars, chars, 0);
+    env->SetCharArrayRegion(jchars, 0, characterBuffer.size(), reinterpret_cast<const jchar*>(characterBuffer.data()));
 
     static jmethodID mid = env->GetMethodID(PG_GetFontClass(env), "getGlyphCodes", "([C)[I");
     ASSERT(mid);
@@ -58,8 +55,12 @@ bool GlyphPage::fill(std::span<const UChar> characterBuffer)
     if (!jglyphs)
         return false;
 
-    Glyph* glyphs = (Glyph*)env->GetPrimitiveArrayCritical(jglyphs, NULL);
-    ASSERT(glyphs);
+    // Glyph is jint in the Java port, so the codes are copied out as they are.
+    Glyph glyphs[2 * GlyphPage::size] { };
+    jsize glyphCount = std::min<jsize>(env->GetArrayLength(jglyphs), std::size(glyphs));
+    env->GetIntArrayRegion(jglyphs, 0, glyphCount, glyphs);
+    if (WTF::CheckAndClearException(env))
+        return false;
 
     unsigned step;  // 1 for BMP, 2 for non-BMP
     if (characterBuffer.size() == GlyphPage::size) {
@@ -79,8 +80,6 @@ bool GlyphPage::fill(std::span<const UChar> characterBuffer)
         } else
             setGlyphForIndex(i, 0, this->font().colorGlyphType(glyph));
     }
-    env->ReleasePrimitiveArrayCritical(jglyphs, glyphs, JNI_ABORT);
-
     return haveGlyphs;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -93,6 +93,11 @@ static void setGradient(Gradient &gradient,
     p0 = gradientSpaceTransformation.mapPoint(p0);
     p1 = gradientSpaceTransformation.mapPoint(p1);
 
+    // The gradient replaces the solid color on the Java side.
+    context->rq().invalidateState(id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT
+        ? com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
+        : com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR);
+
     context->rq().freeSpace(4 * 11 + 20 * nStops)
     << id
     << (jfloat)p0.x()
@@ -177,6 +182,7 @@ void GraphicsContextJava::restorePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+    platformContext()->rq().invalidateState();
 }
 
 // Draws a filled rectangle with a stroked border.
@@ -231,11 +237,9 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(36)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
-    << rect.x() << rect.y()
-    << rect.width() << rect.height()
-    << r << g << b << a;
+    platformContext()->rq().fillRect(
+        rect.x(), rect.y(), rect.width(), rect.height(),
+        r, g, b, a);
 }
 
 void GraphicsContextJava::fillRect(const FloatRect& rect, RequiresClipToRect requiresClip)
@@ -492,6 +496,9 @@ void GraphicsContextJava::translate(float x, float y)
     if (paintingDisabled())
         return;
 
+    if (!x && !y)
+        return;
+
     m_state.transform.translate(x, y);
     platformContext()->rq().freeSpace(12)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_TRANSLATE
@@ -504,6 +511,9 @@ void GraphicsContextJava::setPlatformFillColor(const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    if (platformContext()->rq().isRedundantState(com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR, { r, g, b, a }))
+        return;
+
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
     << r << g << b << a;
@@ -528,6 +538,9 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
     if (paintingDisabled())
         return;
 
+    if (platformContext()->rq().isRedundantState(com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE, { (jfloat)style }))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
     << (jint)style;
@@ -539,6 +552,9 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
+    if (platformContext()->rq().isRedundantState(com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR, { r, g, b, a }))
+        return;
+
     platformContext()->rq().freeSpace(20)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
     << r << g << b << a;
@@ -549,6 +565,9 @@ void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
     if (paintingDisabled())
         return;
 
+    if (platformContext()->rq().isRedundantState(com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH, { strokeThickness }))
+        return;
+
     platformContext()->rq().freeSpace(8)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
     << strokeThickness;
@@ -574,6 +593,9 @@ void GraphicsContextJava::concatCTM(const AffineTransform& at)
     if (paintingDisabled())
         return;
 
+    if (at.isIdentity())
+        return;
+
     m_state.transform.multiply(at);
     platformContext()->rq().freeSpace(28)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_CONCATTRANSFORM_FFFFFF
@@ -807,31 +829,35 @@ void GraphicsContextJava::drawPlatformImage(const PlatformImagePtr& image, const
     if (!image || !image->getImage())
         return;
 
+    if (options.orientation() == ImageOrientation::Orientation::None) {
+        // No transform is needed, so do not wrap the draw into a platform
+        // save and restore. That keeps consecutive draws of one image, e.g.
+        // the sprites of a canvas animation, mergeable by the queue.
+        CompositeOperator oldCompositeOperator = compositeOperation();
+        BlendMode oldBlendMode = blendMode();
+        setCompositeOperation(options.compositeOperator(), options.blendMode());
+        platformContext()->rq().drawImage(image->getImage(), destRect, srcRect);
+        setCompositeOperation(oldCompositeOperator, oldBlendMode);
+        return;
+    }
+
     savePlatformState();
     setCompositeOperation(options.compositeOperator(), options.blendMode());
 
     FloatRect adjustedSrcRect(srcRect);
     FloatRect adjustedDestRect(destRect);
 
-    if (options.orientation() != ImageOrientation::Orientation::None) {
-        // ImageOrientation expects the origin to be at (0, 0).
-        translate(destRect.x(), destRect.y());
-        adjustedDestRect.setLocation(FloatPoint());
-        concatCTM(options.orientation().transformFromDefault(adjustedDestRect.size()));
-        if (options.orientation().usesWidthAsHeight()) {
-            // The destination rectangle will have it's width and height already reversed for the orientation of
-            // the image, as it was needed for page layout, so we need to reverse it back here.
-            adjustedDestRect.setSize(adjustedDestRect.size().transposedSize());
-        }
+    // ImageOrientation expects the origin to be at (0, 0).
+    translate(destRect.x(), destRect.y());
+    adjustedDestRect.setLocation(FloatPoint());
+    concatCTM(options.orientation().transformFromDefault(adjustedDestRect.size()));
+    if (options.orientation().usesWidthAsHeight()) {
+        // The destination rectangle will have it's width and height already reversed for the orientation of
+        // the image, as it was needed for page layout, so we need to reverse it back here.
+        adjustedDestRect.setSize(adjustedDestRect.size().transposedSize());
     }
 
-    platformContext()->rq().freeSpace(72)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE
-        << image->getImage()
-        << adjustedDestRect.x() << adjustedDestRect.y()
-        << adjustedDestRect.width() << adjustedDestRect.height()
-        << adjustedSrcRect.x() << adjustedSrcRect.y()
-        << adjustedSrcRect.width() << adjustedSrcRect.height();
+    platformContext()->rq().drawImage(image->getImage(), adjustedDestRect, adjustedSrcRect);
     restorePlatformState();
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -140,7 +140,7 @@ Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::
     return { };
 }
 
-void* ImageBufferJavaBackend::getData()
+void* ImageBufferJavaBackend::getData(const IntRect& rect)
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -148,13 +148,15 @@ void* ImageBufferJavaBackend::getData()
     //For that purpose it has to be in actual state.
     context().platformContext()->rq().flushBuffer();
 
+    // Only the pixels in [rect] are guaranteed to be read back from the surface.
     static jmethodID midGetBGRABytes = env->GetMethodID(
         PG_GetImageClass(env),
         "getPixelBuffer",
-        "()Ljava/nio/ByteBuffer;");
+        "(IIII)Ljava/nio/ByteBuffer;");
     ASSERT(midGetBGRABytes);
 
-    jobject pixelBuf = env->CallObjectMethod(getWCImage(), midGetBGRABytes);
+    jobject pixelBuf = env->CallObjectMethod(getWCImage(), midGetBGRABytes,
+        (jint)rect.x(), (jint)rect.y(), (jint)rect.width(), (jint)rect.height());
     if (WTF::CheckAndClearException(env) || !pixelBuf) {
         return NULL;
     }
@@ -163,17 +165,18 @@ void* ImageBufferJavaBackend::getData()
     return env->GetDirectBufferAddress(byteBuffer);
 }
 
-void ImageBufferJavaBackend::update() const
+void ImageBufferJavaBackend::update(const IntRect& rect) const
 {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midUpdateByteBuffer = env->GetMethodID(
         PG_GetImageClass(env),
         "drawPixelBuffer",
-        "()V");
+        "(IIII)V");
     ASSERT(midUpdateByteBuffer);
 
-    env->CallObjectMethod(getWCImage(), midUpdateByteBuffer);
+    env->CallVoidMethod(getWCImage(), midUpdateByteBuffer,
+        (jint)rect.x(), (jint)rect.y(), (jint)rect.width(), (jint)rect.height());
     WTF::CheckAndClearException(env);
 }
 
@@ -199,7 +202,12 @@ RefPtr<NativeImage> ImageBufferJavaBackend::createNativeImageReference()
 
 void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, PixelBuffer& destination) //overide method
 {
-    void *data = getData();
+    IntRect readbackRect = intersection({ { }, size() }, srcRect);
+    if (readbackRect.isEmpty()) {
+        destination.zeroFill();
+        return;
+    }
+    void *data = getData(readbackRect);
     if (!data)
         return;
     return getPixelBuffer(srcRect, static_cast<const uint8_t*>(data), destination);
@@ -214,16 +222,26 @@ void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, const uint8_
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat, uint8_t* destination)
 {
     ImageBufferBackend::putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, destination);
-    update();
 }
 
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBuffer& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat) //override
 {
-    void *data = getData();
+    // Same destination clipping as in ImageBufferBackend::putPixelBuffer.
+    auto destRect = intersection({ IntPoint::zero(), sourcePixelBuffer.size() }, srcRect);
+    destRect.moveBy(destPoint);
+    if (srcRect.x() < 0)
+        destRect.setX(destRect.x() - srcRect.x());
+    if (srcRect.y() < 0)
+        destRect.setY(destRect.y() - srcRect.y());
+    destRect.intersect({ { }, size() });
+    if (destRect.isEmpty())
+        return;
+
+    void *data = getData(destRect);
     if (!data)
         return;
     putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, static_cast<uint8_t*>(data));
-    update();
+    update(destRect);
 }
 
 size_t ImageBufferJavaBackend::calculateMemoryCost(const Parameters& parameters)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -107,17 +107,19 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
     static jmethodID midAddImageData = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "addImageData",
-        "([B)V");
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(midAddImageData);
 
     while (m_receivedDataSize < data.size()) {
         const auto& someData = data.getSomeData(m_receivedDataSize);
         unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
+        // The decoder copies the segment out during the call, so the segment
+        // memory is passed as is instead of through a temporary byte[].
+        JLObject jBuffer(env->NewDirectByteBuffer(
+            const_cast<uint8_t*>(someData.span().data()), length));
+        if (jBuffer && !WTF::CheckAndClearException(env)) {
             // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.span().data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)jBuffer);
             WTF::CheckAndClearException(env);
         }
         m_receivedDataSize += length;
@@ -217,6 +219,23 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
     return ImageJava::create(RQRef::create(frame), nullptr, frameSize.width(), frameSize.height());
 }
 
+void ImageDecoderJava::clearFrameBufferCache(size_t clearBeforeFrame)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env || !m_nativeDecoder) {
+        return;
+    }
+
+    static jmethodID midDestroyDecodedData = env->GetMethodID(
+        PG_GetGraphicsImageDecoderClass(env),
+        "destroyDecodedData",
+        "(I)V");
+    ASSERT(midDestroyDecodedData);
+
+    env->CallVoidMethod(m_nativeDecoder, midDestroyDecodedData, (jint)clearBeforeFrame);
+    WTF::CheckAndClearException(env);
+}
+
 WTF::Seconds ImageDecoderJava::frameDurationAtIndex(size_t idx) const
 {
     JNIEnv* env = WTF::GetJavaEnv();
@@ -73,7 +73,7 @@ public:
 
     void setData(const FragmentedSharedBuffer&, bool allDataReceived) final;
     bool isAllDataReceived() const final { return m_isAllDataReceived;}
-    void clearFrameBufferCache(size_t) final {  }
+    void clearFrameBufferCache(size_t) final;
 
     JLObject nativeDecoder() const { return m_nativeDecoder; }
 
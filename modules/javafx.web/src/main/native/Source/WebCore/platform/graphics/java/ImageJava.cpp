@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,13 +59,7 @@ void Image::drawImage(GraphicsContext& gc, const FloatRect &dstRect, const Float
     CompositeOperator oldCompositeOperator = gc.compositeOperation();
     gc.setCompositeOperation(compositeOperator);
 
-    gc.platformContext()->rq().freeSpace(72)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE
-    << nativeImage->platformImage()->getImage()
-    << dstRect.x() << dstRect.y()
-    << dstRect.width() << dstRect.height()
-    << srcRect.x() << srcRect.y()
-    << srcRect.width() << srcRect.height();
+    gc.platformContext()->rq().drawImage(nativeImage->platformImage()->getImage(), dstRect, srcRect);
 
     gc.setCompositeOperation(oldCompositeOperator);
 
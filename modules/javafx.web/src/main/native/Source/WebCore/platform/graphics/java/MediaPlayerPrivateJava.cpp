@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -767,6 +767,10 @@ void MediaPlayerPrivate::notifySizeChanged(int width, int height)
 void MediaPlayerPrivate::notifyNewFrame()
 {
     PLOG_TRACE0(">>MediaPlayerPrivate notifyNewFrame\n");
+    if (!m_isVisible) {
+        // Nothing is painted for an invisible player, see paint().
+        return;
+    }
     m_player->repaint();
     //PLOG_TRACE0("<<MediaPlayerPrivate notifyNewFrame\n");
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -127,72 +127,80 @@ Ref<PathImpl> PathJava::copy() const
 
     auto elementsStream = m_elementsStream ? RefPtr<PathImpl> { m_elementsStream->copy() } : nullptr;
 
-    return PathJava::create(WTFMove(platformPathCopy), downcast<PathStream>(WTFMove(elementsStream)));
+    auto pathCopy = PathJava::create(WTFMove(platformPathCopy), downcast<PathStream>(WTFMove(elementsStream)));
+    pathCopy->m_hasCurrentPoint = m_hasCurrentPoint;
+    return pathCopy;
 }
 
 PlatformPathPtr PathJava::platformPath() const
 {
+    flushPendingSegments();
     return m_platformPath.get();
 }
 
+void PathJava::appendPendingSegment(jint type, std::initializer_list<FloatPoint> points)
+{
+    m_pendingSegments.append(type);
+    for (auto& point : points) {
+        m_pendingSegments.append(point.x());
+        m_pendingSegments.append(point.y());
+    }
+}
 
-void PathJava::add(PathMoveTo moveto)
+void PathJava::flushPendingSegments() const
 {
+    if (m_pendingSegments.isEmpty()) {
+        return;
+    }
     ASSERT(m_platformPath);
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).appendSegments;
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)moveto.point.x(), (jdouble)moveto.point.y());
+    JLocalRef<jdoubleArray> data(env->NewDoubleArray(m_pendingSegments.size()));
+    env->SetDoubleArrayRegion(data, 0, m_pendingSegments.size(), m_pendingSegments.data());
+    m_pendingSegments.clear();
+
+    env->CallVoidMethod(*m_platformPath, mid, (jdoubleArray)data);
     WTF::CheckAndClearException(env);
 }
 
-void PathJava::add(PathLineTo lineTo)
+void PathJava::add(PathMoveTo moveto)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
+    m_hasCurrentPoint = true;
+    if (m_elementsStream) {
+        m_elementsStream->add(moveto);
+    }
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO, { moveto.point });
+}
 
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)lineTo.point.x(), (jdouble)lineTo.point.y());
-    WTF::CheckAndClearException(env);
+void PathJava::add(PathLineTo lineTo)
+{
+    m_hasCurrentPoint = true;
+    if (m_elementsStream) {
+        m_elementsStream->add(lineTo);
+    }
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_LINETO, { lineTo.point });
 }
 
 void PathJava::add(PathQuadCurveTo quadTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)quadTo.controlPoint.x(), (jdouble)quadTo.controlPoint.y(), (jdouble)quadTo.endPoint.x(), (jdouble)quadTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    m_hasCurrentPoint = true;
+    if (m_elementsStream) {
+        m_elementsStream->add(quadTo);
+    }
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO, { quadTo.controlPoint, quadTo.endPoint });
 }
 
 void PathJava::add(PathBezierCurveTo bezierTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)bezierTo.controlPoint1.x(), (jdouble)bezierTo.controlPoint1.y(),
-                        (jdouble)bezierTo.controlPoint2.x(), (jdouble)bezierTo.controlPoint2.y(),
-                        (jdouble)bezierTo.endPoint.x(), (jdouble)bezierTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    m_hasCurrentPoint = true;
+    if (m_elementsStream) {
+        m_elementsStream->add(bezierTo);
+    }
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO,
+        { bezierTo.controlPoint1, bezierTo.controlPoint2, bezierTo.endPoint });
 }
 
 static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
@@ -203,12 +211,15 @@ static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const Flo
 void PathJava::add(PathArcTo arcTo)
 {
     ASSERT(m_platformPath);
+    m_hasCurrentPoint = true;
+    if (m_elementsStream) {
+        m_elementsStream->add(arcTo);
+    }
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).addArcTo;
 
     env->CallVoidMethod(*m_platformPath, mid,
                         (jdouble)arcTo.controlPoint1.x(), (jdouble)arcTo.controlPoint1.y(),
@@ -219,6 +230,11 @@ void PathJava::add(PathArcTo arcTo)
 void PathJava::add(PathArc arc)
 {
     ASSERT(m_platformPath);
+    m_hasCurrentPoint = true;
+    if (m_elementsStream) {
+        m_elementsStream->add(arc);
+    }
+    flushPendingSegments();
     bool clockwise = false;
     const RotationDirection direction = arc.direction;
     if (direction == RotationDirection::Counterclockwise) {
@@ -229,15 +245,14 @@ void PathJava::add(PathArc arc)
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).addArc;
 
     env->CallVoidMethod(*m_platformPath, mid, (jdouble)arc.center.x(), (jdouble)arc.center.y(),
         (jdouble)arc.radius, (jdouble)arc.startAngle, (jdouble)arc.endAngle,
         bool_to_jbool(clockwise));
     WTF::CheckAndClearException(env);
 }
+
 void PathJava::add(PathClosedArc closedArc)
 {
     notImplemented();
@@ -251,11 +266,14 @@ void PathJava::add(PathEllipse ellipse)
 void PathJava::add(PathEllipseInRect ellipseInRect)
 {
     ASSERT(m_platformPath);
+    m_hasCurrentPoint = true;
+    if (m_elementsStream) {
+        m_elementsStream->add(ellipseInRect);
+    }
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).addEllipse;
 
     env->CallVoidMethod(*m_platformPath, mid,
                         (jdouble)ellipseInRect.rect.x(), (jdouble)ellipseInRect.rect.y(),
@@ -266,12 +284,15 @@ void PathJava::add(PathEllipseInRect ellipseInRect)
 void PathJava::add(PathRect rect)
 {
     ASSERT(m_platformPath);
+    m_hasCurrentPoint = true;
+    if (m_elementsStream) {
+        m_elementsStream->add(rect);
+    }
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).addRect;
 
     env->CallVoidMethod(*m_platformPath, mid, (jdouble)rect.rect.x(), (jdouble)rect.rect.y(),
                               (jdouble)rect.rect.width(), (jdouble)rect.rect.height());
@@ -283,18 +304,12 @@ void PathJava::add(PathRoundedRect roundedRect)
     addBeziersForRoundedRect(roundedRect.roundedRect);
 }
 
-void PathJava::add(PathCloseSubpath)
+void PathJava::add(PathCloseSubpath closeSubpath)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
+    if (m_elementsStream) {
+        m_elementsStream->add(closeSubpath);
+    }
+    appendPendingSegment(com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE, { });
 }
 
 void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
@@ -304,6 +319,11 @@ void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
 
 void PathJava::applySegments(const PathSegmentApplier& applier) const
 {
+    if (m_elementsStream) {
+        m_elementsStream->applySegments(applier);
+        return;
+    }
+
     applyElements([&](const PathElement& pathElement) {
         switch (pathElement.type) {
         case PathElement::Type::MoveToPoint:
@@ -331,29 +351,26 @@ void PathJava::applySegments(const PathSegmentApplier& applier) const
 
 bool PathJava::applyElements(const PathElementApplier& applier) const
 {
+    if (m_elementsStream) {
+        return m_elementsStream->applyElements(applier);
+    }
+
     // need to implement this method after looking into cairo implementation
     return true;
 }
 
 bool PathJava::isEmpty() const
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                                            "isEmpty", "()Z");
-    ASSERT(mid);
-
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
-
-    return jbool_to_bool(res);
+    // Same as WCPath.isEmpty(), which is only false once there is a
+    // current point.
+    return !m_hasCurrentPoint;
 }
 
 FloatPoint PathJava::currentPoint() const
 {
-    //utatodo: return current point of subpath.
+    if (m_elementsStream) {
+        return m_elementsStream->currentPoint();
+    }
     float quietNaN = std::numeric_limits<float>::quiet_NaN();
     return FloatPoint(quietNaN, quietNaN);
 }
@@ -361,18 +378,23 @@ FloatPoint PathJava::currentPoint() const
 bool PathJava::transform(const AffineTransform& transform)
 {
     ASSERT(m_platformPath);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "transform", "(DDDDDD)V");
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).transform;
 
     env->CallVoidMethod(*m_platformPath, mid,
                         (jdouble)transform.a(), (jdouble)transform.b(),
                         (jdouble)transform.c(), (jdouble)transform.d(),
                         (jdouble)transform.e(), (jdouble)transform.f());
     WTF::CheckAndClearException(env);
+
+    // Segments such as arcs cannot be transformed in place. The native
+    // copy is dropped then and the queries below go to Java again.
+    if (m_elementsStream && !m_elementsStream->transform(transform)) {
+        m_elementsStream = nullptr;
+    }
     return true;
 }
 
@@ -382,12 +404,11 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
         return false;
 
     ASSERT(m_platformPath);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "contains",
-        "(IDD)Z");
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).contains;
 
     jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jint)rule,
         (jdouble)point.x(), (jdouble)point.y());
@@ -419,12 +440,10 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
     gc.restore();
 
+    flushPendingSegments();
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "strokeContains",
-        "(DDDDIID[D)Z");
-
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).strokeContains;
 
     size_t size = strokeStyle == StrokeStyle::SolidStroke ? 0 : dashes.size();
     JLocalRef<jdoubleArray> dashArray(env->NewDoubleArray(size));
@@ -441,56 +460,65 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
 FloatRect PathJava::fastBoundingRect() const
 {
-    return boundingRect();
+    if (m_elementsStream) {
+        return m_elementsStream->fastBoundingRect();
+    }
+    return platformBoundingRect();
 }
 
 FloatRect PathJava::boundingRect() const
 {
-    return strokeBoundingRect(nullptr);
+    if (m_elementsStream) {
+        return m_elementsStream->boundingRect();
+    }
+    return platformBoundingRect();
 }
 
-FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
+FloatRect PathJava::platformBoundingRect() const
 {
     ASSERT(m_platformPath);
+    flushPendingSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "getBounds",
-            "()Lcom/sun/webkit/graphics/WCRectangle;");
-    ASSERT(mid);
+    jmethodID mid = PG_GetPathMethods(env).getBounds;
 
     JLObject rect(env->CallObjectMethod(*m_platformPath, mid));
     WTF::CheckAndClearException(env);
-    if (rect) {
-        static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
-        ASSERT(rectxFID);
-        static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
-        ASSERT(rectyFID);
-        static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
-        ASSERT(rectwFID);
-        static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
-        ASSERT(recthFID);
-
-        FloatRect bounds(
-            float(env->GetFloatField(rect, rectxFID)),
-            float(env->GetFloatField(rect, rectyFID)),
-            float(env->GetFloatField(rect, rectwFID)),
-            float(env->GetFloatField(rect, recthFID)));
-        WTF::CheckAndClearException(env);
-
-        float thickness;
-        if (strokeStyleApplier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            strokeStyleApplier(gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
-        }
-        return bounds;
-    } else {
+    if (!rect) {
         return FloatRect();
     }
+
+    static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
+    ASSERT(rectxFID);
+    static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
+    ASSERT(rectyFID);
+    static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
+    ASSERT(rectwFID);
+    static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
+    ASSERT(recthFID);
+
+    FloatRect bounds(
+        float(env->GetFloatField(rect, rectxFID)),
+        float(env->GetFloatField(rect, rectyFID)),
+        float(env->GetFloatField(rect, rectwFID)),
+        float(env->GetFloatField(rect, recthFID)));
+    WTF::CheckAndClearException(env);
+    return bounds;
+}
+
+FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
+{
+    FloatRect bounds = boundingRect();
+    if (strokeStyleApplier) {
+        GraphicsContext& gc = scratchContext();
+        gc.save();
+        strokeStyleApplier(gc);
+        float thickness = gc.strokeThickness();
+        gc.restore();
+        bounds.inflate(thickness / 2);
+    }
+    return bounds;
 }
 
 } // namespace WebCore
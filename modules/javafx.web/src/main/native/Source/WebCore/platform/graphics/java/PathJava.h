@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -82,9 +82,21 @@ private:
 
     FloatRect fastBoundingRect() const final;
     FloatRect boundingRect() const final;
+    FloatRect platformBoundingRect() const;
+
+    // Moves, lines, curves and closes are collected here and handed to the
+    // Java path in a single WCPath.appendSegments() call, right before the
+    // Java path is used. Each segment is its WCPathIterator segment type
+    // followed by its points.
+    void appendPendingSegment(jint type, std::initializer_list<FloatPoint>);
+    void flushPendingSegments() const;
 
     RefPtr<RQRef> m_platformPath;
+    // Native copy of the segments, so that bounds, the current point and
+    // the segments themselves are available without calling into Java.
     RefPtr<PathStream> m_elementsStream;
+    mutable Vector<jdouble> m_pendingSegments;
+    bool m_hasCurrentPoint { false };
 };
 
 } // namespace WebCore
@@ -71,9 +71,7 @@ namespace WebCore {
         void addPath(PlatformPathPtr pPath) {
             JNIEnv* env = WTF::GetJavaEnv();
 
-            static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                "addPath", "(Lcom/sun/webkit/graphics/WCPath;)V");
-            ASSERT(mid);
+            jmethodID mid = PG_GetPathMethods(env).addPath;
 
             env->CallVoidMethod((jobject)*m_path.platformPath(), mid, (jobject)*pPath);
             WTF::CheckAndClearException(env);
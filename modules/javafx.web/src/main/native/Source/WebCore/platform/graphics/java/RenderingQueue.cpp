@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,24 +25,98 @@
 
 #include "config.h"
 
+#include "FloatRect.h"
 #include "PlatformJavaClasses.h"
 #include "RenderingQueue.h"
 #include "RQRef.h"
 
 #include <wtf/java/JavaRef.h>
-#include <wtf/HashMap.h>
 #include <wtf/NeverDestroyed.h>
+#include <wtf/SystemTracing.h>
 
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
 
-typedef HashMap<char*, RefPtr<ByteBuffer> > Addr2ByteBuffer;
+/*
+ * In-flight buffers are kept in a slot table indexed by the buffer id that is
+ * passed to Java along with the NIO buffer. WCRenderQueue.twkRelease hands the
+ * ids back, so a release is a single indexed load instead of a hash lookup
+ * keyed by GetDirectBufferAddress. Freed slots are reused LIFO.
+ *
+ * The table is only touched on the Event thread.
+ */
+class InFlightBuffers {
+public:
+    static InFlightBuffers& singleton()
+    {
+        static NeverDestroyed<InFlightBuffers> table;
+        return table.get();
+    }
+
+    jint add(RefPtr<ByteBuffer>&& buffer)
+    {
+        unsigned slot;
+        if (m_freeSlots.isEmpty()) {
+            slot = m_slots.size();
+            m_slots.append(WTFMove(buffer));
+        } else {
+            slot = m_freeSlots.takeLast();
+            m_slots[slot] = WTFMove(buffer);
+        }
+        // Zero is reserved for buffers created on the Java side.
+        return static_cast<jint>(slot + 1);
+    }
+
+    RefPtr<ByteBuffer> take(jint id)
+    {
+        unsigned slot = static_cast<unsigned>(id - 1);
+        if (id <= 0 || slot >= m_slots.size() || !m_slots[slot]) {
+            return nullptr;
+        }
+        m_freeSlots.append(slot);
+        return WTFMove(m_slots[slot]);
+    }
+
+private:
+    Vector<RefPtr<ByteBuffer>> m_slots;
+    Vector<unsigned> m_freeSlots;
+};
 
-static Addr2ByteBuffer& getAddr2ByteBuffer()
+ByteBufferPool& ByteBufferPool::singleton()
 {
-    static NeverDestroyed<Addr2ByteBuffer> container;
-    return container.get();
+    static NeverDestroyed<ByteBufferPool> pool;
+    return pool.get();
+}
+
+RefPtr<ByteBuffer> ByteBufferPool::acquire(int capacity)
+{
+    for (size_t i = m_freeList.size(); i > 0; --i) {
+        if (m_freeList[i - 1]->capacity() >= capacity) {
+            ++m_hitCount;
+            RefPtr<ByteBuffer> buffer = WTFMove(m_freeList[i - 1]);
+            m_freeList.remove(i - 1);
+            return buffer;
+        }
+    }
+    ++m_missCount;
+    return ByteBuffer::create(capacity);
+}
+
+void ByteBufferPool::recycle(RefPtr<ByteBuffer>&& buffer)
+{
+    static const int standardCapacity =
+        com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT;
+
+    // The buffer may still be referenced, e.g. by a pending enclosed queue.
+    if (!buffer->hasOneRef()
+        || buffer->capacity() != standardCapacity
+        || m_freeList.size() >= MAX_POOLED_BUFFER_COUNT) {
+        return;
+    }
+    buffer->reset();
+    m_freeList.append(WTFMove(buffer));
 }
 
 /*static*/
@@ -65,11 +139,119 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = ByteBufferPool::singleton().acquire(std::max(m_capacity, size));
     }
     return *this;
 }
 
+bool RenderingQueue::isRedundantState(jint opcode, std::initializer_list<jfloat> values)
+{
+    ASSERT(values.size() <= 4);
+    StateEntry entry { opcode, { } };
+    std::copy(values.begin(), values.end(), entry.values.begin());
+
+    for (auto& cached : m_stateCache) {
+        if (cached.opcode == opcode) {
+            if (cached.values == entry.values) {
+                return true;
+            }
+            cached.values = entry.values;
+            return false;
+        }
+    }
+    m_stateCache.append(entry);
+    return false;
+}
+
+void RenderingQueue::invalidateState(jint opcode)
+{
+    m_stateCache.removeFirstMatching([opcode] (const StateEntry& entry) {
+        return entry.opcode == opcode;
+    });
+}
+
+void RenderingQueue::fillRect(jfloat x, jfloat y, jfloat w, jfloat h,
+    jfloat r, jfloat g, jfloat b, jfloat a)
+{
+    // FILLRECT_FFFFI:  op x y w h r g b a
+    // FILLRECTS_FFFFI: op x y w h r g b a count {x y w h}*count
+    static const int colorOffset = 5 * sizeof(jint);
+    static const int countOffset = 9 * sizeof(jint);
+    static const int rectSize = 4 * sizeof(jfloat);
+
+    if (m_buffer && m_rectRunEnd == m_buffer->position()) {
+        ByteBuffer& buffer = *m_buffer;
+        bool isSingle = buffer.getIntAt(m_rectRunStart)
+            == com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI;
+        int growth = isSingle ? sizeof(jint) + rectSize : rectSize;
+        if (buffer.hasFreeSpace(growth)
+            && buffer.getFloatAt(m_rectRunStart + colorOffset) == r
+            && buffer.getFloatAt(m_rectRunStart + colorOffset + 4) == g
+            && buffer.getFloatAt(m_rectRunStart + colorOffset + 8) == b
+            && buffer.getFloatAt(m_rectRunStart + colorOffset + 12) == a) {
+            if (isSingle) {
+                buffer.putIntAt(m_rectRunStart, com_sun_webkit_graphics_GraphicsDecoder_FILLRECTS_FFFFI);
+                buffer.putInt(1);
+            } else {
+                int countPosition = m_rectRunStart + countOffset;
+                buffer.putIntAt(countPosition, buffer.getIntAt(countPosition) + 1);
+            }
+            buffer.putFloat(x);
+            buffer.putFloat(y);
+            buffer.putFloat(w);
+            buffer.putFloat(h);
+            m_rectRunEnd = buffer.position();
+            return;
+        }
+    }
+
+    freeSpace(countOffset)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI;
+    m_rectRunStart = m_buffer->position() - sizeof(jint);
+    *this << x << y << w << h << r << g << b << a;
+    m_rectRunEnd = m_buffer->position();
+}
+
+void RenderingQueue::drawImage(RefPtr<RQRef> image, const FloatRect& dst, const FloatRect& src)
+{
+    // DRAWIMAGE:  op image dx dy dw dh sx sy sw sh
+    // DRAWIMAGES: op image dx dy dw dh sx sy sw sh count {dx dy dw dh sx sy sw sh}*count
+    static const int imageOffset = sizeof(jint);
+    static const int countOffset = 10 * sizeof(jint);
+    static const int rectsSize = 8 * sizeof(jfloat);
+
+    ASSERT(image);
+    jint imageID = *image;
+    if (m_buffer && m_imageRunEnd == m_buffer->position()) {
+        ByteBuffer& buffer = *m_buffer;
+        bool isSingle = buffer.getIntAt(m_imageRunStart)
+            == com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE;
+        int growth = isSingle ? sizeof(jint) + rectsSize : rectsSize;
+        if (buffer.hasFreeSpace(growth)
+            && buffer.getIntAt(m_imageRunStart + imageOffset) == imageID) {
+            if (isSingle) {
+                buffer.putIntAt(m_imageRunStart, com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGES);
+                buffer.putInt(1);
+            } else {
+                int countPosition = m_imageRunStart + countOffset;
+                buffer.putIntAt(countPosition, buffer.getIntAt(countPosition) + 1);
+            }
+            *this << dst.x() << dst.y() << dst.width() << dst.height()
+                << src.x() << src.y() << src.width() << src.height();
+            m_imageRunEnd = buffer.position();
+            return;
+        }
+    }
+
+    freeSpace(countOffset)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWIMAGE;
+    m_imageRunStart = m_buffer->position() - sizeof(jint);
+    *this << image
+        << dst.x() << dst.y() << dst.width() << dst.height()
+        << src.x() << src.y() << src.width() << src.height();
+    m_imageRunEnd = m_buffer->position();
+}
+
 void RenderingQueue::flush() {
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -103,18 +285,30 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     if (isEmpty()) {
         return *this;
     }
+    // The next buffer may be decoded on its own, so it has to carry the
+    // complete state.
+    invalidateState();
+    m_rectRunStart = -1;
+    m_rectRunEnd = -1;
+    m_imageRunStart = -1;
+    m_imageRunEnd = -1;
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
+        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;II)V");
     ASSERT(midFwkAddBuffer);
 
-    Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
-    a2bb.set(m_buffer->bufferAddress(), m_buffer);
+    JLObject nioBuffer = m_buffer->directByteBuffer(env);
+    jint length = m_buffer->position();
+    tracePoint(RenderingQueueFlush, length);
+    jint id = InFlightBuffers::singleton().add(WTFMove(m_buffer));
     env->CallVoidMethod(
         getWCRenderingQueue(),
         midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        (jobject)nioBuffer,
+        length,
+        id);
     WTF::CheckAndClearException(env);
 
     m_buffer = nullptr;
@@ -125,7 +319,7 @@ RenderingQueue& RenderingQueue::flushBuffer() {
 
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
-    (JNIEnv* env, jobject, jobjectArray bufs)
+    (JNIEnv* env, jobject, jintArray ids)
 {
     using namespace WebCore;
     /*
@@ -134,12 +328,17 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
      * so when a resource is dereferenced (as a result of ByteBuffer destruction)
      * it should be thread safe.
      */
-    Addr2ByteBuffer& a2bb = getAddr2ByteBuffer();
-    for (int i = 0; i < env->GetArrayLength(bufs); ++i) {
-        char *key = (char *)env->GetDirectBufferAddress(
-            JLObject(env->GetObjectArrayElement(bufs, i)));
-        if (key != 0) {
-            a2bb.remove(key);
+    jsize count = env->GetArrayLength(ids);
+    jint* elements = env->GetIntArrayElements(ids, nullptr);
+    if (!elements) {
+        return;
+    }
+    InFlightBuffers& inFlight = InFlightBuffers::singleton();
+    for (jsize i = 0; i < count; ++i) {
+        RefPtr<ByteBuffer> buffer = inFlight.take(elements[i]);
+        if (buffer) {
+            ByteBufferPool::singleton().recycle(WTFMove(buffer));
         }
     }
+    env->ReleaseIntArrayElements(ids, elements, JNI_ABORT);
 }
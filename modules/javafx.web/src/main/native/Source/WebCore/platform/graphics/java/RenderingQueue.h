@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,9 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <initializer_list>
 #include <jni.h>
 #include <wtf/Vector.h>
 #include <wtf/RefCounted.h>
@@ -35,6 +38,7 @@
 
 namespace WebCore {
 
+class FloatRect;
 class RQRef;
 
 class ByteBuffer : public RefCounted<ByteBuffer> {
@@ -44,15 +48,30 @@ public:
         return adoptRef(new ByteBuffer(capacity));
     }
 
-    JLObject createDirectByteBuffer(JNIEnv* env) {
+    // The direct NIO wrapper spans the whole capacity and is created once per
+    // ByteBuffer, so a recycled buffer is handed to Java without a new
+    // NewDirectByteBuffer call. The Java side limits it to position().
+    JLObject directByteBuffer(JNIEnv* env) {
         ASSERT(!isEmpty());
-        JLObject ret(env->NewDirectByteBuffer(m_buffer, m_position));
-        m_nio_holder = ret;
-        return ret;
+        if (!m_nio_holder) {
+            m_nio_holder = JLObject(env->NewDirectByteBuffer(m_buffer, m_capacity));
+        }
+        return m_nio_holder;
     }
 
     char* bufferAddress() { return m_buffer; }
 
+    int capacity() { return m_capacity; }
+
+    int position() { return m_position; }
+
+    // Drops the resources referenced by the recorded commands and rewinds
+    // the buffer so that it can be reused by ByteBufferPool.
+    void reset() {
+        m_refList.clear();
+        m_position = 0;
+    }
+
     void putRef(RefPtr<RQRef> ref) {
         ASSERT(m_position + sizeof(jint) <= m_capacity);
         RefPtr<RQRef> repeatable_use_holder(ref);
@@ -72,11 +91,37 @@ public:
         m_position += sizeof(jfloat);
     }
 
+    jint getIntAt(int position) {
+        ASSERT(position + sizeof(jint) <= m_position);
+        jint i;
+        memcpy(&i, (m_buffer + position), sizeof(jint));
+        return i;
+    }
+
+    void putIntAt(int position, jint i) {
+        ASSERT(position + sizeof(jint) <= m_position);
+        memcpy((m_buffer + position), &i, sizeof(jint));
+    }
+
+    jfloat getFloatAt(int position) {
+        ASSERT(position + sizeof(jfloat) <= m_position);
+        jfloat f;
+        memcpy(&f, (m_buffer + position), sizeof(jfloat));
+        return f;
+    }
+
     bool hasFreeSpace(int size) { return m_position + size <= m_capacity; }
 
     bool isEmpty() { return m_position == 0; }
 
+    // Bytes held by all ByteBuffers, pooled and in flight included.
+    static std::atomic<size_t>& allocatedBytes() {
+        static std::atomic<size_t> bytes { 0 };
+        return bytes;
+    }
+
     ~ByteBuffer() {
+        allocatedBytes() -= m_capacity;
         delete[] m_buffer;
     }
 
@@ -85,7 +130,9 @@ private:
         m_buffer(new char[capacity]),
         m_capacity(capacity),
         m_position(0)
-    {}
+    {
+        allocatedBytes() += capacity;
+    }
 
     char* m_buffer;
     int m_capacity;
@@ -94,6 +141,33 @@ private:
     Vector< RefPtr<RQRef> > m_refList;
 };
 
+/*
+ * A free list of released ByteBuffers of the standard RenderingQueue capacity.
+ * Buffers come back here from WCRenderQueue.twkRelease and are reused by
+ * RenderingQueue::freeSpace together with their cached direct NIO wrapper.
+ * Oversized buffers requested for a single large command are not pooled.
+ *
+ * Both acquire and recycle happen on the Event thread, so no locking is needed.
+ */
+class ByteBufferPool {
+    RQ_LOG_INSTANCE_COUNT(ByteBufferPool)
+public:
+    static const size_t MAX_POOLED_BUFFER_COUNT = 32;
+
+    static ByteBufferPool& singleton();
+
+    RefPtr<ByteBuffer> acquire(int capacity);
+    void recycle(RefPtr<ByteBuffer>&& buffer);
+
+    unsigned hitCount() const { return m_hitCount; }
+    unsigned missCount() const { return m_missCount; }
+
+private:
+    Vector<RefPtr<ByteBuffer>> m_freeList;
+    unsigned m_hitCount { 0 };
+    unsigned m_missCount { 0 };
+};
+
 /*
  * A lifecycle of an instance of RenderingQueue (RQ) used to draw to ImageBufferJava
  * may continue after the RQ is flushed to java (e.g. when it's used for html5 canvas).
@@ -134,6 +208,25 @@ public:
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
+    // Returns true if the state command was the last one of its kind written
+    // to the current buffer with the same values, so it can be dropped.
+    // Otherwise remembers the values for the next call.
+    bool isRedundantState(jint opcode, std::initializer_list<jfloat> values);
+
+    // Forgets the state written to the current buffer, e.g. on RESTORESTATE
+    // or when another command replaces the paint on the Java side.
+    void invalidateState(jint opcode);
+    void invalidateState() { m_stateCache.clear(); }
+
+    // Appends a color filled rectangle. Consecutive rectangles of the same
+    // color are merged into a single FILLRECTS_FFFFI command.
+    void fillRect(jfloat x, jfloat y, jfloat w, jfloat h,
+        jfloat r, jfloat g, jfloat b, jfloat a);
+
+    // Appends an image draw. Consecutive draws of the same image are
+    // merged into a single DRAWIMAGES command.
+    void drawImage(RefPtr<RQRef> image, const FloatRect& dst, const FloatRect& src);
+
     bool isEmpty() {
         return m_buffer == nullptr || m_buffer->isEmpty();
     }
@@ -148,8 +241,15 @@ public:
         return m_rqoRenderingQueue;
     }
 
+    // Number of live RenderingQueues, of pages and of image buffers.
+    static std::atomic<unsigned>& instanceCount() {
+        static std::atomic<unsigned> count { 0 };
+        return count;
+    }
+
     ~RenderingQueue() {
         disposeGraphics();
+        --instanceCount();
     }
 
 private:
@@ -158,11 +258,18 @@ private:
         m_capacity(capacity),
         m_autoFlush(autoFlush),
         m_buffer(nullptr)
-    {}
+    {
+        ++instanceCount();
+    }
 
     void flush();
     void disposeGraphics();
 
+    struct StateEntry {
+        jint opcode;
+        std::array<jfloat, 4> values;
+    };
+
     //we need to have RQRef here due to [deref]
     //callback in destructor. Texture need to be released.
     RefPtr<RQRef> m_rqoRenderingQueue;
@@ -171,5 +278,14 @@ private:
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
 
+    Vector<StateEntry, 4> m_stateCache;
+    // Start and end of the last color filled rectangle command in m_buffer,
+    // or -1 when there is none to merge with.
+    int m_rectRunStart { -1 };
+    int m_rectRunEnd { -1 };
+    // Start and end of the last image draw command in m_buffer, or -1.
+    int m_imageRunStart { -1 };
+    int m_imageRunEnd { -1 };
+
 };
 } // namespace WebCore
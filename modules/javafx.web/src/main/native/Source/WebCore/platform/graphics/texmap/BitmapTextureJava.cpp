@@ -51,6 +51,32 @@ void BitmapTextureJava::updateContents(NativeImage* image, const IntRect& target
     //m_image->context().drawImage(*image, targetRect, IntRect(offset, targetRect.size()));
 }
 
+void BitmapTextureJava::updateContents(GraphicsLayer* sourceLayer, const IntRect& targetRect, const IntPoint& offset, float scale)
+{
+    // Record the layer straight into the texture's own image buffer rather
+    // than into a temporary one that would then have to be copied over.
+    GraphicsContext* context = graphicsContext();
+    if (!context)
+        return;
+
+    IntRect sourceRect(targetRect);
+    sourceRect.setLocation(offset);
+    sourceRect.scale(1 / scale);
+
+    context->save();
+    context->clip(targetRect);
+    context->clearRect(targetRect);
+    context->setImageInterpolationQuality(InterpolationQuality::Default);
+    context->setTextDrawingMode(TextDrawingMode::Fill);
+    context->translate(targetRect.x(), targetRect.y());
+    context->applyDeviceScaleFactor(scale);
+    context->translate(-sourceRect.x(), -sourceRect.y());
+
+    sourceLayer->paintGraphicsLayerContents(*context, sourceRect);
+
+    context->restore();
+}
+
 RefPtr<BitmapTexture> BitmapTextureJava::applyFilters(TextureMapper&, const FilterOperations&, bool)
 {
     notImplemented();
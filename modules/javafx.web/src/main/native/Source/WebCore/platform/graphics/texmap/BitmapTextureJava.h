@@ -42,6 +42,7 @@ public:
     bool isValid() const override { return m_image.get(); }
     inline GraphicsContext* graphicsContext() { return m_image ? &(m_image->context()) : nullptr; }
     void updateContents(NativeImage*, const IntRect&, const IntPoint&) override;
+    void updateContents(GraphicsLayer*, const IntRect& target, const IntPoint& offset, float scale) override;
     void updateContents(const void*, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine) override;
     RefPtr<BitmapTexture> applyFilters(TextureMapper&, const FilterOperations&, bool) override;
     ImageBuffer* image() const { return m_image.get(); }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,30 +30,44 @@
 
 #include <wtf/Assertions.h>
 #include <wtf/MainThread.h>
+#include <wtf/WallTime.h>
 
 namespace WebCore {
 
-// The fire time is relative to the classic POSIX epoch of January 1, 1970,
-// as the result of currentTime() is.
-#define MINIMAL_INTERVAL 1e-9 //1ns
-void MainThreadSharedTimer::setFireInterval(Seconds timeout)
+// The fire time passed to com.sun.webkit.Timer is in milliseconds since
+// the classic POSIX epoch of January 1, 1970, as System.currentTimeMillis()
+// is. Zero means that the timer is stopped.
+//
+// WebCore reschedules the shared timer whenever its earliest timer changes,
+// which mostly ends up at the same deadline again, for instance for a burst
+// of setTimeout(0) calls. Remember what Java was told last and only call
+// into Java when the deadline actually moves.
+static jlong scheduledFireTime = 0;
+
+void MainThreadSharedTimer::setFireInterval(Seconds interval)
 {
-    auto fireTime = timeout.value();
-    if (fireTime < MINIMAL_INTERVAL) {
-        fireTime = MINIMAL_INTERVAL;
+    jlong fireTime = static_cast<jlong>(std::ceil(
+        (WallTime::now() + std::max(interval, 0_s)).secondsSinceEpoch().milliseconds()));
+    if (fireTime == scheduledFireTime) {
+        return;
     }
     WC_GETJAVAENV_CHKRET(env);
 
     static jmethodID mid = env->GetStaticMethodID(getTimerClass(env),
-                                                  "fwkSetFireTime", "(D)V");
+                                                  "fwkSetFireTime", "(J)V");
     ASSERT(mid);
 
     env->CallStaticVoidMethod(getTimerClass(env), mid, fireTime);
-    WTF::CheckAndClearException(env);
+    if (!WTF::CheckAndClearException(env)) {
+        scheduledFireTime = fireTime;
+    }
 }
 
 void MainThreadSharedTimer::stop()
 {
+    if (!scheduledFireTime) {
+        return;
+    }
     WC_GETJAVAENV_CHKRET(env);
 
     static jmethodID mid = env->GetStaticMethodID(getTimerClass(env),
@@ -62,6 +76,7 @@ void MainThreadSharedTimer::stop()
 
     env->CallStaticVoidMethod(getTimerClass(env), mid);
     WTF::CheckAndClearException(env);
+    scheduledFireTime = 0;
 }
 
 // JDK-8146958
@@ -76,6 +91,8 @@ extern "C" {
 JNIEXPORT void JNICALL Java_com_sun_webkit_Timer_twkFireTimerEvent
     (JNIEnv*, jclass)
 {
+    // Java clears its fire time before firing
+    WebCore::scheduledFireTime = 0;
     WebCore::MainThreadSharedTimer::singleton().fired();
 }
 
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "MemoryRelease.h"
+
+#include <wtf/Lock.h>
+#include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Threading.h>
+#include <wtf/java/JavaEnv.h>
+
+#if OS(LINUX)
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <wtf/text/CString.h>
+#include <wtf/text/MakeString.h>
+#elif OS(WINDOWS)
+#include <windows.h>
+#endif
+
+namespace WebCore {
+
+namespace {
+
+// Minimum time between two purges requested by the monitors below. Under
+// sustained pressure the notifications keep coming, and dropping the caches
+// over and over only makes WebCore refill them.
+constexpr Seconds holdOffInterval = 20_s;
+
+Lock holdOffLock;
+MonotonicTime lastPressureTime WTF_GUARDED_BY_LOCK(holdOffLock) { -MonotonicTime::infinity() };
+
+void didReceiveMemoryPressure(Critical critical)
+{
+    {
+        Locker locker { holdOffLock };
+        auto now = MonotonicTime::now();
+        if (now - lastPressureTime < holdOffInterval) {
+            return;
+        }
+        lastPressureTime = now;
+    }
+
+    callOnMainThread([critical] {
+        releaseMemory(critical, Synchronous::No);
+    });
+}
+
+#if OS(LINUX)
+
+// Returns the pressure stall information file of the cgroup v2 group the
+// process runs in, or the system wide one if there is no such group.
+CString pressureFilePath()
+{
+    FILE* file = fopen("/proc/self/cgroup", "r");
+    if (file) {
+        char line[PATH_MAX];
+        while (fgets(line, sizeof(line), file)) {
+            if (strncmp(line, "0::", 3)) {
+                continue;
+            }
+            line[strcspn(line, "\n")] = '\0';
+            auto path = makeString("/sys/fs/cgroup"_s, StringView::fromLatin1(line + 3), "/memory.pressure"_s).utf8();
+            if (!access(path.data(), R_OK | W_OK)) {
+                fclose(file);
+                return path;
+            }
+        }
+        fclose(file);
+    }
+    return "/proc/pressure/memory";
+}
+
+int openPressureTrigger(const CString& path, const char* trigger)
+{
+    int fd = open(path.data(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    if (write(fd, trigger, strlen(trigger) + 1) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void startSystemMemoryMonitor()
+{
+    // Some task stalled on memory for 150ms within 2s is the first sign of
+    // reclaim; all tasks stalled for 100ms means that the system thrashes.
+    // The window must be a multiple of 2s for unprivileged processes.
+    auto path = pressureFilePath();
+    int someFd = openPressureTrigger(path, "some 150000 2000000");
+    if (someFd < 0) {
+        return;
+    }
+    int fullFd = openPressureTrigger(path, "full 100000 2000000");
+
+    Thread::create("WebKit: Memory Pressure"_s, [someFd, fullFd] {
+        struct pollfd fds[2] = { { someFd, POLLPRI, 0 }, { fullFd, POLLPRI, 0 } };
+        nfds_t count = fullFd < 0 ? 1 : 2;
+        while (true) {
+            if (poll(fds, count, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            if ((fds[0].revents | (count > 1 ? fds[1].revents : 0)) & POLLERR) {
+                break;
+            }
+            if (count > 1 && (fds[1].revents & POLLPRI)) {
+                didReceiveMemoryPressure(Critical::Yes);
+            } else if (fds[0].revents & POLLPRI) {
+                didReceiveMemoryPressure(Critical::No);
+            }
+        }
+        close(someFd);
+        if (fullFd >= 0) {
+            close(fullFd);
+        }
+    }, ThreadType::Unknown, Thread::QOS::Utility)->detach();
+}
+
+#elif OS(WINDOWS)
+
+void startSystemMemoryMonitor()
+{
+    HANDLE lowMemory = CreateMemoryResourceNotification(LowMemoryResourceNotification);
+    if (!lowMemory) {
+        return;
+    }
+
+    Thread::create("WebKit: Memory Pressure"_s, [lowMemory] {
+        while (WaitForSingleObject(lowMemory, INFINITE) == WAIT_OBJECT_0) {
+            didReceiveMemoryPressure(Critical::Yes);
+            // The notification stays signaled for as long as memory is low.
+            Sleep(static_cast<DWORD>(holdOffInterval.milliseconds()));
+        }
+        CloseHandle(lowMemory);
+    }, ThreadType::Unknown, Thread::QOS::Utility)->detach();
+}
+
+#else
+
+void startSystemMemoryMonitor()
+{
+}
+
+#endif
+
+}  // namespace
+
+}  // namespace WebCore
+
+using namespace WebCore;
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryPressure_twkStartMonitor
+  (JNIEnv*, jclass)
+{
+    startSystemMemoryMonitor();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryPressure_twkHeapPressure
+  (JNIEnv*, jclass, jboolean critical)
+{
+    didReceiveMemoryPressure(critical ? Critical::Yes : Critical::No);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_MemoryPressure_twkReleaseMemory
+  (JNIEnv*, jclass, jboolean critical)
+{
+    if (critical) {
+        releaseMemory(Critical::Yes, Synchronous::Yes);
+    } else {
+        releaseMemory(Critical::No, Synchronous::No);
+    }
+}
+
+}
@@ -56,6 +56,28 @@ jclass PG_GetPathClass(JNIEnv* env)
     return pathCls;
 }
 
+const WCPathMethods& PG_GetPathMethods(JNIEnv* env)
+{
+    static const WCPathMethods methods = [env] {
+        jclass cls = PG_GetPathClass(env);
+        WCPathMethods m;
+        m.appendSegments = env->GetMethodID(cls, "appendSegments", "([D)V");
+        m.addArcTo = env->GetMethodID(cls, "addArcTo", "(DDDDD)V");
+        m.addArc = env->GetMethodID(cls, "addArc", "(DDDDDZ)V");
+        m.addEllipse = env->GetMethodID(cls, "addEllipse", "(DDDD)V");
+        m.addRect = env->GetMethodID(cls, "addRect", "(DDDD)V");
+        m.addPath = env->GetMethodID(cls, "addPath", "(Lcom/sun/webkit/graphics/WCPath;)V");
+        m.transform = env->GetMethodID(cls, "transform", "(DDDDDD)V");
+        m.contains = env->GetMethodID(cls, "contains", "(IDD)Z");
+        m.strokeContains = env->GetMethodID(cls, "strokeContains", "(DDDDIID[D)Z");
+        m.getBounds = env->GetMethodID(cls, "getBounds", "()Lcom/sun/webkit/graphics/WCRectangle;");
+        ASSERT(m.appendSegments && m.addArcTo && m.addArc && m.addEllipse && m.addRect
+            && m.addPath && m.transform && m.contains && m.strokeContains && m.getBounds);
+        return m;
+    }();
+    return methods;
+}
+
 jclass PG_GetPathIteratorClass(JNIEnv* env)
 {
     static JGClass pathIteratorCls(
@@ -40,6 +40,23 @@ jclass PG_GetImageFrameClass(JNIEnv* env);
 jclass PG_GetMediaPlayerClass(JNIEnv* env);
 jclass PG_GetPathClass(JNIEnv* env);
 jclass PG_GetPathIteratorClass(JNIEnv* env);
+
+// The method IDs of com.sun.webkit.graphics.WCPath, which are all resolved
+// together on first use, so that the frequent path calls need no lookup
+// and no guard of their own.
+struct WCPathMethods {
+    jmethodID appendSegments;
+    jmethodID addArcTo;
+    jmethodID addArc;
+    jmethodID addEllipse;
+    jmethodID addRect;
+    jmethodID addPath;
+    jmethodID transform;
+    jmethodID contains;
+    jmethodID strokeContains;
+    jmethodID getBounds;
+};
+const WCPathMethods& PG_GetPathMethods(JNIEnv* env);
 jclass PG_GetRectangleClass(JNIEnv* env);
 jclass PG_GetRefClass(JNIEnv* env);
 jclass PG_GetRenderQueueClass(JNIEnv* env);
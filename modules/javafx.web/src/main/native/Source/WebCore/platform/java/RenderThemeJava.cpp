@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,7 +26,9 @@
 #include "config.h"
 
 #include <cstdio>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/Vector.h>
+#include <wtf/WeakHashMap.h>
 #include <wtf/text/StringBuilder.h>
 
 #include "CSSPropertyNames.h"
@@ -91,6 +93,45 @@ int RenderThemeJava::createWidgetState(const RenderObject& o)
     return state;
 }
 
+namespace {
+
+// The widget created for a control is reused for as long as nothing that
+// goes into createWidget changes, so that repainting an unchanged form
+// does not call into the Java theme for each of its controls.
+struct CachedWidget {
+    JGObject renderTheme;
+    jint widgetGeneration;
+    Vector<jbyte> key;
+    RefPtr<RQRef> widgetRef;
+};
+
+SingleThreadWeakHashMap<RenderObject, CachedWidget>& cachedWidgets()
+{
+    static NeverDestroyed<SingleThreadWeakHashMap<RenderObject, CachedWidget>> widgets;
+    return widgets;
+}
+
+// The Java theme bumps this whenever widgets it created before may no
+// longer be drawn.
+jint widgetGeneration(JNIEnv* env, jobject jRenderTheme)
+{
+    static jfieldID fid = env->GetFieldID(PG_GetRenderThemeClass(env), "widgetGeneration", "I");
+    ASSERT(fid);
+    return env->GetIntField(jRenderTheme, fid);
+}
+
+Vector<jbyte> widgetKey(int widgetIndex, int state, const IntSize& size, jint bgColor, const Vector<jbyte>& extParams)
+{
+    jint values[] = { widgetIndex, state, size.width(), size.height(), bgColor };
+    Vector<jbyte> key(sizeof(values) + extParams.size());
+    memcpy(key.data(), values, sizeof(values));
+    if (!extParams.isEmpty())
+        memcpy(key.data() + sizeof(values), extParams.data(), extParams.size());
+    return key;
+}
+
+}
+
 bool RenderThemeJava::paintWidget(
     int widgetIndex,
     const RenderObject& object,
@@ -185,29 +226,49 @@ bool RenderThemeJava::paintWidget(
         memcpy(data, &region, sizeof(region));
     }
 
-    static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "createWidget",
-            "(JIIIIILjava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/Ref;");
-    ASSERT(mid);
-
     auto [r, g, b, a] = bgColor.toColorTypeLossy<SRGBA<uint8_t>>().resolved();
-    RefPtr<RQRef> widgetRef = RQRef::create(
-        env->CallObjectMethod(jobject(*jRenderTheme), mid,
-            ptr_to_jlong(&object),
-            (jint)widgetIndex,
-            (jint)state,
-            (jint)rect.width(), (jint)rect.height(),
-            (jint)(a << 24 | r << 16 | g << 8 | b),
-            (jobject)JLObject(extParams.isEmpty()
-                ? nullptr
-                : env->NewDirectByteBuffer(
-                    extParams.data(),
-                    extParams.size())))
-        );
-    if (!widgetRef.get()) {
-        //switch to WebKit default render
-        return true;
+    jint jbgColor = a << 24 | r << 16 | g << 8 | b;
+
+    auto key = widgetKey(widgetIndex, state, rect.size(), jbgColor, extParams);
+    RefPtr<RQRef> widgetRef;
+    auto it = cachedWidgets().find(object);
+    if (it != cachedWidgets().end()
+        && it->value.key == key
+        && it->value.widgetGeneration == widgetGeneration(env, jobject(*jRenderTheme))
+        && env->IsSameObject(it->value.renderTheme, jobject(*jRenderTheme))) {
+        widgetRef = it->value.widgetRef;
+    } else {
+        static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "createWidget",
+                "(JIIIIILjava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/Ref;");
+        ASSERT(mid);
+
+        widgetRef = RQRef::create(
+            env->CallObjectMethod(jobject(*jRenderTheme), mid,
+                ptr_to_jlong(&object),
+                (jint)widgetIndex,
+                (jint)state,
+                (jint)rect.width(), (jint)rect.height(),
+                jbgColor,
+                (jobject)JLObject(extParams.isEmpty()
+                    ? nullptr
+                    : env->NewDirectByteBuffer(
+                        extParams.data(),
+                        extParams.size())))
+            );
+        if (!widgetRef.get()) {
+            cachedWidgets().remove(object);
+            //switch to WebKit default render
+            return true;
+        }
+        WTF::CheckAndClearException(env);
+
+        cachedWidgets().set(object, CachedWidget {
+            JGObject(jobject(*jRenderTheme)),
+            widgetGeneration(env, jobject(*jRenderTheme)),
+            WTFMove(key),
+            widgetRef
+        });
     }
-    WTF::CheckAndClearException(env);
 
     // widgetRef will go into rq's inner refs vector.
     paintInfo.context().platformContext()->rq().freeSpace(20)
@@ -29,17 +29,67 @@
 #if PLATFORM(JAVA)
 
 #include "NotImplemented.h"
+#include "PlatformJavaClasses.h"
 
 namespace WebCore {
 
+namespace DNSResolveQueueJavaInternal {
+
+static JGClass networkContextClass;
+static jmethodID prefetchDNSMethod;
+static jmethodID isUsingProxyMethod;
+
+static void initRefs(JNIEnv* env)
+{
+    if (!networkContextClass) {
+        networkContextClass = JLClass(env->FindClass(
+                "com/sun/webkit/network/NetworkContext"));
+        ASSERT(networkContextClass);
+
+        prefetchDNSMethod = env->GetStaticMethodID(
+                networkContextClass,
+                "fwkPrefetchDNS",
+                "(Ljava/lang/String;)V");
+        ASSERT(prefetchDNSMethod);
+
+        isUsingProxyMethod = env->GetStaticMethodID(
+                networkContextClass,
+                "fwkIsUsingProxy",
+                "()Z");
+        ASSERT(isUsingProxyMethod);
+    }
+}
+}
+
 void DNSResolveQueueJava::updateIsUsingProxy()
 {
-    notImplemented();
+    using namespace DNSResolveQueueJavaInternal;
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            networkContextClass,
+            isUsingProxyMethod);
+    if (WTF::CheckAndClearException(env)) {
+        result = JNI_TRUE;
+    }
+    m_isUsingProxy = result == JNI_TRUE;
 }
 
-void DNSResolveQueueJava::platformResolve(const String& /* hostname */)
+void DNSResolveQueueJava::platformResolve(const String& hostname)
 {
-    notImplemented();
+    using namespace DNSResolveQueueJavaInternal;
+    JNIEnv* env = WTF::GetJavaEnv();
+    initRefs(env);
+
+    // The lookup runs on a bounded pool on the Java side, which does its
+    // own throttling, so the request is done as far as the queue is concerned.
+    env->CallStaticVoidMethod(
+            networkContextClass,
+            prefetchDNSMethod,
+            (jstring)hostname.toJavaString(env));
+    WTF::CheckAndClearException(env);
+    decrementRequestCount();
 }
 
 void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
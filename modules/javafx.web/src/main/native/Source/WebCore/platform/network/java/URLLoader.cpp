@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -507,9 +507,28 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDa
     ASSERT(target);
     const uint8_t* address =
             static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<FragmentedSharedBuffer> tmp_buf = FragmentedSharedBuffer::create(std::span<const uint8_t>(address, remaining));
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    ASSERT(address);
+    // The Java buffer is reused after the call, so the data is copied once,
+    // straight into the contiguous buffer handed to the client.
+    Ref<SharedBuffer> buffer = SharedBuffer::create(std::span<const uint8_t>(address + position, remaining));
+    target->didReceiveData(buffer.ptr(), remaining);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDataArray
+  (JNIEnv* env, jclass, jbyteArray array, jint offset, jint length,
+   jlong data)
+{
+    using namespace WebCore;
+    URLLoader::Target* target =
+            static_cast<URLLoader::Target*>(jlong_to_ptr(data));
+    ASSERT(target);
+    Vector<uint8_t> bytes(length);
+    env->GetByteArrayRegion(array, offset, length, reinterpret_cast<jbyte*>(bytes.data()));
+    if (WTF::CheckAndClearException(env)) {
+        return;
+    }
+    Ref<SharedBuffer> buffer = SharedBuffer::create(WTFMove(bytes));
+    target->didReceiveData(buffer.ptr(), length);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
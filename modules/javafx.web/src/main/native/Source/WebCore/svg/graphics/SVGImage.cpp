@@ -186,14 +186,7 @@ ImageDrawResult SVGImage::drawForContainer(GraphicsContext& context, const Float
     if (!m_page)
         return ImageDrawResult::DidNothing;
 
-    RefPtr observer = imageObserver();
-    ASSERT(observer);
-
-    // Temporarily reset image observer, we don't want to receive any changeInRect() calls due to this relayout.
-    setImageObserver(nullptr);
-
     IntSize roundedContainerSize = roundedIntSize(containerSize);
-    setContainerSize(roundedContainerSize);
 
     FloatRect scaledSrc = srcRect;
     scaledSrc.scale(1 / containerZoom);
@@ -203,14 +196,93 @@ ImageDrawResult SVGImage::drawForContainer(GraphicsContext& context, const Float
     adjustedSrcSize.scale(roundedContainerSize.width() / containerSize.width(), roundedContainerSize.height() / containerSize.height());
     scaledSrc.setSize(adjustedSrcSize);
 
+#if PLATFORM(JAVA)
+    IntSize rasterSize = rasterSizeForContainer(context, roundedContainerSize, dstRect, scaledSrc);
+    FloatRect rasterSrc = scaledSrc;
+    if (!rasterSize.isEmpty()) {
+        rasterSrc.scale(static_cast<float>(rasterSize.width()) / roundedContainerSize.width(), static_cast<float>(rasterSize.height()) / roundedContainerSize.height());
+        if (RefPtr image = cachedRasterForContainer(roundedContainerSize, initialFragmentURL, rasterSize)) {
+            context.drawNativeImage(*image, dstRect, rasterSrc, options);
+            return ImageDrawResult::DidDraw;
+        }
+    }
+#endif
+
+    RefPtr observer = imageObserver();
+    ASSERT(observer);
+
+    // Temporarily reset image observer, we don't want to receive any changeInRect() calls due to this relayout.
+    setImageObserver(nullptr);
+
+    setContainerSize(roundedContainerSize);
+
     protectedFrameView()->scrollToFragment(initialFragmentURL);
 
+#if PLATFORM(JAVA)
+    if (!rasterSize.isEmpty()) {
+        if (RefPtr image = rasterizeForContainer(context, roundedContainerSize, initialFragmentURL, rasterSize)) {
+            context.drawNativeImage(*image, dstRect, rasterSrc, options);
+            setImageObserver(WTFMove(observer));
+            return ImageDrawResult::DidDraw;
+        }
+    }
+#endif
+
     ImageDrawResult result = draw(context, dstRect, scaledSrc, options);
 
     setImageObserver(WTFMove(observer));
     return result;
 }
 
+#if PLATFORM(JAVA)
+static constexpr int maximumRasterDimension = 512;
+static constexpr size_t maximumRasterCacheEntries = 4;
+
+IntSize SVGImage::rasterSizeForContainer(const GraphicsContext& context, const IntSize& containerSize, const FloatRect& dstRect, const FloatRect& srcRect) const
+{
+    if (context.paintingDisabled() || isAnimating() || srcRect.isEmpty() || containerSize.isEmpty())
+        return { };
+
+    // The raster covers the whole container at the resolution the destination
+    // ends up with on the device, so it folds in both zoom and device scale.
+    AffineTransform transform = context.getCTM();
+    FloatSize rasterSize(containerSize);
+    rasterSize.scale(transform.xScale() * dstRect.width() / srcRect.width(), transform.yScale() * dstRect.height() / srcRect.height());
+
+    IntSize size = expandedIntSize(rasterSize);
+    if (size.isEmpty() || size.width() > maximumRasterDimension || size.height() > maximumRasterDimension)
+        return { };
+    return size;
+}
+
+RefPtr<NativeImage> SVGImage::cachedRasterForContainer(const IntSize& containerSize, const URL& fragmentURL, const IntSize& rasterSize) const
+{
+    for (auto& entry : m_rasterCache) {
+        if (entry.containerSize == containerSize && entry.rasterSize == rasterSize && entry.fragmentURL == fragmentURL)
+            return entry.image;
+    }
+    return nullptr;
+}
+
+RefPtr<NativeImage> SVGImage::rasterizeForContainer(const GraphicsContext& context, const IntSize& containerSize, const URL& fragmentURL, const IntSize& rasterSize)
+{
+    RefPtr buffer = context.createImageBuffer(rasterSize);
+    if (!buffer)
+        return nullptr;
+
+    draw(buffer->context(), FloatRect(FloatPoint(), rasterSize), FloatRect(FloatPoint(), containerSize));
+
+    RefPtr image = ImageBuffer::sinkIntoNativeImage(WTFMove(buffer));
+    if (!image)
+        return nullptr;
+
+    if (m_rasterCache.size() >= maximumRasterCacheEntries)
+        m_rasterCache.remove(0);
+    m_rasterCache.append({ containerSize, rasterSize, fragmentURL, image });
+    return image;
+}
+#endif
+
 RefPtr<NativeImage> SVGImage::nativeImage(const DestinationColorSpace& colorSpace)
 {
     if (!m_page)
@@ -463,6 +535,9 @@ EncodedDataStatus SVGImage::dataChanged(bool allDataReceived)
         return EncodedDataStatus::Complete;
 
     if (allDataReceived) {
+#if PLATFORM(JAVA)
+        clearRasterCache();
+#endif
         auto pageConfiguration = pageConfigurationWithEmptyClients(std::nullopt, PAL::SessionID::defaultSessionID());
         pageConfiguration.chromeClient = makeUniqueRef<SVGImageChromeClient>(this);
 
@@ -99,8 +99,28 @@ private:
     ImageDrawResult drawForContainer(GraphicsContext&, const FloatSize containerSize, float containerZoom, const URL& initialFragmentURL, const FloatRect& dstRect, const FloatRect& srcRect, ImagePaintingOptions = { });
     void drawPatternForContainer(GraphicsContext&, const FloatSize& containerSize, float containerZoom, const URL& initialFragmentURL, const FloatRect& srcRect, const AffineTransform&, const FloatPoint& phase, const FloatSize& spacing, const FloatRect&, ImagePaintingOptions = { });
 
+#if PLATFORM(JAVA)
+    // Icons are drawn over and over at the same size, and painting the SVG
+    // document each time goes through many path calls into Java. Keep a few
+    // device-scale rasterizations around and draw those instead.
+    struct RasterCacheEntry {
+        IntSize containerSize;
+        IntSize rasterSize;
+        URL fragmentURL;
+        RefPtr<NativeImage> image;
+    };
+
+    IntSize rasterSizeForContainer(const GraphicsContext&, const IntSize& containerSize, const FloatRect& dstRect, const FloatRect& srcRect) const;
+    RefPtr<NativeImage> cachedRasterForContainer(const IntSize& containerSize, const URL& fragmentURL, const IntSize& rasterSize) const;
+    RefPtr<NativeImage> rasterizeForContainer(const GraphicsContext&, const IntSize& containerSize, const URL& fragmentURL, const IntSize& rasterSize);
+    void clearRasterCache() { m_rasterCache.clear(); }
+#endif
+
     RefPtr<Page> m_page;
     FloatSize m_intrinsicSize;
+#if PLATFORM(JAVA)
+    Vector<RasterCacheEntry> m_rasterCache;
+#endif
 
     Timer m_startAnimationTimer;
 };
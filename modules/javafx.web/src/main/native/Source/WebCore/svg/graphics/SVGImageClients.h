@@ -68,6 +68,12 @@ private:
         if (!imageObserver)
             return;
 
+#if PLATFORM(JAVA)
+        // The observer is detached while the image draws itself, so this
+        // is a change to the document rather than a relayout for a container.
+        image->clearRasterCache();
+#endif
+
         imageObserver->imageFrameAvailable(*image, image->isAnimating() ? ImageAnimatingState::Yes : ImageAnimatingState::No, &rect);
     }
 
@@ -39,6 +39,7 @@
 #include <wtf/Threading.h>
 
 #if PLATFORM(JAVA)
+#include <wtf/CPUTime.h>
 #include <wtf/java/JavaEnv.h>
 #endif
 
@@ -51,6 +52,15 @@ unsigned WorkerThread::workerThreadCount()
     return workerThreadCounter;
 }
 
+#if PLATFORM(JAVA)
+static std::atomic<uint64_t> exitedWorkerThreadsCPUTimeInMicroseconds { 0 };
+
+Seconds WorkerThread::exitedWorkerThreadsCPUTime()
+{
+    return Seconds::fromMicroseconds(exitedWorkerThreadsCPUTimeInMicroseconds.load());
+}
+#endif
+
 WorkerParameters WorkerParameters::isolatedCopy() const
 {
     return {
@@ -131,6 +141,9 @@ Ref<Thread> WorkerThread::createThread()
 
     return Thread::create(threadName(), [this] {
         workerOrWorkletThread();
+#if PLATFORM(JAVA)
+        exitedWorkerThreadsCPUTimeInMicroseconds += CPUTime::forCurrentThread().microsecondsAs<uint64_t>();
+#endif
     }, ThreadType::JavaScript);
 }
 
@@ -105,6 +105,11 @@ public:
     // Number of active worker threads.
     WEBCORE_EXPORT static unsigned workerThreadCount();
 
+#if PLATFORM(JAVA)
+    // CPU time spent by worker threads that have exited.
+    WEBCORE_EXPORT static Seconds exitedWorkerThreadsCPUTime();
+#endif
+
 #if ENABLE(NOTIFICATIONS)
     NotificationClient* getNotificationClient() { return m_notificationClient; }
     void setNotificationClient(NotificationClient* client) { m_notificationClient = client; }
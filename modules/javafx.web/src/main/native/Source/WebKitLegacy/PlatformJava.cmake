@@ -124,6 +124,7 @@ list(APPEND WebKitLegacy_SOURCES
     java/WebCoreSupport/EditorClientJava.cpp
     java/WebCoreSupport/FrameLoaderClientJava.cpp
     java/WebCoreSupport/ProgressTrackerClientJava.cpp
+    java/WebCoreSupport/UserContentProviderJava.cpp
     java/WebCoreSupport/VisitedLinkStoreJava.cpp
     java/WebCoreSupport/InspectorClientJava.cpp
     java/WebCoreSupport/WebPage.cpp
@@ -26,6 +26,7 @@
 
 #include "PingHandle.h"
 #include <WebCore/CachedResource.h>
+#include <WebCore/DNS.h>
 #include <WebCore/Document.h>
 #include <WebCore/DocumentLoader.h>
 #include <WebCore/FetchOptions.h>
@@ -414,7 +415,14 @@ void WebResourceLoadScheduler::addOnlineStateChangeListener(WTF::Function<void(b
     NetworkStateNotifier::singleton().addListener(WTFMove(listener));
 }
 
-void WebResourceLoadScheduler::preconnectTo(FrameLoader&, const URL&, StoredCredentialsPolicy, ShouldPreconnectAsFirstParty, PreconnectCompletionHandler&&)
+void WebResourceLoadScheduler::preconnectTo(FrameLoader&, const URL& url, StoredCredentialsPolicy, ShouldPreconnectAsFirstParty, PreconnectCompletionHandler&&)
 {
+#if PLATFORM(JAVA)
+    // The Java loaders have no socket level preconnect, so at least get
+    // the host name resolved before the first request goes out.
+    prefetchDNS(url.host().toString());
+#else
+    UNUSED_PARAM(url);
+#endif
 }
 
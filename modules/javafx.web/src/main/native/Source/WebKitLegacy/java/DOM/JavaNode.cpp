@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #undef IMPL
 
 #include <wtf/RefPtr.h>
+#include <wtf/Vector.h>
 
 #include <WebCore/AddEventListenerOptions.h>
 #include <WebCore/Document.h>
@@ -56,6 +57,13 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeImpl_dispose(JNIEnv*, jclass,
     IMPL->deref();
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeImpl_disposePeers(JNIEnv* env, jclass, jlongArray peers, jint count) {
+    Vector<jlong> nodes(count);
+    env->GetLongArrayRegion(peers, 0, count, nodes.data());
+    for (auto peer : nodes)
+        IMPL->deref();
+}
+
 
 // Attributes
 JNIEXPORT jstring JNICALL Java_com_sun_webkit_dom_NodeImpl_getNodeNameImpl(JNIEnv* env, jclass, jlong peer) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,6 +32,7 @@
 
 #include <wtf/RefPtr.h>
 #include <wtf/GetPtr.h>
+#include <wtf/Vector.h>
 
 #include <WebCore/JavaDOMUtils.h>
 #include <wtf/java/JavaEnv.h>
@@ -64,5 +65,45 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_dom_NodeListImpl_itemImpl(JNIEnv* en
     return JavaReturn<Node>(env, WTF::getPtr(IMPL->item(index)));
 }
 
+// Returns the items of a static list, for example the result of
+// querySelectorAll, in one call. Every non-zero entry holds a reference
+// that is either adopted by NodeImpl.getImpl or released by
+// releaseItemsImpl. Live lists return null, the caller has to go through
+// itemImpl for them.
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_dom_NodeListImpl_itemsImpl(JNIEnv* env, jclass, jlong peer)
+{
+    WebCore::JSMainThreadNullState state;
+    if (IMPL->isLiveNodeList() || IMPL->isChildNodeList())
+        return nullptr;
+
+    unsigned length = IMPL->length();
+    Vector<jlong> items(length);
+    for (unsigned i = 0; i < length; ++i) {
+        RefPtr node = IMPL->item(i);
+        items[i] = ptr_to_jlong(node.leakRef());
+    }
+
+    jlongArray result = env->NewLongArray(length);
+    if (!result) {
+        for (auto item : items) {
+            if (item)
+                jlong_to_Nodeptr(item)->deref();
+        }
+        return nullptr;
+    }
+    env->SetLongArrayRegion(result, 0, length, items.data());
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeListImpl_releaseItemsImpl(JNIEnv* env, jclass, jlongArray items)
+{
+    Vector<jlong> peers(env->GetArrayLength(items));
+    env->GetLongArrayRegion(items, 0, peers.size(), peers.data());
+    for (auto item : peers) {
+        if (item)
+            jlong_to_Nodeptr(item)->deref();
+    }
+}
+
 
 }
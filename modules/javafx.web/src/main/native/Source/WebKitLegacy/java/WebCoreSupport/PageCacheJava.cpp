@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 
 #include <WebCore/BackForwardCache.h>
 #include <WebCore/PlatformJavaClasses.h>
+#include <wtf/RAMSize.h>
 // FIXME: Openjfx2.26 rename pagecache to backforwardcache
 #include "com_sun_webkit_PageCache.h"
 
@@ -44,4 +45,30 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_PageCache_twkSetCapacity
     WebCore::BackForwardCache::singleton().setMaxSize(capacity);
 }
 
+JNIEXPORT jint JNICALL Java_com_sun_webkit_PageCache_twkGetDefaultCapacity
+  (JNIEnv *, jclass)
+{
+    // A cached page keeps its whole DOM, render tree and JavaScript heap
+    // alive, so only keep a few of them and none at all on small machines.
+    // This follows the WebKit browser cache models, with some more room on
+    // machines that have plenty of memory.
+    size_t memorySize = WTF::ramSize() / (1024 * 1024);
+    if (memorySize >= 4096) {
+        return 4;
+    }
+    if (memorySize >= 512) {
+        return 2;
+    }
+    if (memorySize >= 256) {
+        return 1;
+    }
+    return 0;
+}
+
+JNIEXPORT jint JNICALL Java_com_sun_webkit_PageCache_twkGetPageCount
+  (JNIEnv *, jclass)
+{
+    return WebCore::BackForwardCache::singleton().pageCount();
+}
+
 }
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "UserContentProviderJava.h"
+
+#if ENABLE(CONTENT_EXTENSIONS)
+#include <WebCore/CompiledContentExtension.h>
+#include <WebCore/ContentExtensionCompiler.h>
+#include <WebCore/ContentExtensionParser.h>
+#endif
+#include <wtf/NeverDestroyed.h>
+
+using namespace WebCore;
+
+UserContentProviderJava& UserContentProviderJava::shared()
+{
+    static NeverDestroyed<Ref<UserContentProviderJava>> provider(adoptRef(*new UserContentProviderJava));
+    return provider.get();
+}
+
+#if ENABLE(CONTENT_EXTENSIONS)
+
+namespace {
+
+// The serialized form starts with a magic number and a version, followed by
+// the sizes of the four bytecode sections and the sections themselves.
+// Bump the version whenever the WebCore bytecode format changes.
+constexpr uint32_t compiledRuleListMagic = 0x4A465843; // "JFXC"
+constexpr uint32_t compiledRuleListVersion = 1;
+constexpr size_t sectionCount = 4;
+constexpr size_t headerSize = (2 + sectionCount) * sizeof(uint32_t);
+
+class CompiledContentRuleListJava final : public ContentExtensions::CompiledContentExtension {
+public:
+    static RefPtr<CompiledContentRuleListJava> create(Vector<uint8_t>&& data)
+    {
+        if (data.size() < headerSize)
+            return nullptr;
+        uint32_t header[2 + sectionCount];
+        memcpy(header, data.data(), headerSize);
+        if (header[0] != compiledRuleListMagic || header[1] != compiledRuleListVersion)
+            return nullptr;
+        size_t size = headerSize;
+        for (size_t i = 0; i < sectionCount; ++i)
+            size += header[2 + i];
+        if (size != data.size())
+            return nullptr;
+        return adoptRef(*new CompiledContentRuleListJava(WTFMove(data), header + 2));
+    }
+
+    std::span<const uint8_t> serializedActions() const final { return m_sections[0]; }
+    std::span<const uint8_t> urlFiltersBytecode() const final { return m_sections[1]; }
+    std::span<const uint8_t> topURLFiltersBytecode() const final { return m_sections[2]; }
+    std::span<const uint8_t> frameURLFiltersBytecode() const final { return m_sections[3]; }
+
+private:
+    CompiledContentRuleListJava(Vector<uint8_t>&& data, const uint32_t* sectionSizes)
+        : m_data(WTFMove(data))
+    {
+        auto remaining = m_data.span().subspan(headerSize);
+        for (size_t i = 0; i < sectionCount; ++i) {
+            m_sections[i] = remaining.first(sectionSizes[i]);
+            remaining = remaining.subspan(sectionSizes[i]);
+        }
+    }
+
+    Vector<uint8_t> m_data;
+    std::array<std::span<const uint8_t>, sectionCount> m_sections;
+};
+
+class CompilationClient final : public ContentExtensions::ContentExtensionCompilationClient {
+public:
+    Vector<uint8_t> serialize()
+    {
+        uint32_t header[2 + sectionCount] = { compiledRuleListMagic, compiledRuleListVersion };
+        size_t size = headerSize;
+        for (size_t i = 0; i < sectionCount; ++i) {
+            header[2 + i] = m_sections[i].size();
+            size += m_sections[i].size();
+        }
+        Vector<uint8_t> data;
+        data.reserveInitialCapacity(size);
+        data.append(std::span { reinterpret_cast<const uint8_t*>(header), headerSize });
+        for (auto& section : m_sections)
+            data.appendVector(section);
+        return data;
+    }
+
+private:
+    void writeSource(String&&) final { }
+    void writeActions(Vector<ContentExtensions::SerializedActionByte>&& actions) final { m_sections[0].appendVector(actions); }
+    void writeURLFiltersBytecode(Vector<ContentExtensions::DFABytecode>&& bytecode) final { m_sections[1].appendVector(bytecode); }
+    void writeTopURLFiltersBytecode(Vector<ContentExtensions::DFABytecode>&& bytecode) final { m_sections[2].appendVector(bytecode); }
+    void writeFrameURLFiltersBytecode(Vector<ContentExtensions::DFABytecode>&& bytecode) final { m_sections[3].appendVector(bytecode); }
+    void finalize() final { }
+
+    std::array<Vector<uint8_t>, sectionCount> m_sections;
+};
+
+} // namespace
+
+Expected<Vector<uint8_t>, String> UserContentProviderJava::compileContentRuleList(const String& json)
+{
+    auto rules = ContentExtensions::parseRuleList(json);
+    if (!rules)
+        return makeUnexpected(String::fromUTF8(rules.error().message().c_str()));
+
+    CompilationClient client;
+    if (auto error = ContentExtensions::compileRuleList(client, String(json), WTFMove(*rules)))
+        return makeUnexpected(String::fromUTF8(error.message().c_str()));
+    return client.serialize();
+}
+
+bool UserContentProviderJava::addContentRuleList(const String& identifier, Vector<uint8_t>&& compiled)
+{
+    auto ruleList = CompiledContentRuleListJava::create(WTFMove(compiled));
+    if (!ruleList)
+        return false;
+    m_contentExtensionBackend.addContentExtension(identifier, ruleList.releaseNonNull(), { });
+    invalidateInjectedStyleSheetCacheInAllFramesInAllPages();
+    return true;
+}
+
+void UserContentProviderJava::removeContentRuleList(const String& identifier)
+{
+    m_contentExtensionBackend.removeContentExtension(identifier);
+    invalidateInjectedStyleSheetCacheInAllFramesInAllPages();
+}
+
+#endif // ENABLE(CONTENT_EXTENSIONS)
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <WebCore/UserContentProvider.h>
+#include <wtf/Expected.h>
+
+// Holds the content rule lists that apply to the loads of all pages.
+// A rule list is compiled from the WebKit content blocker JSON format
+// into DFA bytecode, which the Java side may keep on disk and install
+// again later without compiling.
+class UserContentProviderJava final : public WebCore::UserContentProvider {
+public:
+    static UserContentProviderJava& shared();
+
+#if ENABLE(CONTENT_EXTENSIONS)
+    // Returns the compiled rule list in the serialized form accepted by
+    // addContentRuleList, or a description of the error.
+    static Expected<Vector<uint8_t>, String> compileContentRuleList(const String& json);
+
+    // Returns false if the data is not a compiled rule list of this version.
+    bool addContentRuleList(const String& identifier, Vector<uint8_t>&& compiled);
+    void removeContentRuleList(const String& identifier);
+#endif
+
+private:
+    UserContentProviderJava() = default;
+
+    void forEachUserScript(Function<void(WebCore::DOMWrapperWorld&, const WebCore::UserScript&)>&&) const final { }
+    void forEachUserStyleSheet(Function<void(const WebCore::UserStyleSheet&)>&&) const final { }
+#if ENABLE(USER_MESSAGE_HANDLERS)
+    void forEachUserMessageHandler(Function<void(const WebCore::UserMessageHandlerDescriptor&)>&&) const final { }
+#endif
+#if ENABLE(CONTENT_EXTENSIONS)
+    WebCore::ContentExtensions::ContentExtensionsBackend& userContentExtensionBackend() final { return m_contentExtensionBackend; }
+
+    WebCore::ContentExtensions::ContentExtensionsBackend m_contentExtensionBackend;
+#endif
+};
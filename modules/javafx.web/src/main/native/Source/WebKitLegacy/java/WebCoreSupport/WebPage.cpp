@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,7 @@
 #include "PageStorageSessionProvider.h"
 #include "PlatformStrategiesJava.h"
 #include "ProgressTrackerClientJava.h"
+#include "UserContentProviderJava.h"
 #include "VisitedLinkStoreJava.h"
 #include "WebKitLegacy/Storage/StorageNamespaceImpl.h"
 #include "WebKitLegacy/Storage/WebDatabaseProvider.h"
@@ -51,13 +52,17 @@
 #include <JavaScriptCore/InitializeThreading.h>
 #include <JavaScriptCore/JSContextRef.h>
 #include <JavaScriptCore/JSContextRefPrivate.h>
+#include <JavaScriptCore/HeapObserver.h>
 #include <JavaScriptCore/JSStringRef.h>
 #include <JavaScriptCore/Options.h>
+#include <JavaScriptCore/VM.h>
+#include <WebCore/BackForwardCache.h>
 #include <WebCore/BackForwardController.h>
 #include <WebCore/BridgeUtils.h>
 #include <WebCore/CharacterData.h>
 #include <WebCore/Chrome.h>
 #include <WebCore/ColorTypes.h>
+#include <WebCore/CommonVM.h>
 #include <WebCore/CompositionHighlight.h>
 #include <WebCore/ContextMenu.h>
 #include <WebCore/ContextMenuController.h>
@@ -73,6 +78,7 @@
 #include <WebCore/FloatRect.h>
 #include <WebCore/FloatSize.h>
 #include <WebCore/FocusController.h>
+#include <WebCore/FontCache.h>
 #include <WebCore/Frame.h>
 #include <WebCore/FrameLoadRequest.h>
 #include <WebCore/FrameTree.h>
@@ -83,6 +89,7 @@
 #include <WebCore/GraphicsLayerTextureMapper.h>
 #include <WebCore/InspectorController.h>
 #include <WebCore/KeyboardEvent.h>
+#include <WebCore/MemoryCache.h>
 #include <WebCore/LogInitialization.h>
 #include <WebCore/NodeTraversal.h>
 #include <WebCore/Page.h>
@@ -95,8 +102,10 @@
 #include <WebCore/PlatformTouchEvent.h>
 #include <WebCore/PlatformWheelEvent.h>
 #include <WebCore/RenderTreeAsText.h>
+#include <WebCore/RenderingQueue.h>
 #include <WebCore/RenderView.h>
 #include <WebCore/ResourceRequest.h>
+#include <WebCore/ScriptBytecodeCacheJava.h>
 #include <WebCore/ScriptController.h>
 #include <WebCore/SecurityPolicy.h>
 #include <WebCore/Settings.h>
@@ -106,11 +115,17 @@
 #include <WebCore/TextureMapperLayer.h>
 #include <WebCore/WorkerThread.h>
 #include <WebCore/platform/graphics/java/GraphicsContextJava.h>
+#include <wtf/Lock.h>
+#include <wtf/MemoryFootprint.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/Ref.h>
 #include <wtf/RunLoop.h>
+#include <wtf/SystemTracing.h>
 #include <wtf/java/JavaRef.h>
+#include <wtf/java/TraceRecorderJava.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/text/MakeString.h>
+#include <wtf/text/StringBuilder.h>
 #include <wtf/text/StringToIntegerConversion.h>
 
 // FIXME: Move dependency of runtime_root to BridgeUtils
@@ -265,6 +280,8 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
         return;
     }
 
+    TraceScope tracingScope(WebPagePaintStart, WebPagePaintEnd);
+
     // Will be deleted by GraphicsContext destructor
     PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
     GraphicsContextJava gc(ppgc);
@@ -314,6 +331,38 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
     gc.platformContext()->rq().flushBuffer();
 }
 
+// Paints [x, y, w, h] of the page into an image render queue whose origin
+// is the top left corner of that rectangle. Composited layers are painted
+// directly, as there is no scene graph to composite them into.
+void WebPage::paintOffscreen(jobject rq, jint x, jint y, jint w, jint h)
+{
+    Frame* mainFrame = (Frame*)&m_page->mainFrame();
+    auto* localFrame = dynamicDowncast<LocalFrame>(mainFrame);
+    LocalFrameView* frameView = localFrame ? localFrame->view() : nullptr;
+    if (!frameView) {
+        return;
+    }
+
+    TraceScope tracingScope(WebPagePaintStart, WebPagePaintEnd);
+
+    // Will be deleted by GraphicsContext destructor
+    PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
+    GraphicsContextJava gc(ppgc);
+
+    JSGlobalContextRef globalContext = toGlobalRef(localFrame->script().globalObject(mainThreadNormalWorld()));
+    JSC::JSLockHolder sw(toJS(globalContext));
+
+    IntRect rect(x, y, w, h);
+    gc.translate(-x, -y);
+    if (m_rootLayer) {
+        renderCompositedLayers(gc, rect);
+    } else {
+        frameView->paint(gc, rect);
+    }
+
+    gc.platformContext()->rq().flushBuffer();
+}
+
 void WebPage::scroll(const IntSize& scrollDelta,
                      const IntRect& rectToScroll,
                      const IntRect& clipRect)
@@ -400,13 +449,34 @@ void WebPage::scheduleRenderingUpdate()
 void WebPage::markForSync()
 {
     if (!m_rootLayer) {
-        m_page->isolatedUpdateRendering();
+        requestRenderingUpdate();
         return;
     }
     m_syncLayers = true;
     requestJavaRepaint(pageRect());
 }
 
+void WebPage::requestRenderingUpdate()
+{
+    // The update runs from WebPage.updateContent on the next pulse, which
+    // keeps requestAnimationFrame in step with the frames actually shown
+    // and suspends it while the view is hidden.
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(
+            PG_GetWebPageClass(env),
+            "fwkScheduleRenderingUpdate",
+            "()Z");
+    ASSERT(mid);
+
+    jboolean deferred = env->CallBooleanMethod(
+            jobjectFromPage(m_page.get()),
+            mid);
+    if (WTF::CheckAndClearException(env) || !deferred) {
+        m_page->isolatedUpdateRendering();
+    }
+}
+
 void WebPage::syncLayers()
 {
     if (!m_rootLayer) {
@@ -872,6 +942,61 @@ namespace {
 bool s_useJIT;
 bool s_useDFGJIT;
 bool s_useCSS3D;
+// Total memory cache capacity in bytes, 0 keeps the WebCore default.
+unsigned s_memoryCacheCapacity;
+
+// Records JavaScriptCore collections of the shared VM so that embedders
+// can line them up with the JVM's own GC log.
+class GCStatisticsObserver final : public JSC::HeapObserver {
+public:
+    void willGarbageCollect() final
+    {
+        m_collectionStart = MonotonicTime::now();
+    }
+
+    void didGarbageCollect(JSC::CollectionScope scope) final
+    {
+        Seconds duration = MonotonicTime::now() - m_collectionStart;
+        Locker locker { m_lock };
+        if (scope == JSC::CollectionScope::Full)
+            ++m_fullCollections;
+        else
+            ++m_edenCollections;
+        m_totalTime += duration;
+        m_lastTime = duration;
+        m_maxTime = std::max(m_maxTime, duration);
+        m_lastEnd = WallTime::now();
+    }
+
+    std::array<jdouble, 6> statistics()
+    {
+        Locker locker { m_lock };
+        return {
+            static_cast<jdouble>(m_edenCollections),
+            static_cast<jdouble>(m_fullCollections),
+            m_totalTime.milliseconds(),
+            m_lastTime.milliseconds(),
+            m_maxTime.milliseconds(),
+            m_lastEnd.secondsSinceEpoch().milliseconds()
+        };
+    }
+
+private:
+    MonotonicTime m_collectionStart;
+    Lock m_lock;
+    uint64_t m_edenCollections WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    uint64_t m_fullCollections WTF_GUARDED_BY_LOCK(m_lock) { 0 };
+    Seconds m_totalTime WTF_GUARDED_BY_LOCK(m_lock);
+    Seconds m_lastTime WTF_GUARDED_BY_LOCK(m_lock);
+    Seconds m_maxTime WTF_GUARDED_BY_LOCK(m_lock);
+    WallTime m_lastEnd WTF_GUARDED_BY_LOCK(m_lock);
+};
+
+GCStatisticsObserver& gcStatisticsObserver()
+{
+    static NeverDestroyed<GCStatisticsObserver> observer;
+    return observer;
+}
 
 }  // namespace
 
@@ -884,6 +1009,18 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
     s_useCSS3D = useCSS3D;
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetMemoryCacheCapacity
+    (JNIEnv*, jclass, jlong capacity)
+{
+    s_memoryCacheCapacity = static_cast<unsigned>(std::clamp<jlong>(capacity, 0, std::numeric_limits<unsigned>::max()));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBytecodeCacheDirectory
+    (JNIEnv* env, jclass, jstring directory)
+{
+    ScriptBytecodeCacheJava::setDirectory(String(env, directory));
+}
+
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
     (JNIEnv* env, jobject self, jboolean editable)
 {
@@ -910,6 +1047,24 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+        // Lets VM entries show up in TraceRecorder, which is checked first.
+        JSC::Options::useTracePoints() = true;
+    });
+
+    static std::once_flag initializeMemoryCache;
+    std::call_once(initializeMemoryCache, [] {
+        // Decoded image data of live resources is released, least recently
+        // painted first, once the live resources outgrow their share of the
+        // capacity. The encoded data is kept and decoded again when painted.
+        if (s_memoryCacheCapacity) {
+            MemoryCache::singleton().setCapacities(s_memoryCacheCapacity / 8,
+                s_memoryCacheCapacity / 4, s_memoryCacheCapacity);
+        }
+    });
+
+    static std::once_flag installGCStatisticsObserver;
+    std::call_once(installGCStatisticsObserver, [] {
+        commonVM().heap.addObserver(&gcStatisticsObserver().get());
     });
 
     JLObject jlself(self, true);
@@ -927,6 +1082,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
     pc.databaseProvider = &WebDatabaseProvider::singleton();
     pc.storageNamespaceProvider = adoptRef(new WebStorageNamespaceProviderJava());
     pc.visitedLinkStore = VisitedLinkStoreJava::create();
+    pc.userContentProvider = Ref<UserContentProvider> { UserContentProviderJava::shared() };
 
     //pc.clientForMainFrame = UniqueRef<LocalFrameLoaderClient>(makeUniqueRef<FrameLoaderClientJava>(jlself));
     pc.clientCreatorForMainFrame = CompletionHandler<UniqueRef<LocalFrameLoaderClient>(LocalFrame&)>(
@@ -1433,6 +1589,139 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkOverridePreference
     }
 }
 
+JNIEXPORT jdoubleArray JNICALL Java_com_sun_webkit_WebPage_twkGetJSGCStatistics
+    (JNIEnv* env, jclass)
+{
+    auto statistics = gcStatisticsObserver().statistics();
+    jdoubleArray result = env->NewDoubleArray(statistics.size());
+    if (!result) {
+        return nullptr;
+    }
+    env->SetDoubleArrayRegion(result, 0, statistics.size(), statistics.data());
+    return result;
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetJSCTiers
+    (JNIEnv* env, jclass)
+{
+    StringBuilder tiers;
+    auto addTier = [&](ASCIILiteral name) {
+        if (!tiers.isEmpty()) {
+            tiers.append(' ');
+        }
+        tiers.append(name);
+    };
+#if ENABLE(C_LOOP)
+    addTier("CLoop"_s);
+#else
+    if (JSC::Options::useLLInt()) {
+        addTier("LLInt"_s);
+    }
+#endif
+#if ENABLE(JIT)
+    if (JSC::Options::useJIT() && JSC::Options::useBaselineJIT()) {
+        addTier("Baseline"_s);
+    }
+#endif
+#if ENABLE(DFG_JIT)
+    if (JSC::Options::useJIT() && JSC::Options::useDFGJIT()) {
+        addTier("DFG"_s);
+    }
+#endif
+#if ENABLE(FTL_JIT)
+    if (JSC::Options::useJIT() && JSC::Options::useFTLJIT()) {
+        addTier("FTL"_s);
+    }
+#endif
+    return tiers.toString().toJavaString(env).releaseLocal();
+}
+
+JNIEXPORT jlongArray JNICALL Java_com_sun_webkit_WebPage_twkGetMemoryStatistics
+    (JNIEnv* env, jclass)
+{
+    auto& vm = commonVM();
+    JSC::JSLockHolder lock(vm);
+    auto cache = MemoryCache::singleton().getStatistics();
+    auto& fontCache = FontCache::forCurrentThread();
+
+    // Keep in sync with WebPage.getMemoryStatistics
+    std::array<jlong, 12> statistics = {
+        static_cast<jlong>(WTF::memoryFootprint()),
+        static_cast<jlong>(vm.heap.size()),
+        static_cast<jlong>(vm.heap.capacity()),
+        static_cast<jlong>(vm.heap.extraMemorySize()),
+        static_cast<jlong>(MemoryCache::singleton().size()),
+        static_cast<jlong>(cache.images.size),
+        static_cast<jlong>(cache.images.decodedSize),
+        static_cast<jlong>(fontCache.fontCount()),
+        static_cast<jlong>(fontCache.inactiveFontCount()),
+        static_cast<jlong>(BackForwardCache::singleton().pageCount()),
+        static_cast<jlong>(RenderingQueue::instanceCount().load()),
+        static_cast<jlong>(ByteBuffer::allocatedBytes().load()),
+    };
+    jlongArray result = env->NewLongArray(statistics.size());
+    if (!result) {
+        return nullptr;
+    }
+    env->SetLongArrayRegion(result, 0, statistics.size(), statistics.data());
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetTracingEnabled
+    (JNIEnv*, jclass, jboolean enabled)
+{
+    TraceRecorder::setEnabled(enabled);
+}
+
+JNIEXPORT jstring JNICALL Java_com_sun_webkit_WebPage_twkGetTraceEvents
+    (JNIEnv* env, jclass)
+{
+    return TraceRecorder::chromeTraceJSON().toJavaString(env).releaseLocal();
+}
+
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_WebPage_twkCompileContentRuleList
+    (JNIEnv* env, jclass, jstring json)
+{
+#if ENABLE(CONTENT_EXTENSIONS)
+    auto compiled = UserContentProviderJava::compileContentRuleList(String(env, json));
+    if (!compiled) {
+        env->ThrowNew(JLClass(env->FindClass("java/lang/IllegalArgumentException")),
+            compiled.error().utf8().data());
+        return nullptr;
+    }
+    jbyteArray result = env->NewByteArray(compiled->size());
+    if (!result) {
+        return nullptr;
+    }
+    env->SetByteArrayRegion(result, 0, compiled->size(), reinterpret_cast<const jbyte*>(compiled->data()));
+    return result;
+#else
+    env->ThrowNew(JLClass(env->FindClass("java/lang/UnsupportedOperationException")),
+        "Content rule lists are not supported");
+    return nullptr;
+#endif
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_WebPage_twkAddContentRuleList
+    (JNIEnv* env, jclass, jstring identifier, jbyteArray compiled)
+{
+#if ENABLE(CONTENT_EXTENSIONS)
+    Vector<uint8_t> data(env->GetArrayLength(compiled));
+    env->GetByteArrayRegion(compiled, 0, data.size(), reinterpret_cast<jbyte*>(data.data()));
+    return bool_to_jbool(UserContentProviderJava::shared().addContentRuleList(String(env, identifier), WTFMove(data)));
+#else
+    return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkRemoveContentRuleList
+    (JNIEnv* env, jclass, jstring identifier)
+{
+#if ENABLE(CONTENT_EXTENSIONS)
+    UserContentProviderJava::shared().removeContentRuleList(String(env, identifier));
+#endif
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkResetToConsistentStateBeforeTesting
     (JNIEnv* env, jobject self, jlong pPage)
 {
@@ -1470,6 +1759,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkResetToConsistentStateBefo
     settings.setUsesBackForwardCache(false);
     settings.setCSSOMViewScrollingAPIEnabled(true);
     settings.setRequestIdleCallbackEnabled(true);
+    // The HTML parser runs on the event thread; yield to it between chunks
+    // of a large document rather than after the default 500 ms.
+    settings.setMaxParseDuration(0.05);
 
     // settings.setPrivateBrowsingEnabled(false);
     settings.setAllowTopNavigationToDataURLs(true);
@@ -1754,6 +2046,12 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateRendering
     WebPage::pageFromJLong(pPage)->isolatedUpdateRendering();
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPaintOffscreen
+  (JNIEnv*, jobject, jlong pPage, jobject rq, jint x, jint y, jint w, jint h)
+{
+    WebPage::webPageFromJLong(pPage)->paintOffscreen(rq, x, y, w, h);
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPostPaint
   (JNIEnv*, jobject, jlong pPage, jobject rq, jint x, jint y, jint w, jint h)
 {
@@ -2599,6 +2897,12 @@ JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkWorkerThreadCount
     return WorkerThread::workerThreadCount();
 }
 
+JNIEXPORT jdouble JNICALL Java_com_sun_webkit_WebPage_twkExitedWorkerThreadsCPUTime
+  (JNIEnv*, jclass)
+{
+    return WorkerThread::exitedWorkerThreadsCPUTime().milliseconds();
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDoJSCGarbageCollection
   (JNIEnv*, jclass)
 {
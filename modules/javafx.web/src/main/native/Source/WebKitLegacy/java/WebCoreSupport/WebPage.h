@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,7 @@ public:
     void prePaint();
     void paint(jobject, jint, jint, jint, jint);
     void postPaint(jobject, jint, jint, jint, jint);
+    void paintOffscreen(jobject, jint, jint, jint, jint);
     bool processKeyEvent(const PlatformKeyboardEvent& event);
 
     void scroll(const IntSize& scrollDelta, const IntRect& rectToScroll,
@@ -107,6 +108,7 @@ public:
 private:
     void requestJavaRepaint(const IntRect&);
     void markForSync();
+    void requestRenderingUpdate();
     void syncLayers();
     IntRect pageRect();
     void renderCompositedLayers(GraphicsContext&, const IntRect&);
@@ -82,6 +82,7 @@ WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_DRAG_SUPPORT PUBLIC ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_TOUCH_EVENTS PUBLIC OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_VIDEO PUBLIC ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_3D_TRANSFORMS PRIVATE ON)
+WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_CONTENT_EXTENSIONS PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_DATALIST_ELEMENT PUBLIC OFF)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTPDIR PRIVATE ON)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FULLSCREEN_API PRIVATE ON)
@@ -110,6 +111,10 @@ WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_LCMS PRIVATE OFF)
 
 if (APPLE)
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PRIVATE OFF)
+elseif (UNIX)
+# bmalloc/libpas is supported on Linux but not the default yet, build with
+# -DUSE_SYSTEM_MALLOC=OFF to use it.
+WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PUBLIC ON)
 else()
 WEBKIT_OPTION_DEFAULT_PORT_VALUE(USE_SYSTEM_MALLOC PRIVATE ON)
 endif()
@@ -132,15 +137,29 @@ if (WIN32)
     endif ()
 endif ()
 
+# Linux aarch64 targets are often kiosks running JavaScript heavy pages,
+# keep the baseline and DFG JIT tiers on there unless the kernel uses 64 KB
+# pages. FTL stays off as on all other platforms of the port.
+if (UNIX AND NOT APPLE AND WTF_CPU_ARM64 AND NOT USE_64KB_PAGE_BLOCK)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_JIT PUBLIC ON)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_DFG_JIT PRIVATE ON)
+endif ()
+
 # Finalize the value for all options. Do not attempt to use an option before
 # this point, and do not attempt to change any option after this point.
 WEBKIT_OPTION_END()
 
 
+message(STATUS "JavaScriptCore on ${CMAKE_SYSTEM_PROCESSOR}: C_LOOP=${ENABLE_C_LOOP} JIT=${ENABLE_JIT} DFG_JIT=${ENABLE_DFG_JIT} FTL_JIT=${ENABLE_FTL_JIT}")
+
 set(ENABLE_WEBKIT_LEGACY ON)
 set(ENABLE_WEBKIT OFF)
 set(ENABLE_WEBINSPECTORUI OFF)
 add_definitions(-DBUILDING_JAVA__=1)
+if (NOT APPLE AND NOT USE_SYSTEM_MALLOC AND CMAKE_SIZEOF_VOID_P EQUAL 8)
+    # BPlatform.h leaves libpas off on Linux.
+    add_definitions(-DBENABLE_LIBPAS=1 -DPAS_BMALLOC=1)
+endif ()
 add_definitions(-DDATA_DIR="${CMAKE_INSTALL_DATADIR}")
 # add_definitions(-DUSE_CROSS_PLATFORM_CONTEXT_MENUS=1)
 
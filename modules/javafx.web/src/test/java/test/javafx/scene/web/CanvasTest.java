@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -162,6 +162,38 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasRepeatedDrawImage() {
+        final String htmlCanvasContent = "\n"
+            + "<canvas id='canvassprites' width='100' height='20'></canvas>\n"
+            + "<script>\n"
+            + "var sprite = document.createElement('canvas');\n"
+            + "sprite.width = sprite.height = 10;\n"
+            + "var spriteCtx = sprite.getContext('2d');\n"
+            + "spriteCtx.fillStyle = 'red';\n"
+            + "spriteCtx.fillRect(0, 0, 10, 10);\n"
+            + "\n"
+            + "var ctx = document.getElementById('canvassprites').getContext('2d');\n"
+            + "for (var i = 0; i < 5; i++) {\n"
+            + "    ctx.drawImage(sprite, i * 20, 0);\n"
+            + "}\n"
+            + "ctx.drawImage(sprite, 0, 0, 10, 10, 90, 10, 10, 10);\n"
+            + "</script>\n";
+
+        loadContent(htmlCanvasContent);
+        submit(() -> {
+            final String pixel =
+                    "document.getElementById('canvassprites').getContext('2d').getImageData(%d, %d, 1, 1).data[0]";
+            for (int i = 0; i < 5; i++) {
+                assertEquals(255, (int) getEngine().executeScript(String.format(pixel, i * 20 + 5, 5)),
+                        "Sprite " + i);
+                assertEquals(0, (int) getEngine().executeScript(String.format(pixel, i * 20 + 15, 5)),
+                        "Gap after sprite " + i);
+            }
+            assertEquals(255, (int) getEngine().executeScript(String.format(pixel, 95, 15)),
+                    "Sprite with source rectangle");
+        });
+    }
+
     private BufferedImage htmlCanvasToBufferedImage(final String mime) throws Exception {
         ByteArrayOutputStream errStream = new ByteArrayOutputStream();
         System.setErr(new PrintStream(errStream));
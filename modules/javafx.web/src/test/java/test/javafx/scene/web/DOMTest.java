@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -436,6 +436,27 @@ public class DOMTest extends TestBase {
         });
     }
 
+    @Test public void testQuerySelectorAllIsStatic() {
+        final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
+        submit(() -> {
+            NodeList ps = ((DocumentImpl) doc).querySelectorAll("p");
+            int length = ps.getLength();
+            assertTrue(length > 0, "Number of matched paragraphs");
+            assertEquals(doc.getElementsByTagName("p").getLength(), length, "Number of matched paragraphs");
+
+            Node first = ps.item(0);
+            assertSame(first, ps.item(0), "Same item returned twice");
+            assertSame(doc.getElementsByTagName("p").item(0), first, "Same peer as the live list");
+            assertNull(ps.item(length), "Item past the end");
+            assertNull(ps.item(-1), "Item before the start");
+
+            first.getParentNode().removeChild(first);
+            assertEquals(length, ps.getLength(), "Static list length after removal");
+            assertSame(first, ps.item(0), "Static list item after removal");
+            assertEquals(length - 1, doc.getElementsByTagName("p").getLength(), "Live list length after removal");
+        });
+    }
+
     // helper methods
 
     private void verifyChildRemoved(Node parent,
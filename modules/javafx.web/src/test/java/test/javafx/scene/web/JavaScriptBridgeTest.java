@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -136,6 +136,19 @@ public class JavaScriptBridgeTest extends TestBase {
         });
     }
 
+    public @Test void testSlotsBatch() {
+        submit(() -> {
+            JSObject arr = (JSObject) getEngine().executeScript("new Array(1, 2, 3)");
+            arr.setSlots(1, "two", 3.5, null, 5);
+            assertEquals(5, arr.getMember("length"));
+            assertArrayEquals(new Object[] {1, "two", 3.5, null, 5},
+                              arr.getSlots(0, 5));
+            assertArrayEquals(new Object[0], arr.getSlots(2, 0));
+            assertEquals("undefined", arr.getSlots(5, 1)[0]);
+            assertThrows(IllegalArgumentException.class, () -> arr.getSlots(0, -1));
+        });
+    }
+
     public @Test void testJSBridge3() {
         //final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
         final WebEngine web = getEngine();
@@ -752,4 +765,46 @@ public class JavaScriptBridgeTest extends TestBase {
             });
         });
     }
+
+    public static class TypedArrayReceiver {
+        public double sum(double[] values) {
+            double sum = 0;
+            for (double v : values) {
+                sum += v;
+            }
+            return sum;
+        }
+
+        public int length(byte[] bytes) {
+            return bytes == null ? -1 : bytes.length;
+        }
+
+        public int last(int[] values) {
+            return values[values.length - 1];
+        }
+
+        public boolean isNull(float[] values) {
+            return values == null;
+        }
+    }
+
+    @Test public void testTypedArrayArguments() {
+        final WebEngine web = getEngine();
+        submit(() -> {
+            bind("receiver", new TypedArrayReceiver());
+            assertEquals(6.5, web.executeScript(
+                    "receiver.sum(new Float64Array([1, 2, 3.5]))"));
+            assertEquals(1000000, web.executeScript(
+                    "receiver.length(new Uint8Array(1000000))"));
+            assertEquals(16, web.executeScript(
+                    "receiver.length(new ArrayBuffer(16))"));
+            assertEquals(4, web.executeScript(
+                    "receiver.length(new Uint8Array(new ArrayBuffer(16), 4, 4))"));
+            assertEquals(-7, web.executeScript(
+                    "receiver.last(new Int32Array([1, 2, -7]))"));
+            // Element types have to match
+            assertEquals(Boolean.TRUE, web.executeScript(
+                    "receiver.isNull(new Float64Array(2))"));
+        });
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 package test.javafx.scene.web;
 
+import com.sun.webkit.MemoryPressure;
 import java.io.BufferedReader;
 import java.io.File;
 import java.io.FileInputStream;
@@ -508,4 +509,17 @@ public class MiscellaneousTest extends TestBase {
             }
         });
     }
+
+    @Test public void testReleaseMemoryKeepsPageAlive() {
+        loadContent(
+            "<body><p id='p'>text</p><img src='data:image/png;base64," +
+            "iVBORw0KGgoAAAANSUhEUgAAAAEAAAABCAYAAAAfFcSJAAAADUlEQVR42mNk+M9QDwADhgGAWjR9awAAAABJRU5ErkJggg=='>" +
+            "<script>window.counter = 41;</script></body>");
+        submit(() -> {
+            MemoryPressure.releaseMemory(false);
+            MemoryPressure.releaseMemory(true);
+            assertEquals(42, getEngine().executeScript("++window.counter"));
+            assertEquals("text", getEngine().executeScript("document.getElementById('p').textContent"));
+        });
+    }
 }
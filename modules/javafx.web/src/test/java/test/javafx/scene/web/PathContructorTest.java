@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -59,4 +59,42 @@ public class PathContructorTest extends TestBase {
                     "First rect center");
         });
     }
+
+    @Test public void testCanvasPathWithManySegments() {
+        final String htmlCanvasContent = "<!DOCTYPE html>\n" +
+                "<html>\n" +
+                "<body style='margin: 0px 0px;'>\n" +
+                "<canvas id=\"myCanvas\" width=\"200\" height=\"100\"></canvas>\n" +
+                "<script>\n" +
+                "const ctx = document.getElementById(\"myCanvas\").getContext(\"2d\");\n" +
+                "ctx.beginPath();\n" +
+                "ctx.moveTo(10, 10);\n" +
+                "for (let x = 10; x <= 90; x += 0.01) ctx.lineTo(x, 10);\n" +
+                "ctx.lineTo(90, 90);\n" +
+                "ctx.quadraticCurveTo(50, 95, 10, 90);\n" +
+                "ctx.closePath();\n" +
+                "ctx.moveTo(150, 50);\n" +
+                "ctx.arc(150, 50, 30, 0, 2 * Math.PI);\n" +
+                "ctx.fillStyle = 'green';\n" +
+                "ctx.fill();\n" +
+                "window.inside = ctx.isPointInPath(50, 50) && ctx.isPointInPath(150, 50);\n" +
+                "window.outside = ctx.isPointInPath(110, 50);\n" +
+                "</script>\n" +
+                "</body>\n" +
+                "</html>";
+
+        loadContent(htmlCanvasContent);
+
+        submit(() -> {
+            assertEquals(Boolean.TRUE, getEngine().executeScript("window.inside"));
+            assertEquals(Boolean.FALSE, getEngine().executeScript("window.outside"));
+            int greenColor = 128;
+            assertEquals(greenColor, (int) getEngine().executeScript(
+                            "document.getElementById('myCanvas').getContext('2d').getImageData(50, 50, 1, 1).data[1]"),
+                    "Polygon center");
+            assertEquals(greenColor, (int) getEngine().executeScript(
+                            "document.getElementById('myCanvas').getContext('2d').getImageData(150, 50, 1, 1).data[1]"),
+                    "Circle center");
+        });
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,11 +27,14 @@ package test.javafx.scene.web;
 
 import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageShim;
+import java.nio.BufferOverflowException;
+import java.nio.IntBuffer;
 import javafx.scene.web.WebEngineShim;
 
 import static org.junit.jupiter.api.Assertions.assertEquals;
 import static org.junit.jupiter.api.Assertions.assertNull;
 import static org.junit.jupiter.api.Assertions.assertThrows;
+import static org.junit.jupiter.api.Assertions.assertTrue;
 import org.junit.jupiter.api.Test;
 
 public class WebPageTest extends TestBase {
@@ -105,4 +108,76 @@ public class WebPageTest extends TestBase {
             page.getClientLocationOffset(0, 0);
         });
     }
+
+    @Test
+    public void testRenderOffscreenFromNonEventThread() {
+        assertThrows(IllegalStateException.class, () -> {
+            WebPage page = WebEngineShim.getPage(getEngine());
+            page.renderOffscreen(0, 0, 1, 1, IntBuffer.allocate(1));
+        });
+    }
+
+    @Test
+    public void testRenderOffscreenBufferTooSmall() {
+        WebPage page = WebEngineShim.getPage(getEngine());
+        submit(() -> {
+            assertThrows(BufferOverflowException.class,
+                    () -> page.renderOffscreen(0, 0, 4, 4, IntBuffer.allocate(15)));
+            assertThrows(IllegalArgumentException.class,
+                    () -> page.renderOffscreen(0, 0, 0, 4, IntBuffer.allocate(16)));
+        });
+    }
+
+    @Test
+    public void testJSGCStatistics() {
+        loadContent("<script>var a = []; for (var i = 0; i < 100000; i++) a.push({ i: i });</script>");
+        submit(() -> {
+            double[] stats = WebPage.getJSGCStatistics();
+            assertEquals(6, stats.length);
+            for (double value : stats) {
+                assertTrue(value >= 0, "Negative statistic");
+            }
+            assertTrue(stats[2] >= stats[4], "Total time is at least the longest collection");
+            assertTrue(stats[4] >= stats[3], "Longest collection is at least the last one");
+        });
+    }
+
+    @Test
+    public void testJSCTiers() {
+        loadContent(HTML);
+        String tiers = submit(() -> WebPage.getJSCTiers());
+        assertTrue(tiers.startsWith("LLInt") || tiers.startsWith("CLoop"), tiers);
+        // Linux aarch64 kiosks depend on the JIT for JavaScript heavy pages
+        if (System.getProperty("os.name").startsWith("Linux")
+                && "aarch64".equals(System.getProperty("os.arch"))) {
+            assertTrue(tiers.contains("Baseline"), "Baseline JIT is used: " + tiers);
+            assertTrue(tiers.contains("DFG"), "DFG JIT is used: " + tiers);
+        }
+    }
+
+    @Test
+    public void testMemoryStatistics() {
+        loadContent(HTML);
+        submit(() -> {
+            long[] stats = WebPage.getMemoryStatistics();
+            assertEquals(12, stats.length);
+            for (long value : stats) {
+                assertTrue(value >= 0, "Negative statistic");
+            }
+            assertTrue(stats[2] >= stats[1], "JS heap capacity is at least its size");
+        });
+    }
+
+    @Test
+    public void testTraceEvents() {
+        submit(() -> WebPage.setTracingEnabled(true));
+        loadContent("<div style='width: 50%'>text</div><script>document.body.offsetWidth;</script>");
+        submit(() -> {
+            WebPage.setTracingEnabled(false);
+            String trace = WebPage.getTraceEvents();
+            assertTrue(trace.startsWith("{\"traceEvents\":["), "Trace event format");
+            assertTrue(trace.contains("\"name\":\"Layout\""), "Layout is traced");
+            assertTrue(trace.contains("\"name\":\"JavaScript\""), "JavaScript is traced");
+        });
+    }
 }
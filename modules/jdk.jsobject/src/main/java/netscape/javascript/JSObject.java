@@ -131,4 +131,48 @@ public abstract class JSObject {
      */
     public abstract void setSlot(int index, Object value) throws JSException;
 
+    /**
+     * Retrieves consecutive indexed members of a JavaScript object.
+     * Equivalent to calling {@link #getSlot(int)} for each index from
+     * {@code index} to {@code index + count - 1}, but an implementation
+     * may retrieve all of them in a single operation.
+     *
+     * @param index The index of the first member to be accessed.
+     * @param count The number of members to be accessed.
+     * @return The values of the indexed members.
+     * @throws JSException when an error is reported from the browser or
+     * JavaScript engine.
+     * @throws IllegalArgumentException if {@code count} is negative
+     * @since 25
+     */
+    public Object[] getSlots(int index, int count) throws JSException {
+        if (count < 0) {
+            throw new IllegalArgumentException("count must not be negative");
+        }
+        Object[] values = new Object[count];
+        for (int i = 0; i < count; i++) {
+            values[i] = getSlot(index + i);
+        }
+        return values;
+    }
+
+    /**
+     * Sets consecutive indexed members of a JavaScript object.
+     * Equivalent to calling {@link #setSlot(int, Object)} for each
+     * element of {@code values} at {@code index} plus its position, but
+     * an implementation may set all of them in a single operation.
+     *
+     * @param index The index of the first member to be set.
+     * @param values The values to set.
+     * @throws JSException when an error is reported from the browser or
+     * JavaScript engine.
+     * @throws NullPointerException if {@code values} is null
+     * @since 25
+     */
+    public void setSlots(int index, Object... values) throws JSException {
+        for (int i = 0; i < values.length; i++) {
+            setSlot(index + i, values[i]);
+        }
+    }
+
 }
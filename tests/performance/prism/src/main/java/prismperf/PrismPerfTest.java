@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package prismperf;
+
+import java.util.Arrays;
+import java.util.List;
+import java.util.Locale;
+import java.util.concurrent.Callable;
+import java.util.concurrent.FutureTask;
+import java.util.concurrent.TimeUnit;
+import java.util.function.LongConsumer;
+
+import javafx.animation.AnimationTimer;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Group;
+import javafx.scene.Node;
+import javafx.scene.Parent;
+import javafx.scene.PerspectiveCamera;
+import javafx.scene.Scene;
+import javafx.scene.SceneAntialiasing;
+import javafx.scene.effect.GaussianBlur;
+import javafx.scene.image.ImageView;
+import javafx.scene.image.PixelFormat;
+import javafx.scene.image.WritableImage;
+import javafx.scene.paint.Color;
+import javafx.scene.paint.PhongMaterial;
+import javafx.scene.shape.Box;
+import javafx.scene.shape.Rectangle;
+import javafx.scene.text.Font;
+import javafx.scene.text.Text;
+import javafx.scene.transform.Rotate;
+import javafx.stage.Stage;
+
+import com.sun.javafx.perf.PerformanceTracker;
+import com.sun.prism.GraphicsPipeline;
+
+/**
+ * {@link PrismPerfTest} isolates the Prism render primitives, so that changes
+ * to a pipeline can be compared between builds, releases and GPUs.
+ * Each test keeps the scene graph work per frame small and lets a single
+ * primitive dominate the frame:
+ * <ul>
+ *  <li>Quads: textured quads per second, drawn in batches through drawIndexedQuads</li>
+ *  <li>TextureUpload: MB per second uploaded from a WritableImage</li>
+ *  <li>Readback: latency of rendering and reading back a snapshot</li>
+ *  <li>Glyphs: glyphs per second at a font size that changes every frame,
+ *      so that the glyph cache is missed</li>
+ *  <li>Blur: Mpixels per second through a Decora GaussianBlur</li>
+ *  <li>Meshes: mesh draw calls per second</li>
+ * </ul>
+ * The pipeline is chosen with -Dprism.order (es2, d3d or sw). Each test
+ * prints one JSON object per line, so that results can be collected by
+ * scripts, for example:
+ * <pre>
+ * {"test":"Quads","pipeline":"ES2Pipeline","count":20000,"fps":61.3,"unit":"quads/s","value":1226000}
+ * </pre>
+ * Frame rates are taken from the PerformanceTracker of the scene and count
+ * the frames actually rendered, not the pulses.
+ *
+ * <p>
+ * Steps to run the application:
+ * <ol>
+ *  <li>cd prism/src/main/java</li>
+ *  <li>Command to compile the program: javac --add-exports javafx.graphics/com.sun.javafx.perf=ALL-UNNAMED
+ *      --add-exports javafx.graphics/com.sun.prism=ALL-UNNAMED
+ *      {@literal @}{@literal <}path_to{@literal >}/compile.args prismperf/{@link PrismPerfTest}.java</li>
+ *  <li>Command to execute the program: java --add-exports javafx.graphics/com.sun.javafx.perf=ALL-UNNAMED
+ *      --add-exports javafx.graphics/com.sun.prism=ALL-UNNAMED -Dprism.order={@literal <}pipeline{@literal >}
+ *      {@literal @}{@literal <}path_to{@literal >}/run.args prismperf/{@link PrismPerfTest}
+ *      -t {@literal <}test_name{@literal >} -n {@literal <}count{@literal >} -d {@literal <}seconds{@literal >}</li>
+ *  Where:
+ *  <ul>
+ *      <li>pipeline: es2, d3d or sw.</li>
+ *      <li>test_name: Name of the test to be executed. If not specified, all tests are executed.</li>
+ *      <li>count: Number of quads, texture edge in pixels, snapshots, text nodes, blurred
+ *          edge in pixels or meshes of the test. If not specified, each test uses its own default.</li>
+ *      <li>seconds: Duration of each test that measures a frame rate, 10 by default.</li>
+ *  </ul>
+ * NOTE: Set JVM command line parameter -Djavafx.animation.fullspeed=true to run animations at full speed
+ * </ol>
+ */
+public class PrismPerfTest extends Application {
+    private static final double WIDTH = 800;
+    private static final double HEIGHT = 800;
+    private static final long TIMEOUT_SECONDS = 120;
+    private static final long WARMUP_SECONDS = 2;
+
+    private static final List<String> ALL_TESTS =
+            List.of("Quads", "TextureUpload", "Readback", "Glyphs", "Blur", "Meshes");
+
+    private static List<String> testList = ALL_TESTS;
+    private static int count = 0;
+    private static long duration = 10;
+
+    private static Scene scene;
+    private static String pipeline;
+
+    private static <T> T onFxThread(Callable<T> callable) throws Exception {
+        FutureTask<T> task = new FutureTask<>(callable);
+        Platform.runLater(task);
+        return task.get(TIMEOUT_SECONDS, TimeUnit.SECONDS);
+    }
+
+    private static void sleep(long seconds) throws InterruptedException {
+        Thread.sleep(TimeUnit.SECONDS.toMillis(seconds));
+    }
+
+    private static void report(String test, int count, double fps, String unit, double value,
+                               String extra) {
+        System.out.printf(Locale.ROOT,
+                "{\"test\":\"%s\",\"pipeline\":\"%s\",\"count\":%d,\"fps\":%.1f,\"unit\":\"%s\",\"value\":%.0f%s}%n",
+                test, pipeline, count, fps, unit, value, extra);
+    }
+
+    /**
+     * Shows the root, calls update on every pulse and returns the average
+     * number of frames rendered per second after a warm up.
+     */
+    private static double measureFps(Parent root, boolean perspective, LongConsumer update)
+            throws Exception {
+        AnimationTimer timer = onFxThread(() -> {
+            scene.setRoot(root);
+            scene.setCamera(perspective ? new PerspectiveCamera() : null);
+            AnimationTimer t = new AnimationTimer() {
+                private long frame;
+
+                @Override
+                public void handle(long now) {
+                    update.accept(frame++);
+                }
+            };
+            t.start();
+            return t;
+        });
+        sleep(WARMUP_SECONDS);
+        PerformanceTracker tracker = onFxThread(() -> {
+            PerformanceTracker t = PerformanceTracker.getSceneTracker(scene);
+            t.resetAverageFPS();
+            return t;
+        });
+        sleep(duration);
+        return onFxThread(() -> {
+            double fps = tracker.getAverageFPS();
+            timer.stop();
+            PerformanceTracker.releaseSceneTracker(scene);
+            return fps;
+        });
+    }
+
+    private static WritableImage sprite(int size) {
+        WritableImage image = new WritableImage(size, size);
+        for (int y = 0; y < size; y++) {
+            for (int x = 0; x < size; x++) {
+                image.getPixelWriter().setColor(x, y, Color.hsb(x * 360.0 / size, 1, (double) y / size));
+            }
+        }
+        return image;
+    }
+
+    private static void runQuads() throws Exception {
+        int quads = count > 0 ? count : 20000;
+        WritableImage image = sprite(16);
+        ImageView[] views = new ImageView[quads];
+        Group root = new Group();
+        for (int i = 0; i < quads; i++) {
+            views[i] = new ImageView(image);
+            root.getChildren().add(views[i]);
+        }
+        double fps = measureFps(root, false, frame -> {
+            for (int i = 0; i < quads; i++) {
+                views[i].relocate((i * 37 + frame) % (WIDTH - 16), (i * 53 + frame / 2) % (HEIGHT - 16));
+            }
+        });
+        report("Quads", quads, fps, "quads/s", fps * quads, "");
+    }
+
+    private static void runTextureUpload() throws Exception {
+        int size = count > 0 ? count : 1024;
+        WritableImage image = new WritableImage(size, size);
+        int[][] buffers = new int[2][size * size];
+        Arrays.fill(buffers[0], 0xFF2060C0);
+        Arrays.fill(buffers[1], 0xFFC06020);
+        ImageView view = new ImageView(image);
+        view.setFitWidth(WIDTH);
+        view.setFitHeight(HEIGHT);
+        double fps = measureFps(new Group(view), false, frame -> {
+            image.getPixelWriter().setPixels(0, 0, size, size,
+                    PixelFormat.getIntArgbPreInstance(), buffers[(int) (frame & 1)], 0, size);
+        });
+        double bytesPerFrame = 4.0 * size * size;
+        report("TextureUpload", size, fps, "MB/s", fps * bytesPerFrame / 1e6, "");
+    }
+
+    private static void runReadback() throws Exception {
+        int snapshots = count > 0 ? count : 200;
+        Group root = new Group();
+        for (int i = 0; i < 200; i++) {
+            Rectangle r = new Rectangle((i * 37) % WIDTH, (i * 53) % HEIGHT, 64, 64);
+            r.setFill(Color.hsb(i * 7 % 360, 0.8, 0.9));
+            root.getChildren().add(r);
+        }
+        onFxThread(() -> {
+            scene.setRoot(root);
+            scene.setCamera(null);
+            for (int i = 0; i < 10; i++) {
+                scene.snapshot(null);
+            }
+            return null;
+        });
+        long[] times = new long[snapshots];
+        for (int i = 0; i < snapshots; i++) {
+            times[i] = onFxThread(() -> {
+                long start = System.nanoTime();
+                scene.snapshot(null);
+                return System.nanoTime() - start;
+            });
+        }
+        Arrays.sort(times);
+        double p50 = times[snapshots / 2] / 1e6;
+        double bytes = 4.0 * WIDTH * HEIGHT;
+        report("Readback", snapshots, 1000 / p50, "MB/s", bytes / (p50 / 1000) / 1e6,
+                String.format(Locale.ROOT, ",\"p50Ms\":%.2f,\"p90Ms\":%.2f,\"maxMs\":%.2f",
+                        p50, times[(int) (snapshots * 0.9)] / 1e6, times[snapshots - 1] / 1e6));
+    }
+
+    private static void runGlyphs() throws Exception {
+        int nodes = count > 0 ? count : 40;
+        String line = "The quick brown fox jumps over the lazy dog 0123456789";
+        Text[] texts = new Text[nodes];
+        Group root = new Group();
+        for (int i = 0; i < nodes; i++) {
+            texts[i] = new Text(4, 16 + i * HEIGHT / nodes, line);
+            root.getChildren().add(texts[i]);
+        }
+        int glyphs = nodes * line.replace(" ", "").length();
+        double fps = measureFps(root, false, frame -> {
+            // Sizes repeat only after 1000 frames, so nearly every frame
+            // rasterizes its glyphs again.
+            Font font = Font.font(8 + (frame % 1000) / 100.0);
+            for (Text t : texts) {
+                t.setFont(font);
+            }
+        });
+        report("Glyphs", nodes, fps, "glyphs/s", fps * glyphs, "");
+    }
+
+    private static void runBlur() throws Exception {
+        int size = count > 0 ? count : 600;
+        Group content = new Group();
+        for (int i = 0; i < 16; i++) {
+            Rectangle r = new Rectangle((i % 4) * size / 4.0, (i / 4) * size / 4.0, size / 4.0, size / 4.0);
+            r.setFill(Color.hsb(i * 22.5, 0.8, 0.9));
+            content.getChildren().add(r);
+        }
+        content.setEffect(new GaussianBlur(32));
+        Rotate rotate = new Rotate(0, size / 2.0, size / 2.0);
+        content.getTransforms().add(rotate);
+        double fps = measureFps(new Group(content), false, frame -> rotate.setAngle(frame % 360));
+        report("Blur", size, fps, "Mpixels/s", fps * size * size / 1e6, "");
+    }
+
+    private static void runMeshes() throws Exception {
+        int meshes = count > 0 ? count : 1000;
+        int columns = (int) Math.ceil(Math.sqrt(meshes));
+        double cell = WIDTH / columns;
+        Node[] boxes = new Node[meshes];
+        Group root = new Group();
+        PhongMaterial material = new PhongMaterial(Color.ORANGE);
+        for (int i = 0; i < meshes; i++) {
+            Box box = new Box(cell * 0.6, cell * 0.6, cell * 0.6);
+            box.setMaterial(material);
+            box.setTranslateX((i % columns + 0.5) * cell);
+            box.setTranslateY((i / columns + 0.5) * cell);
+            box.setRotationAxis(Rotate.Y_AXIS);
+            boxes[i] = box;
+            root.getChildren().add(box);
+        }
+        double fps = measureFps(root, true, frame -> {
+            for (int i = 0; i < meshes; i++) {
+                boxes[i].setRotate((frame + i) % 360);
+            }
+        });
+        report("Meshes", meshes, fps, "draws/s", fps * meshes, "");
+    }
+
+    private static void runTest(String test) throws Exception {
+        switch (test) {
+            case "Quads" -> runQuads();
+            case "TextureUpload" -> runTextureUpload();
+            case "Readback" -> runReadback();
+            case "Glyphs" -> runGlyphs();
+            case "Blur" -> runBlur();
+            case "Meshes" -> runMeshes();
+            default -> System.out.println("Unknown test: " + test);
+        }
+    }
+
+    private static void usage() {
+        System.out.println("Usage: java -Dprism.order=<pipeline> prismperf.PrismPerfTest"
+                + " [-t test] [-n count] [-d seconds] [-h]");
+        System.out.println("Tests: " + String.join(", ", ALL_TESTS));
+    }
+
+    @Override
+    public void start(Stage stage) {
+        scene = new Scene(new Group(), WIDTH, HEIGHT, true, SceneAntialiasing.DISABLED);
+        stage.setScene(scene);
+        stage.setTitle("PrismPerfTest");
+        stage.show();
+
+        Thread runner = new Thread(() -> {
+            try {
+                pipeline = GraphicsPipeline.getPipeline().getClass().getSimpleName();
+                for (String test : testList) {
+                    runTest(test);
+                }
+            } catch (Exception e) {
+                e.printStackTrace();
+            } finally {
+                Platform.exit();
+            }
+        }, "PrismPerfTest");
+        runner.setDaemon(true);
+        runner.start();
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < args.length; i++) {
+            switch (args[i]) {
+                case "-t" -> testList = Arrays.asList(args[++i].split(","));
+                case "-n" -> count = Integer.parseInt(args[++i]);
+                case "-d" -> duration = Long.parseLong(args[++i]);
+                case "-h" -> {
+                    usage();
+                    return;
+                }
+                default -> {
+                    usage();
+                    return;
+                }
+            }
+        }
+        Application.launch(PrismPerfTest.class, args);
+    }
+}
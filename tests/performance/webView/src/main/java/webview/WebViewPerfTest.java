@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webview;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.FutureTask;
+import java.util.concurrent.TimeUnit;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import javafx.animation.AnimationTimer;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.beans.value.ChangeListener;
+import javafx.beans.value.ObservableValue;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+import netscape.javascript.JSObject;
+
+import com.sun.webkit.WebPage;
+
+/**
+ * {@link WebViewPerfTest} measures typical WebView workloads, so that the
+ * effect of changes to the web module can be compared between builds.
+ * The following tests are available:
+ * <ul>
+ *  <li>Load: time to load and lay out a large local DOM, cold and warm</li>
+ *  <li>Scroll: frame time distribution while the page scrolls</li>
+ *  <li>Canvas: canvas drawImage calls per second of a sprite animation</li>
+ *  <li>Bridge: JavaScript to Java calls per second</li>
+ *  <li>Navigation: Java heap in use after a number of navigations</li>
+ * </ul>
+ * Each test also reports the RenderingQueue bytes and JNI upcalls per
+ * painted frame, taken from the trace recorded by
+ * {@link WebPage#setTracingEnabled}. The trace keeps only the most recent
+ * events, so these numbers cover the end of long tests.
+ *
+ * <p>
+ * Steps to run the application:
+ * <ol>
+ *  <li>cd webView/src/main/java</li>
+ *  <li>Command to compile the program: javac --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED
+ *      {@literal @}{@literal <}path_to{@literal >}/compile.args webview/{@link WebViewPerfTest}.java</li>
+ *  <li>Command to execute the program: java --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED
+ *      {@literal @}{@literal <}path_to{@literal >}/run.args webview/{@link WebViewPerfTest}
+ *      -t {@literal <}test_name{@literal >} -n {@literal <}count{@literal >} -d {@literal <}seconds{@literal >}</li>
+ *  Where:
+ *  <ul>
+ *      <li>test_name: Name of the test to be executed. If not specified, all tests are executed.</li>
+ *      <li>count: Number of DOM rows, sprites, calls or navigations of the test.
+ *          If not specified, each test uses its own default.</li>
+ *      <li>seconds: Duration of the Scroll and Canvas tests, 10 by default.</li>
+ *  </ul>
+ * NOTE: Set JVM command line parameter -Djavafx.animation.fullspeed=true to run animations at full speed
+ * </ol>
+ */
+public class WebViewPerfTest extends Application {
+    private static final double WIDTH = 800;
+    private static final double HEIGHT = 800;
+    private static final long SECOND_IN_NANOS = 1_000_000_000L;
+    private static final long TIMEOUT_SECONDS = 120;
+
+    private static final List<String> ALL_TESTS =
+            List.of("Load", "Scroll", "Canvas", "Bridge", "Navigation");
+
+    private static List<String> testList = ALL_TESTS;
+    private static int count = 0;
+    private static long duration = 10;
+
+    private static WebView webView;
+    private static WebEngine engine;
+
+    /**
+     * Object exposed to JavaScript by the Bridge test.
+     */
+    public static final class Bridge {
+        private long sum;
+
+        public void call(int value) {
+            sum += value;
+        }
+    }
+
+    private static String largeDocument(int rows) {
+        StringBuilder html = new StringBuilder(rows * 96);
+        html.append("<html><head><style>")
+            .append("td { padding: 2px; border: 1px solid #ccc; } ")
+            .append("tr:nth-child(odd) td { background: #eef; } ")
+            .append(".num { text-align: right; }")
+            .append("</style></head><body><table>");
+        for (int i = 0; i < rows; i++) {
+            html.append("<tr><td>Row ").append(i)
+                .append("</td><td class='num'>").append(i * 31 % 997)
+                .append("</td><td><a href='#r").append(i).append("'>link</a></td></tr>");
+        }
+        html.append("</table></body></html>");
+        return html.toString();
+    }
+
+    private static String spriteDocument(int sprites) {
+        return "<html><body style='margin:0'>"
+            + "<canvas id='c' width='" + (int) WIDTH + "' height='" + (int) HEIGHT + "'></canvas>"
+            + "<script>"
+            + "var sprite = document.createElement('canvas');"
+            + "sprite.width = sprite.height = 16;"
+            + "var s = sprite.getContext('2d');"
+            + "s.fillStyle = 'orange'; s.beginPath(); s.arc(8, 8, 7, 0, 2 * Math.PI); s.fill();"
+            + "var ctx = document.getElementById('c').getContext('2d');"
+            + "var frames = 0; var running = true;"
+            + "function frame(t) {"
+            + "  ctx.clearRect(0, 0, " + WIDTH + ", " + HEIGHT + ");"
+            + "  for (var i = 0; i < " + sprites + "; i++) {"
+            + "    ctx.drawImage(sprite, (i * 37 + t / 4) % " + WIDTH + ", (i * 53) % " + HEIGHT + ");"
+            + "  }"
+            + "  frames++;"
+            + "  if (running) requestAnimationFrame(frame);"
+            + "}"
+            + "requestAnimationFrame(frame);"
+            + "</script></body></html>";
+    }
+
+    private static <T> T onFxThread(Callable<T> callable) throws Exception {
+        FutureTask<T> task = new FutureTask<>(callable);
+        Platform.runLater(task);
+        return task.get(TIMEOUT_SECONDS, TimeUnit.SECONDS);
+    }
+
+    private static long loadAndWait(String html) throws Exception {
+        CountDownLatch loaded = new CountDownLatch(1);
+        long start = onFxThread(() -> {
+            engine.getLoadWorker().stateProperty().addListener(new ChangeListener<Worker.State>() {
+                @Override
+                public void changed(ObservableValue<? extends Worker.State> ov,
+                                    Worker.State o, Worker.State n) {
+                    if (n == Worker.State.SUCCEEDED || n == Worker.State.FAILED) {
+                        ov.removeListener(this);
+                        loaded.countDown();
+                    }
+                }
+            });
+            long t = System.nanoTime();
+            engine.loadContent(html);
+            return t;
+        });
+        if (!loaded.await(TIMEOUT_SECONDS, TimeUnit.SECONDS)) {
+            throw new IllegalStateException("Page did not load");
+        }
+        // Force the layout that a load does not wait for.
+        return onFxThread(() -> {
+            engine.executeScript("document.body.offsetHeight");
+            return System.nanoTime() - start;
+        });
+    }
+
+    private static void sleep(long seconds) throws InterruptedException {
+        Thread.sleep(TimeUnit.SECONDS.toMillis(seconds));
+    }
+
+    private static void startTrace() throws Exception {
+        onFxThread(() -> {
+            WebPage.setTracingEnabled(true);
+            return null;
+        });
+    }
+
+    private static final Pattern FLUSH_BYTES =
+            Pattern.compile("\"name\":\"RenderingQueueFlush\"[^}]*\"bytes\":(\\d+)");
+    private static final Pattern UPCALLS =
+            Pattern.compile("\"name\":\"JNIUpcalls\"[^}]*\"count\":(\\d+)");
+    private static final Pattern PAINT =
+            Pattern.compile("\"name\":\"Paint\",\"ph\":\"B\"");
+
+    private static long sum(Pattern pattern, String trace) {
+        long sum = 0;
+        Matcher m = pattern.matcher(trace);
+        while (m.find()) {
+            sum += Long.parseLong(m.group(1));
+        }
+        return sum;
+    }
+
+    private static void stopTraceAndReport(String test) throws Exception {
+        String trace = onFxThread(() -> {
+            WebPage.setTracingEnabled(false);
+            return WebPage.getTraceEvents();
+        });
+        long frames = PAINT.matcher(trace).results().count();
+        long bytes = sum(FLUSH_BYTES, trace);
+        long upcalls = sum(UPCALLS, trace);
+        if (frames == 0) {
+            System.out.printf("%s: no frames painted, %d queue bytes, %d JNI upcalls%n",
+                    test, bytes, upcalls);
+        } else {
+            System.out.printf("%s: %d frames, %d queue bytes/frame, %d JNI upcalls/frame%n",
+                    test, frames, bytes / frames, upcalls / frames);
+        }
+    }
+
+    private static void runLoad() throws Exception {
+        int rows = count > 0 ? count : 20000;
+        String html = largeDocument(rows);
+        startTrace();
+        long cold = loadAndWait(html);
+        long best = Long.MAX_VALUE;
+        for (int i = 0; i < 5; i++) {
+            best = Math.min(best, loadAndWait(html));
+        }
+        System.out.printf("Load: %d rows, cold %.1f ms, warm %.1f ms%n",
+                rows, cold / 1e6, best / 1e6);
+        stopTraceAndReport("Load");
+    }
+
+    private static void runScroll() throws Exception {
+        int rows = count > 0 ? count : 20000;
+        loadAndWait(largeDocument(rows));
+        List<Long> frameTimes = new ArrayList<>();
+        CountDownLatch done = new CountDownLatch(1);
+        startTrace();
+        onFxThread(() -> {
+            new AnimationTimer() {
+                private long start;
+                private long last;
+
+                @Override
+                public void handle(long now) {
+                    if (start == 0) {
+                        start = last = now;
+                    } else {
+                        frameTimes.add(now - last);
+                        last = now;
+                    }
+                    engine.executeScript("window.scrollBy(0, 20);"
+                            + "if (window.scrollY + window.innerHeight >= document.body.scrollHeight)"
+                            + " window.scrollTo(0, 0);");
+                    if (now - start > duration * SECOND_IN_NANOS) {
+                        stop();
+                        done.countDown();
+                    }
+                }
+            }.start();
+            return null;
+        });
+        done.await(duration + TIMEOUT_SECONDS, TimeUnit.SECONDS);
+        long[] times = frameTimes.stream().mapToLong(Long::longValue).sorted().toArray();
+        if (times.length == 0) {
+            System.out.println("Scroll: no frames");
+        } else {
+            System.out.printf("Scroll: %d frames, p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms%n",
+                    times.length,
+                    times[times.length / 2] / 1e6,
+                    times[(int) (times.length * 0.9)] / 1e6,
+                    times[(int) (times.length * 0.99)] / 1e6,
+                    times[times.length - 1] / 1e6);
+        }
+        stopTraceAndReport("Scroll");
+    }
+
+    private static void runCanvas() throws Exception {
+        int sprites = count > 0 ? count : 2000;
+        loadAndWait(spriteDocument(sprites));
+        startTrace();
+        int startFrames = onFxThread(() -> (Integer) engine.executeScript("frames"));
+        long start = System.nanoTime();
+        sleep(duration);
+        int frames = onFxThread(() -> (Integer) engine.executeScript("running = false; frames"))
+                - startFrames;
+        double seconds = (System.nanoTime() - start) / 1e9;
+        System.out.printf("Canvas: %d sprites, %.1f frames/s, %.0f drawImage/s%n",
+                sprites, frames / seconds, frames * (double) sprites / seconds);
+        stopTraceAndReport("Canvas");
+    }
+
+    private static void runBridge() throws Exception {
+        int calls = count > 0 ? count : 1_000_000;
+        loadAndWait("<html><body></body></html>");
+        startTrace();
+        long elapsed = onFxThread(() -> {
+            JSObject window = (JSObject) engine.executeScript("window");
+            window.setMember("bridge", new Bridge());
+            long start = System.nanoTime();
+            engine.executeScript("for (var i = 0; i < " + calls + "; i++) bridge.call(i);");
+            return System.nanoTime() - start;
+        });
+        System.out.printf("Bridge: %d calls, %.0f calls/s%n", calls, calls / (elapsed / 1e9));
+        stopTraceAndReport("Bridge");
+    }
+
+    private static long usedHeap() throws InterruptedException {
+        Runtime runtime = Runtime.getRuntime();
+        for (int i = 0; i < 3; i++) {
+            System.gc();
+            Thread.sleep(100);
+        }
+        return runtime.totalMemory() - runtime.freeMemory();
+    }
+
+    private static void runNavigation() throws Exception {
+        int navigations = count > 0 ? count : 50;
+        String html = largeDocument(2000);
+        loadAndWait(html);
+        long before = usedHeap();
+        startTrace();
+        for (int i = 0; i < navigations; i++) {
+            loadAndWait(html);
+        }
+        loadAndWait("<html><body></body></html>");
+        long after = usedHeap();
+        System.out.printf("Navigation: %d navigations, Java heap %.1f MB before, %.1f MB after%n",
+                navigations, before / 1e6, after / 1e6);
+        stopTraceAndReport("Navigation");
+    }
+
+    private static void runTest(String test) throws Exception {
+        switch (test) {
+            case "Load" -> runLoad();
+            case "Scroll" -> runScroll();
+            case "Canvas" -> runCanvas();
+            case "Bridge" -> runBridge();
+            case "Navigation" -> runNavigation();
+            default -> System.out.println("Unknown test: " + test);
+        }
+    }
+
+    private static void usage() {
+        System.out.println("Usage: java webview.WebViewPerfTest [-t test] [-n count] [-d seconds] [-h]");
+        System.out.println("Tests: " + String.join(", ", ALL_TESTS));
+    }
+
+    @Override
+    public void start(Stage stage) {
+        webView = new WebView();
+        engine = webView.getEngine();
+        stage.setScene(new Scene(webView, WIDTH, HEIGHT));
+        stage.setTitle("WebViewPerfTest");
+        stage.show();
+
+        Thread runner = new Thread(() -> {
+            try {
+                for (String test : testList) {
+                    runTest(test);
+                }
+            } catch (Exception e) {
+                e.printStackTrace();
+            } finally {
+                Platform.exit();
+            }
+        }, "WebViewPerfTest");
+        runner.setDaemon(true);
+        runner.start();
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < args.length; i++) {
+            switch (args[i]) {
+                case "-t" -> testList = Arrays.asList(args[++i].split(","));
+                case "-n" -> count = Integer.parseInt(args[++i]);
+                case "-d" -> duration = Long.parseLong(args[++i]);
+                case "-h" -> {
+                    usage();
+                    return;
+                }
+                default -> {
+                    usage();
+                    return;
+                }
+            }
+        }
+        Application.launch(WebViewPerfTest.class, args);
+    }
+}